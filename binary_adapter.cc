@@ -0,0 +1,556 @@
+/*
+    This file is part of Kismet
+
+    Kismet is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Kismet is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Kismet; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#include "config.h"
+
+#include <string.h>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "binary_adapter.h"
+#include "entrytracker.h"
+#include "macaddr.h"
+#include "uuid.h"
+
+namespace {
+
+// Output buffer; accumulates a large block before writing it to the stream
+class binary_buffer {
+public:
+    binary_buffer(std::ostream& stream) :
+        stream{stream} {
+        buf.reserve(flush_sz + 4096);
+    }
+
+    ~binary_buffer() {
+        flush();
+    }
+
+    void flush() {
+        if (buf.size() > 0) {
+            stream.write(buf.data(), buf.size());
+            buf.clear();
+        }
+    }
+
+    void put(uint8_t b) {
+        buf.push_back(static_cast<char>(b));
+    }
+
+    // Big-endian integer of n bytes
+    void put_be(uint64_t v, unsigned int n) {
+        for (unsigned int i = n; i > 0; i--)
+            buf.push_back(static_cast<char>((v >> ((i - 1) * 8)) & 0xFF));
+    }
+
+    void put(const char *data, size_t len) {
+        buf.append(data, len);
+
+        if (buf.size() >= flush_sz)
+            flush();
+    }
+
+    void put(const std::string& s) {
+        put(s.data(), s.length());
+    }
+
+protected:
+    static constexpr size_t flush_sz = 64 * 1024;
+
+    std::ostream& stream;
+    std::string buf;
+};
+
+uint64_t double_bits(double v) {
+    uint64_t r;
+    memcpy(&r, &v, sizeof(r));
+    return r;
+}
+
+// MessagePack encoding
+struct msgpack_encoder {
+    static void nil(binary_buffer& out) {
+        out.put(0xc0);
+    }
+
+    static void uint(binary_buffer& out, uint64_t v) {
+        if (v < 0x80) {
+            out.put(static_cast<uint8_t>(v));
+        } else if (v <= 0xFF) {
+            out.put(0xcc);
+            out.put_be(v, 1);
+        } else if (v <= 0xFFFF) {
+            out.put(0xcd);
+            out.put_be(v, 2);
+        } else if (v <= 0xFFFFFFFF) {
+            out.put(0xce);
+            out.put_be(v, 4);
+        } else {
+            out.put(0xcf);
+            out.put_be(v, 8);
+        }
+    }
+
+    static void sint(binary_buffer& out, int64_t v) {
+        if (v >= 0) {
+            uint(out, static_cast<uint64_t>(v));
+        } else if (v >= -32) {
+            out.put(static_cast<uint8_t>(0xe0 | (v + 32)));
+        } else if (v >= INT8_MIN) {
+            out.put(0xd0);
+            out.put_be(static_cast<uint64_t>(v), 1);
+        } else if (v >= INT16_MIN) {
+            out.put(0xd1);
+            out.put_be(static_cast<uint64_t>(v), 2);
+        } else if (v >= INT32_MIN) {
+            out.put(0xd2);
+            out.put_be(static_cast<uint64_t>(v), 4);
+        } else {
+            out.put(0xd3);
+            out.put_be(static_cast<uint64_t>(v), 8);
+        }
+    }
+
+    static void dbl(binary_buffer& out, double v) {
+        out.put(0xcb);
+        out.put_be(double_bits(v), 8);
+    }
+
+    static void str(binary_buffer& out, const std::string& s) {
+        auto l = s.length();
+
+        if (l < 32) {
+            out.put(static_cast<uint8_t>(0xa0 | l));
+        } else if (l <= 0xFF) {
+            out.put(0xd9);
+            out.put_be(l, 1);
+        } else if (l <= 0xFFFF) {
+            out.put(0xda);
+            out.put_be(l, 2);
+        } else {
+            out.put(0xdb);
+            out.put_be(l, 4);
+        }
+
+        out.put(s);
+    }
+
+    static void bin(binary_buffer& out, const std::string& s) {
+        auto l = s.length();
+
+        if (l <= 0xFF) {
+            out.put(0xc4);
+            out.put_be(l, 1);
+        } else if (l <= 0xFFFF) {
+            out.put(0xc5);
+            out.put_be(l, 2);
+        } else {
+            out.put(0xc6);
+            out.put_be(l, 4);
+        }
+
+        out.put(s);
+    }
+
+    static void array(binary_buffer& out, size_t n) {
+        if (n < 16) {
+            out.put(static_cast<uint8_t>(0x90 | n));
+        } else if (n <= 0xFFFF) {
+            out.put(0xdc);
+            out.put_be(n, 2);
+        } else {
+            out.put(0xdd);
+            out.put_be(n, 4);
+        }
+    }
+
+    static void map(binary_buffer& out, size_t n) {
+        if (n < 16) {
+            out.put(static_cast<uint8_t>(0x80 | n));
+        } else if (n <= 0xFFFF) {
+            out.put(0xde);
+            out.put_be(n, 2);
+        } else {
+            out.put(0xdf);
+            out.put_be(n, 4);
+        }
+    }
+};
+
+// CBOR (RFC 8949) encoding
+struct cbor_encoder {
+    static void head(binary_buffer& out, uint8_t major, uint64_t v) {
+        major <<= 5;
+
+        if (v < 24) {
+            out.put(static_cast<uint8_t>(major | v));
+        } else if (v <= 0xFF) {
+            out.put(major | 24);
+            out.put_be(v, 1);
+        } else if (v <= 0xFFFF) {
+            out.put(major | 25);
+            out.put_be(v, 2);
+        } else if (v <= 0xFFFFFFFF) {
+            out.put(major | 26);
+            out.put_be(v, 4);
+        } else {
+            out.put(major | 27);
+            out.put_be(v, 8);
+        }
+    }
+
+    static void nil(binary_buffer& out) {
+        out.put(0xf6);
+    }
+
+    static void uint(binary_buffer& out, uint64_t v) {
+        head(out, 0, v);
+    }
+
+    static void sint(binary_buffer& out, int64_t v) {
+        if (v >= 0)
+            head(out, 0, static_cast<uint64_t>(v));
+        else
+            head(out, 1, static_cast<uint64_t>(-1 - v));
+    }
+
+    static void dbl(binary_buffer& out, double v) {
+        out.put(0xfb);
+        out.put_be(double_bits(v), 8);
+    }
+
+    static void str(binary_buffer& out, const std::string& s) {
+        head(out, 3, s.length());
+        out.put(s);
+    }
+
+    static void bin(binary_buffer& out, const std::string& s) {
+        head(out, 2, s.length());
+        out.put(s);
+    }
+
+    static void array(binary_buffer& out, size_t n) {
+        head(out, 4, n);
+    }
+
+    static void map(binary_buffer& out, size_t n) {
+        head(out, 5, n);
+    }
+};
+
+// Encoded name of a field id, cached per thread; field names never change once registered
+template<class E>
+const std::string& cached_field_name(int id) {
+    thread_local std::vector<std::string> cache;
+    thread_local std::string uncached;
+
+    auto make_name = [id]() {
+        std::stringstream ss;
+
+        {
+            binary_buffer b(ss);
+            E::str(b, Globalreg::globalreg->entrytracker->get_field_name(id));
+        }
+
+        return ss.str();
+    };
+
+    // Unregistered elements have no id to cache under
+    if (id < 0) {
+        uncached = make_name();
+        return uncached;
+    }
+
+    if (static_cast<size_t>(id) >= cache.size())
+        cache.resize(id + 1);
+
+    auto& r = cache[id];
+
+    if (r.length() == 0)
+        r = make_name();
+
+    return r;
+}
+
+template<class E>
+void pack_element(binary_buffer& out, shared_tracker_element e,
+        const std::shared_ptr<tracker_element_serializer::rename_map>& name_map);
+
+// Maps keyed by something other than a field; nulls are skipped unless only the keys
+// are being sent, as in the json serializer
+template<class E, class M, class KF>
+void pack_keyed_map(binary_buffer& out, M *m, const KF& key_fn,
+        const std::shared_ptr<tracker_element_serializer::rename_map>& name_map) {
+    auto as_vector = m->as_vector();
+    auto as_key_vector = m->as_key_vector();
+
+    size_t n = 0;
+
+    for (const auto& i : *m) {
+        if (i.second != nullptr || as_key_vector)
+            n++;
+    }
+
+    if (as_vector || as_key_vector)
+        E::array(out, n);
+    else
+        E::map(out, n);
+
+    for (const auto& i : *m) {
+        if (i.second == nullptr && !as_key_vector)
+            continue;
+
+        if (!as_vector)
+            key_fn(i.first);
+
+        if (!as_key_vector)
+            pack_element<E>(out, i.second, name_map);
+    }
+}
+
+template<class E>
+void pack_element(binary_buffer& out, shared_tracker_element e,
+        const std::shared_ptr<tracker_element_serializer::rename_map>& name_map) {
+
+    if (e == nullptr) {
+        E::nil(out);
+        return;
+    }
+
+    serializer_scope s(e, name_map);
+
+    if (e->get_type() == tracker_type::tracker_alias) {
+        e = std::static_pointer_cast<tracker_element_alias>(e)->get();
+
+        if (e == nullptr) {
+            E::nil(out);
+            return;
+        }
+    }
+
+    switch (e->get_type()) {
+        case tracker_type::tracker_string:
+            E::str(out, std::static_pointer_cast<tracker_element_string>(e)->get());
+            break;
+        case tracker_type::tracker_byte_array:
+            E::bin(out, std::static_pointer_cast<tracker_element_byte_array>(e)->get());
+            break;
+        case tracker_type::tracker_int8:
+            E::sint(out, std::static_pointer_cast<tracker_element_int8>(e)->get());
+            break;
+        case tracker_type::tracker_uint8:
+            E::uint(out, std::static_pointer_cast<tracker_element_uint8>(e)->get());
+            break;
+        case tracker_type::tracker_placeholder_missing:
+            E::uint(out, std::static_pointer_cast<tracker_element_placeholder>(e)->get());
+            break;
+        case tracker_type::tracker_int16:
+            E::sint(out, std::static_pointer_cast<tracker_element_int16>(e)->get());
+            break;
+        case tracker_type::tracker_uint16:
+            E::uint(out, std::static_pointer_cast<tracker_element_uint16>(e)->get());
+            break;
+        case tracker_type::tracker_int32:
+            E::sint(out, std::static_pointer_cast<tracker_element_int32>(e)->get());
+            break;
+        case tracker_type::tracker_uint32:
+            E::uint(out, std::static_pointer_cast<tracker_element_uint32>(e)->get());
+            break;
+        case tracker_type::tracker_int64:
+            E::sint(out, std::static_pointer_cast<tracker_element_int64>(e)->get());
+            break;
+        case tracker_type::tracker_uint64:
+            E::uint(out, std::static_pointer_cast<tracker_element_uint64>(e)->get());
+            break;
+        case tracker_type::tracker_float:
+            E::dbl(out, std::static_pointer_cast<tracker_element_float>(e)->get());
+            break;
+        case tracker_type::tracker_double:
+            E::dbl(out, std::static_pointer_cast<tracker_element_double>(e)->get());
+            break;
+        case tracker_type::tracker_mac_addr:
+        case tracker_type::tracker_uuid:
+        case tracker_type::tracker_key:
+        case tracker_type::tracker_ipv4_addr:
+            E::str(out, e->as_string());
+            break;
+        case tracker_type::tracker_vector: {
+            auto v = std::static_pointer_cast<tracker_element_vector>(e);
+
+            size_t n = 0;
+            for (const auto& i : *v) {
+                if (i != nullptr)
+                    n++;
+            }
+
+            E::array(out, n);
+
+            for (const auto& i : *v) {
+                if (i != nullptr)
+                    pack_element<E>(out, i, name_map);
+            }
+
+            break;
+        }
+        case tracker_type::tracker_vector_double: {
+            auto v = std::static_pointer_cast<tracker_element_vector_double>(e);
+
+            E::array(out, v->size());
+
+            for (const auto& i : *v)
+                E::dbl(out, i);
+
+            break;
+        }
+        case tracker_type::tracker_vector_string: {
+            auto v = std::static_pointer_cast<tracker_element_vector_string>(e);
+
+            E::array(out, v->size());
+
+            for (const auto& i : *v)
+                E::str(out, i);
+
+            break;
+        }
+        case tracker_type::tracker_pair_double: {
+            auto p = std::static_pointer_cast<tracker_element_pair_double>(e)->get();
+
+            E::array(out, 2);
+            E::dbl(out, std::get<0>(p));
+            E::dbl(out, std::get<1>(p));
+
+            break;
+        }
+        case tracker_type::tracker_map: {
+            auto m = std::static_pointer_cast<tracker_element_map>(e);
+            auto as_vector = m->as_vector();
+            auto as_key_vector = m->as_key_vector();
+
+            size_t n = 0;
+            for (const auto& i : *m) {
+                if (i.second != nullptr)
+                    n++;
+            }
+
+            if (as_vector || as_key_vector)
+                E::array(out, n);
+            else
+                E::map(out, n);
+
+            for (const auto& i : *m) {
+                if (i.second == nullptr)
+                    continue;
+
+                if (!as_vector) {
+                    std::string tname;
+
+                    if (name_map != nullptr) {
+                        auto nmi = name_map->find(i.second);
+                        if (nmi != name_map->end() && nmi->second->rename.length() != 0)
+                            tname = nmi->second->rename;
+                    }
+
+                    if (tname.length() == 0) {
+                        auto it = i.second->get_type();
+
+                        if (it == tracker_type::tracker_placeholder_missing)
+                            tname = std::static_pointer_cast<tracker_element_placeholder>(i.second)->get_name();
+                        else if (it == tracker_type::tracker_alias)
+                            tname = std::static_pointer_cast<tracker_element_alias>(i.second)->get_alias_name();
+                    }
+
+                    if (tname.length() == 0)
+                        out.put(cached_field_name<E>(i.first));
+                    else
+                        E::str(out, tname);
+                }
+
+                if (!as_key_vector)
+                    pack_element<E>(out, i.second, name_map);
+            }
+
+            break;
+        }
+        case tracker_type::tracker_int_map:
+            pack_keyed_map<E>(out, std::static_pointer_cast<tracker_element_int_map>(e).get(),
+                    [&out](int k) { E::sint(out, k); }, name_map);
+            break;
+        case tracker_type::tracker_hashkey_map:
+            pack_keyed_map<E>(out, std::static_pointer_cast<tracker_element_hashkey_map>(e).get(),
+                    [&out](size_t k) { E::uint(out, k); }, name_map);
+            break;
+        case tracker_type::tracker_double_map:
+            pack_keyed_map<E>(out, std::static_pointer_cast<tracker_element_double_map>(e).get(),
+                    [&out](double k) { E::dbl(out, k); }, name_map);
+            break;
+        case tracker_type::tracker_mac_map:
+            pack_keyed_map<E>(out, std::static_pointer_cast<tracker_element_mac_map>(e).get(),
+                    [&out](const mac_addr& k) { E::str(out, k.mac_to_string()); }, name_map);
+            break;
+        case tracker_type::tracker_string_map:
+            pack_keyed_map<E>(out, std::static_pointer_cast<tracker_element_string_map>(e).get(),
+                    [&out](const std::string& k) { E::str(out, k); }, name_map);
+            break;
+        case tracker_type::tracker_key_map:
+            pack_keyed_map<E>(out, std::static_pointer_cast<tracker_element_device_key_map>(e).get(),
+                    [&out](const device_key& k) { E::str(out, k.as_string()); }, name_map);
+            break;
+        case tracker_type::tracker_uuid_map:
+            pack_keyed_map<E>(out, std::static_pointer_cast<tracker_element_uuid_map>(e).get(),
+                    [&out](const uuid& k) { E::str(out, k.as_string()); }, name_map);
+            break;
+        case tracker_type::tracker_double_map_double: {
+            auto m = std::static_pointer_cast<tracker_element_double_map_double>(e);
+
+            if (m->as_vector() || m->as_key_vector())
+                E::array(out, m->size());
+            else
+                E::map(out, m->size());
+
+            for (const auto& i : *m) {
+                if (!m->as_vector())
+                    E::dbl(out, i.first);
+
+                if (!m->as_key_vector())
+                    E::dbl(out, i.second);
+            }
+
+            break;
+        }
+        default:
+            E::nil(out);
+            break;
+    }
+}
+
+}
+
+void msgpack_adapter::pack(std::ostream& stream, shared_tracker_element e,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map) {
+    binary_buffer out(stream);
+    pack_element<msgpack_encoder>(out, e, name_map);
+}
+
+void cbor_adapter::pack(std::ostream& stream, shared_tracker_element e,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map) {
+    binary_buffer out(stream);
+    pack_element<cbor_encoder>(out, e, name_map);
+}
+
@@ -0,0 +1,78 @@
+/*
+    This file is part of Kismet
+
+    Kismet is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Kismet is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Kismet; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef __BINARY_ADAPTER_H__
+#define __BINARY_ADAPTER_H__
+
+#include "config.h"
+
+#include "globalregistry.h"
+#include "trackedelement.h"
+
+// Binary serialization adapters for machine consumers, MessagePack and CBOR.
+//
+// Both produce the same structure as the JSON serializer, including the field
+// simplification and renaming of summarized requests, with a few differences where
+// the binary formats can carry the data natively:
+//
+// * Numbers are native integers and doubles, instead of decimal text
+// * Byte arrays are binary blobs instead of hex strings
+// * Integer and double keyed maps use numeric keys instead of quoted strings
+//
+// MAC addresses, UUIDs, device keys, and IP addresses are strings, as in JSON.
+
+namespace msgpack_adapter {
+
+void pack(std::ostream& stream, shared_tracker_element e,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map = nullptr);
+
+class serializer : public tracker_element_serializer {
+public:
+    serializer() :
+        tracker_element_serializer() { }
+
+    virtual int serialize(shared_tracker_element in_elem, std::ostream &stream,
+            std::shared_ptr<rename_map> name_map = nullptr) override {
+        pack(stream, in_elem, name_map);
+        return 0;
+    }
+};
+
+}
+
+namespace cbor_adapter {
+
+void pack(std::ostream& stream, shared_tracker_element e,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map = nullptr);
+
+class serializer : public tracker_element_serializer {
+public:
+    serializer() :
+        tracker_element_serializer() { }
+
+    virtual int serialize(shared_tracker_element in_elem, std::ostream &stream,
+            std::shared_ptr<rename_map> name_map = nullptr) override {
+        pack(stream, in_elem, name_map);
+        return 0;
+    }
+};
+
+}
+
+#endif
+
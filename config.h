@@ -0,0 +1,328 @@
+/* config.h.  Generated from config.h.in by configure.  */
+/* config.h.in.  Generated from configure.ac by autoheader.  */
+
+/* Define if building universal (internal helper macro) */
+/* #undef AC_APPLE_UNIVERSAL_BUILD */
+
+/* backtrace stack support */
+/* #undef BACKWARD_HAS_BACKTRACE */
+
+/* backtrace stack support */
+/* #undef BACKWARD_HAS_BACKTRACE_SYMBOL */
+
+/* libbfd for stack printing */
+/* #undef BACKWARD_HAS_BFD */
+
+/* libdl for stack printing */
+/* #undef BACKWARD_HAS_DW */
+
+/* unwind stack support */
+/* #undef BACKWARD_HAS_UNWIND */
+
+/* system binary directory */
+#define BIN_LOC "/usr/local/bin"
+
+/* system data directory */
+#define DATA_LOC "/usr/local/share"
+
+/* Named mutex debugging */
+#define DEBUG_MUTEX_NAME 1
+
+/* disabled by configure arguments */
+#define DISABLE_BACKWARD 1
+
+/* Remove mutex deadlock timeout protection */
+/* #undef DISABLE_MUTEX_TIMEOUT */
+
+/* gcc version */
+#define GCC_VERSION_MAJOR 12
+
+/* gcc version */
+#define GCC_VERSION_MINOR 0
+
+/* gcc version */
+#define GCC_VERSION_PATCH 0
+
+/* Define to 1 if you have the <bfd.h> header file. */
+/* #undef HAVE_BFD_H */
+
+/* BSD radiotap packet headers */
+/* #undef HAVE_BSD_SYS_RADIOTAP */
+
+/* Define to 1 if you have the <btbb.h> header file. */
+/* #undef HAVE_BTBB_H */
+
+/* kernel capability support */
+/* #undef HAVE_CAPABILITY */
+
+/* cpp11 available */
+#define HAVE_CXX11 1
+
+/* cpp14 available */
+#define HAVE_CXX14 1
+
+/* cpp17 available */
+#define HAVE_CXX17 1
+
+/* Define to 1 if you have the <dwarf.h> header file. */
+/* #undef HAVE_DWARF_H */
+
+/* Define to 1 if you have the <elfutils/libdwfl.h> header file. */
+/* #undef HAVE_ELFUTILS_LIBDWFL_H */
+
+/* Define to 1 if you have the <elfutils/libdw.h> header file. */
+/* #undef HAVE_ELFUTILS_LIBDW_H */
+
+/* Define to 1 if you have the <execinfo.h> header file. */
+/* #undef HAVE_EXECINFO_H */
+
+/* GPS support will be built. */
+#define HAVE_GPS 1
+
+/* inttypes.h is present */
+#define HAVE_INTTYPES_H 1
+
+/* libbladerf */
+/* #undef HAVE_LIBBLADERF */
+
+/* Define to 1 if you have the `cap' library (-lcap). */
+/* #undef HAVE_LIBCAP */
+
+/* libnl netlink library */
+/* #undef HAVE_LIBNL */
+
+/* libnl netlink library */
+/* #undef HAVE_LIBNL10 */
+
+/* libnl-2.0 netlink library */
+/* #undef HAVE_LIBNL20 */
+
+/* libnl-3.0 netlink library */
+/* #undef HAVE_LIBNL30 */
+
+/* libnl-2.0 netlink library */
+/* #undef HAVE_LIBNLTINY */
+
+/* libnltiny headers present */
+/* #undef HAVE_LIBNLTINY_HEADERS */
+
+/* NetworkManager interface library */
+/* #undef HAVE_LIBNM */
+
+/* libpcap packet capture lib */
+#define HAVE_LIBPCAP 1
+
+/* libpcre regex support */
+/* #undef HAVE_LIBPCRE */
+
+/* libsqlite3 database support */
+#define HAVE_LIBSQLITE3 1
+
+/* libubertooth has ubertooth_count */
+/* #undef HAVE_LIBUBERTOOTH_UBERTOOTH_COUNT */
+
+/* Define to 1 if you have the <libutil.h> header file. */
+/* #undef HAVE_LIBUTIL_H */
+
+/* libwebsockets */
+/* #undef HAVE_LIBWEBSOCKETS */
+
+/* Linux wireless iwfreq.flag */
+/* #undef HAVE_LINUX_IWFREQFLAG */
+
+/* Netlink works */
+/* #undef HAVE_LINUX_NETLINK */
+
+/* Linux wireless extentions present */
+/* #undef HAVE_LINUX_WIRELESS */
+
+/* local radiotap packet headers */
+#define HAVE_LOCAL_RADIOTAP 1
+
+/* Define to 1 if you have the <memory.h> header file. */
+#define HAVE_MEMORY_H 1
+
+/* pcap/pcap.h */
+/* #undef HAVE_PCAPPCAP_H */
+
+/* libpcap header */
+#define HAVE_PCAP_H 1
+
+/* System has pipe2 */
+#define HAVE_PIPE2 1
+
+/* Define to 1 if you have the `pstat' function. */
+/* #undef HAVE_PSTAT */
+
+/* have pthread timelock */
+#define HAVE_PTHREAD_TIMELOCK 1
+
+/* Define to 1 if you have the <sensors/sensors.h> header file. */
+/* #undef HAVE_SENSORS_SENSORS_H */
+
+/* Define to 1 if you have the `setproctitle' function. */
+/* #undef HAVE_SETPROCTITLE */
+
+/* accept() takes type socklen_t for addrlen */
+#define HAVE_SOCKLEN_T 1
+
+/* stdint.h is present */
+#define HAVE_STDINT_H 1
+
+/* Define to 1 if you have the <stdlib.h> header file. */
+#define HAVE_STDLIB_H 1
+
+/* Define to 1 if you have the <strings.h> header file. */
+#define HAVE_STRINGS_H 1
+
+/* Define to 1 if you have the <string.h> header file. */
+#define HAVE_STRING_H 1
+
+/* Define to 1 if you have the <sys/pstat.h> header file. */
+/* #undef HAVE_SYS_PSTAT_H */
+
+/* Define to 1 if you have the <sys/stat.h> header file. */
+#define HAVE_SYS_STAT_H 1
+
+/* Define to 1 if you have the <sys/types.h> header file. */
+#define HAVE_SYS_TYPES_H 1
+
+/* Define to 1 if you have the <ubertooth.h> header file. */
+/* #undef HAVE_UBERTOOTH_H */
+
+/* ubertooth.h in ubertooth dir */
+/* #undef HAVE_UBERTOOTH_UBERTOOTH_H */
+
+/* Define to 1 if you have the <unistd.h> header file. */
+#define HAVE_UNISTD_H 1
+
+/* Define to 1 if you have the <unwind.h> header file. */
+/* #undef HAVE_UNWIND_H */
+
+/* __PROGNAME glibc macro available */
+#define HAVE___PROGNAME 1
+
+/* system library directory */
+#define LIB_LOC "/usr/local/lib"
+
+/* system state directory */
+#define LOCALSTATE_DIR "/usr/local/var"
+
+/* we need to shim isnan */
+/* #undef MISSING_STD_ISNAN */
+
+/* we need to shim std snprintf */
+/* #undef MISSING_STD_SNPRINTF */
+
+/* Define to the address where bug reports for this package should be sent. */
+#define PACKAGE_BUGREPORT ""
+
+/* Define to the full name of this package. */
+#define PACKAGE_NAME ""
+
+/* Define to the full name and version of this package. */
+#define PACKAGE_STRING ""
+
+/* Define to the one symbol short name of this package. */
+#define PACKAGE_TARNAME ""
+
+/* Define to the home page for this package. */
+#define PACKAGE_URL ""
+
+/* Define to the version of this package. */
+#define PACKAGE_VERSION ""
+
+/* writeable argv type */
+#define PF_ARGV_TYPE PF_ARGV_WRITEABLE
+
+/* Libprelude support enabled */
+/* #undef PRELUDE */
+
+/* Define to 1 if you have the ANSI C header files. */
+#define STDC_HEADERS 1
+
+/* strerror_r return type */
+#define STRERROR_R_T char *
+
+/* system config directory */
+#define SYSCONF_LOC "/usr/local/etc"
+
+/* Compiling for Cygwin */
+/* #undef SYS_CYGWIN */
+
+/* Compiling for OSX/Darwin */
+/* #undef SYS_DARWIN */
+
+/* Compiling for FreeBSD */
+/* #undef SYS_FREEBSD */
+
+/* Compiling for Linux OS */
+#define SYS_LINUX 1
+
+/* Compiling for NetBSD */
+/* #undef SYS_NETBSD */
+
+/* Compiling for OpenBSD */
+/* #undef SYS_OPENBSD */
+
+/* Do not enforce runtime type safety */
+#define TE_TYPE_SAFETY 1
+
+/* Define WORDS_BIGENDIAN to 1 if your processor stores words with the most
+   significant byte first (like Motorola and SPARC, unlike Intel). */
+#if defined AC_APPLE_UNIVERSAL_BUILD
+# if defined __BIG_ENDIAN__
+#  define WORDS_BIGENDIAN 1
+# endif
+#else
+# ifndef WORDS_BIGENDIAN
+/* #  undef WORDS_BIGENDIAN */
+# endif
+#endif
+
+/* Enable large inode numbers on Mac OS X 10.5.  */
+#ifndef _DARWIN_USE_64_BIT_INODE
+# define _DARWIN_USE_64_BIT_INODE 1
+#endif
+
+/* Number of bits in a file offset, on hosts where this is settable. */
+/* #undef _FILE_OFFSET_BITS */
+
+/* Define for large files, on AIX-style hosts. */
+/* #undef _LARGE_FILES */
+/* proftpd argv stuff */
+#define PF_ARGV_NONE        0
+#define PF_ARGV_NEW     	1
+#define PF_ARGV_WRITEABLE   2
+#define PF_ARGV_PSTAT       3
+#define PF_ARGV_PSSTRINGS   4
+
+/* Maximum number of characters in the status line */
+#define STATUS_MAX 1024
+
+/* Stupid ncurses */
+#define NCURSES_NOMACROS
+
+/* Number of hex pairs in a key */
+#define WEPKEY_MAX 32
+
+/* String length of a key */
+#define WEPKEYSTR_MAX ((WEPKEY_MAX * 2) + WEPKEY_MAX)
+
+/* system min isn't reliable */
+#define kismin(x,y) ((x) < (y) ? (x) : (y))
+#define kismax(x,y) ((x) > (y) ? (x) : (y))
+
+/* Timer slices per second */
+#define SERVER_TIMESLICES_SEC 10
+
+/* Max chars in SSID */
+#define MAX_SSID_LEN    255
+
+#ifndef _
+#define _(x) x
+#endif
+
+/* asio global defs */
+#define ASIO_HAS_STD_CHRONO
+#define ASIO_HAS_MOVE
@@ -922,6 +922,7 @@ void datasource_tracker::trigger_deferred_startup() {
                     con->clear_timeout();
                     con->set_target_file("kismet-all-packets.pcapng");
                     con->set_closure_cb([pcapng]() { pcapng->stop_stream("http connection lost"); });
+                    con->set_streaming();
 
                     auto sid = 
                         streamtracker->register_streamer(pcapng, "kismet-all-packets.pcapng",
@@ -966,6 +967,7 @@ void datasource_tracker::trigger_deferred_startup() {
                     con->set_target_file(fmt::format("kismet-datasource-{}-{}.pcapng", 
                                 ds->get_source_name(), dsuuid));
                     con->set_closure_cb([pcapng]() { pcapng->stop_stream("http connection lost"); });
+                    con->set_streaming();
 
                     auto sid = 
                         streamtracker->register_streamer(pcapng, fmt::format("kismet-datasource-{}-{}.pcapng", 
@@ -56,6 +56,9 @@ int Devicetracker_packethook_commontracker(CHAINCALL_PARMS) {
 	return ((device_tracker *) auxdata)->common_tracker(in_pack);
 }
 
+thread_local unsigned int kis_devicelist_mutex::depth = 0;
+thread_local std::vector<std::shared_ptr<kis_tracked_device_base>> kis_devicelist_mutex::pinned;
+
 device_tracker::device_tracker() :
     lifetime_global(),
     kis_database("devicetracker"),
@@ -64,6 +67,11 @@ device_tracker::device_tracker() :
     phy_mutex.set_name("device_tracker::phy_mutex");
     devicelist_mutex.set_name("devicetracker::devicelist");
 
+    for (auto& ds : device_shards)
+        ds.mutex.set_name("devicetracker::device_shard");
+
+    num_devices = 0;
+
     next_phy_id = 0;
 
     // create a vector
@@ -159,7 +167,8 @@ device_tracker::device_tracker() :
 
 	// Common tracker, very early in the tracker chain
 	packetchain->register_handler(&Devicetracker_packethook_commontracker,
-											this, CHAINPOS_TRACKER, -100);
+											this, CHAINPOS_TRACKER, -100,
+											"devicetracker Devicetracker_packethook_commontracker");
 
     // Post any events related to the device generated during tracking mode
     // (like a new device being created) at the very END of tracking, so that
@@ -171,7 +180,7 @@ device_tracker::device_tracker() :
             for (const auto& e : in_packet->process_complete_events)
                 eventbus->publish(e);
             return 1;
-        }, CHAINPOS_TRACKER, 0x7FFF'FFFF);
+        }, CHAINPOS_TRACKER, 0x7FFF'FFFF, "devicetracker complete_events");
 
     if (!Globalreg::globalreg->kismet_config->fetch_opt_bool("track_device_rrds", true)) {
         _MSG("Not tracking historical packet data to save RAM", MSGFLAG_INFO);
@@ -243,6 +252,12 @@ device_tracker::device_tracker() :
 #endif
 
     last_database_logged = 0;
+    database_log_cursor = 0;
+    database_log_subscribed = false;
+    database_log_generation = 0;
+
+    change_log = std::make_unique<device_change_log>(
+            Globalreg::globalreg->kismet_config->fetch_opt_uint("tracker_change_log_size", 65536));
 
     // Preload the vector for speed
     unsigned int preload_sz = 
@@ -308,33 +323,33 @@ device_tracker::device_tracker() :
     auto httpd = Globalreg::fetch_mandatory_global_as<kis_net_beast_httpd>();
 
     httpd->register_route("/devices/views/all_views", {"GET", "POST"}, httpd->RO_ROLE, {},
-            std::make_shared<kis_net_web_tracked_endpoint>(view_vec, get_devicelist_mutex()));
+            std::make_shared<kis_net_web_tracked_endpoint>(view_vec, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/multimac/devices", {"POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](shared_con con) -> std::shared_ptr<tracker_element> {
                     return multimac_endp_handler(con);
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/multikey/devices", {"POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](shared_con con) -> std::shared_ptr<tracker_element> {
                     return multikey_endp_handler(con, false);
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/multikey/as-object/devices", {"POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](shared_con con) -> std::shared_ptr<tracker_element> {
                     return multikey_endp_handler(con, true);
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
-    httpd->register_route("/devices/all_devices", {"GET", "POST"}, httpd->RO_ROLE, {"ekjson", "itjson"},
+    httpd->register_route("/devices/all_devices", {"GET", "POST"}, httpd->RO_ROLE, {"ekjson", "itjson", "msgpack", "cbor"},
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](shared_con con) -> std::shared_ptr<tracker_element> {
                     auto device_ro = std::make_shared<tracker_element_vector>();
                     device_ro->set(immutable_tracked_vec->begin(), immutable_tracked_vec->end());
                     return device_ro;
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/by-key/:key/device", {"GET", "POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
@@ -351,7 +366,7 @@ device_tracker::device_tracker() :
                         throw std::runtime_error("nonexistent device key");
 
                     return dev;
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/by-mac/:mac/devices", {"GET", "POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
@@ -364,12 +379,11 @@ device_tracker::device_tracker() :
 
                     auto devvec = std::make_shared<tracker_element_vector>();
 
-                    const auto mmp = tracked_mac_multimap.equal_range(mac);
-                    for (auto mmpi = mmp.first; mmpi != mmp.second; ++mmpi)
-                        devvec->push_back(mmpi->second);
+                    for (const auto& d : fetch_devices(mac))
+                        devvec->push_back(d);
 
                     return devvec;
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/last-time/:timestamp/devices", {"GET", "POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
@@ -393,7 +407,42 @@ device_tracker::device_tracker() :
                         });
 
                     return do_readonly_device_work(ts_worker);
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
+
+    httpd->register_route("/devices/changed-since/:cursor/devices", {"GET", "POST"}, httpd->RO_ROLE, {},
+            std::make_shared<kis_net_web_tracked_endpoint>(
+                [this](shared_con con) -> std::shared_ptr<tracker_element> {
+                    auto cursor_k = con->uri_params().find(":cursor");
+                    auto cursor = string_to_n<uint64_t>(cursor_k->second);
+
+                    auto ret = std::make_shared<tracker_element_string_map>();
+                    auto devvec = std::make_shared<tracker_element_vector>();
+
+                    std::vector<std::shared_ptr<kis_tracked_device_base>> changed;
+                    bool complete = true;
+
+                    // A cursor the log can't satisfy gets every device, and the cursor to 
+                    // continue from
+                    if (fetch_changed_devices(cursor, changed)) {
+                        for (const auto& d : changed)
+                            devvec->push_back(d);
+                    } else {
+                        complete = false;
+
+                        for (const auto& d : *immutable_tracked_vec) {
+                            if (d != nullptr)
+                                devvec->push_back(d);
+                        }
+                    }
+
+                    ret->insert(std::make_pair("kismet.devicetracker.change_cursor",
+                                std::make_shared<tracker_element_uint64>(0, cursor)));
+                    ret->insert(std::make_pair("kismet.devicetracker.change_complete",
+                                std::make_shared<tracker_element_uint8>(0, complete)));
+                    ret->insert(std::make_pair("kismet.devicetracker.devices", devvec));
+
+                    return ret;
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/by-key/:key/set_name", {"POST"}, httpd->LOGON_ROLE, {"cmd"},
             std::make_shared<kis_net_web_function_endpoint>(
@@ -415,7 +464,7 @@ device_tracker::device_tracker() :
 
                     std::ostream os(&con->response_stream());
                     os << "Device name set\n";
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/by-key/:key/set_tag", {"POST"}, httpd->LOGON_ROLE, {"cmd"},
             std::make_shared<kis_net_web_function_endpoint>(
@@ -438,7 +487,7 @@ device_tracker::device_tracker() :
 
                     std::ostream os(&con->response_stream());
                     os << "Device tag set\n";
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/pcap/by-key/:key/packets", {"GET"}, httpd->RO_ROLE, {"pcapng"},
             std::make_shared<kis_net_web_function_endpoint>(
@@ -469,6 +518,7 @@ device_tracker::device_tracker() :
                     con->clear_timeout();
                     con->set_target_file(fmt::format("kismet-device-{}.pcapng", devkey));
                     con->set_closure_cb([pcapng]() { pcapng->stop_stream("http connection lost"); });
+                    con->set_streaming();
 
                     auto sid = 
                         streamtracker->register_streamer(pcapng, fmt::format("kismet-device-{}.pcapng", devkey),
@@ -529,7 +579,7 @@ device_tracker::device_tracker() :
                         else
                             macdevice_alert_conf_map[mi] = type_set;
                     }
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/alerts/mac/:type/remove", {"POST"}, httpd->LOGON_ROLE, {"cmd"},
             std::make_shared<kis_net_web_function_endpoint>(
@@ -589,7 +639,7 @@ device_tracker::device_tracker() :
                             }
                         }
                     }
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/devices/alerts/mac/:type/macs", {"GET"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
@@ -614,7 +664,7 @@ device_tracker::device_tracker() :
                     }
 
                     return ret;
-                }, get_devicelist_mutex()));
+                }, get_devicelist_mutex().reader_mutex()));
 
     httpd->register_websocket_route("/devices/monitor", httpd->RO_ROLE, {"ws"},
             std::make_shared<kis_net_web_function_endpoint>(
@@ -673,50 +723,61 @@ device_tracker::device_tracker() :
 
                                 auto rename_map = std::make_shared<tracker_element_serializer::rename_map>();
 
-                                time_t last_tm = 0;
+                                auto last_tm = std::make_shared<time_t>(0);
+
+                                // Monitoring all devices follows the change log, so each timer only
+                                // looks at the devices which changed.  The cursor is taken before the
+                                // first pass so nothing changed during the initial dump is missed.
+                                auto cursor = std::make_shared<uint64_t>(subscribe_device_changes());
+                                auto full_pass = std::make_shared<bool>(true);
+
+                                // Serialize under the device lock, the packet threads may be updating it
+                                auto send_device = [this, ws, json, format_t](const std::shared_ptr<kis_tracked_device_base>& dev) {
+                                    std::stringstream ss;
+
+                                    {
+                                        std::lock_guard<std::recursive_mutex> dev_lk(dev->get_device_mutex());
+                                        entrytracker->serialize_with_json_summary(format_t, ss, dev, json);
+                                    }
+
+                                    ws->write(ss.str(), true);
+                                };
 
                                 // Generate a timer event that goes and looks for the devices and
                                 // serializes them with the fields record
                                 auto tid = 
                                     timetracker->register_timer(std::chrono::seconds(rate), true,
-                                            [this, con, dev_r, dev_k, dev_m, json, ws, &last_tm, rename_map, format_t](int) -> int {
-                                                if (dev_r == "*") {
-                                                    auto worker = device_tracker_view_function_worker([json, last_tm, format_t, this, ws](std::shared_ptr<kis_tracked_device_base> dev) -> bool {
-                                                        if (dev->get_mod_time() > last_tm) {
-                                                            std::stringstream ss;
-                                                            entrytracker->serialize_with_json_summary(format_t, ss, dev, json);
-                                                            ws->write(ss.str(), true);
-                                                        }
+                                            [this, con, dev_r, dev_k, dev_m, last_tm, cursor, full_pass, send_device](int) -> int {
+                                                std::vector<std::shared_ptr<kis_tracked_device_base>> changed;
+
+                                                if (dev_r == "*" && !*full_pass && fetch_changed_devices(*cursor, changed)) {
+                                                    for (const auto& dev : changed)
+                                                        send_device(dev);
+                                                } else if (dev_r == "*") {
+                                                    // Send every device on the first pass, or when we fell behind 
+                                                    // the change log; the worker is called with the device locked
+                                                    *full_pass = false;
+
+                                                    auto worker = device_tracker_view_function_worker([last_tm, send_device](std::shared_ptr<kis_tracked_device_base> dev) -> bool {
+                                                        if (dev->get_mod_time() > *last_tm)
+                                                            send_device(dev);
 
                                                         return false;
                                                     });
 
-                                                    do_device_work(worker);
+                                                    do_readonly_device_work(worker);
                                                 } else if (!dev_k.get_error()) {
-                                                    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "ws monitor timer serialize lambda");
-
                                                     auto dev = fetch_device(dev_k);
-                                                    if (dev != nullptr) {
-                                                        if (dev->get_mod_time() > last_tm) {
-                                                            std::stringstream ss;
-                                                            entrytracker->serialize_with_json_summary(format_t, ss, dev, json);
-                                                            ws->write(ss.str(), true);
-                                                        }
-                                                    }
+                                                    if (dev != nullptr && dev->get_mod_time() > *last_tm)
+                                                        send_device(dev);
                                                 } else if (!dev_m.error()) {
-                                                    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "ws monitor timer serialize lambda");
-
-                                                    const auto mmp = tracked_mac_multimap.equal_range(dev_m);
-                                                    for (auto mmpi = mmp.first; mmpi != mmp.second; ++mmpi) {
-                                                        if (mmpi->second->get_mod_time() > last_tm) {
-                                                            std::stringstream ss;
-                                                            entrytracker->serialize_with_json_summary(format_t, ss, mmpi->second, json);
-                                                            ws->write(ss.str(), true);
-                                                        }
+                                                    for (const auto& d : fetch_devices(dev_m)) {
+                                                        if (d->get_mod_time() > *last_tm)
+                                                            send_device(d);
                                                     }
                                                 }
 
-                                                last_tm = time(0);
+                                                *last_tm = time(0);
 
                                                 return 1;
                                             });
@@ -898,11 +959,15 @@ device_tracker::~device_tracker() {
 
     tracked_vec.clear();
     immutable_tracked_vec->clear();
-    tracked_mac_multimap.clear();
+
+    for (auto& ds : device_shards) {
+        ds.key_map.clear();
+        ds.mac_map.clear();
+    }
 }
 
 void device_tracker::macdevice_timer_event() {
-    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "device_tracker macdevice_timer_event");
+    kis_lock_guard<kis_devicelist_mutex> lk(get_devicelist_mutex(), "device_tracker macdevice_timer_event");
 
     time_t now = time(0);
 
@@ -964,9 +1029,7 @@ std::string device_tracker::fetch_phy_name(int in_phy) {
 }
 
 int device_tracker::fetch_num_devices() {
-    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "device_tracker fetch_num_devices");
-
-    return tracked_map.size();
+    return num_devices;
 }
 
 int device_tracker::fetch_num_packets() {
@@ -1027,38 +1090,122 @@ void device_tracker::update_full_refresh() {
 }
 
 std::shared_ptr<kis_tracked_device_base> device_tracker::fetch_device(device_key in_key) {
-    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "device_tracker fetch_device");
+    auto dev = fetch_device_nr(in_key);
 
-	device_itr i = tracked_map.find(in_key);
-
-	if (i != tracked_map.end())
-		return i->second;
+    // Writers lock the device for the rest of their devicelist hold
+    devicelist_mutex.pin(dev);
 
-	return NULL;
+    return dev;
 }
 
 std::shared_ptr<kis_tracked_device_base> device_tracker::fetch_device_nr(device_key in_key) {
-	device_itr i = tracked_map.find(in_key);
+    auto& shard = get_device_shard(in_key.get_dkey());
+    kis_lock_guard<kis_shared_mutex> lk(shard.mutex, kismet::shared_lock, "device_tracker fetch_device");
+
+	device_itr i = shard.key_map.find(in_key);
 
-	if (i != tracked_map.end())
+	if (i != shard.key_map.end())
 		return i->second;
 
 	return NULL;
 }
 
 // Fetch one or more devices by mac address or mac mask
+uint64_t device_tracker::subscribe_device_changes() {
+    return change_log->subscribe();
+}
+
+bool device_tracker::fetch_changed_devices(uint64_t& io_cursor, 
+        std::vector<std::shared_ptr<kis_tracked_device_base>>& out_devices) {
+    std::vector<uint64_t> ids;
+
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex, "device_tracker fetch_changed_devices");
+
+    if (!change_log->read(io_cursor, ids))
+        return false;
+
+    out_devices.reserve(ids.size());
+
+    for (const auto& id : ids) {
+        // Devices which have since been removed leave a null slot
+        if (id >= immutable_tracked_vec->size())
+            continue;
+
+        auto d = (*immutable_tracked_vec)[id];
+
+        if (d != nullptr)
+            out_devices.push_back(std::static_pointer_cast<kis_tracked_device_base>(d));
+    }
+
+    return true;
+}
+
 std::vector<std::shared_ptr<kis_tracked_device_base>> device_tracker::fetch_devices(mac_addr in_mac) {
-    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "device_tracker fetch_device mac");
     std::vector<std::shared_ptr<kis_tracked_device_base>> ret;
-   
-    const auto mmp = tracked_mac_multimap.equal_range(in_mac);
-    for (auto mmpi = mmp.first; mmpi != mmp.second; ++mmpi) {
-        ret.push_back(mmpi->second);
+
+    auto fetch_shard = [&](device_map_shard& shard) {
+        kis_lock_guard<kis_shared_mutex> lk(shard.mutex, kismet::shared_lock, "device_tracker fetch_device mac");
+
+        const auto mmp = shard.mac_map.equal_range(in_mac);
+        for (auto mmpi = mmp.first; mmpi != mmp.second; ++mmpi) {
+            ret.push_back(mmpi->second);
+        }
+    };
+
+    // A full mac lives in a single shard; a mac mask may match devices in any shard
+    if (in_mac.maskbits >= 48) {
+        fetch_shard(get_device_shard(in_mac.longmac));
+    } else {
+        for (auto& ds : device_shards)
+            fetch_shard(ds);
     }
 
+    for (const auto& d : ret)
+        devicelist_mutex.pin(d);
+
     return ret;
 }
 
+void device_tracker::insert_device_shard(std::shared_ptr<kis_tracked_device_base> device) {
+    auto& shard = get_device_shard(device->get_key().get_dkey());
+    kis_lock_guard<kis_shared_mutex> lk(shard.mutex, "device_tracker insert_device_shard");
+
+    shard.key_map[device->get_key()] = device;
+    shard.mac_map.emplace(std::make_pair(device->get_macaddr(), device));
+
+    num_devices++;
+}
+
+void device_tracker::device_removed_phy(std::shared_ptr<kis_tracked_device_base> device) {
+    auto phy = fetch_phy_handler(device->get_phyid());
+
+    if (phy != nullptr)
+        phy->device_removed(device);
+}
+
+void device_tracker::remove_device_shard(std::shared_ptr<kis_tracked_device_base> device) {
+    auto& shard = get_device_shard(device->get_key().get_dkey());
+    kis_lock_guard<kis_shared_mutex> lk(shard.mutex, "device_tracker remove_device_shard");
+
+    device_itr mi = shard.key_map.find(device->get_key());
+
+    if (mi == shard.key_map.end())
+        return;
+
+    shard.key_map.erase(mi);
+
+    auto mmp = shard.mac_map.equal_range(device->get_macaddr());
+
+    for (auto mmpi = mmp.first; mmpi != mmp.second; ++mmpi) {
+        if (mmpi->second->get_key() == device->get_key()) {
+            shard.mac_map.erase(mmpi);
+            break;
+        }
+    }
+
+    num_devices--;
+}
+
 int device_tracker::common_tracker(kis_packet *in_pack) {
     kis_lock_guard<kis_mutex> lk(phy_mutex, "device_tracker common_tracker");
 
@@ -1142,7 +1289,7 @@ std::shared_ptr<kis_tracked_device_base>
     // Updating devices can only happen in serial because we don't know that a device is being
     // created & we don't know how to append the data until we get to the end of processing
     // so the entire chain is perforce locked
-    kis_lock_guard<kis_mutex> lg(get_devicelist_mutex(), "device_tracker update_common_device");
+    kis_lock_guard<kis_devicelist_mutex> lg(get_devicelist_mutex(), "device_tracker update_common_device");
 
     std::stringstream sstr;
 
@@ -1163,11 +1310,12 @@ std::shared_ptr<kis_tracked_device_base>
 
     key = device_key(in_phy->fetch_phyname_hash(), in_mac);
 
-	if ((device = fetch_device_nr(key)) == NULL) {
+	if ((device = fetch_device(key)) == NULL) {
         if (in_flags & UCD_UPDATE_EXISTING_ONLY)
             return NULL;
 
         device = std::make_shared<kis_tracked_device_base>(device_base_id);
+        devicelist_mutex.pin(device);
 
         // Device ID is the size of the vector so a new device always gets put
         // in it's numbered slot
@@ -1208,6 +1356,7 @@ std::shared_ptr<kis_tracked_device_base>
 
     // Update the mod data
     device->update_modtime();
+    change_log->record(device->get_change_seq(), device->get_kis_internal_id());
 
     // Raise alerts for new devices or devices which have been
     // idle and re-appeared
@@ -1343,14 +1492,11 @@ std::shared_ptr<kis_tracked_device_base>
 
     if (new_device) {
         // Add the new device to the list
-        tracked_map[key] = device;
+        insert_device_shard(device);
 
         tracked_vec.push_back(device);
         immutable_tracked_vec->push_back(device);
 
-        auto mm_pair = std::make_pair(in_mac, device);
-        tracked_mac_multimap.insert(mm_pair);
-
         // If we have no packet info, add it to the device list immediately,
         // otherwise, flag the packet to trigger a new device event at the
         // end of the packet processing stage of the chain
@@ -1369,6 +1515,9 @@ std::shared_ptr<kis_tracked_device_base>
         // Release the devicelist lock before we add it to the views
         ul_list.unlock();
 #endif
+    } else {
+        // Counters and timestamps changed, so move the device in any view sort indices
+        update_view_sort_keys(device);
     }
 
     return device;
@@ -1404,7 +1553,7 @@ bool devicetracker_sort_lastseen(std::shared_ptr<kis_tracked_device_base> a,
 
 void device_tracker::timetracker_event(int eventid) {
     if (eventid == device_idle_timer) {
-        kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "device_tracker timetracker_event device_idle_timer");
+        kis_lock_guard<kis_devicelist_mutex> lk(get_devicelist_mutex(), "device_tracker timetracker_event device_idle_timer");
 
         time_t ts_now = time(0);
         bool purged = false;
@@ -1415,20 +1564,8 @@ void device_tracker::timetracker_event(int eventid) {
                     if (ts_now - d->get_last_time() > device_idle_expiration &&
                             (d->get_packets() < device_idle_min_packets || 
                              device_idle_min_packets <= 0)) {
-                        device_itr mi = tracked_map.find(d->get_key());
-
-                        if (mi != tracked_map.end())
-                            tracked_map.erase(mi);
-
-                        // Erase it from the multimap
-                        auto mmp = tracked_mac_multimap.equal_range(d->get_macaddr());
-
-                        for (auto mmpi = mmp.first; mmpi != mmp.second; ++mmpi) {
-                            if (mmpi->second->get_key() == d->get_key()) {
-                                tracked_mac_multimap.erase(mmpi);
-                                break;
-                            }
-                        }
+                        remove_device_shard(d);
+                        device_removed_phy(d);
 
                         // Forget it from any views
                         remove_view_device(d);
@@ -1451,7 +1588,7 @@ void device_tracker::timetracker_event(int eventid) {
             update_full_refresh();
 
     } else if (eventid == max_devices_timer) {
-        kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "device_tracker timetracker_event max_devices_timer");
+        kis_lock_guard<kis_devicelist_mutex> lk(get_devicelist_mutex(), "device_tracker timetracker_event max_devices_timer");
 
 		// Do nothing if we don't care
 		if (max_num_devices <= 0)
@@ -1472,20 +1609,8 @@ void device_tracker::timetracker_event(int eventid) {
 
         tracked_vec.erase(std::remove_if(tracked_vec.begin() + max_num_devices, tracked_vec.end(),
                 [&](std::shared_ptr<kis_tracked_device_base> d) {
-                    device_itr mi = tracked_map.find(d->get_key());
-
-                    if (mi != tracked_map.end())
-                        tracked_map.erase(mi);
-
-                    // Erase it from the multimap
-                    auto mmp = tracked_mac_multimap.equal_range(d->get_macaddr());
-
-                    for (auto mmpi = mmp.first; mmpi != mmp.second; ++mmpi) {
-                        if (mmpi->second->get_key() == d->get_key()) {
-                            tracked_mac_multimap.erase(mmpi);
-                            break;
-                        }
-                    }
+                    remove_device_shard(d);
+                    device_removed_phy(d);
 
                     // Forget it from the immutable vec, but keep its 
                     // position; we need to have vecpos = devid
@@ -1591,7 +1716,7 @@ int device_tracker::database_upgrade_db() {
 }
 
 void device_tracker::add_device(std::shared_ptr<kis_tracked_device_base> device) {
-    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "device_tracker add_device");
+    kis_lock_guard<kis_devicelist_mutex> lk(get_devicelist_mutex(), "device_tracker add_device");
 
     if (fetch_device_nr(device->get_key()) != NULL) {
         _MSG("device_tracker tried to add device " + device->get_macaddr().mac_to_string() + 
@@ -1603,16 +1728,13 @@ void device_tracker::add_device(std::shared_ptr<kis_tracked_device_base> device)
     // in it's numbered slot
     device->set_kis_internal_id(immutable_tracked_vec->size());
 
-    tracked_map[device->get_key()] = device;
+    insert_device_shard(device);
     tracked_vec.push_back(device);
     immutable_tracked_vec->push_back(device);
-
-    auto mm_pair = std::make_pair(device->get_macaddr(), device);
-    tracked_mac_multimap.emplace(mm_pair);
 }
 
 bool device_tracker::add_view(std::shared_ptr<device_tracker_view> in_view) {
-    kis_lock_guard<kis_mutex> lk(devicelist_mutex);
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex);
 
     for (const auto& i : *view_vec) {
         auto vi = std::static_pointer_cast<device_tracker_view>(i);
@@ -1631,7 +1753,7 @@ bool device_tracker::add_view(std::shared_ptr<device_tracker_view> in_view) {
 }
 
 void device_tracker::remove_view(const std::string& in_id) {
-    kis_lock_guard<kis_mutex> lk(devicelist_mutex);
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex);
         
     for (auto i = view_vec->begin(); i != view_vec->end(); ++i) {
         auto vi = std::static_pointer_cast<device_tracker_view>(*i);
@@ -1643,7 +1765,7 @@ void device_tracker::remove_view(const std::string& in_id) {
 }
 
 void device_tracker::new_view_device(std::shared_ptr<kis_tracked_device_base> in_device) {
-    kis_lock_guard<kis_mutex> lk(devicelist_mutex);
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex);
 
     for (const auto& i : *view_vec) {
         auto vi = std::static_pointer_cast<device_tracker_view>(i);
@@ -1652,7 +1774,7 @@ void device_tracker::new_view_device(std::shared_ptr<kis_tracked_device_base> in
 }
 
 void device_tracker::update_view_device(std::shared_ptr<kis_tracked_device_base> in_device) {
-    kis_lock_guard<kis_mutex> lk(devicelist_mutex);
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex);
 
     for (const auto& i : *view_vec) {
         auto vi = std::static_pointer_cast<device_tracker_view>(i);
@@ -1661,7 +1783,7 @@ void device_tracker::update_view_device(std::shared_ptr<kis_tracked_device_base>
 }
 
 void device_tracker::remove_view_device(std::shared_ptr<kis_tracked_device_base> in_device) {
-    kis_lock_guard<kis_mutex> lk(devicelist_mutex);
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex);
 
     for (const auto& i : *view_vec) {
         auto vi = std::static_pointer_cast<device_tracker_view>(i);
@@ -1669,8 +1791,19 @@ void device_tracker::remove_view_device(std::shared_ptr<kis_tracked_device_base>
     }
 }
 
+void device_tracker::update_view_sort_keys(std::shared_ptr<kis_tracked_device_base> in_device) {
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex);
+
+    for (const auto& i : *view_vec) {
+        auto vi = std::static_pointer_cast<device_tracker_view>(i);
+
+        if (vi->sort_indices_live())
+            vi->update_sort_keys(in_device);
+    }
+}
+
 std::shared_ptr<device_tracker_view> device_tracker::get_phy_view(int in_phyid) {
-    kis_lock_guard<kis_mutex> lk(devicelist_mutex);
+    kis_lock_guard<kis_devicelist_mutex> lk(devicelist_mutex);
 
     auto vk = phy_view_map.find(in_phyid);
     if (vk != phy_view_map.end())
@@ -1685,6 +1818,32 @@ void device_tracker::databaselog_write_devices() {
     if (dbf == nullptr)
         return;
 
+    // A rotated log starts out empty, so every device has to be written to it again
+    if (dbf->get_log_generation() != database_log_generation) {
+        database_log_generation = dbf->get_log_generation();
+        database_log_subscribed = false;
+        last_database_logged = 0;
+    }
+
+    // Remember the time BEFORE we spend time looking at all the devices
+    auto log_time = time(0);
+
+    // Once we've made a full pass, only the devices in the change log need to be written
+    std::vector<std::shared_ptr<kis_tracked_device_base>> changed;
+
+    if (database_log_subscribed && fetch_changed_devices(database_log_cursor, changed)) {
+        for (const auto& d : changed)
+            dbf->log_device(d);
+
+        last_database_logged = log_time;
+        return;
+    }
+
+    if (!database_log_subscribed) {
+        database_log_cursor = subscribe_device_changes();
+        database_log_subscribed = true;
+    }
+
     device_tracker_view_function_worker worker([this, dbf](std::shared_ptr<kis_tracked_device_base> dev) -> bool {
             if (dev->get_mod_time() >= last_database_logged) {
                 dbf->log_device(dev);
@@ -1693,9 +1852,6 @@ void device_tracker::databaselog_write_devices() {
             return false;
         });
 
-    // Remember the time BEFORE we spend time looking at all the devices
-    auto log_time = time(0);
-
     do_readonly_device_work(worker);
 
     // Then update the log; we might catch a few high-change devices twice, but this is
@@ -1818,7 +1974,8 @@ void device_tracker::load_stored_tags(std::shared_ptr<kis_tracked_device_base> i
 void device_tracker::set_device_user_name(std::shared_ptr<kis_tracked_device_base> in_dev,
         std::string in_username) {
 
-    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "set_device_user_name");
+    kis_lock_guard<kis_devicelist_mutex> lk(get_devicelist_mutex(), "set_device_user_name");
+    pin_device(in_dev);
 
     in_dev->set_username(in_username);
 
@@ -1868,7 +2025,8 @@ void device_tracker::set_device_user_name(std::shared_ptr<kis_tracked_device_bas
 void device_tracker::set_device_tag(std::shared_ptr<kis_tracked_device_base> in_dev,
         std::string in_tag, std::string in_content) {
 
-    kis_lock_guard<kis_mutex> lk(get_devicelist_mutex(), "set_device_tag");
+    kis_lock_guard<kis_devicelist_mutex> lk(get_devicelist_mutex(), "set_device_tag");
+    pin_device(in_dev);
 
     auto e = std::make_shared<tracker_element_string>();
     e->set(in_content);
@@ -29,6 +29,7 @@
 #include <unordered_map>
 #include <vector>
 #include <algorithm>
+#include <array>
 #include <string>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -52,6 +53,7 @@
 #include "timetracker.h"
 #include "kis_net_beast_httpd.h"
 #include "devicetracker_view.h"
+#include "devicetracker_changelog.h"
 #include "devicetracker_view_workers.h"
 #include "kis_database.h"
 #include "eventbus.h"
@@ -64,6 +66,91 @@
 class kis_phy_handler;
 class kis_packet;
 
+// Number of shards in the device map; must be a power of two
+#define KIS_DEVICE_MAP_SHARDS       64
+
+// The devicelist mutex serializes writers which modify device records (the phy
+// classifiers, device expiry, etc).  Devices fetched or updated by a thread holding 
+// this mutex are pinned:  their per-device lock is taken, and held until the thread 
+// releases the devicelist mutex completely.  It wraps a kis_mutex rather than being one,
+// so it can only be locked through its own type and every hold is seen.
+// Readers which only need a consistent view of a single device, such as view filters, 
+// take the per-device lock instead of the devicelist, and only block packet 
+// processing of that one device.
+class kis_devicelist_mutex {
+public:
+    kis_devicelist_mutex() { }
+
+    kis_devicelist_mutex(const kis_devicelist_mutex&) = delete;
+    kis_devicelist_mutex& operator=(const kis_devicelist_mutex&) = delete;
+
+    void set_name(const std::string& name) {
+        mutex.set_name(name);
+    }
+
+    const std::string& get_name() const {
+        return mutex.get_name();
+    }
+
+    void lock() {
+        mutex.lock();
+        depth++;
+    }
+
+    bool try_lock() {
+        if (mutex.try_lock()) {
+            depth++;
+            return true;
+        }
+
+        return false;
+    }
+
+    void unlock() {
+        if (depth > 0 && --depth == 0) {
+            for (auto& d : pinned)
+                d->get_device_mutex().unlock();
+            pinned.clear();
+        }
+
+        mutex.unlock();
+    }
+
+    void lock_shared() {
+        throw std::runtime_error("lock_shared called on non-shared mutex");
+    }
+
+    void unlock_shared() {
+        throw std::runtime_error("unlock_shared called on non-shared mutex");
+    }
+
+    // Lock a device for the remainder of the current devicelist hold, if this thread 
+    // holds it as a writer
+    void pin(const std::shared_ptr<kis_tracked_device_base>& in_dev) {
+        if (depth == 0 || in_dev == nullptr)
+            return;
+
+        for (const auto& d : pinned)
+            if (d == in_dev)
+                return;
+
+        in_dev->get_device_mutex().lock();
+        pinned.push_back(in_dev);
+    }
+
+    // The underlying mutex, for read-only holders which need a kis_mutex (such as 
+    // tracked endpoints serializing devices); it excludes writers but pins nothing
+    kis_mutex& reader_mutex() {
+        return mutex;
+    }
+
+protected:
+    kis_mutex mutex;
+
+    static thread_local unsigned int depth;
+    static thread_local std::vector<std::shared_ptr<kis_tracked_device_base>> pinned;
+};
+
 class device_tracker : public lifetime_global, public kis_database, 
     public deferred_startup, public std::enable_shared_from_this<device_tracker> {
 
@@ -121,6 +208,14 @@ public:
     // Fetch one or more devices by mac address or mac mask
     std::vector<std::shared_ptr<kis_tracked_device_base>> fetch_devices(mac_addr in_mac);
 
+    // Follow the device change log; subscribe returns a new cursor, and fetch_changed_devices
+    // returns the devices which changed since the cursor and advances it.  If the cursor 
+    // fell too far behind, fetch_changed_devices returns false and resets the cursor, and the
+    // caller must look at every device instead.
+    uint64_t subscribe_device_changes();
+    bool fetch_changed_devices(uint64_t& io_cursor, 
+            std::vector<std::shared_ptr<kis_tracked_device_base>>& out_devices);
+
     // Look for an existing device record, without lock - must be called under some form of existing
     // lock to be safely used
     std::shared_ptr<kis_tracked_device_base> fetch_device_nr(device_key in_key);
@@ -222,6 +317,8 @@ public:
     virtual void new_view_device(std::shared_ptr<kis_tracked_device_base> in_device);
     virtual void update_view_device(std::shared_ptr<kis_tracked_device_base> in_device);
     virtual void remove_view_device(std::shared_ptr<kis_tracked_device_base> in_device);
+    // Keep the view sort indices in order after a device has been updated
+    virtual void update_view_sort_keys(std::shared_ptr<kis_tracked_device_base> in_device);
 
     // Get phy views
     std::shared_ptr<device_tracker_view> get_phy_view(int in_phy);
@@ -233,10 +330,16 @@ public:
     std::shared_ptr<tracker_element_string> get_cached_phyname(const std::string& phyname);
 
     // Expose to devicelist mutex for external batch locking
-    kis_mutex& get_devicelist_mutex() {
+    kis_devicelist_mutex& get_devicelist_mutex() {
         return devicelist_mutex;
     }
 
+    // Pin a device which was not obtained via fetch_device or update_common_device
+    // for the rest of the current devicelist hold
+    void pin_device(const std::shared_ptr<kis_tracked_device_base>& in_dev) {
+        devicelist_mutex.pin(in_dev);
+    }
+
 protected:
     std::shared_ptr<entry_tracker> entrytracker;
     std::shared_ptr<packet_chain> packetchain;
@@ -333,14 +436,35 @@ protected:
     // Signal threshold
     int device_location_signal_threshold;
 
-	// Tracked devices
-    device_map_t tracked_map;
-	// Vector of tracked devices so we can iterate them quickly
-    std::vector<std::shared_ptr<kis_tracked_device_base> > tracked_vec;
+    // Tracked devices, sharded by mac address so that lookups from the packet threads
+    // and the webui only contend for the same shard.  The device key is derived from
+    // the mac, so both the key map and the mac map of a device live in the same shard.
+    //
     // MAC address lookups are incredibly expensive from the webui if we don't
     // track by map; in theory multiple objects in different PHYs could have the
     // same MAC so it's not a simple 1:1 map
-    std::multimap<mac_addr, std::shared_ptr<kis_tracked_device_base> > tracked_mac_multimap;
+    struct device_map_shard {
+        kis_shared_mutex mutex;
+        device_map_t key_map;
+        std::multimap<mac_addr, std::shared_ptr<kis_tracked_device_base>> mac_map;
+    };
+
+    std::array<device_map_shard, KIS_DEVICE_MAP_SHARDS> device_shards;
+
+    device_map_shard& get_device_shard(uint64_t in_longmac) {
+        return device_shards[((in_longmac * 0x9E3779B97F4A7C15ULL) >> 32) & (KIS_DEVICE_MAP_SHARDS - 1)];
+    }
+
+    // Insert and remove devices from the shards; called under the devicelist lock
+    void insert_device_shard(std::shared_ptr<kis_tracked_device_base> device);
+    void remove_device_shard(std::shared_ptr<kis_tracked_device_base> device);
+    // Tell the phy of a removed device to forget it
+    void device_removed_phy(std::shared_ptr<kis_tracked_device_base> device);
+
+    std::atomic<unsigned int> num_devices;
+
+	// Vector of tracked devices so we can iterate them quickly
+    std::vector<std::shared_ptr<kis_tracked_device_base> > tracked_vec;
 
     // Immutable vector, one entry per device; may never be sorted.  Devices
     // which are removed are set to 'null'.  Each position corresponds to the
@@ -366,7 +490,10 @@ protected:
     kis_mutex phy_mutex;
 
     // New multimutex primitive
-    kis_mutex devicelist_mutex;
+    kis_devicelist_mutex devicelist_mutex;
+
+    // Devices changed by update_common_device, by internal id
+    std::unique_ptr<device_change_log> change_log;
 
     kis_mutex storing_mutex;
     std::atomic<bool> devices_storing;
@@ -374,6 +501,9 @@ protected:
     // If we log devices to the kismet database...
     int databaselog_timer;
     time_t last_database_logged;
+    uint64_t database_log_cursor;
+    bool database_log_subscribed;
+    unsigned int database_log_generation;
     kis_mutex databaselog_mutex;
     bool databaselog_logging;
 
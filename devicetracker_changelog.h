@@ -0,0 +1,162 @@
+/*
+    This file is part of Kismet
+
+    Kismet is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Kismet is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Kismet; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef __DEVICETRACKER_CHANGELOG_H__
+#define __DEVICETRACKER_CHANGELOG_H__
+
+#include "config.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+// Sequenced log of changed devices.
+//
+// Every change is appended to a fixed ring with the next sequence number, without
+// taking a lock.  Subscribers keep their own cursor (the sequence number they will
+// read next) and collect the devices changed since it, so the cost of a poll scales
+// with the number of changed devices instead of the number of devices.
+//
+// A device is only appended again once some subscriber has read past its previous
+// entry; until then the old entry still tells every subscriber the device changed.
+// With no subscribers, each device is logged at most once.
+//
+// A subscriber which falls more than the size of the ring behind has lost entries,
+// and has to fall back to examining every device.
+class device_change_log {
+public:
+    device_change_log(size_t in_size) {
+        size_t sz = 1024;
+
+        while (sz < in_size)
+            sz <<= 1;
+
+        mask = sz - 1;
+        ring = std::unique_ptr<slot[]>(new slot[sz]);
+
+        for (size_t i = 0; i < sz; i++) {
+            ring[i].seq.store(0, std::memory_order_relaxed);
+            ring[i].id.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    device_change_log(const device_change_log&) = delete;
+    device_change_log& operator=(const device_change_log&) = delete;
+
+    // Record a change to a device; in_last is the per-device record of its most recent
+    // entry (sequence + 1, or 0 if never logged)
+    void record(std::atomic<uint64_t>& in_last, uint64_t in_id) {
+        auto last = in_last.load(std::memory_order_relaxed);
+
+        if (last != 0 && last - 1 >= consumed.load(std::memory_order_acquire))
+            return;
+
+        auto s = head.fetch_add(1, std::memory_order_relaxed);
+        auto& sl = ring[s & mask];
+
+        // Invalidate the slot before replacing the id, so a reader racing the write
+        // can't pair the old sequence with the new id
+        sl.seq.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        sl.id.store(in_id, std::memory_order_relaxed);
+        sl.seq.store(s + 1, std::memory_order_release);
+
+        in_last.store(s + 1, std::memory_order_relaxed);
+    }
+
+    // Start a new subscriber, returning its cursor; only changes after this point are
+    // reported to it
+    uint64_t subscribe() {
+        auto s = head.load(std::memory_order_acquire);
+        advance_consumed(s);
+        return s;
+    }
+
+    // Collect the ids of devices changed since the cursor, sorted and without duplicates,
+    // and advance the cursor past them.  Returns false if the cursor has fallen behind
+    // the ring; the cursor is then reset to the current position, and the caller must
+    // examine every device instead.
+    bool read(uint64_t& io_cursor, std::vector<uint64_t>& out_ids) {
+        auto h = head.load(std::memory_order_acquire);
+
+        if (io_cursor > h || h - io_cursor > mask + 1) {
+            io_cursor = subscribe();
+            return false;
+        }
+
+        out_ids.reserve(out_ids.size() + (h - io_cursor));
+
+        auto s = io_cursor;
+
+        for (; s < h; s++) {
+            auto& sl = ring[s & mask];
+
+            auto s1 = sl.seq.load(std::memory_order_acquire);
+            auto id = sl.id.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            auto s2 = sl.seq.load(std::memory_order_relaxed);
+
+            // Overwritten by a later entry
+            if (s1 > s + 1 || s2 > s + 1) {
+                io_cursor = subscribe();
+                return false;
+            }
+
+            // Claimed but not completely written yet; pick it up on the next read
+            if (s1 != s + 1 || s2 != s + 1)
+                break;
+
+            out_ids.push_back(id);
+        }
+
+        io_cursor = s;
+        advance_consumed(s);
+
+        std::sort(out_ids.begin(), out_ids.end());
+        out_ids.erase(std::unique(out_ids.begin(), out_ids.end()), out_ids.end());
+
+        return true;
+    }
+
+protected:
+    struct slot {
+        std::atomic<uint64_t> seq;
+        std::atomic<uint64_t> id;
+    };
+
+    void advance_consumed(uint64_t in_seq) {
+        auto c = consumed.load(std::memory_order_relaxed);
+
+        while (c < in_seq &&
+                !consumed.compare_exchange_weak(c, in_seq, std::memory_order_acq_rel))
+            ;
+    }
+
+    std::unique_ptr<slot[]> ring;
+    uint64_t mask;
+
+    // Next sequence number to be written
+    alignas(64) std::atomic<uint64_t> head{0};
+    // Furthest point any subscriber has read to
+    alignas(64) std::atomic<uint64_t> consumed{0};
+};
+
+#endif
+
@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <list>
 #include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -581,16 +582,40 @@ public:
         kis_internal_id = in_id;
     }
 
+    // Most recent entry of this device in the device change log
+    std::atomic<uint64_t>& get_change_seq() {
+        return change_seq;
+    }
+
+    // Per-device lock; held by the packet threads while they modify a device (see
+    // kis_devicelist_mutex), and while the device is serialized or examined by a 
+    // view, so that readers only contend with writers touching the same device
+    std::recursive_mutex& get_device_mutex() {
+        return device_mutex;
+    }
+
+    virtual void pre_serialize() override {
+        device_mutex.lock();
+    }
+
+    virtual void post_serialize() override {
+        device_mutex.unlock();
+    }
+
 protected:
     virtual void register_fields() override;
     virtual void reserve_fields(std::shared_ptr<tracker_element_map> e) override;
 
+    std::recursive_mutex device_mutex;
+
     // Unique, meaningless, incremental ID.  Practically, this is the order
     // in which kismet saw devices; it has no purpose other than a sorting
     // key which will always preserve order - time, etc, will not.  Used for breaking
     // up long-running queries.
     uint64_t kis_internal_id;
 
+    std::atomic<uint64_t> change_seq{0};
+
     // Unique key
     std::shared_ptr<tracker_element_device_key> key;
 
@@ -64,26 +64,18 @@ std::shared_ptr<tracker_element> device_tracker::multimac_endp_handler(shared_co
         macs.push_back(ma);
     }
 
-    // Duplicate the mac index so that we're 'immune' to things changing it under us; because we
-    // may have quite a number of devices in our query list, this is safest.
-    kis_unique_lock<kis_mutex> devlist_locker(get_devicelist_mutex(), std::defer_lock, "multimac_endp_handler");
-    devlist_locker.lock();
-    auto immutable_copy = 
-        std::multimap<mac_addr, std::shared_ptr<kis_tracked_device_base>>{tracked_mac_multimap};
-    devlist_locker.unlock();
-
-    // Pull all the devices out of the list
+    // Pull all the devices out of the sharded mac index; each lookup only locks the
+    // shard holding that mac
     for (auto m : macs) {
-        const auto& mi = immutable_copy.equal_range(m);
-        for (auto msi = mi.first; msi != mi.second; ++msi)
-            ret_devices->push_back(msi->second);
+        for (const auto& d : fetch_devices(m))
+            ret_devices->push_back(d);
     }
 
     return ret_devices;
 }
 
 std::shared_ptr<tracker_element> device_tracker::all_phys_endp_handler(shared_con con) {
-    kis_lock_guard<kis_mutex> lg(get_devicelist_mutex(), "all_phys_endp_handler");
+    kis_lock_guard<kis_devicelist_mutex> lg(get_devicelist_mutex(), "all_phys_endp_handler");
 
     auto ret_vec = std::make_shared<tracker_element_vector>();
 
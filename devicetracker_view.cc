@@ -18,6 +18,8 @@
 
 #include "config.h"
 
+#include <unordered_set>
+
 #include "devicetracker_view.h"
 #include "devicetracker.h"
 #include "devicetracker_component.h"
@@ -37,11 +39,15 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
     register_fields();
     reserve_fields(nullptr);
 
+    view_mutex.set_name(fmt::format("device_tracker_view {}", in_id));
+
     view_id->set(in_id);
     view_description->set(in_description);
 
     device_list = std::make_shared<tracker_element_vector>();
 
+    init_sort_index();
+
     auto httpd = Globalreg::fetch_mandatory_global_as<kis_net_beast_httpd>();
 
     auto uri = fmt::format("/devices/views/{}/devices", in_id);
@@ -49,7 +55,7 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
             std::make_shared<kis_net_web_function_endpoint>(
                 [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
                     return device_endpoint_handler(con);
-                }, devicetracker->get_devicelist_mutex()));
+                }));
 
     uri = fmt::format("/devices/views/{}/last-time/:timestamp/devices", in_id);
     fmt::print("{}\n", uri);
@@ -57,7 +63,7 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
                     return device_time_endpoint(con);
-                }, devicetracker->get_devicelist_mutex()));
+                }, devicetracker->get_devicelist_mutex().reader_mutex()));
 }
 
 device_tracker_view::device_tracker_view(const std::string& in_id, const std::string& in_description,
@@ -72,11 +78,15 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
     register_fields();
     reserve_fields(nullptr);
 
+    view_mutex.set_name(fmt::format("device_tracker_view {}", in_id));
+
     view_id->set(in_id);
     view_description->set(in_description);
 
     device_list = std::make_shared<tracker_element_vector>();
 
+    init_sort_index();
+
     auto httpd = Globalreg::fetch_mandatory_global_as<kis_net_beast_httpd>();
 
     auto uri = fmt::format("/devices/views/{}/devices", in_id);
@@ -84,14 +94,14 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
             std::make_shared<kis_net_web_function_endpoint>(
                 [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
                     return device_endpoint_handler(con);
-                }, devicetracker->get_devicelist_mutex()));
+                }));
 
     uri = fmt::format("/devices/views/{}/last-time/:timestamp/devices", in_id);
     httpd->register_route(uri, {"GET", "POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
                     return device_time_endpoint(con);
-                }, devicetracker->get_devicelist_mutex()));
+                }, devicetracker->get_devicelist_mutex().reader_mutex()));
 
     uri = fmt::format("/devices/views/{}/monitor", in_id);
     httpd->register_websocket_route(uri, httpd->RO_ROLE, {"ws"},
@@ -171,7 +181,7 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
 
                                                     do_device_work(worker);
                                                 } else if (!dev_k.get_error()) {
-                                                    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), "view ws monitor timer serialize lambda");
+                                                    kis_lock_guard<kis_devicelist_mutex> lk(devicetracker->get_devicelist_mutex(), "view ws monitor timer serialize lambda");
 
                                                     auto dev = fetch_device(dev_k);
                                                     if (dev != nullptr) {
@@ -182,7 +192,7 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
                                                         }
                                                     }
                                                 } else if (!dev_m.error()) {
-                                                    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), "view ws monitor timer serialize lambda");
+                                                    kis_lock_guard<kis_devicelist_mutex> lk(devicetracker->get_devicelist_mutex(), "view ws monitor timer serialize lambda");
 
                                                     auto mvec = devicetracker->fetch_devices(dev_m);
 
@@ -238,29 +248,393 @@ device_tracker_view::device_tracker_view(const std::string& in_id, const std::st
             std::make_shared<kis_net_web_function_endpoint>(
                 [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
                     return device_endpoint_handler(con);
-                }, devicetracker->get_devicelist_mutex()));
+                }));
 
     uri = fmt::format("/devices/views/{}last-time/:timestamp/devices", ss.str());
     httpd->register_route(uri, {"GET", "POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
                     return device_time_endpoint(con);
-                }, devicetracker->get_devicelist_mutex()));
+                }, devicetracker->get_devicelist_mutex().reader_mutex()));
+}
+
+void device_tracker_view::init_sort_index() {
+    sort_index_mutex.set_name(fmt::format("device_tracker_view {} sort_index", view_id->get()));
+
+    sort_index_fields = 
+        str_tokenize(Globalreg::globalreg->kismet_config->fetch_opt_dfl("view_sort_index", 
+                    "kismet.device.base.last_time,kismet.device.base.first_time,"
+                    "kismet.device.base.signal/kismet.common.signal.last_signal,"
+                    "kismet.device.base.packets.total,kismet.device.base.commonname"), ",");
+
+    // An empty option disables the indices
+    if (sort_index_fields.size() == 1 && sort_index_fields[0].length() == 0)
+        sort_index_fields.clear();
+
+    sort_index_idle = 
+        Globalreg::globalreg->kismet_config->fetch_opt_as<time_t>("view_sort_index_idle", 60);
+
+    sort_index_resolved = false;
+    sort_index_any_live = false;
+    sort_index_generation = 0;
+    sort_index_timer = -1;
+
+    if (sort_index_fields.size() == 0)
+        return;
+
+    auto timetracker = Globalreg::fetch_mandatory_global_as<time_tracker>();
+
+    sort_index_timer = 
+        timetracker->register_timer(std::chrono::seconds(1), true,
+                [this](int) -> int {
+                    maintain_sort_indices();
+                    return 1;
+                });
+}
+
+device_tracker_view::~device_tracker_view() {
+    if (sort_index_timer >= 0) {
+        auto timetracker = Globalreg::fetch_global_as<time_tracker>();
+
+        if (timetracker != nullptr)
+            timetracker->remove_timer(sort_index_timer);
+    }
+}
+
+device_tracker_view::sort_index_key 
+device_tracker_view::make_sort_index_key(const std::vector<int>& path, 
+        std::shared_ptr<kis_tracked_device_base> device) {
+    auto key = sort_index_key{false, 0, ""};
+
+    std::lock_guard<std::recursive_mutex> lk(device->get_device_mutex());
+
+    auto f = get_tracker_element_path(path, device);
+
+    if (f == nullptr)
+        return key;
+
+    key.present = true;
+
+    switch (f->get_type()) {
+        case tracker_type::tracker_int8:
+            key.num = std::static_pointer_cast<tracker_element_int8>(f)->get();
+            break;
+        case tracker_type::tracker_uint8:
+            key.num = std::static_pointer_cast<tracker_element_uint8>(f)->get();
+            break;
+        case tracker_type::tracker_int16:
+            key.num = std::static_pointer_cast<tracker_element_int16>(f)->get();
+            break;
+        case tracker_type::tracker_uint16:
+            key.num = std::static_pointer_cast<tracker_element_uint16>(f)->get();
+            break;
+        case tracker_type::tracker_int32:
+            key.num = std::static_pointer_cast<tracker_element_int32>(f)->get();
+            break;
+        case tracker_type::tracker_uint32:
+            key.num = std::static_pointer_cast<tracker_element_uint32>(f)->get();
+            break;
+        case tracker_type::tracker_int64:
+            key.num = std::static_pointer_cast<tracker_element_int64>(f)->get();
+            break;
+        case tracker_type::tracker_uint64:
+            key.num = std::static_pointer_cast<tracker_element_uint64>(f)->get();
+            break;
+        case tracker_type::tracker_float:
+            key.num = std::static_pointer_cast<tracker_element_float>(f)->get();
+            break;
+        case tracker_type::tracker_double:
+            key.num = std::static_pointer_cast<tracker_element_double>(f)->get();
+            break;
+        case tracker_type::tracker_ipv4_addr:
+            key.num = std::static_pointer_cast<tracker_element_ipv4_addr>(f)->get();
+            break;
+        case tracker_type::tracker_string:
+        case tracker_type::tracker_byte_array:
+            key.str = std::static_pointer_cast<tracker_element_string>(f)->get();
+            break;
+        case tracker_type::tracker_mac_addr:
+        case tracker_type::tracker_uuid:
+            key.str = f->as_string();
+            break;
+        default:
+            // Not sortable, everything compares equal
+            break;
+    }
+
+    return key;
+}
+
+bool device_tracker_view::sort_index_less(const sort_index_key& a, const sort_index_key& b) {
+    // Devices without the field sort first, as they do in the full sort
+    if (!b.present)
+        return false;
+
+    if (!a.present)
+        return true;
+
+    if (a.num != b.num)
+        return a.num < b.num;
+
+    return a.str < b.str;
+}
+
+bool device_tracker_view::sort_index_equal(const sort_index_key& a, const sort_index_key& b) {
+    return a.present == b.present && a.num == b.num && a.str == b.str;
+}
+
+device_tracker_view::sort_index_keyset 
+device_tracker_view::make_sort_index_keys(std::shared_ptr<kis_tracked_device_base> device) {
+    auto ret = sort_index_keyset{0, {}};
+
+    if (!sort_index_any_live)
+        return ret;
+
+    {
+        kis_lock_guard<kis_mutex> lk(sort_index_mutex, "device_tracker_view make_sort_index_keys");
+
+        ret.generation = sort_index_generation;
+
+        for (const auto& i : sort_indices) {
+            if (i->live)
+                ret.keys.push_back(std::make_pair(i.get(), sort_index_key{false, 0, ""}));
+        }
+    }
+
+    // The index paths never change once resolved, so they can be read unlocked
+    for (auto& k : ret.keys)
+        k.second = make_sort_index_key(k.first->path, device);
+
+    return ret;
+}
+
+void device_tracker_view::sort_index_place(std::shared_ptr<kis_tracked_device_base> device,
+        const sort_index_keyset& keys) {
+    if (!sort_index_any_live)
+        return;
+
+    kis_lock_guard<kis_mutex> lk(sort_index_mutex, "device_tracker_view sort_index_place");
+
+    // An index went live after the keys were made; the timer keys the device again
+    if (keys.generation != sort_index_generation) {
+        sort_index_pending.push_back(device);
+        return;
+    }
+
+    for (const auto& k : keys.keys) {
+        auto idx = k.first;
+
+        if (!idx->live)
+            continue;
+
+        auto pi = idx->positions.find(device->get_key());
+
+        if (pi != idx->positions.end()) {
+            if (sort_index_equal(pi->second->key, k.second))
+                continue;
+
+            idx->entries.erase(pi->second);
+            pi->second = idx->entries.insert(sort_index_entry{k.second, device});
+        } else {
+            idx->positions[device->get_key()] = idx->entries.insert(sort_index_entry{k.second, device});
+        }
+    }
+}
+
+void device_tracker_view::sort_index_erase(std::shared_ptr<kis_tracked_device_base> device) {
+    if (!sort_index_any_live)
+        return;
+
+    kis_lock_guard<kis_mutex> lk(sort_index_mutex, "device_tracker_view sort_index_erase");
+
+    for (const auto& i : sort_indices) {
+        auto pi = i->positions.find(device->get_key());
+
+        if (pi == i->positions.end())
+            continue;
+
+        i->entries.erase(pi->second);
+        i->positions.erase(pi);
+    }
+}
+
+void device_tracker_view::update_sort_keys(std::shared_ptr<kis_tracked_device_base> device) {
+    if (!sort_index_any_live)
+        return;
+
+    auto keys = make_sort_index_keys(device);
+
+    kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view update_sort_keys");
+
+    if (device_presence_map.find(device->get_key()) == device_presence_map.end())
+        return;
+
+    sort_index_place(device, keys);
+}
+
+bool device_tracker_view::fetch_sort_index_window(const std::vector<int>& path, bool in_reverse,
+        unsigned int& in_start, unsigned int in_len, size_t& out_total,
+        std::shared_ptr<tracker_element_vector> out_devices) {
+    kis_lock_guard<kis_mutex> lk(sort_index_mutex, "device_tracker_view fetch_sort_index_window");
+
+    if (!sort_index_resolved) {
+        for (const auto& f : sort_index_fields) {
+            auto rpath = tracker_element_summary(f).resolved_path;
+
+            if (rpath.size() == 0)
+                continue;
+
+            auto idx = std::make_unique<sort_index>();
+            idx->path = rpath;
+            idx->last_used = 0;
+            idx->live = false;
+            idx->built = false;
+            sort_indices.push_back(std::move(idx));
+        }
+
+        sort_index_resolved = true;
+    }
+
+    for (const auto& i : sort_indices) {
+        if (i->path != path)
+            continue;
+
+        // Unbuilt indices are picked up by the timer
+        i->last_used = time(0);
+
+        if (!i->built)
+            return false;
+
+        out_total = i->entries.size();
+
+        if (in_start >= out_total)
+            in_start = 0;
+
+        auto n = out_total - in_start;
+        if (in_len != 0 && in_len < n)
+            n = in_len;
+
+        out_devices->reserve(n);
+
+        if (!in_reverse) {
+            auto ei = std::next(i->entries.begin(), in_start);
+            for (size_t c = 0; c < n; c++, ++ei)
+                out_devices->push_back(ei->device);
+        } else {
+            auto ei = std::next(i->entries.rbegin(), in_start);
+            for (size_t c = 0; c < n; c++, ++ei)
+                out_devices->push_back(ei->device);
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+void device_tracker_view::maintain_sort_indices() {
+    auto now = time(0);
+
+    std::vector<sort_index *> building;
+
+    {
+        kis_lock_guard<kis_mutex> lk(sort_index_mutex, "device_tracker_view maintain_sort_indices");
+
+        bool any_live = false;
+
+        for (const auto& i : sort_indices) {
+            bool wanted = i->last_used != 0 && now - i->last_used < sort_index_idle;
+
+            if (i->live && !wanted) {
+                // Nobody has sorted by this recently
+                i->live = false;
+                i->built = false;
+                i->positions.clear();
+                i->entries.clear();
+            } else if (!i->live && wanted) {
+                building.push_back(i.get());
+            }
+
+            any_live |= i->live;
+        }
+
+        sort_index_any_live = any_live;
+    }
+
+    if (building.size()) {
+        std::vector<std::shared_ptr<kis_tracked_device_base>> snapshot;
+
+        {
+            // From here on the view updates maintain the new indices; devices already in
+            // the view are added from the snapshot
+            kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view maintain_sort_indices");
+            kis_lock_guard<kis_mutex> slk(sort_index_mutex, "device_tracker_view maintain_sort_indices");
+
+            for (auto idx : building)
+                idx->live = true;
+
+            sort_index_generation++;
+            sort_index_any_live = true;
+
+            snapshot.reserve(device_list->size());
+            for (const auto& d : *device_list)
+                snapshot.push_back(std::static_pointer_cast<kis_tracked_device_base>(d));
+        }
+
+        std::vector<std::vector<sort_index_key>> keys(building.size());
+
+        for (size_t b = 0; b < building.size(); b++) {
+            keys[b].reserve(snapshot.size());
+
+            for (const auto& d : snapshot)
+                keys[b].push_back(make_sort_index_key(building[b]->path, d));
+        }
+
+        kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view maintain_sort_indices");
+        kis_lock_guard<kis_mutex> slk(sort_index_mutex, "device_tracker_view maintain_sort_indices");
+
+        for (size_t b = 0; b < building.size(); b++) {
+            auto idx = building[b];
+
+            for (size_t d = 0; d < snapshot.size(); d++) {
+                const auto& dk = snapshot[d]->get_key();
+
+                // Skip devices which have left the view, or which an update already placed
+                if (device_presence_map.find(dk) == device_presence_map.end() ||
+                        idx->positions.find(dk) != idx->positions.end())
+                    continue;
+
+                idx->positions[dk] = idx->entries.insert(sort_index_entry{keys[b][d], snapshot[d]});
+            }
+
+            idx->built = true;
+        }
+    }
+
+    std::vector<std::shared_ptr<kis_tracked_device_base>> pending;
+
+    {
+        kis_lock_guard<kis_mutex> lk(sort_index_mutex, "device_tracker_view maintain_sort_indices");
+        pending.swap(sort_index_pending);
+    }
+
+    for (const auto& d : pending)
+        update_sort_keys(d);
 }
 
 void device_tracker_view::pre_serialize() {
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), kismet::retain_lock, "devicetracker_view serialize");
+    kis_lock_guard<kis_mutex> lk(view_mutex, kismet::retain_lock, "devicetracker_view serialize");
 }
 
 void device_tracker_view::post_serialize() {
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), std::adopt_lock, "devicetracker_view post_serialize");
+    kis_lock_guard<kis_mutex> lk(view_mutex, std::adopt_lock, "devicetracker_view post_serialize");
 }
 
 std::shared_ptr<tracker_element_vector> device_tracker_view::do_device_work(device_tracker_view_worker& worker) {
     // Make a copy of the vector in case the worker manipulates the original
     std::shared_ptr<tracker_element_vector> immutable_copy;
     {
-        kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex());
+        kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view device_work copy");
         immutable_copy = std::make_shared<tracker_element_vector>(device_list);
     }
 
@@ -271,7 +645,7 @@ std::shared_ptr<tracker_element_vector> device_tracker_view::do_readonly_device_
     // Make a copy of the vector in case the worker manipulates the original
     std::shared_ptr<tracker_element_vector> immutable_copy;
     {
-        kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex());
+        kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view device_work copy");
         immutable_copy = std::make_shared<tracker_element_vector>(device_list);
     }
 
@@ -283,9 +657,10 @@ std::shared_ptr<tracker_element_vector> device_tracker_view::do_device_work(devi
     auto ret = std::make_shared<tracker_element_vector>();
     ret->reserve(devices->size());
 
-    // Lock the whole device list for the duration; we may already hold this lock if we're inside the webserver
-    // but that's OK
-    kis_lock_guard<kis_mutex> dev_lg(devicetracker->get_devicelist_mutex(), 
+    // Lock the whole device list for the duration, as a writer; we may already hold this lock 
+    // if we're inside the webserver or a classifier but that's OK.  Matched devices are pinned
+    // because the caller may modify them.
+    kis_lock_guard<kis_devicelist_mutex> dev_lg(devicetracker->get_devicelist_mutex(), 
             "device_tracker_view do_device_work");
 
     std::for_each(devices->begin(), devices->end(),
@@ -297,10 +672,15 @@ std::shared_ptr<tracker_element_vector> device_tracker_view::do_device_work(devi
             auto dev = std::static_pointer_cast<kis_tracked_device_base>(val);
 
             bool m;
-            m = worker.match_device(dev);
+            {
+                std::lock_guard<std::recursive_mutex> dev_lk(dev->get_device_mutex());
+                m = worker.match_device(dev);
+            }
 
-            if (m) 
+            if (m) {
+                devicetracker->pin_device(dev);
                 ret->push_back(dev);
+            }
 
         });
 
@@ -314,18 +694,13 @@ std::shared_ptr<tracker_element_vector> device_tracker_view::do_device_work(devi
 std::shared_ptr<tracker_element_vector> device_tracker_view::do_readonly_device_work(device_tracker_view_worker& worker,
         std::shared_ptr<tracker_element_vector> devices) {
 
-    // read-only workers are currently disabled because it may not be reasonable to solve conflicts
-    // at the per-device level, use the locked worker.
-
-    return do_device_work(worker, devices);
+    // Read-only workers only lock each device as it is examined, so the packet threads
+    // are only blocked when they touch the device currently being matched.  The worker
+    // must not take the devicelist lock.
 
-#if 0
     auto ret = std::make_shared<tracker_element_vector>();
     ret->reserve(devices->size());
 
-    kis_lock_guard<kis_mutex> ul_devlist(devicetracker->get_devicelist_mutex(), 
-            "device_tracker_view do_readonly_device_work");
-
     std::for_each(devices->begin(), devices->end(),
             [&](shared_tracker_element val) {
 
@@ -334,7 +709,11 @@ std::shared_ptr<tracker_element_vector> device_tracker_view::do_readonly_device_
 
             auto dev = std::static_pointer_cast<kis_tracked_device_base>(val);
 
-            auto m = worker.match_device(dev);
+            bool m;
+            {
+                std::lock_guard<std::recursive_mutex> dev_lk(dev->get_device_mutex());
+                m = worker.match_device(dev);
+            }
 
             if (m) 
                 ret->push_back(dev);
@@ -346,16 +725,17 @@ std::shared_ptr<tracker_element_vector> device_tracker_view::do_readonly_device_
     worker.finalize();
 
     return ret;
-#endif
 }
 
 std::shared_ptr<kis_tracked_device_base> device_tracker_view::fetch_device(device_key in_key) {
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), "device_tracker_view fetch_device");
+    {
+        kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view fetch_device");
 
-    auto present_itr = device_presence_map.find(in_key);
+        auto present_itr = device_presence_map.find(in_key);
 
-    if (present_itr == device_presence_map.end() || present_itr->second == false)
-        return nullptr;
+        if (present_itr == device_presence_map.end() || present_itr->second == false)
+            return nullptr;
+    }
 
     return devicetracker->fetch_device(in_key);
 }
@@ -366,11 +746,16 @@ void device_tracker_view::new_device(std::shared_ptr<kis_tracked_device_base> de
         // kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex());
 
         if (new_cb(device)) {
+            auto keys = make_sort_index_keys(device);
+
+            kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view new_device");
+
             auto dpmi = device_presence_map.find(device->get_key());
 
             if (dpmi == device_presence_map.end()) {
                 device_presence_map[device->get_key()] = true;
                 device_list->push_back(device);
+                sort_index_place(device, keys);
             }
 
             list_sz->set(device_list->size());
@@ -388,6 +773,13 @@ void device_tracker_view::update_device(std::shared_ptr<kis_tracked_device_base>
     
     bool retain = update_cb(device);
 
+    auto keys = sort_index_keyset{0, {}};
+
+    if (retain)
+        keys = make_sort_index_keys(device);
+
+    kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view update_device");
+
     auto dpmi = device_presence_map.find(device->get_key());
 
     // If we're adding the device (or keeping it) and we don't have it tracked,
@@ -396,6 +788,13 @@ void device_tracker_view::update_device(std::shared_ptr<kis_tracked_device_base>
         device_list->push_back(device);
         device_presence_map[device->get_key()] = true;
         list_sz->set(device_list->size());
+        sort_index_place(device, keys);
+        return;
+    }
+
+    // Keeping the device; move it to match any changes
+    if (retain) {
+        sort_index_place(device, keys);
         return;
     }
 
@@ -410,6 +809,7 @@ void device_tracker_view::update_device(std::shared_ptr<kis_tracked_device_base>
         }
         device_presence_map.erase(dpmi);
         list_sz->set(device_list->size());
+        sort_index_erase(device);
         return;
     }
 }
@@ -417,6 +817,7 @@ void device_tracker_view::update_device(std::shared_ptr<kis_tracked_device_base>
 void device_tracker_view::remove_device(std::shared_ptr<kis_tracked_device_base> device) {
     // Only called under guard from devicetracker
     // kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex());
+    kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view remove_device");
 
     auto di = device_presence_map.find(device->get_key());
 
@@ -431,11 +832,14 @@ void device_tracker_view::remove_device(std::shared_ptr<kis_tracked_device_base>
         }
         
         list_sz->set(device_list->size());
+        sort_index_erase(device);
     }
 }
 
 void device_tracker_view::add_device_direct(std::shared_ptr<kis_tracked_device_base> device) {
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex());
+    auto keys = make_sort_index_keys(device);
+
+    kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view add_device_direct");
 
     auto di = device_presence_map.find(device->get_key());
 
@@ -444,12 +848,13 @@ void device_tracker_view::add_device_direct(std::shared_ptr<kis_tracked_device_b
 
     device_presence_map[device->get_key()] = true;
     device_list->push_back(device);
+    sort_index_place(device, keys);
 
     list_sz->set(device_list->size());
 }
 
 void device_tracker_view::remove_device_direct(std::shared_ptr<kis_tracked_device_base> device) {
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex());
+    kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view remove_device_direct");
 
     auto di = device_presence_map.find(device->get_key());
 
@@ -464,6 +869,7 @@ void device_tracker_view::remove_device_direct(std::shared_ptr<kis_tracked_devic
         }
         
         list_sz->set(device_list->size());
+        sort_index_erase(device);
     }
 }
 
@@ -659,10 +1065,32 @@ void device_tracker_view::device_endpoint_handler(std::shared_ptr<kis_net_beast_
     // Next vector we do work on
     auto next_work_vec = std::make_shared<tracker_element_vector>();
 
+    // Unfiltered requests ordered by an indexed column are windowed straight out of the 
+    // sort index, instead of copying and sorting the whole view
+    bool indexed = false;
+
+    if (in_order_column_num.length() && order_field.size() > 0 && timestamp_min == 0 &&
+            search_term.length() == 0 && regex.isNull()) {
+        size_t sz = 0;
+
+        indexed = fetch_sort_index_window(order_field, in_order_direction != 0,
+                in_window_start, in_window_len, sz, next_work_vec);
+
+        if (indexed) {
+            total_sz_elem->set(sz);
+            filtered_sz_elem->set(sz);
+            start_elem->set(in_window_start);
+            length_elem->set(next_work_vec->size());
+        }
+    }
+
     // Copy the entire vector list, under lock, to the next work vector; this makes it an independent copy
     // we can sort and manipulate
-    next_work_vec->set(device_list->begin(), device_list->end());
-    total_sz_elem->set(next_work_vec->size());
+    if (!indexed) {
+        kis_lock_guard<kis_mutex> lk(view_mutex, "device_tracker_view device_endpoint_handler");
+        next_work_vec->set(device_list->begin(), device_list->end());
+        total_sz_elem->set(next_work_vec->size());
+    }
 
     // If we have a time filter, apply that first, it's the fastest.
     if (timestamp_min > 0) {
@@ -700,49 +1128,60 @@ void device_tracker_view::device_endpoint_handler(std::shared_ptr<kis_net_beast_
         }
     }
 
-    // Apply the filtered length
-    filtered_sz_elem->set(next_work_vec->size());
+    tracker_element_vector::iterator si = next_work_vec->begin();
+    tracker_element_vector::iterator ei = next_work_vec->end();
 
-    // Slice from the beginning of the list
-    if (in_window_start >= next_work_vec->size()) 
-        in_window_start = 0;
+    // The index already returned just the window
+    if (!indexed) {
+        // Apply the filtered length
+        filtered_sz_elem->set(next_work_vec->size());
 
-    // Update the start
-    start_elem->set(in_window_start);
+        // Slice from the beginning of the list
+        if (in_window_start >= next_work_vec->size()) 
+            in_window_start = 0;
 
-    tracker_element_vector::iterator si = std::next(next_work_vec->begin(), in_window_start);
-    tracker_element_vector::iterator ei;
+        // Update the start
+        start_elem->set(in_window_start);
 
-    if (in_window_len + in_window_start >= next_work_vec->size() || in_window_len == 0)
-        ei = next_work_vec->end();
-    else
-        ei = std::next(next_work_vec->begin(), in_window_start + in_window_len);
+        si = std::next(next_work_vec->begin(), in_window_start);
 
-    // Update the end
-    length_elem->set(ei - si);
+        if (in_window_len + in_window_start >= next_work_vec->size() || in_window_len == 0)
+            ei = next_work_vec->end();
+        else
+            ei = std::next(next_work_vec->begin(), in_window_start + in_window_len);
 
-    if (in_order_column_num.length() && order_field.size() > 0) {
-        std::stable_sort(next_work_vec->begin(), next_work_vec->end(),
-                [&](shared_tracker_element a, shared_tracker_element b) -> bool {
-                shared_tracker_element fa;
-                shared_tracker_element fb;
+        // Update the end
+        length_elem->set(ei - si);
+    }
 
-                fa = get_tracker_element_path(order_field, a);
-                fb = get_tracker_element_path(order_field, b);
+    if (!indexed && in_order_column_num.length() && order_field.size() > 0) {
+        // Read each device's sort key once, under that device's lock, and sort the keys;
+        // comparing the live fields would lock two devices per comparison
+        std::vector<sort_index_entry> keyed;
+        keyed.reserve(next_work_vec->size());
 
-                if (fa == nullptr) 
-                    return in_order_direction == 0;
+        for (const auto& d : *next_work_vec) {
+            auto dev = std::static_pointer_cast<kis_tracked_device_base>(d);
+            keyed.push_back(sort_index_entry{make_sort_index_key(order_field, dev), dev});
+        }
 
-                if (fb == nullptr)
-                    return in_order_direction != 0;
+        std::stable_sort(keyed.begin(), keyed.end(),
+                [in_order_direction](const sort_index_entry& a, const sort_index_entry& b) -> bool {
+                    if (in_order_direction == 0)
+                        return sort_index_less(a.key, b.key);
 
-                if (in_order_direction == 0)
-                    return fast_sort_tracker_element_less(fa, fb);
+                    return sort_index_less(b.key, a.key);
+                });
 
-                return fast_sort_tracker_element_less(fb, fa);
-            });
+        for (size_t i = 0; i < keyed.size(); i++)
+            (*next_work_vec)[i] = keyed[i].device;
     }
 
+    // The summarized output references fields inside the devices, so the (windowed) output 
+    // is summarized and serialized under the devicelist lock
+    kis_lock_guard<kis_devicelist_mutex> lk(devicetracker->get_devicelist_mutex(), 
+            "device_tracker_view device_endpoint_handler serialize");
+
     // Summarize into the output element
     auto final_devices_vec = std::make_shared<tracker_element_vector>();
 
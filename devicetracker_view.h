@@ -22,6 +22,7 @@
 #include "config.h"
 
 #include <functional>
+#include <set>
 #include <unordered_map>
 
 #include "uuid.h"
@@ -77,7 +78,7 @@ public:
             const std::vector<std::string>& in_aux_path, 
             new_device_cb in_new_cb, updated_device_cb in_upd_cb);
 
-    virtual ~device_tracker_view() { }
+    virtual ~device_tracker_view();
 
     __ProxyGet(view_id, std::string, std::string, view_id);
     __ProxyGet(view_description, std::string, std::string, view_description);
@@ -111,6 +112,16 @@ public:
     virtual void add_device_direct(std::shared_ptr<kis_tracked_device_base> device);
     virtual void remove_device_direct(std::shared_ptr<kis_tracked_device_base> device);
 
+    // Called by the device tracker after a device in the view has been updated, so that
+    // its position in the sort indices follows its new values; must not be called with
+    // the view locked
+    void update_sort_keys(std::shared_ptr<kis_tracked_device_base> device);
+
+    // Does the view have any sort indices which need to follow device updates
+    bool sort_indices_live() const {
+        return sort_index_any_live.load(std::memory_order_relaxed);
+    }
+
 	// Look for an existing device record under read-only shared lock
     std::shared_ptr<kis_tracked_device_base> fetch_device(device_key in_key);
 
@@ -136,11 +147,97 @@ protected:
     new_device_cb new_cb;
     updated_device_cb update_cb;
 
+    // Protects the device list and presence map; the devices themselves are protected
+    // by their own locks
+    kis_mutex view_mutex;
+
     // Main vector of devices
     std::shared_ptr<tracker_element_vector> device_list;
     // Map of device presence in our list for fast reference during updates
     std::unordered_map<device_key, bool> device_presence_map;
 
+    // Sort indices for the columns the UI commonly orders by.  Each index holds the view 
+    // devices ordered by a copy of the sorted field, and is kept in order as devices are 
+    // added to, updated in, and removed from the view, so a sorted request only has to 
+    // walk to its window.  An index is built by the maintenance timer once a client sorts
+    // by it, and dropped once nobody has sorted by it for view_sort_index_idle seconds.
+    struct sort_index_key {
+        bool present;
+        double num;
+        std::string str;
+    };
+
+    struct sort_index_entry {
+        sort_index_key key;
+        std::shared_ptr<kis_tracked_device_base> device;
+    };
+
+    struct sort_index_entry_less {
+        bool operator()(const sort_index_entry& a, const sort_index_entry& b) const {
+            return sort_index_less(a.key, b.key);
+        }
+    };
+
+    typedef std::multiset<sort_index_entry, sort_index_entry_less> sort_index_set;
+
+    struct sort_index {
+        std::vector<int> path;
+        time_t last_used;
+        // Live indices are maintained by the view updates; built indices also hold every
+        // device which was in the view when they were built, and can serve requests
+        bool live;
+        bool built;
+        sort_index_set entries;
+        std::unordered_map<device_key, sort_index_set::iterator> positions;
+    };
+
+    // Keys of one device for each live index; the generation records which set of live
+    // indices they were made for
+    struct sort_index_keyset {
+        unsigned int generation;
+        std::vector<std::pair<sort_index *, sort_index_key>> keys;
+    };
+
+    static sort_index_key make_sort_index_key(const std::vector<int>& path,
+            std::shared_ptr<kis_tracked_device_base> device);
+    static bool sort_index_less(const sort_index_key& a, const sort_index_key& b);
+    static bool sort_index_equal(const sort_index_key& a, const sort_index_key& b);
+
+    // Key a device for the live indices; locks the device, so it must not be called with
+    // the view locked
+    sort_index_keyset make_sort_index_keys(std::shared_ptr<kis_tracked_device_base> device);
+
+    // Place a device in, or remove it from, the live indices; called with the view locked
+    void sort_index_place(std::shared_ptr<kis_tracked_device_base> device, 
+            const sort_index_keyset& keys);
+    void sort_index_erase(std::shared_ptr<kis_tracked_device_base> device);
+
+    // Copy a window of an index into out_devices and mark the index as in use; returns
+    // false if the path isn't indexed or the index hasn't been built yet.  in_start is 
+    // reset to 0 if it is past the end, as for unindexed requests.
+    bool fetch_sort_index_window(const std::vector<int>& path, bool in_reverse,
+            unsigned int& in_start, unsigned int in_len, size_t& out_total,
+            std::shared_ptr<tracker_element_vector> out_devices);
+
+    // Build newly requested indices, drop idle ones, and place devices keyed for an older
+    // set of live indices; from the sort index timer
+    void maintain_sort_indices();
+
+    // Protects the indices; taken after the view lock, and nothing locks a device while
+    // holding it
+    kis_mutex sort_index_mutex;
+    // Indexed field names from the config, resolved on first use
+    std::vector<std::string> sort_index_fields;
+    bool sort_index_resolved;
+    time_t sort_index_idle;
+    std::vector<std::unique_ptr<sort_index>> sort_indices;
+    std::atomic<bool> sort_index_any_live;
+    unsigned int sort_index_generation;
+    // Devices keyed for an older generation, waiting to be placed by the timer
+    std::vector<std::shared_ptr<kis_tracked_device_base>> sort_index_pending;
+    int sort_index_timer;
+
+    void init_sort_index();
     void device_endpoint_handler(std::shared_ptr<kis_net_beast_httpd_connection> con);
     std::shared_ptr<tracker_element> device_time_endpoint(std::shared_ptr<kis_net_beast_httpd_connection> con);
 
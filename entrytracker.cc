@@ -135,7 +135,7 @@ std::shared_ptr<tracker_element> entry_tracker::register_and_get_field(const std
                         field_iter->second->builder->get_type_as_string(),
                         field_iter->second->builder->get_signature()));
 
-        return field_iter->second->builder->clone_type();
+        return field_iter->second->builder->clone_shared();
     }
 
     auto definition = std::make_shared<reserved_field>();
@@ -148,7 +148,7 @@ std::shared_ptr<tracker_element> entry_tracker::register_and_get_field(const std
     field_name_map[in_name] = definition;
     field_id_map[definition->field_id] = definition;
 
-    return definition->builder->clone_type();
+    return definition->builder->clone_shared();
 }
 
 
@@ -196,7 +196,18 @@ std::shared_ptr<tracker_element> entry_tracker::get_shared_instance(int in_id) {
     if (iter == field_id_map.end()) 
         return nullptr;
 
-    return iter->second->builder->clone_type();
+    return iter->second->builder->clone_shared();
+}
+
+tracker_element *entry_tracker::get_builder(int in_id) {
+    kis_lock_guard<kis_mutex> lk(entry_mutex, "entry_tracker get_builder");
+
+    auto iter = field_id_map.find(in_id);
+
+    if (iter == field_id_map.end())
+        return nullptr;
+
+    return iter->second->builder.get();
 }
 
 std::shared_ptr<tracker_element> entry_tracker::get_shared_instance(const std::string& in_name) {
@@ -209,7 +220,7 @@ std::shared_ptr<tracker_element> entry_tracker::get_shared_instance(const std::s
     if (iter == field_name_map.end()) 
         return nullptr;
 
-    return iter->second->builder->clone_type();
+    return iter->second->builder->clone_shared();
 }
 
 void entry_tracker::register_serializer(const std::string& in_name, 
@@ -103,6 +103,10 @@ public:
     }
     std::shared_ptr<tracker_element> get_shared_instance(int in_id);
 
+    // Fetch the builder for a field id.  Builders are never removed once registered, so
+    // the pointer may be cached and cloned from without holding the entrytracker lock.
+    tracker_element *get_builder(int in_id);
+
     // Register a serializer for auto-serialization based on type
     void register_serializer(const std::string& type, std::shared_ptr<tracker_element_serializer> in_ser);
     void remove_serializer(const std::string& type);
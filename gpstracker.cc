@@ -54,7 +54,7 @@ gps_tracker::gps_tracker() :
 
     // Register the packet chain hook
     Globalreg::globalreg->packetchain->register_handler(&kis_gpspack_hook, this,
-            CHAINPOS_POSTCAP, -100);
+            CHAINPOS_POSTCAP, -100, "gpstracker kis_gpspack_hook");
 
     gps_prototypes_vec = std::make_shared<tracker_element_vector>();
     gps_instances_vec = std::make_shared<tracker_element_vector>();
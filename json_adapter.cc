@@ -26,7 +26,9 @@
 #include <algorithm>
 #include <string>
 #include <math.h>
+#include <charconv>
 #include <cmath>
+#include <sstream>
 
 #include "globalregistry.h"
 #include "trackedelement.h"
@@ -676,3 +678,542 @@ void json_adapter::pack(std::ostream &stream, shared_tracker_element e,
     }
 }
 
+
+namespace {
+
+// Output buffer for the direct packer; accumulates a large block before writing it
+// to the stream, so the stream (and whatever buffering sits behind it) sees a few large
+// writes instead of one per token
+class json_buffer {
+public:
+    json_buffer(std::ostream& stream) :
+        stream{stream} {
+        buf.reserve(flush_sz + 4096);
+    }
+
+    ~json_buffer() {
+        flush();
+    }
+
+    void flush() {
+        if (buf.size() > 0) {
+            stream.write(buf.data(), buf.size());
+            buf.clear();
+        }
+    }
+
+    void append(char c) {
+        buf.push_back(c);
+    }
+
+    void append(const char *data, size_t len) {
+        buf.append(data, len);
+
+        if (buf.size() >= flush_sz)
+            flush();
+    }
+
+    void append(const std::string& s) {
+        append(s.data(), s.length());
+    }
+
+    // Append a string with json escaping, copying unescaped runs as a block
+    void append_escaped(const std::string& s) {
+        size_t run = 0;
+
+        for (size_t i = 0; i < s.length(); i++) {
+            auto c = s[i];
+            const char *esc = nullptr;
+
+            switch (c) {
+                case '"':
+                    esc = "\\\"";
+                    break;
+                case '\\':
+                    esc = "\\\\";
+                    break;
+                case '\b':
+                    esc = "\\b";
+                    break;
+                case '\f':
+                    esc = "\\f";
+                    break;
+                case '\n':
+                    esc = "\\n";
+                    break;
+                case '\r':
+                    esc = "\\r";
+                    break;
+                case '\t':
+                    esc = "\\t";
+                    break;
+                default:
+                    if (c >= 0x00 && c <= 0x1f) {
+                        buf.append(s.data() + run, i - run);
+                        run = i + 1;
+
+                        char u[8];
+                        snprintf(u, sizeof(u), "\\u%04x", int(c));
+                        buf.append(u, 6);
+                    }
+                    continue;
+            }
+
+            buf.append(s.data() + run, i - run);
+            run = i + 1;
+            buf.append(esc, 2);
+        }
+
+        append(s.data() + run, s.length() - run);
+    }
+
+    template<typename N>
+    void append_int(N v) {
+        char b[24];
+        auto r = std::to_chars(b, b + sizeof(b), v);
+        append(b, r.ptr - b);
+    }
+
+    // Same formatting as float_numerical_string
+    void append_float(double v) {
+        if (std::isnan(v) || std::isinf(v)) {
+            append('0');
+            return;
+        }
+
+        if (floor(v) == v) {
+            append_int((long long) v);
+            return;
+        }
+
+        char b[64];
+#ifdef __cpp_lib_to_chars
+        auto r = std::to_chars(b, b + sizeof(b), v, std::chars_format::fixed, 6);
+        append(b, r.ptr - b);
+#else
+        auto l = snprintf(b, sizeof(b), "%f", v);
+        append(b, std::min<size_t>(l, sizeof(b) - 1));
+#endif
+    }
+
+protected:
+    static constexpr size_t flush_sz = 64 * 1024;
+
+    std::ostream& stream;
+    std::string buf;
+};
+
+// Escaped '"name": ' of a field id, cached per thread; field names never change once
+// registered
+const std::string& cached_field_name(int id, json_adapter::field_names names) {
+    thread_local std::vector<std::string> cache[2];
+    thread_local std::string uncached;
+
+    auto make_name = [id, names]() {
+        auto n = Globalreg::globalreg->entrytracker->get_field_name(id);
+
+        if (names == json_adapter::field_names::underscored)
+            n = multi_replace_all(n, ".", "_");
+
+        return "\"" + json_adapter::sanitize_string(n) + "\": ";
+    };
+
+    // Unregistered elements have no id to cache under
+    if (id < 0) {
+        uncached = make_name();
+        return uncached;
+    }
+
+    auto& c = cache[static_cast<unsigned int>(names)];
+
+    if (static_cast<size_t>(id) >= c.size())
+        c.resize(id + 1);
+
+    auto& r = c[id];
+
+    if (r.length() == 0)
+        r = make_name();
+
+    return r;
+}
+
+bool pack_direct_type(tracker_type t) {
+    switch (t) {
+        case tracker_type::tracker_string:
+        case tracker_type::tracker_int8:
+        case tracker_type::tracker_uint8:
+        case tracker_type::tracker_int16:
+        case tracker_type::tracker_uint16:
+        case tracker_type::tracker_int32:
+        case tracker_type::tracker_uint32:
+        case tracker_type::tracker_int64:
+        case tracker_type::tracker_uint64:
+        case tracker_type::tracker_float:
+        case tracker_type::tracker_double:
+        case tracker_type::tracker_mac_addr:
+        case tracker_type::tracker_uuid:
+        case tracker_type::tracker_key:
+        case tracker_type::tracker_ipv4_addr:
+        case tracker_type::tracker_byte_array:
+        case tracker_type::tracker_vector:
+        case tracker_type::tracker_map:
+        case tracker_type::tracker_int_map:
+        case tracker_type::tracker_mac_map:
+        case tracker_type::tracker_string_map:
+        case tracker_type::tracker_key_map:
+        case tracker_type::tracker_vector_double:
+        case tracker_type::tracker_vector_string:
+        case tracker_type::tracker_uuid_map:
+        case tracker_type::tracker_double_map:
+        case tracker_type::tracker_hashkey_map:
+        case tracker_type::tracker_double_map_double:
+        case tracker_type::tracker_pair_double:
+            return true;
+        default:
+            return false;
+    }
+}
+
+template<class M, class KF>
+void pack_direct_keyed_map(json_buffer& out, M *m, const KF& key_fn,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map,
+        json_adapter::field_names names);
+
+void pack_direct_element(json_buffer& out, shared_tracker_element e,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map,
+        json_adapter::field_names names) {
+
+    if (e == nullptr)
+        return;
+
+    auto t = e->get_type();
+
+    if (t == tracker_type::tracker_alias) {
+        auto ae = std::static_pointer_cast<tracker_element_alias>(e)->get();
+
+        if (ae == nullptr)
+            return;
+
+        t = ae->get_type();
+    }
+
+    // Anything else (such as placeholders) goes through the stream packer
+    if (!pack_direct_type(t)) {
+        std::stringstream ss;
+
+        if (names == json_adapter::field_names::underscored)
+            json_adapter::pack(ss, e, name_map, false, 0,
+                    [](const std::string& s) { 
+                        return multi_replace_all(s, ".", "_");
+                    });
+        else
+            json_adapter::pack(ss, e, name_map);
+
+        out.append(ss.str());
+        return;
+    }
+
+    serializer_scope s(e, name_map);
+
+    if (e->get_type() == tracker_type::tracker_alias) 
+        e = std::static_pointer_cast<tracker_element_alias>(e)->get();
+
+    switch (t) {
+        case tracker_type::tracker_string:
+            out.append('"');
+            out.append_escaped(std::static_pointer_cast<tracker_element_string>(e)->get());
+            out.append('"');
+            break;
+        case tracker_type::tracker_int8:
+            out.append_int(std::static_pointer_cast<tracker_element_int8>(e)->get());
+            break;
+        case tracker_type::tracker_uint8:
+            out.append_int(std::static_pointer_cast<tracker_element_uint8>(e)->get());
+            break;
+        case tracker_type::tracker_int16:
+            out.append_int(std::static_pointer_cast<tracker_element_int16>(e)->get());
+            break;
+        case tracker_type::tracker_uint16:
+            out.append_int(std::static_pointer_cast<tracker_element_uint16>(e)->get());
+            break;
+        case tracker_type::tracker_int32:
+            out.append_int(std::static_pointer_cast<tracker_element_int32>(e)->get());
+            break;
+        case tracker_type::tracker_uint32:
+            out.append_int(std::static_pointer_cast<tracker_element_uint32>(e)->get());
+            break;
+        case tracker_type::tracker_int64:
+            out.append_int(std::static_pointer_cast<tracker_element_int64>(e)->get());
+            break;
+        case tracker_type::tracker_uint64:
+            out.append_int(std::static_pointer_cast<tracker_element_uint64>(e)->get());
+            break;
+        case tracker_type::tracker_float:
+            out.append_float(std::static_pointer_cast<tracker_element_float>(e)->get());
+            break;
+        case tracker_type::tracker_double:
+            out.append_float(std::static_pointer_cast<tracker_element_double>(e)->get());
+            break;
+        case tracker_type::tracker_mac_addr:
+        case tracker_type::tracker_uuid:
+        case tracker_type::tracker_key:
+        case tracker_type::tracker_ipv4_addr:
+        case tracker_type::tracker_byte_array:
+            out.append('"');
+            out.append_escaped(e->as_string());
+            out.append('"');
+            break;
+        case tracker_type::tracker_vector: {
+            bool prepend_comma = false;
+
+            out.append('[');
+
+            for (const auto& i : *(std::static_pointer_cast<tracker_element_vector>(e))) {
+                if (i == nullptr)
+                    continue;
+
+                if (prepend_comma)
+                    out.append(',');
+                prepend_comma = true;
+
+                pack_direct_element(out, i, name_map, names);
+            }
+
+            out.append(']');
+            break;
+        }
+        case tracker_type::tracker_vector_double: {
+            bool prepend_comma = false;
+
+            out.append('[');
+
+            for (const auto& i : *(std::static_pointer_cast<tracker_element_vector_double>(e))) {
+                if (prepend_comma)
+                    out.append(',');
+                prepend_comma = true;
+
+                out.append_float(i);
+            }
+
+            out.append(']');
+            break;
+        }
+        case tracker_type::tracker_vector_string: {
+            bool prepend_comma = false;
+
+            out.append('[');
+
+            for (const auto& i : *(std::static_pointer_cast<tracker_element_vector_string>(e))) {
+                if (prepend_comma)
+                    out.append(',');
+                prepend_comma = true;
+
+                out.append('"');
+                out.append_escaped(i);
+                out.append('"');
+            }
+
+            out.append(']');
+            break;
+        }
+        case tracker_type::tracker_pair_double: {
+            const auto& p = std::static_pointer_cast<tracker_element_pair_double>(e)->get();
+
+            out.append('[');
+            out.append_float(std::get<0>(p));
+            out.append(", ", 2);
+            out.append_float(std::get<1>(p));
+            out.append(']');
+            break;
+        }
+        case tracker_type::tracker_map: {
+            auto m = std::static_pointer_cast<tracker_element_map>(e);
+            auto as_vector = m->as_vector();
+            auto as_key_vector = m->as_key_vector();
+            bool prepend_comma = false;
+
+            out.append((as_vector || as_key_vector) ? '[' : '{');
+
+            for (const auto& i : *m) {
+                if (i.second == nullptr)
+                    continue;
+
+                if (prepend_comma)
+                    out.append(',');
+                prepend_comma = true;
+
+                if (!as_vector) {
+                    std::string tname;
+                    bool named = false;
+
+                    if (name_map != nullptr) {
+                        auto nmi = name_map->find(i.second);
+                        if (nmi != name_map->end() && nmi->second->rename.length() != 0) {
+                            tname = nmi->second->rename;
+                            named = true;
+                        }
+                    }
+
+                    if (!named) {
+                        auto it = i.second->get_type();
+
+                        if (it == tracker_type::tracker_placeholder_missing)
+                            tname = std::static_pointer_cast<tracker_element_placeholder>(i.second)->get_name();
+                        else if (it == tracker_type::tracker_alias)
+                            tname = std::static_pointer_cast<tracker_element_alias>(i.second)->get_alias_name();
+
+                        // Plain fields use the cached name
+                        if (tname.length() == 0) {
+                            out.append(cached_field_name(i.first, names));
+                            pack_direct_element(out, i.second, name_map, names);
+                            continue;
+                        }
+                    }
+
+                    if (names == json_adapter::field_names::underscored)
+                        tname = multi_replace_all(tname, ".", "_");
+
+                    out.append('"');
+                    out.append_escaped(tname);
+                    out.append("\": ", 3);
+                }
+
+                pack_direct_element(out, i.second, name_map, names);
+            }
+
+            out.append((as_vector || as_key_vector) ? ']' : '}');
+            break;
+        }
+        case tracker_type::tracker_int_map:
+            pack_direct_keyed_map(out, std::static_pointer_cast<tracker_element_int_map>(e).get(),
+                    [&out](const int& k) {
+                        out.append('"');
+                        out.append_int(k);
+                        out.append('"');
+                    }, name_map, names);
+            break;
+        case tracker_type::tracker_mac_map:
+            pack_direct_keyed_map(out, std::static_pointer_cast<tracker_element_mac_map>(e).get(),
+                    [&out](const mac_addr& k) {
+                        out.append('"');
+                        out.append(k.mac_to_string());
+                        out.append('"');
+                    }, name_map, names);
+            break;
+        case tracker_type::tracker_string_map:
+            pack_direct_keyed_map(out, std::static_pointer_cast<tracker_element_string_map>(e).get(),
+                    [&out](const std::string& k) {
+                        out.append('"');
+                        out.append_escaped(k);
+                        out.append('"');
+                    }, name_map, names);
+            break;
+        case tracker_type::tracker_key_map:
+            pack_direct_keyed_map(out, std::static_pointer_cast<tracker_element_device_key_map>(e).get(),
+                    [&out](const device_key& k) {
+                        std::stringstream ss;
+                        ss << k;
+                        out.append('"');
+                        out.append(ss.str());
+                        out.append('"');
+                    }, name_map, names);
+            break;
+        case tracker_type::tracker_uuid_map:
+            pack_direct_keyed_map(out, std::static_pointer_cast<tracker_element_uuid_map>(e).get(),
+                    [&out](const uuid& k) {
+                        out.append('"');
+                        out.append(k.uuid_to_string());
+                        out.append('"');
+                    }, name_map, names);
+            break;
+        case tracker_type::tracker_double_map:
+            // Double keys are handled as strings in json
+            pack_direct_keyed_map(out, std::static_pointer_cast<tracker_element_double_map>(e).get(),
+                    [&out](const double& k) {
+                        out.append('"');
+                        out.append_float(k);
+                        out.append('"');
+                    }, name_map, names);
+            break;
+        case tracker_type::tracker_hashkey_map:
+            pack_direct_keyed_map(out, std::static_pointer_cast<tracker_element_hashkey_map>(e).get(),
+                    [&out](const size_t& k) {
+                        out.append('"');
+                        out.append_int(k);
+                        out.append('"');
+                    }, name_map, names);
+            break;
+        case tracker_type::tracker_double_map_double: {
+            auto m = std::static_pointer_cast<tracker_element_double_map_double>(e);
+            auto as_vector = m->as_vector();
+            auto as_key_vector = m->as_key_vector();
+            bool prepend_comma = false;
+
+            out.append((as_vector || as_key_vector) ? '[' : '{');
+
+            for (const auto& i : *m) {
+                if (prepend_comma)
+                    out.append(',');
+                prepend_comma = true;
+
+                if (!as_vector) {
+                    out.append('"');
+                    out.append_float(i.first);
+                    out.append('"');
+
+                    if (!as_key_vector)
+                        out.append(": ", 2);
+                }
+
+                if (!as_key_vector)
+                    out.append_float(i.second);
+            }
+
+            out.append((as_vector || as_key_vector) ? ']' : '}');
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+template<class M, class KF>
+void pack_direct_keyed_map(json_buffer& out, M *m, const KF& key_fn,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map,
+        json_adapter::field_names names) {
+    auto as_vector = m->as_vector();
+    auto as_key_vector = m->as_key_vector();
+    bool prepend_comma = false;
+
+    out.append((as_vector || as_key_vector) ? '[' : '{');
+
+    for (const auto& i : *m) {
+        if (i.second == nullptr && !as_key_vector)
+            continue;
+
+        if (prepend_comma)
+            out.append(',');
+        prepend_comma = true;
+
+        if (!as_vector) {
+            key_fn(i.first);
+
+            if (!as_key_vector)
+                out.append(": ", 2);
+        }
+
+        if (!as_key_vector)
+            pack_direct_element(out, i.second, name_map, names);
+    }
+
+    out.append((as_vector || as_key_vector) ? ']' : '}');
+}
+
+}
+
+void json_adapter::pack_direct(std::ostream& stream, shared_tracker_element e,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map,
+        field_names names) {
+    json_buffer out(stream);
+    pack_direct_element(out, e, name_map, names);
+}
@@ -41,6 +41,19 @@ void pack(std::ostream &stream, shared_tracker_element e,
 std::string sanitize_string(const std::string& in) noexcept;
 std::size_t sanitize_extra_space(const std::string& in) noexcept;
 
+// Field naming used by the direct packer; the ELK style replaces dots with underscores
+enum class field_names {
+    dotted = 0, underscored = 1
+};
+
+// Direct packer, producing the same output as the compact (non-pretty) pack().  Output is
+// built in a contiguous buffer and written to the stream in large blocks; the escaped 
+// "name": of each field is cached per field id, and numbers are formatted in place instead
+// of through temporary strings.
+void pack_direct(std::ostream& stream, shared_tracker_element e,
+        std::shared_ptr<tracker_element_serializer::rename_map> name_map = nullptr,
+        field_names names = field_names::dotted);
+
 class serializer : public tracker_element_serializer {
 public:
     serializer() :
@@ -48,7 +61,7 @@ public:
 
     virtual int serialize(shared_tracker_element in_elem, std::ostream &stream,
             std::shared_ptr<rename_map> name_map = nullptr) override {
-        pack(stream, in_elem, name_map);
+        pack_direct(stream, in_elem, name_map);
         return 0;
     }
 };
@@ -79,17 +92,13 @@ public:
                 if (i == nullptr)
                     continue;
 
-                json_adapter::pack(stream, i, name_map, false, 0,
-                        [](const std::string& s) { 
-                            return multi_replace_all(s, ".", "_");
-                        });
+                json_adapter::pack_direct(stream, i, name_map, 
+                        json_adapter::field_names::underscored);
                 stream << "\n";
             }
         } else {
-            json_adapter::pack(stream, in_elem, name_map, false, 0,
-                    [](const std::string& s) { 
-                    return multi_replace_all(s, ".", "_");
-                    });
+            json_adapter::pack_direct(stream, in_elem, name_map, 
+                    json_adapter::field_names::underscored);
             stream << "\n";
         }
 
@@ -114,11 +123,11 @@ public:
 
         if (in_elem->get_type() == tracker_type::tracker_vector) {
             for (auto i : *(std::static_pointer_cast<tracker_element_vector>(in_elem))) {
-                json_adapter::pack(stream, i, name_map);
+                json_adapter::pack_direct(stream, i, name_map);
                 stream << "\n";
             }
         } else {
-            json_adapter::pack(stream, in_elem, name_map);
+            json_adapter::pack_direct(stream, in_elem, name_map);
             stream << "\n";
         }
 
@@ -20,6 +20,7 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/stat.h>
 
 #include "globalregistry.h"
 #include "json_adapter.h"
@@ -28,6 +29,7 @@
 #include "messagebus.h"
 #include "packetchain.h"
 #include "sqlite3_cpp11.h"
+#include "xxhash.h"
 
 kis_database_logfile::kis_database_logfile():
     kis_logfile(shared_log_builder(NULL)), 
@@ -36,8 +38,6 @@ kis_database_logfile::kis_database_logfile():
 
     eventbus = Globalreg::fetch_mandatory_global_as<event_bus>();
 
-    transaction_mutex.set_name("kis_database_logfile_transaction");
-
     std::shared_ptr<packet_chain> packetchain =
         Globalreg::fetch_mandatory_global_as<packet_chain>("PACKETCHAIN");
 
@@ -59,6 +59,48 @@ kis_database_logfile::kis_database_logfile():
 
     message_evt_id = 0;
     alert_evt_id = 0;
+
+    device_format = KISMETDB_DEVICE_FORMAT_JSON;
+
+    writer_shutdown = false;
+    write_queue_max = 0;
+    commit_rows = 0;
+    commit_interval = std::chrono::milliseconds(0);
+
+    packet_stmt = data_stmt = snapshot_stmt = alert_stmt = nullptr;
+    message_stmt = device_stmt = datasource_stmt = packet_body_stmt = nullptr;
+
+    stat_records_written = 0;
+    stat_max_queue_depth = 0;
+    stat_commits = 0;
+    stat_last_commit_rows = 0;
+    stat_last_commit_usec = 0;
+    stat_max_commit_usec = 0;
+    stat_total_commit_usec = 0;
+    stat_producer_waits = 0;
+
+    journal_wal = false;
+    log_synchronous = "NORMAL";
+    checkpoint_interval = std::chrono::seconds(0);
+    checkpoint_shutdown = false;
+    rotate_size = 0;
+    rotate_age = 0;
+    db_open_time = 0;
+    log_generation = 0;
+
+    stat_checkpoints = 0;
+    stat_last_checkpoint_usec = 0;
+    stat_max_checkpoint_usec = 0;
+    stat_last_checkpoint_frames = 0;
+    stat_wal_frames = 0;
+    stat_rotations = 0;
+
+    packet_indexes = packet_index_policy::live;
+
+    packet_dedup = false;
+    stat_dedup_packets = 0;
+    stat_dedup_bodies = 0;
+    stat_dedup_bytes_saved = 0;
 }
 
 kis_database_logfile::~kis_database_logfile() {
@@ -83,44 +125,69 @@ bool kis_database_logfile::open_log(std::string in_path) {
     auto timetracker = 
         Globalreg::fetch_mandatory_global_as<time_tracker>("TIMETRACKER");
 
-    bool dbr = database_open(in_path);
+    write_queue_max =
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("kis_log_write_queue_max", 65536);
+    commit_rows =
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("kis_log_commit_rows", 10000);
+    commit_interval = std::chrono::milliseconds(
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("kis_log_commit_interval", 10000));
 
-    if (!dbr) {
-        _MSG_FATAL("Unable to open KismetDB log at '{}'; check that the directory exists "
-                "and that you have write permissions to it.", in_path);
-        Globalreg::globalreg->fatal_condition = true;
-        return false;
-    }
+    if (commit_rows == 0)
+        commit_rows = 1;
 
-    dbr = database_upgrade_db();
+    journal_wal =
+        Globalreg::globalreg->kismet_config->fetch_opt_bool("kis_log_journal_wal", true);
+    checkpoint_interval = std::chrono::seconds(
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("kis_log_checkpoint_interval", 30));
 
-    if (!dbr) {
-        _MSG_FATAL("Unable to update existing KismetDB log at {}", in_path);
-        Globalreg::globalreg->fatal_condition = true;
-        return false;
-    }
+    log_synchronous = 
+        str_upper(Globalreg::globalreg->kismet_config->fetch_opt_dfl("kis_log_synchronous", "normal"));
 
-    sqlite3_exec(db, "PRAGMA journal_mode=PERSIST", NULL, NULL, NULL);
-    
-    // Go into transactional mode where we only commit every 10 seconds
-    sqlite3_exec(db, "BEGIN TRANSACTION", NULL, NULL, NULL);
+    if (log_synchronous != "OFF" && log_synchronous != "NORMAL" && log_synchronous != "FULL") {
+        _MSG_ERROR("Unknown kis_log_synchronous '{}', expected 'off', 'normal', or 'full'; "
+                "using 'normal'.", log_synchronous);
+        log_synchronous = "NORMAL";
+    }
 
-    transaction_timer = 
-        timetracker->register_timer(SERVER_TIMESLICES_SEC * 10, NULL, 1,
-            [this](int) -> int {
+    rotate_size = 
+        Globalreg::globalreg->kismet_config->fetch_opt_ulong("kis_log_rotate_size", 0) * 1024 * 1024;
+    rotate_age =
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("kis_log_rotate_age", 0);
 
-            // local_locker dblock(&ds_mutex, "kismetdb transaction_timer");
+    packet_dedup =
+        Globalreg::globalreg->kismet_config->fetch_opt_bool("kis_log_packet_dedup", false);
 
-            in_transaction_sync = true;
+    auto packet_index_opt =
+        str_lower(Globalreg::globalreg->kismet_config->fetch_opt_dfl("kis_log_packet_index", "live"));
 
-            sqlite3_exec(db, "END TRANSACTION", NULL, NULL, NULL);
-            sqlite3_exec(db, "BEGIN TRANSACTION", NULL, NULL, NULL);
+    if (packet_index_opt == "close") {
+        packet_indexes = packet_index_policy::close;
+    } else if (packet_index_opt == "none") {
+        packet_indexes = packet_index_policy::none;
+    } else {
+        if (packet_index_opt != "live")
+            _MSG_ERROR("Unknown kis_log_packet_index '{}', expected 'live', 'close', or 'none'; "
+                    "using 'live'.", packet_index_opt);
+        packet_indexes = packet_index_policy::live;
+    }
 
-            in_transaction_sync = false;
+    if (Globalreg::globalreg->kismet_config->fetch_opt_bool("kis_log_ephemeral_dangerous", false)) {
+        // An ephemeral log is unlinked as soon as it is opened, which would leave the
+        // WAL behind, and there's nothing to rotate
+        journal_wal = false;
+        rotate_size = 0;
+        rotate_age = 0;
+    }
 
-            return 1;
-        });
+    if (!open_database(in_path)) {
+        _MSG_FATAL("Unable to open KismetDB log at '{}'; check that the directory exists "
+                "and that you have write permissions to it.", in_path);
+        Globalreg::globalreg->fatal_condition = true;
+        return false;
+    }
 
+    writer_shutdown = false;
+    writer_thread = std::thread([this]() { writer_thread_fn(); });
 
     set_int_log_path(in_path);
 
@@ -146,9 +213,16 @@ bool kis_database_logfile::open_log(std::string in_path) {
                     auto data_delete =
                         fmt::format("DELETE FROM data WHERE ts_sec < {}",
                                 time(0) - packet_timeout);
+                    // Bodies are refreshed as they're used, so any body older than this
+                    // has no packets left
+                    auto body_delete =
+                        fmt::format("DELETE FROM packet_bodies WHERE ts_sec < {}",
+                                time(0) - packet_timeout - KISMETDB_DEDUP_REFRESH);
 
+                    kis_lock_guard<kis_mutex> lk(ds_mutex, "kismetdb timeout");
                     sqlite3_exec(db, pkt_delete.c_str(), NULL, NULL, NULL);
                     sqlite3_exec(db, data_delete.c_str(), NULL, NULL, NULL);
+                    sqlite3_exec(db, body_delete.c_str(), NULL, NULL, NULL);
 
                     return 1;
                     });
@@ -168,6 +242,7 @@ bool kis_database_logfile::open_log(std::string in_path) {
                         fmt::format("DELETE FROM devices WHERE last_time < {}",
                                 time(0) - device_timeout);
 
+                    kis_lock_guard<kis_mutex> lk(ds_mutex, "kismetdb timeout");
                     sqlite3_exec(db, pkt_delete.c_str(), NULL, NULL, NULL);
 
                     return 1;
@@ -188,6 +263,7 @@ bool kis_database_logfile::open_log(std::string in_path) {
                         fmt::format("DELETE FROM messages WHERE ts_sec < {}",
                                 time(0) - message_timeout);
 
+                    kis_lock_guard<kis_mutex> lk(ds_mutex, "kismetdb timeout");
                     sqlite3_exec(db, pkt_delete.c_str(), NULL, NULL, NULL);
 
                     return 1;
@@ -208,6 +284,7 @@ bool kis_database_logfile::open_log(std::string in_path) {
                         fmt::format("DELETE FROM alerts WHERE ts_sec < {}",
                                 time(0) - alert_timeout);
 
+                    kis_lock_guard<kis_mutex> lk(ds_mutex, "kismetdb timeout");
                     sqlite3_exec(db, pkt_delete.c_str(), NULL, NULL, NULL);
 
                     return 1;
@@ -228,6 +305,7 @@ bool kis_database_logfile::open_log(std::string in_path) {
                         fmt::format("DELETE FROM snapshots WHERE ts_sec < {}",
                                 time(0) - snapshot_timeout);
 
+                    kis_lock_guard<kis_mutex> lk(ds_mutex, "kismetdb timeout");
                     sqlite3_exec(db, pkt_delete.c_str(), NULL, NULL, NULL);
 
                     return 1;
@@ -239,6 +317,20 @@ bool kis_database_logfile::open_log(std::string in_path) {
     log_duplicate_packets =
         Globalreg::globalreg->kismet_config->fetch_opt_bool("kis_log_duplicate_packets", true);
 
+    auto device_format_opt = 
+        str_lower(Globalreg::globalreg->kismet_config->fetch_opt_dfl("kis_log_device_format", "json"));
+
+    if (device_format_opt == "compressed") {
+        device_format = KISMETDB_DEVICE_FORMAT_JSON_DEFLATE;
+        _MSG_INFO("Compressing device records in the Kismet database log; use kismetdb_dump_devices "
+                "to extract them.");
+    } else {
+        if (device_format_opt != "json")
+            _MSG_ERROR("Unknown kis_log_device_format '{}', expected 'json' or 'compressed'; "
+                    "logging devices as JSON.", device_format_opt);
+        device_format = KISMETDB_DEVICE_FORMAT_JSON;
+    }
+
     auto httpd = Globalreg::fetch_mandatory_global_as<kis_net_beast_httpd>();
 
     httpd->register_route("/logging/kismetdb/pcap/drop", {"POST"}, httpd->LOGON_ROLE, {"cmd"},
@@ -265,6 +357,12 @@ bool kis_database_logfile::open_log(std::string in_path) {
                     return pcapng_endp_handler(con);
                 }));
 
+    httpd->register_route("/logging/kismetdb/stats", {"GET"}, httpd->RO_ROLE, {"json"},
+            std::make_shared<kis_net_web_tracked_endpoint>(
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    return writer_stats_endp_handler();
+                }));
+
     device_mac_filter = 
         std::make_shared<class_filter_mac_addr>("kismetdb_devices", 
                 "Kismetdb device MAC filtering");
@@ -407,7 +505,7 @@ bool kis_database_logfile::open_log(std::string in_path) {
         packet_handler_id = 
             packetchain->register_handler([this, this_ref](kis_packet *packet) -> int {
                     return log_packet(packet);
-                }, CHAINPOS_LOGGING, -100);
+                }, CHAINPOS_LOGGING, -100, "kismetdb log_packet");
     } else {
         packet_handler_id = -1;
         _MSG_INFO("Packets will not be saved to the Kismet database log.");
@@ -420,21 +518,26 @@ void kis_database_logfile::close_log() {
     // We have to shut down inside lock but not cancel packet handlers while 
     // the various handlers might be holding locks
 
+    // Stop accepting new records and let the writer drain what's already queued; the 
+    // writer may already have stopped on its own after a write error
+    db_enabled = false;
+    writer_shutdown = true;
+
+    if (writer_thread.joinable() && writer_thread.get_id() != std::this_thread::get_id())
+        writer_thread.join();
+
     {
         kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb close_log");
         db_lock_with_sync_check(dblock, return);
 
         set_int_log_open(false);
-        db_enabled = false;
-
-        // End the transaction
-        sqlite3_exec(db, "END TRANSACTION", NULL, NULL, NULL);
 
-        sqlite3_exec(db, "PRAGMA journal_mode=DELETE", NULL, NULL, NULL);
-        sqlite3_exec(db, "BEGIN_EXCLUSIVE", NULL, NULL, NULL);
-        sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+        // Anything still queued was logged after the writer went away
+        kismetdb_record *r;
+        while (write_queue.try_dequeue(r))
+            delete r;
 
-        database_close();
+        close_database();
     }
 
     // Kill the eventbus subs
@@ -453,7 +556,6 @@ void kis_database_logfile::close_log() {
         Globalreg::fetch_global_as<time_tracker>();
 
     if (timetracker != NULL) {
-        timetracker->remove_timer(transaction_timer);
         timetracker->remove_timer(packet_timeout_timer);
         timetracker->remove_timer(alert_timeout_timer);
         timetracker->remove_timer(device_timeout_timer);
@@ -499,6 +601,8 @@ int kis_database_logfile::database_upgrade_db() {
 
         "device BLOB, " // Actual device
 
+        "device_format INT, " // Encoding of the device record, see kismetdb_device_codec.h
+
         "UNIQUE(phyname, devmac) ON CONFLICT REPLACE)";
 
     r = sqlite3_exec(db, sql.c_str(),
@@ -546,7 +650,10 @@ int kis_database_logfile::database_upgrade_db() {
 
         "tags TEXT,"  // Arbitrary packet tags
 
-        "datarate REAL" // datarate, if known
+        "datarate REAL, " // datarate, if known
+
+        "body_hash TEXT, " // Shared frame body, if the packet was deduplicated
+        "body_offset INT"
         ")";
 
     r = sqlite3_exec(db, sql.c_str(),
@@ -559,6 +666,26 @@ int kis_database_logfile::database_upgrade_db() {
         return -1;
     }
 
+    sql =
+        "CREATE TABLE packet_bodies ("
+
+        "hash TEXT PRIMARY KEY, " // Hash of the body, referenced by packets.body_hash
+
+        "ts_sec INT, " // Last time the body was stored
+
+        "body BLOB"
+        ")";
+
+    r = sqlite3_exec(db, sql.c_str(),
+            [] (void *, int, char **, char **) -> int { return 0; }, NULL, &sErrMsg);
+
+    if (r != SQLITE_OK) {
+        _MSG("Kismet log was unable to create packet body table in " + ds_dbfile + ": " +
+                std::string(sErrMsg), MSGFLAG_ERROR);
+        close_log();
+        return -1;
+    }
+
     sql =
         "CREATE TABLE data ("
 
@@ -704,97 +831,55 @@ void kis_database_logfile::handle_message(std::shared_ptr<tracked_message> msg)
     if (!db_enabled)
         return;
 
-    int r;
-    std::string sql;
-    sqlite3_stmt *msg_stmt;
-    const char *msg_pz;
-
     std::shared_ptr<kis_gps_packinfo> loc;
 
     if (gpstracker != nullptr) 
         loc = std::shared_ptr<kis_gps_packinfo>(gpstracker->get_best_location());
 
-    sql =
-        "INSERT INTO messages "
-        "(ts_sec, "
-        "lat, lon, "
-        "msgtype, message) "
-        "VALUES (?, ?, ?, ?, ?)";
-
-    kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb handle_message");
-    db_lock_with_sync_check(dblock, return);
+    auto rec = new kismetdb_record(kismetdb_message_record{});
+    auto& r = std::get<kismetdb_message_record>(*rec);
 
-    r = sqlite3_prepare(db, sql.c_str(), sql.length(), &msg_stmt, &msg_pz);
-
-    if (r != SQLITE_OK) {
-        _MSG("kis_database_logfile unable to prepare database insert for messages in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return;
-    }
-
-    unsigned int spos = 1;
-
-    sqlite3_bind_int64(msg_stmt, spos++, time(0));
+    r.ts_sec = time(0);
 
     if (loc != nullptr && loc->fix >= 2) {
-        sqlite3_bind_double(msg_stmt, spos++, loc->lat);
-        sqlite3_bind_double(msg_stmt, spos++, loc->lon);
+        r.lat = loc->lat;
+        r.lon = loc->lon;
     } else {
-        sqlite3_bind_double(msg_stmt, spos++, 0);
-        sqlite3_bind_double(msg_stmt, spos++, 0);
+        r.lat = 0;
+        r.lon = 0;
     }
 
-    std::string msgtype;
-
     if (msg->get_flags() & MSGFLAG_INFO)
-        msgtype = "INFO";
+        r.msgtype = "INFO";
     else if (msg->get_flags() & MSGFLAG_ERROR)
-        msgtype = "ERROR";
+        r.msgtype = "ERROR";
     else if (msg->get_flags() & MSGFLAG_DEBUG)
-        msgtype = "DEBUG";
+        r.msgtype = "DEBUG";
     else if (msg->get_flags() & MSGFLAG_FATAL)
-        msgtype = "FATAL";
+        r.msgtype = "FATAL";
 
-    sqlite3_bind_text(msg_stmt, spos++, msgtype.c_str(), msgtype.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(msg_stmt, spos++, msg->get_message().c_str(), msg->get_message().length(), SQLITE_TRANSIENT);
+    r.message = msg->get_message();
 
-    if (sqlite3_step(msg_stmt) != SQLITE_DONE) {
-        close_log();
-        _MSG_ERROR("Unable to insert message into {}: {}", ds_dbfile, sqlite3_errmsg(db));
-    }
-
-    sqlite3_finalize(msg_stmt);
+    queue_record(rec);
 }
 
 int kis_database_logfile::log_device(std::shared_ptr<kis_tracked_device_base> d) {
     if (!db_enabled)
         return 0;
 
-    std::string sql;
-
-    std::string phystring;
-    std::string macstring;
-    std::string typestring;
-    std::string keystring;
-
     if (d == nullptr)
         return 0;
 
+    // Only this device needs to be consistent, so hold the per-device lock instead
+    // of blocking the packet threads with the devicelist lock
+    std::lock_guard<std::recursive_mutex> lg_dev(d->get_device_mutex());
+
     if (device_mac_filter->filter(d->get_macaddr(), d->get_phyid()))
         return 0;
 
-    phystring = d->get_phyname();
-    macstring = d->get_macaddr().mac_to_string();
-    typestring = d->get_type_string();
-    keystring = d->get_key().as_string();
-
-    int spos = 1;
-
     std::stringstream sstr;
 
     {
-        kis_lock_guard<kis_mutex> lg_dl(devicetracker->get_devicelist_mutex(), "database_logfile::log_device");
         int r = Globalreg::globalreg->entrytracker->serialize("json", sstr, d, nullptr);
 
         if (r < 0) {
@@ -803,80 +888,33 @@ int kis_database_logfile::log_device(std::shared_ptr<kis_tracked_device_base> d)
         }
     }
 
-    std::string streamstring = sstr.str();
-
-    int r;
-    sqlite3_stmt *device_stmt;
-    const char *device_pz;
-
-    sql =
-        "INSERT INTO devices "
-        "(first_time, last_time, devkey, phyname, devmac, strongest_signal, "
-        "min_lat, min_lon, max_lat, max_lon, "
-        "avg_lat, avg_lon, "
-        "bytes_data, type, device) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
-
-    kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb log_device");
-    db_lock_with_sync_check(dblock, return);
-
-    r = sqlite3_prepare(db, sql.c_str(), sql.length(), &device_stmt, &device_pz);
-
-    if (r != SQLITE_OK) {
-        _MSG("kis_database_logfile unable to prepare database insert for devices in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return -1;
-    }
+    auto rec = new kismetdb_record(kismetdb_device_record{});
+    auto& r = std::get<kismetdb_device_record>(*rec);
 
-    sqlite3_bind_int64(device_stmt, spos++, d->get_first_time());
-    sqlite3_bind_int64(device_stmt, spos++, d->get_last_time());
-    sqlite3_bind_text(device_stmt, spos++, keystring.c_str(), 
-            keystring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(device_stmt, spos++, phystring.c_str(), 
-            phystring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(device_stmt, spos++, macstring.c_str(), 
-            macstring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_int(device_stmt, spos++, d->get_signal_data()->get_max_signal());
+    r.first_time = d->get_first_time();
+    r.last_time = d->get_last_time();
+    r.devkey = d->get_key().as_string();
+    r.phyname = d->get_phyname();
+    r.devmac = d->get_macaddr();
+    r.strongest_signal = d->get_signal_data()->get_max_signal();
 
     if (d->get_tracker_location() != NULL) {
-        sqlite3_bind_double(device_stmt, spos++, 
-                d->get_location()->get_min_loc()->get_lat());
-        sqlite3_bind_double(device_stmt, spos++,
-                d->get_location()->get_min_loc()->get_lon());
-        sqlite3_bind_double(device_stmt, spos++,
-                d->get_location()->get_max_loc()->get_lat());
-        sqlite3_bind_double(device_stmt, spos++,
-                d->get_location()->get_max_loc()->get_lon());
-        sqlite3_bind_double(device_stmt, spos++,
-                d->get_location()->get_avg_loc()->get_lat());
-        sqlite3_bind_double(device_stmt, spos++,
-                d->get_location()->get_avg_loc()->get_lon());
+        r.min_lat = d->get_location()->get_min_loc()->get_lat();
+        r.min_lon = d->get_location()->get_min_loc()->get_lon();
+        r.max_lat = d->get_location()->get_max_loc()->get_lat();
+        r.max_lon = d->get_location()->get_max_loc()->get_lon();
+        r.avg_lat = d->get_location()->get_avg_loc()->get_lat();
+        r.avg_lon = d->get_location()->get_avg_loc()->get_lon();
     } else {
         // Empty location
-        sqlite3_bind_double(device_stmt, spos++, 0);
-        sqlite3_bind_double(device_stmt, spos++, 0);
-        sqlite3_bind_double(device_stmt, spos++, 0);
-        sqlite3_bind_double(device_stmt, spos++, 0);
-        sqlite3_bind_double(device_stmt, spos++, 0);
-        sqlite3_bind_double(device_stmt, spos++, 0);
+        r.min_lat = r.min_lon = r.max_lat = r.max_lon = r.avg_lat = r.avg_lon = 0;
     }
 
-    sqlite3_bind_int64(device_stmt, spos++, d->get_datasize());
-    sqlite3_bind_text(device_stmt, spos++, typestring.c_str(), 
-            typestring.length(), SQLITE_TRANSIENT);
-
-    sqlite3_bind_blob(device_stmt, spos++, streamstring.c_str(), 
-            streamstring.length(), SQLITE_TRANSIENT);
-
-    if (sqlite3_step(device_stmt) != SQLITE_DONE) {
-        _MSG("kis_database_logfile unable to insert device in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return -1;
-    }
+    r.bytes_data = d->get_datasize();
+    r.type = d->get_type_string();
+    r.device = sstr.str();
 
-    sqlite3_finalize(device_stmt);
+    queue_record(rec);
 
     return 1;
 }
@@ -887,12 +925,6 @@ int kis_database_logfile::log_packet(kis_packet *in_pack) {
     }
 
     std::string phystring;
-    std::string macstring;
-    std::string deststring;
-    std::string transstring;
-    std::string keystring;
-    std::string sourceuuidstring;
-    double frequency;
 
     if (in_pack->duplicate && !log_duplicate_packets)
         return 0;
@@ -921,133 +953,70 @@ int kis_database_logfile::log_packet(kis_packet *in_pack) {
 
     kis_phy_handler *phyh = NULL;
 
-    // Packets are no longer a 1:1 with a device
-    keystring = "0";
-
-    if (commoninfo != NULL) {
+    if (commoninfo != NULL) 
         phyh = devicetracker->fetch_phy_handler(commoninfo->phyid);
-        macstring = commoninfo->source.mac_to_string();
-        deststring = commoninfo->dest.mac_to_string();
-        transstring = commoninfo->transmitter.mac_to_string();
-        frequency = commoninfo->freq_khz;
-    } else {
-        macstring = "00:00:00:00:00:00";
-        deststring = "00:00:00:00:00:00";
-        transstring = "00:00:00:00:00:00";
-        frequency = 0;
-    }
 
     if (phyh == NULL)
         phystring = "Unknown";
     else
         phystring = phyh->fetch_phy_name();
 
-
-    if (datasrc != NULL) {
-        sourceuuidstring = datasrc->ref_source->get_source_uuid().uuid_to_string();
-    } else {
-        sourceuuidstring = "00000000-0000-0000-0000-000000000000";
-    }
-
     // Log into the PACKET table if we're a loggable packet (ie, have a link frame)
     if (chunk != nullptr) {
-        int r;
-        std::string sql;
-        sqlite3_stmt *packet_stmt;
-        const char *packet_pz;
-
-        sql =
-            "INSERT INTO packets "
-            "(ts_sec, ts_usec, phyname, "
-            "sourcemac, destmac, transmac, devkey, frequency, " 
-            "lat, lon, alt, speed, heading, "
-            "packet_len, signal, "
-            "datasource, "
-            "dlt, packet, "
-            "error, tags, datarate) "
-            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
-
-        kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb log_packet");
-        db_lock_with_sync_check(dblock, return -1);
-
-
-        r = sqlite3_prepare(db, sql.c_str(), sql.length(), &packet_stmt, &packet_pz);
-
-        if (r != SQLITE_OK) {
-            _MSG("kis_database_logfile unable to prepare database insert for packets in " +
-                    ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-            close_log();
-            return -1;
+        auto rec = new kismetdb_record(kismetdb_packet_record{});
+        auto& r = std::get<kismetdb_packet_record>(*rec);
+
+        r.ts_sec = in_pack->ts.tv_sec;
+        r.ts_usec = in_pack->ts.tv_usec;
+        r.phyname = phystring;
+
+        if (commoninfo != NULL) {
+            r.sourcemac = commoninfo->source;
+            r.destmac = commoninfo->dest;
+            r.transmac = commoninfo->transmitter;
+            r.frequency = commoninfo->freq_khz;
+        } else {
+            r.sourcemac = mac_addr("00:00:00:00:00:00");
+            r.destmac = mac_addr("00:00:00:00:00:00");
+            r.transmac = mac_addr("00:00:00:00:00:00");
+            r.frequency = 0;
         }
 
-        int sql_pos = 1;
-
-        sqlite3_bind_int64(packet_stmt, sql_pos++, in_pack->ts.tv_sec);
-        sqlite3_bind_int64(packet_stmt, sql_pos++, in_pack->ts.tv_usec);
-
-        sqlite3_bind_text(packet_stmt, sql_pos++, phystring.c_str(), phystring.length(), SQLITE_TRANSIENT);
-        sqlite3_bind_text(packet_stmt, sql_pos++, macstring.c_str(), macstring.length(), SQLITE_TRANSIENT);
-        sqlite3_bind_text(packet_stmt, sql_pos++, deststring.c_str(), deststring.length(), SQLITE_TRANSIENT);
-        sqlite3_bind_text(packet_stmt, sql_pos++, transstring.c_str(), transstring.length(), SQLITE_TRANSIENT);
-        sqlite3_bind_text(packet_stmt, sql_pos++, keystring.c_str(), keystring.length(), SQLITE_TRANSIENT);
-        sqlite3_bind_double(packet_stmt, sql_pos++, frequency);
-
+        r.gps = gpsdata != NULL;
         if (gpsdata != NULL) {
-            sqlite3_bind_double(packet_stmt, sql_pos++, gpsdata->lat);
-            sqlite3_bind_double(packet_stmt, sql_pos++, gpsdata->lon);
-            sqlite3_bind_double(packet_stmt, sql_pos++, gpsdata->alt);
-            sqlite3_bind_double(packet_stmt, sql_pos++, gpsdata->speed);
-            sqlite3_bind_double(packet_stmt, sql_pos++, gpsdata->heading);
-        } else {
-            sqlite3_bind_double(packet_stmt, sql_pos++, 0);
-            sqlite3_bind_double(packet_stmt, sql_pos++, 0);
-            sqlite3_bind_double(packet_stmt, sql_pos++, 0);
-            sqlite3_bind_double(packet_stmt, sql_pos++, 0);
-            sqlite3_bind_double(packet_stmt, sql_pos++, 0);
+            r.lat = gpsdata->lat;
+            r.lon = gpsdata->lon;
+            r.alt = gpsdata->alt;
+            r.speed = gpsdata->speed;
+            r.heading = gpsdata->heading;
         }
 
-        sqlite3_bind_int64(packet_stmt, sql_pos++, chunk->length);
+        r.packet_len = chunk->length;
 
         if (radioinfo != nullptr) {
-            sqlite3_bind_int(packet_stmt, sql_pos++, radioinfo->signal_dbm);
+            r.signal = radioinfo->signal_dbm;
+            r.datarate = radioinfo->datarate / 10;
         } else {
-            sqlite3_bind_int(packet_stmt, sql_pos++, 0);
+            r.signal = 0;
+            r.datarate = 0;
         }
 
-        sqlite3_bind_text(packet_stmt, sql_pos++, sourceuuidstring.c_str(), 
-                sourceuuidstring.length(), SQLITE_TRANSIENT);
+        if (datasrc != NULL) 
+            r.datasource = datasrc->ref_source->get_source_uuid();
 
-        sqlite3_bind_int(packet_stmt, sql_pos++, chunk->dlt);
-        sqlite3_bind_blob(packet_stmt, sql_pos++, (const char *) chunk->data, chunk->length, 0);
+        r.dlt = chunk->dlt;
+        r.packet.assign((const char *) chunk->data, chunk->length);
+        r.error = in_pack->error;
 
-        sqlite3_bind_int(packet_stmt, sql_pos++, in_pack->error);
-
-        std::stringstream tagstream;
         bool space_needed = false;
-
-        for (auto tag : in_pack->tag_vec) {
+        for (const auto& tag : in_pack->tag_vec) {
             if (space_needed)
-                tagstream << " ";
+                r.tags += " ";
             space_needed = true;
-            tagstream << tag;
+            r.tags += tag;
         }
 
-        auto str = tagstream.str();
-        sqlite3_bind_text(packet_stmt, sql_pos++, str.c_str(), tagstream.str().length(), SQLITE_TRANSIENT);
-
-        if (radioinfo != nullptr)
-            sqlite3_bind_double(packet_stmt, sql_pos++, radioinfo->datarate / 10);
-        else
-            sqlite3_bind_double(packet_stmt, sql_pos++, 0);
-
-        if (sqlite3_step(packet_stmt) != SQLITE_DONE) {
-            _MSG("kis_database_logfile unable to insert packet in " +
-                    ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-            close_log();
-            return -1;
-        }
-
-        sqlite3_finalize(packet_stmt);
+        queue_record(rec);
     }
 
     // If the packet has a metablob record, log that; if the packet ONLY has meta data we should only get a 'data'
@@ -1076,73 +1045,28 @@ int kis_database_logfile::log_data(kis_gps_packinfo *gps, struct timeval tv,
     if (!db_enabled)
         return 0;
 
-    std::string macstring = devmac.mac_to_string();
-    std::string uuidstring = datasource_uuid.uuid_to_string();
-
-    int r;
-    std::string sql;
-    sqlite3_stmt *data_stmt;
-    const char *data_pz;
-
-    sql =
-        "INSERT INTO data "
-        "(ts_sec, ts_usec, "
-        "phyname, devmac, "
-        "lat, lon, alt, speed, heading, "
-        "datasource, "
-        "type, json) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)";
+    auto rec = new kismetdb_record(kismetdb_data_record{});
+    auto& r = std::get<kismetdb_data_record>(*rec);
 
-    kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb log_data");
-    db_lock_with_sync_check(dblock, return -1);
-
-    r = sqlite3_prepare(db, sql.c_str(), sql.length(), &data_stmt, &data_pz);
-
-    if (r != SQLITE_OK) {
-        _MSG("kis_database_logfile unable to prepare database insert for data in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return -1;
-    }
-
-    sqlite3_reset(data_stmt);
-    sqlite3_clear_bindings(data_stmt);
-
-    int sql_pos = 1;
-
-    sqlite3_bind_int64(data_stmt, sql_pos++, tv.tv_sec);
-    sqlite3_bind_int64(data_stmt, sql_pos++, tv.tv_usec);
-
-    sqlite3_bind_text(data_stmt, sql_pos++, phystring.c_str(), phystring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(data_stmt, sql_pos++, macstring.c_str(), macstring.length(), SQLITE_TRANSIENT);
+    r.ts_sec = tv.tv_sec;
+    r.ts_usec = tv.tv_usec;
+    r.phyname = phystring;
+    r.devmac = devmac;
 
+    r.gps = gps != NULL;
     if (gps != NULL) {
-        sqlite3_bind_double(data_stmt, sql_pos++, gps->lat);
-        sqlite3_bind_double(data_stmt, sql_pos++, gps->lon);
-        sqlite3_bind_double(data_stmt, sql_pos++, gps->alt);
-        sqlite3_bind_double(data_stmt, sql_pos++, gps->speed);
-        sqlite3_bind_double(data_stmt, sql_pos++, gps->heading);
-    } else {
-        sqlite3_bind_double(data_stmt, sql_pos++, 0);
-        sqlite3_bind_double(data_stmt, sql_pos++, 0);
-        sqlite3_bind_double(data_stmt, sql_pos++, 0);
-        sqlite3_bind_double(data_stmt, sql_pos++, 0);
-        sqlite3_bind_double(data_stmt, sql_pos++, 0);
+        r.lat = gps->lat;
+        r.lon = gps->lon;
+        r.alt = gps->alt;
+        r.speed = gps->speed;
+        r.heading = gps->heading;
     }
 
-    sqlite3_bind_text(data_stmt, sql_pos++, uuidstring.c_str(), uuidstring.length(), SQLITE_TRANSIENT);
-
-    sqlite3_bind_text(data_stmt, sql_pos++, type.data(), type.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(data_stmt, sql_pos++, json.data(), json.length(), SQLITE_TRANSIENT);
-
-    if (sqlite3_step(data_stmt) != SQLITE_DONE) {
-        _MSG("kis_database_logfile unable to insert data in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return -1;
-    }
+    r.datasource = datasource_uuid;
+    r.type = type;
+    r.json = json;
 
-    sqlite3_finalize(data_stmt);
+    queue_record(rec);
 
     return 1;
 }
@@ -1170,201 +1094,815 @@ int kis_database_logfile::log_datasource(shared_tracker_element in_datasource) {
     std::shared_ptr<kis_datasource> ds =
         std::static_pointer_cast<kis_datasource>(in_datasource);
 
-    std::string uuidstring = ds->get_source_uuid().uuid_to_string();
-    std::string typestring = ds->get_source_builder()->get_source_type();
-    std::string defstring = ds->get_source_definition();
-    std::string namestring = ds->get_source_name();
-    std::string intfstring = ds->get_source_interface();
+    auto rec = new kismetdb_record(kismetdb_datasource_record{});
+    auto& r = std::get<kismetdb_datasource_record>(*rec);
 
-    std::stringstream ss;
-    std::string jsonstring;
+    r.uuid = ds->get_source_uuid().uuid_to_string();
+    r.typestring = ds->get_source_builder()->get_source_type();
+    r.definition = ds->get_source_definition();
+    r.name = ds->get_source_name();
+    r.interface = ds->get_source_interface();
 
+    std::stringstream ss;
     json_adapter::pack(ss, in_datasource, NULL);
-    jsonstring = ss.str();
+    r.json = ss.str();
 
-    int r;
-    std::string sql;
-    sqlite3_stmt *datasource_stmt;
-    const char *datasource_pz;
+    queue_record(rec);
 
-    sql =
-        "INSERT INTO datasources "
-        "(uuid, "
-        "typestring, definition, "
-        "name, interface, "
-        "json) "
-        "VALUES (?, ?, ?, ?, ?, ?)";
-
-    kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb log_datasource");
-    db_lock_with_sync_check(dblock, return -1);
+    return 1;
+}
 
-    r = sqlite3_prepare(db, sql.c_str(), sql.length(), &datasource_stmt, &datasource_pz);
+int kis_database_logfile::log_alert(std::shared_ptr<tracked_alert> in_alert) {
+    if (!db_enabled)
+        return 0;
 
-    if (r != SQLITE_OK) {
-        _MSG("kis_database_logfile unable to prepare database insert for datasources in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return -1;
-    }
+    auto rec = new kismetdb_record(kismetdb_alert_record{});
+    auto& r = std::get<kismetdb_alert_record>(*rec);
 
-    sqlite3_bind_text(datasource_stmt, 1, uuidstring.data(), uuidstring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(datasource_stmt, 2, typestring.data(), typestring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(datasource_stmt, 3, defstring.data(), defstring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(datasource_stmt, 4, namestring.data(), namestring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(datasource_stmt, 5, intfstring.data(), intfstring.length(), SQLITE_TRANSIENT);
+    // Break the double timestamp into two integers
+    double intpart, fractpart;
+    fractpart = modf(in_alert->get_timestamp(), &intpart);
 
-    sqlite3_bind_blob(datasource_stmt, 6, jsonstring.data(), jsonstring.length(), SQLITE_TRANSIENT);
+    r.ts_sec = intpart;
+    r.ts_usec = fractpart * 1000000;
+    r.phyname = devicetracker->fetch_phy_name(in_alert->get_phy());
+    r.devmac = in_alert->get_transmitter_mac();
 
-    if (sqlite3_step(datasource_stmt) != SQLITE_DONE) {
-        _MSG("kis_database_logfile unable to insert datasource in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return -1;
+    if (in_alert->get_location()->get_valid()) {
+        r.lat = in_alert->get_location()->get_lat();
+        r.lon = in_alert->get_location()->get_lon();
+    } else {
+        r.lat = 0;
+        r.lon = 0;
     }
 
-    sqlite3_finalize(datasource_stmt);
+    r.header = in_alert->get_header();
+
+    std::stringstream ss;
+    json_adapter::pack(ss, in_alert, NULL);
+    r.json = ss.str();
+
+    queue_record(rec);
 
     return 1;
 }
 
-int kis_database_logfile::log_alert(std::shared_ptr<tracked_alert> in_alert) {
+int kis_database_logfile::log_snapshot(kis_gps_packinfo *gps, struct timeval tv,
+        std::string snaptype, std::string json) {
+
     if (!db_enabled)
         return 0;
 
-    std::string macstring = in_alert->get_transmitter_mac().mac_to_string();
-    std::string phystring = devicetracker->fetch_phy_name(in_alert->get_phy());
-    std::string headerstring = in_alert->get_header();
+    std::shared_ptr<kis_gps_packinfo> loc;
 
-    std::stringstream ss;
-    std::string jsonstring;
+    if (gps == nullptr && gpstracker != nullptr) 
+        loc = std::shared_ptr<kis_gps_packinfo>(gpstracker->get_best_location());
 
-    json_adapter::pack(ss, in_alert, NULL);
-    jsonstring = ss.str();
+    auto rec = new kismetdb_record(kismetdb_snapshot_record{});
+    auto& r = std::get<kismetdb_snapshot_record>(*rec);
 
-    // Break the double timestamp into two integers
-    double intpart, fractpart;
-    fractpart = modf(in_alert->get_timestamp(), &intpart);
+    r.ts_sec = tv.tv_sec;
+    r.ts_usec = tv.tv_usec;
 
-    int r;
-    std::string sql;
-    sqlite3_stmt *alert_stmt;
-    const char *alert_pz;
+    if (gps != NULL) {
+        r.lat = gps->lat;
+        r.lon = gps->lon;
+    } else if (loc != nullptr && loc->fix >= 2) {
+        r.lat = loc->lat;
+        r.lon = loc->lon;
+    } else {
+        r.lat = 0;
+        r.lon = 0;
+    }
 
-    sql =
-        "INSERT INTO alerts "
-        "(ts_sec, ts_usec, phyname, devmac, "
-        "lat, lon, "
-        "header, "
-        "json) "
-        "VALUES (?, ?, ?, ?, ?, ?, ?, ?)";
+    r.snaptype = snaptype;
+    r.json = json;
 
-    kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb log_alert");
-    db_lock_with_sync_check(dblock, return -1);
+    queue_record(rec);
 
-    r = sqlite3_prepare(db, sql.c_str(), sql.length(), &alert_stmt, &alert_pz);
+    return 1;
+}
 
-    if (r != SQLITE_OK) {
-        _MSG("kis_database_logfile unable to prepare database insert for alerts in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
-        return -1;
+void kis_database_logfile::queue_record(kismetdb_record *record) {
+    // Hold the logging thread back when the writer can't keep up, instead of growing 
+    // the queue without bound.  Messages raised by the writer itself are never held.
+    if (write_queue_max > 0 && write_queue.size_approx() >= write_queue_max &&
+            std::this_thread::get_id() != writer_thread.get_id()) {
+        stat_producer_waits++;
+
+        while (write_queue.size_approx() >= write_queue_max && db_enabled && !writer_shutdown)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
     }
 
-    sqlite3_bind_int64(alert_stmt, 1, intpart);
-    sqlite3_bind_int64(alert_stmt, 2, fractpart * 1000000);
+    write_queue.enqueue(record);
 
-    sqlite3_bind_text(alert_stmt, 3, phystring.c_str(), phystring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(alert_stmt, 4, macstring.c_str(), macstring.length(), SQLITE_TRANSIENT);
+    uint64_t depth = write_queue.size_approx();
+    auto max_depth = stat_max_queue_depth.load();
+    while (depth > max_depth && !stat_max_queue_depth.compare_exchange_weak(max_depth, depth))
+        ;
+}
 
-    if (in_alert->get_location()->get_valid()) {
-        sqlite3_bind_double(alert_stmt, 5, in_alert->get_location()->get_lat());
-        sqlite3_bind_double(alert_stmt, 6, in_alert->get_location()->get_lon());
+void kis_database_logfile::writer_thread_fn() {
+    thread_set_process_name("kismetdb writer");
+
+    std::vector<kismetdb_record *> batch(256);
+    size_t uncommitted = 0;
+    auto last_commit = std::chrono::steady_clock::now();
+    auto last_rotate_check = last_commit;
+    bool failed = false;
+
+    while (true) {
+        auto n = write_queue.wait_dequeue_bulk_timed(batch.begin(), batch.size(), 
+                std::chrono::milliseconds(100));
+
+        if (n > 0) {
+            kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb writer");
+            db_lock_with_sync_check(dblock, return);
+
+            for (size_t i = 0; i < n; i++) {
+                if (!failed && std::visit([this](const auto& r) { return write_record(r); }, *batch[i]) < 0)
+                    failed = true;
+
+                delete batch[i];
+            }
+
+            stat_records_written += n;
+            uncommitted += n;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+
+        // Don't start a new file while the log is being closed
+        if (!failed && !writer_shutdown && (rotate_size > 0 || rotate_age > 0) && 
+                now - last_rotate_check >= std::chrono::seconds(1)) {
+            last_rotate_check = now;
+
+            if (rotation_due()) {
+                kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb writer rotate");
+                db_lock_with_sync_check(dblock, return);
+
+                if (!rotate_database())
+                    failed = true;
+
+                uncommitted = 0;
+                last_commit = now;
+            }
+        }
+
+        if (failed) {
+            // Stop logging; close_log finishes tearing down the database
+            db_enabled = false;
+
+            _MSG_ERROR("Kismetdb log writer stopped after an error; no further records "
+                    "will be saved to {}", ds_dbfile);
+
+            kismetdb_record *r;
+            while (write_queue.try_dequeue(r))
+                delete r;
+
+            return;
+        }
+
+        if (uncommitted > 0 && (uncommitted >= commit_rows || now - last_commit >= commit_interval)) {
+            kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb writer commit");
+            db_lock_with_sync_check(dblock, return);
+
+            stat_last_commit_rows = uncommitted;
+            commit_transaction();
+
+            uncommitted = 0;
+            last_commit = now;
+        }
+
+        if (n == 0 && writer_shutdown)
+            return;
+    }
+}
+
+bool kis_database_logfile::open_database(const std::string& in_path) {
+    if (!database_open(in_path))
+        return false;
+
+    if (database_upgrade_db() <= 0) {
+        _MSG_ERROR("Unable to create the KismetDB log tables in {}", in_path);
+        database_close();
+        return false;
+    }
+
+    if (packet_indexes == packet_index_policy::live)
+        create_packet_indexes();
+
+    if (journal_wal) {
+        sqlite3_exec(db, "PRAGMA journal_mode=WAL", NULL, NULL, NULL);
+
+        // Commits only append to the WAL; folding it back into the database is left to 
+        // the checkpoint thread, so a commit never waits on a checkpoint
+        if (checkpoint_interval.count() > 0)
+            sqlite3_exec(db, "PRAGMA wal_autocheckpoint=0", NULL, NULL, NULL);
     } else {
-        sqlite3_bind_int(alert_stmt, 5, 0);
-        sqlite3_bind_int(alert_stmt, 6, 0);
+        sqlite3_exec(db, "PRAGMA journal_mode=PERSIST", NULL, NULL, NULL);
     }
 
-    sqlite3_bind_text(alert_stmt, 7, headerstring.c_str(), headerstring.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_blob(alert_stmt, 8, jsonstring.data(), jsonstring.length(), SQLITE_TRANSIENT);
+    auto sync_pragma = fmt::format("PRAGMA synchronous={}", log_synchronous);
+    sqlite3_exec(db, sync_pragma.c_str(), NULL, NULL, NULL);
 
-    if (sqlite3_step(alert_stmt) != SQLITE_DONE) {
-        _MSG("kis_database_logfile unable to insert alert in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
+    // Go into transactional mode; the writer commits in batches
+    sqlite3_exec(db, "BEGIN TRANSACTION", NULL, NULL, NULL);
+
+    if (!prepare_statements()) {
+        finalize_statements();
+        sqlite3_exec(db, "END TRANSACTION", NULL, NULL, NULL);
+        database_close();
+        return false;
+    }
+
+    // A new file has none of the bodies we've stored
+    packet_body_map.clear();
+
+    if (journal_wal && checkpoint_interval.count() > 0)
+        start_checkpoint_thread(in_path);
+
+    db_open_time = time(0);
+
+    return true;
+}
+
+void kis_database_logfile::close_database() {
+    stop_checkpoint_thread();
+
+    finalize_statements();
+
+    // End the transaction
+    sqlite3_exec(db, "END TRANSACTION", NULL, NULL, NULL);
+
+    if (db != nullptr && packet_indexes == packet_index_policy::close) {
+        _MSG_INFO("Indexing packets in the kismetdb log {}, this may take a moment", ds_dbfile);
+        create_packet_indexes();
+    }
+
+    // Leaving WAL mode checkpoints and removes the WAL, leaving a single-file log
+    sqlite3_exec(db, "PRAGMA journal_mode=DELETE", NULL, NULL, NULL);
+    sqlite3_exec(db, "BEGIN_EXCLUSIVE", NULL, NULL, NULL);
+    sqlite3_exec(db, "COMMIT", NULL, NULL, NULL);
+
+    database_close();
+}
+
+void kis_database_logfile::create_packet_indexes() {
+    // Time windows, datasources, and addresses are how packets are selected for export 
+    // and expiry
+    for (const auto& sql : {
+            "CREATE INDEX IF NOT EXISTS packets_ts_sec ON packets (ts_sec)",
+            "CREATE INDEX IF NOT EXISTS packets_datasource ON packets (datasource)",
+            "CREATE INDEX IF NOT EXISTS packets_sourcemac ON packets (sourcemac)",
+            "CREATE INDEX IF NOT EXISTS packets_destmac ON packets (destmac)",
+            "CREATE INDEX IF NOT EXISTS packets_transmac ON packets (transmac)"}) {
+        if (sqlite3_exec(db, sql, NULL, NULL, NULL) != SQLITE_OK) {
+            _MSG_ERROR("Unable to create packet index in the kismetdb log {}: {}", 
+                    ds_dbfile, sqlite3_errmsg(db));
+            return;
+        }
+    }
+}
+
+void kis_database_logfile::start_checkpoint_thread(const std::string& in_path) {
+    // Checkpoints run on their own connection, so that a passive checkpoint only 
+    // contends with the writer inside sqlite instead of on the database lock
+    sqlite3 *ckpt_db = nullptr;
+
+    // The connection only finds the WAL once it has read the database, and until then a
+    // checkpoint silently does nothing
+    if (sqlite3_open_v2(in_path.c_str(), &ckpt_db, SQLITE_OPEN_READWRITE, nullptr) != SQLITE_OK ||
+            sqlite3_exec(ckpt_db, "SELECT count(*) FROM sqlite_master", NULL, NULL, NULL) != SQLITE_OK) {
+        _MSG_ERROR("Unable to open a checkpoint connection to {}, falling back to automatic "
+                "checkpoints: {}", in_path, sqlite3_errmsg(ckpt_db));
+        sqlite3_close(ckpt_db);
+        sqlite3_exec(db, "PRAGMA wal_autocheckpoint=1000", NULL, NULL, NULL);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lk(checkpoint_mutex);
+        checkpoint_shutdown = false;
+    }
+
+    checkpoint_thread = std::thread([this, ckpt_db]() {
+        thread_set_process_name("kismetdb ckpt");
+
+        std::unique_lock<std::mutex> lk(checkpoint_mutex);
+
+        while (!checkpoint_shutdown) {
+            checkpoint_cv.wait_for(lk, checkpoint_interval);
+
+            if (checkpoint_shutdown)
+                break;
+
+            lk.unlock();
+
+            auto start = std::chrono::steady_clock::now();
+
+            int wal_frames = 0, ckpt_frames = 0;
+            auto r = sqlite3_wal_checkpoint_v2(ckpt_db, nullptr, SQLITE_CHECKPOINT_PASSIVE, 
+                    &wal_frames, &ckpt_frames);
+
+            if (r != SQLITE_OK || wal_frames < 0) {
+                lk.lock();
+                continue;
+            }
+
+            uint64_t usec = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+
+            stat_checkpoints++;
+            stat_last_checkpoint_usec = usec;
+            stat_last_checkpoint_frames = ckpt_frames;
+            stat_wal_frames = wal_frames;
+
+            auto max_usec = stat_max_checkpoint_usec.load();
+            while (usec > max_usec && !stat_max_checkpoint_usec.compare_exchange_weak(max_usec, usec))
+                ;
+
+            lk.lock();
+        }
+
+        lk.unlock();
+
+        sqlite3_close(ckpt_db);
+    });
+}
+
+void kis_database_logfile::stop_checkpoint_thread() {
+    {
+        std::lock_guard<std::mutex> lk(checkpoint_mutex);
+        checkpoint_shutdown = true;
+    }
+
+    checkpoint_cv.notify_all();
+
+    if (checkpoint_thread.joinable())
+        checkpoint_thread.join();
+}
+
+bool kis_database_logfile::rotation_due() {
+    if (rotate_age > 0 && time(0) - db_open_time >= (time_t) rotate_age)
+        return true;
+
+    if (rotate_size > 0) {
+        struct stat db_stat, wal_stat;
+        uint64_t sz = 0;
+
+        if (stat(ds_dbfile.c_str(), &db_stat) == 0)
+            sz += db_stat.st_size;
+
+        auto wal = ds_dbfile + "-wal";
+        if (stat(wal.c_str(), &wal_stat) == 0)
+            sz += wal_stat.st_size;
+
+        if (sz >= rotate_size)
+            return true;
+    }
+
+    return false;
+}
+
+bool kis_database_logfile::rotate_database() {
+    auto logtracker = Globalreg::fetch_global_as<log_tracker>();
+
+    std::string new_path;
+
+    if (logtracker != nullptr)
+        new_path = Globalreg::globalreg->kismet_config->expand_log_path(logtracker->get_log_template(),
+                logtracker->get_log_title(), "kismet", 1, 0);
+
+    if (new_path.length() == 0 || new_path == ds_dbfile) {
+        _MSG_ERROR("Unable to find a new file name to rotate the kismetdb log {} to; check the "
+                "log_template.  Log rotation is disabled.", ds_dbfile);
+        rotate_size = 0;
+        rotate_age = 0;
+        return true;
+    }
+
+    auto old_path = ds_dbfile;
+
+    close_database();
+
+    if (!open_database(new_path)) {
+        _MSG_ERROR("Unable to open the new kismetdb log {} while rotating {}", new_path, old_path);
+        return false;
+    }
+
+    set_int_log_path(new_path);
+    stat_rotations++;
+    log_generation++;
+
+    _MSG_INFO("Rotated kismetdb log {} to {}", old_path, new_path);
+
+    auto evt = eventbus->get_eventbus_event(event_log_open());
+    eventbus->publish(evt);
+
+    return true;
+}
+
+void kis_database_logfile::commit_transaction() {
+    auto start = std::chrono::steady_clock::now();
+
+    in_transaction_sync = true;
+
+    sqlite3_exec(db, "END TRANSACTION", NULL, NULL, NULL);
+    sqlite3_exec(db, "BEGIN TRANSACTION", NULL, NULL, NULL);
+
+    in_transaction_sync = false;
+
+    uint64_t usec = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start).count();
+
+    stat_commits++;
+    stat_last_commit_usec = usec;
+    stat_total_commit_usec += usec;
+
+    auto max_usec = stat_max_commit_usec.load();
+    while (usec > max_usec && !stat_max_commit_usec.compare_exchange_weak(max_usec, usec))
+        ;
+}
+
+bool kis_database_logfile::prepare_statements() {
+    auto prepare = [this](const std::string& sql, sqlite3_stmt **stmt) -> bool {
+        if (sqlite3_prepare_v2(db, sql.c_str(), sql.length(), stmt, nullptr) != SQLITE_OK) {
+            _MSG_ERROR("kis_database_logfile unable to prepare database insert in {}: {}",
+                    ds_dbfile, sqlite3_errmsg(db));
+            return false;
+        }
+
+        return true;
+    };
+
+    return prepare("INSERT INTO packets "
+            "(ts_sec, ts_usec, phyname, "
+            "sourcemac, destmac, transmac, devkey, frequency, " 
+            "lat, lon, alt, speed, heading, "
+            "packet_len, signal, "
+            "datasource, "
+            "dlt, packet, "
+            "error, tags, datarate, "
+            "body_hash, body_offset) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", &packet_stmt) &&
+        prepare("INSERT OR REPLACE INTO packet_bodies "
+            "(hash, ts_sec, body) "
+            "VALUES (?, ?, ?)", &packet_body_stmt) &&
+        prepare("INSERT INTO data "
+            "(ts_sec, ts_usec, "
+            "phyname, devmac, "
+            "lat, lon, alt, speed, heading, "
+            "datasource, "
+            "type, json) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", &data_stmt) &&
+        prepare("INSERT INTO snapshots "
+            "(ts_sec, ts_usec, "
+            "lat, lon, "
+            "snaptype, json) "
+            "VALUES (?, ?, ?, ?, ?, ?)", &snapshot_stmt) &&
+        prepare("INSERT INTO alerts "
+            "(ts_sec, ts_usec, phyname, devmac, "
+            "lat, lon, "
+            "header, "
+            "json) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?, ?)", &alert_stmt) &&
+        prepare("INSERT INTO messages "
+            "(ts_sec, "
+            "lat, lon, "
+            "msgtype, message) "
+            "VALUES (?, ?, ?, ?, ?)", &message_stmt) &&
+        prepare("INSERT INTO devices "
+            "(first_time, last_time, devkey, phyname, devmac, strongest_signal, "
+            "min_lat, min_lon, max_lat, max_lon, "
+            "avg_lat, avg_lon, "
+            "bytes_data, type, device, device_format) "
+            "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)", &device_stmt) &&
+        prepare("INSERT INTO datasources "
+            "(uuid, "
+            "typestring, definition, "
+            "name, interface, "
+            "json) "
+            "VALUES (?, ?, ?, ?, ?, ?)", &datasource_stmt);
+}
+
+void kis_database_logfile::finalize_statements() {
+    for (auto stmt : {&packet_stmt, &data_stmt, &snapshot_stmt, &alert_stmt, 
+            &message_stmt, &device_stmt, &datasource_stmt, &packet_body_stmt}) {
+        if (*stmt != nullptr)
+            sqlite3_finalize(*stmt);
+        *stmt = nullptr;
+    }
+}
+
+// Bound values only need to live until the statement is stepped; each write resets the 
+// statement and clears the bindings once the row is inserted
+static int kismetdb_step(sqlite3_stmt *stmt) {
+    auto r = sqlite3_step(stmt);
+
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    return r;
+}
+
+int kis_database_logfile::write_record(const kismetdb_packet_record& r) {
+    auto sourcemac = r.sourcemac.mac_to_string();
+    auto destmac = r.destmac.mac_to_string();
+    auto transmac = r.transmac.mac_to_string();
+    auto datasource = r.datasource.uuid_to_string();
+
+    int sql_pos = 1;
+
+    sqlite3_bind_int64(packet_stmt, sql_pos++, r.ts_sec);
+    sqlite3_bind_int64(packet_stmt, sql_pos++, r.ts_usec);
+
+    sqlite3_bind_text(packet_stmt, sql_pos++, r.phyname.data(), r.phyname.length(), SQLITE_STATIC);
+    sqlite3_bind_text(packet_stmt, sql_pos++, sourcemac.data(), sourcemac.length(), SQLITE_STATIC);
+    sqlite3_bind_text(packet_stmt, sql_pos++, destmac.data(), destmac.length(), SQLITE_STATIC);
+    sqlite3_bind_text(packet_stmt, sql_pos++, transmac.data(), transmac.length(), SQLITE_STATIC);
+    // Packets are no longer a 1:1 with a device
+    sqlite3_bind_text(packet_stmt, sql_pos++, "0", 1, SQLITE_STATIC);
+    sqlite3_bind_double(packet_stmt, sql_pos++, r.frequency);
+
+    if (r.gps) {
+        sqlite3_bind_double(packet_stmt, sql_pos++, r.lat);
+        sqlite3_bind_double(packet_stmt, sql_pos++, r.lon);
+        sqlite3_bind_double(packet_stmt, sql_pos++, r.alt);
+        sqlite3_bind_double(packet_stmt, sql_pos++, r.speed);
+        sqlite3_bind_double(packet_stmt, sql_pos++, r.heading);
+    } else {
+        sqlite3_bind_double(packet_stmt, sql_pos++, 0);
+        sqlite3_bind_double(packet_stmt, sql_pos++, 0);
+        sqlite3_bind_double(packet_stmt, sql_pos++, 0);
+        sqlite3_bind_double(packet_stmt, sql_pos++, 0);
+        sqlite3_bind_double(packet_stmt, sql_pos++, 0);
+    }
+
+    sqlite3_bind_int64(packet_stmt, sql_pos++, r.packet_len);
+    sqlite3_bind_int(packet_stmt, sql_pos++, r.signal);
+
+    sqlite3_bind_text(packet_stmt, sql_pos++, datasource.data(), datasource.length(), SQLITE_STATIC);
+
+    size_t body_pos = 0, body_len = 0;
+    std::string body_hash;
+
+    if (packet_dedup && kismetdb_packet_dedup_span(r.dlt, r.packet, body_pos, body_len)) {
+        auto body = r.packet.data() + body_pos;
+
+        body_hash = fmt::format("{:016x}", XXH64(body, body_len, 0));
+
+        auto b = packet_body_map.find(body_hash);
+
+        if (b == packet_body_map.end() || r.ts_sec >= b->second + KISMETDB_DEDUP_REFRESH) {
+            sqlite3_bind_text(packet_body_stmt, 1, body_hash.data(), body_hash.length(), SQLITE_STATIC);
+            sqlite3_bind_int64(packet_body_stmt, 2, r.ts_sec);
+            sqlite3_bind_blob(packet_body_stmt, 3, body, body_len, SQLITE_STATIC);
+
+            if (kismetdb_step(packet_body_stmt) != SQLITE_DONE) {
+                _MSG_ERROR("kis_database_logfile unable to insert packet body in {}: {}", 
+                        ds_dbfile, sqlite3_errmsg(db));
+                return -1;
+            }
+
+            if (b == packet_body_map.end()) {
+                // Forgetting bodies only costs storing them again
+                if (packet_body_map.size() >= 100000)
+                    packet_body_map.clear();
+
+                packet_body_map[body_hash] = r.ts_sec;
+                stat_dedup_bodies++;
+            } else {
+                b->second = r.ts_sec;
+            }
+        }
+
+        packet_fragment_buf.assign(r.packet, 0, body_pos);
+        packet_fragment_buf.append(r.packet, body_pos + body_len, std::string::npos);
+
+        stat_dedup_packets++;
+        stat_dedup_bytes_saved += body_len;
+    }
+
+    sqlite3_bind_int(packet_stmt, sql_pos++, r.dlt);
+
+    if (body_hash.length() != 0)
+        sqlite3_bind_blob(packet_stmt, sql_pos++, packet_fragment_buf.data(), 
+                packet_fragment_buf.length(), SQLITE_STATIC);
+    else
+        sqlite3_bind_blob(packet_stmt, sql_pos++, r.packet.data(), r.packet.length(), SQLITE_STATIC);
+
+    sqlite3_bind_int(packet_stmt, sql_pos++, r.error);
+    sqlite3_bind_text(packet_stmt, sql_pos++, r.tags.data(), r.tags.length(), SQLITE_STATIC);
+    sqlite3_bind_double(packet_stmt, sql_pos++, r.datarate);
+
+    if (body_hash.length() != 0) {
+        sqlite3_bind_text(packet_stmt, sql_pos++, body_hash.data(), body_hash.length(), SQLITE_STATIC);
+        sqlite3_bind_int64(packet_stmt, sql_pos++, body_pos);
+    } else {
+        sqlite3_bind_null(packet_stmt, sql_pos++);
+        sqlite3_bind_null(packet_stmt, sql_pos++);
+    }
+
+    if (kismetdb_step(packet_stmt) != SQLITE_DONE) {
+        _MSG_ERROR("kis_database_logfile unable to insert packet in {}: {}", ds_dbfile, sqlite3_errmsg(db));
         return -1;
     }
 
-    sqlite3_finalize(alert_stmt);
+    return 1;
+}
+
+int kis_database_logfile::write_record(const kismetdb_data_record& r) {
+    auto devmac = r.devmac.mac_to_string();
+    auto datasource = r.datasource.uuid_to_string();
+
+    int sql_pos = 1;
+
+    sqlite3_bind_int64(data_stmt, sql_pos++, r.ts_sec);
+    sqlite3_bind_int64(data_stmt, sql_pos++, r.ts_usec);
+
+    sqlite3_bind_text(data_stmt, sql_pos++, r.phyname.data(), r.phyname.length(), SQLITE_STATIC);
+    sqlite3_bind_text(data_stmt, sql_pos++, devmac.data(), devmac.length(), SQLITE_STATIC);
+
+    if (r.gps) {
+        sqlite3_bind_double(data_stmt, sql_pos++, r.lat);
+        sqlite3_bind_double(data_stmt, sql_pos++, r.lon);
+        sqlite3_bind_double(data_stmt, sql_pos++, r.alt);
+        sqlite3_bind_double(data_stmt, sql_pos++, r.speed);
+        sqlite3_bind_double(data_stmt, sql_pos++, r.heading);
+    } else {
+        sqlite3_bind_double(data_stmt, sql_pos++, 0);
+        sqlite3_bind_double(data_stmt, sql_pos++, 0);
+        sqlite3_bind_double(data_stmt, sql_pos++, 0);
+        sqlite3_bind_double(data_stmt, sql_pos++, 0);
+        sqlite3_bind_double(data_stmt, sql_pos++, 0);
+    }
+
+    sqlite3_bind_text(data_stmt, sql_pos++, datasource.data(), datasource.length(), SQLITE_STATIC);
+
+    sqlite3_bind_text(data_stmt, sql_pos++, r.type.data(), r.type.length(), SQLITE_STATIC);
+    sqlite3_bind_text(data_stmt, sql_pos++, r.json.data(), r.json.length(), SQLITE_STATIC);
+
+    if (kismetdb_step(data_stmt) != SQLITE_DONE) {
+        _MSG_ERROR("kis_database_logfile unable to insert data in {}: {}", ds_dbfile, sqlite3_errmsg(db));
+        return -1;
+    }
 
     return 1;
 }
 
-int kis_database_logfile::log_snapshot(kis_gps_packinfo *gps, struct timeval tv,
-        std::string snaptype, std::string json) {
+int kis_database_logfile::write_record(const kismetdb_snapshot_record& r) {
+    sqlite3_bind_int64(snapshot_stmt, 1, r.ts_sec);
+    sqlite3_bind_int64(snapshot_stmt, 2, r.ts_usec);
+    sqlite3_bind_double(snapshot_stmt, 3, r.lat);
+    sqlite3_bind_double(snapshot_stmt, 4, r.lon);
+    sqlite3_bind_text(snapshot_stmt, 5, r.snaptype.data(), r.snaptype.length(), SQLITE_STATIC);
+    sqlite3_bind_text(snapshot_stmt, 6, r.json.data(), r.json.length(), SQLITE_STATIC);
 
-    if (!db_enabled)
-        return 0;
+    if (kismetdb_step(snapshot_stmt) != SQLITE_DONE) {
+        _MSG_ERROR("kis_database_logfile unable to insert snapshot in {}: {}", ds_dbfile, sqlite3_errmsg(db));
+        return -1;
+    }
 
-    int r;
-    std::string sql;
-    sqlite3_stmt *snapshot_stmt;
-    const char *snapshot_pz;
+    return 1;
+}
 
-    std::shared_ptr<kis_gps_packinfo> loc;
+int kis_database_logfile::write_record(const kismetdb_alert_record& r) {
+    auto devmac = r.devmac.mac_to_string();
 
-    if (gps == nullptr && gpstracker != nullptr) 
-        loc = std::shared_ptr<kis_gps_packinfo>(gpstracker->get_best_location());
+    sqlite3_bind_int64(alert_stmt, 1, r.ts_sec);
+    sqlite3_bind_int64(alert_stmt, 2, r.ts_usec);
+    sqlite3_bind_text(alert_stmt, 3, r.phyname.data(), r.phyname.length(), SQLITE_STATIC);
+    sqlite3_bind_text(alert_stmt, 4, devmac.data(), devmac.length(), SQLITE_STATIC);
+    sqlite3_bind_double(alert_stmt, 5, r.lat);
+    sqlite3_bind_double(alert_stmt, 6, r.lon);
+    sqlite3_bind_text(alert_stmt, 7, r.header.data(), r.header.length(), SQLITE_STATIC);
+    sqlite3_bind_blob(alert_stmt, 8, r.json.data(), r.json.length(), SQLITE_STATIC);
 
-    sql =
-        "INSERT INTO snapshots "
-        "(ts_sec, ts_usec, "
-        "lat, lon, "
-        "snaptype, json) "
-        "VALUES (?, ?, ?, ?, ?, ?)";
+    if (kismetdb_step(alert_stmt) != SQLITE_DONE) {
+        _MSG_ERROR("kis_database_logfile unable to insert alert in {}: {}", ds_dbfile, sqlite3_errmsg(db));
+        return -1;
+    }
 
-    kis_unique_lock<kis_mutex> dblock(ds_mutex, std::defer_lock, "kismetdb log_snapshot");
-    db_lock_with_sync_check(dblock, return -1);
+    return 1;
+}
 
-    r = sqlite3_prepare(db, sql.c_str(), sql.length(), &snapshot_stmt, &snapshot_pz);
+int kis_database_logfile::write_record(const kismetdb_message_record& r) {
+    sqlite3_bind_int64(message_stmt, 1, r.ts_sec);
+    sqlite3_bind_double(message_stmt, 2, r.lat);
+    sqlite3_bind_double(message_stmt, 3, r.lon);
+    sqlite3_bind_text(message_stmt, 4, r.msgtype.data(), r.msgtype.length(), SQLITE_STATIC);
+    sqlite3_bind_text(message_stmt, 5, r.message.data(), r.message.length(), SQLITE_STATIC);
 
-    if (r != SQLITE_OK) {
-        _MSG("kis_database_logfile unable to prepare database insert for snapshots in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
+    if (kismetdb_step(message_stmt) != SQLITE_DONE) {
+        _MSG_ERROR("Unable to insert message into {}: {}", ds_dbfile, sqlite3_errmsg(db));
         return -1;
     }
 
-    sqlite3_bind_int64(snapshot_stmt, 1, tv.tv_sec);
-    sqlite3_bind_int64(snapshot_stmt, 2, tv.tv_usec);
+    return 1;
+}
 
-    if (gps != NULL) {
-        sqlite3_bind_double(snapshot_stmt, 3, gps->lat);
-        sqlite3_bind_double(snapshot_stmt, 4, gps->lon);
+int kis_database_logfile::write_record(const kismetdb_device_record& r) {
+    auto devmac = r.devmac.mac_to_string();
+
+    int spos = 1;
+
+    sqlite3_bind_int64(device_stmt, spos++, r.first_time);
+    sqlite3_bind_int64(device_stmt, spos++, r.last_time);
+    sqlite3_bind_text(device_stmt, spos++, r.devkey.data(), r.devkey.length(), SQLITE_STATIC);
+    sqlite3_bind_text(device_stmt, spos++, r.phyname.data(), r.phyname.length(), SQLITE_STATIC);
+    sqlite3_bind_text(device_stmt, spos++, devmac.data(), devmac.length(), SQLITE_STATIC);
+    sqlite3_bind_int(device_stmt, spos++, r.strongest_signal);
+    sqlite3_bind_double(device_stmt, spos++, r.min_lat);
+    sqlite3_bind_double(device_stmt, spos++, r.min_lon);
+    sqlite3_bind_double(device_stmt, spos++, r.max_lat);
+    sqlite3_bind_double(device_stmt, spos++, r.max_lon);
+    sqlite3_bind_double(device_stmt, spos++, r.avg_lat);
+    sqlite3_bind_double(device_stmt, spos++, r.avg_lon);
+    sqlite3_bind_int64(device_stmt, spos++, r.bytes_data);
+    sqlite3_bind_text(device_stmt, spos++, r.type.data(), r.type.length(), SQLITE_STATIC);
+
+    // Compress in the writer, rather than in the thread logging the device
+    if (device_format != KISMETDB_DEVICE_FORMAT_JSON &&
+            kismetdb_device_encode(device_format, r.device, device_encode_buf)) {
+        sqlite3_bind_blob(device_stmt, spos++, device_encode_buf.data(), 
+                device_encode_buf.length(), SQLITE_STATIC);
+        sqlite3_bind_int(device_stmt, spos++, device_format);
     } else {
-        if (loc != nullptr && loc->fix >= 2) {
-            sqlite3_bind_double(snapshot_stmt, 3, loc->lat);
-            sqlite3_bind_double(snapshot_stmt, 4, loc->lon);
-        } else {
-            sqlite3_bind_int(snapshot_stmt, 3, 0);
-            sqlite3_bind_int(snapshot_stmt, 4, 0);
-        }
+        sqlite3_bind_blob(device_stmt, spos++, r.device.data(), r.device.length(), SQLITE_STATIC);
+        sqlite3_bind_int(device_stmt, spos++, KISMETDB_DEVICE_FORMAT_JSON);
     }
 
-    sqlite3_bind_text(snapshot_stmt, 5, snaptype.c_str(), snaptype.length(), SQLITE_TRANSIENT);
-    sqlite3_bind_text(snapshot_stmt, 6, json.data(), json.length(), SQLITE_TRANSIENT);
-
-    if (sqlite3_step(snapshot_stmt) != SQLITE_DONE) {
-        _MSG("kis_database_logfile unable to insert snapshot in " +
-                ds_dbfile + ":" + std::string(sqlite3_errmsg(db)), MSGFLAG_ERROR);
-        close_log();
+    if (kismetdb_step(device_stmt) != SQLITE_DONE) {
+        _MSG_ERROR("kis_database_logfile unable to insert device in {}: {}", ds_dbfile, sqlite3_errmsg(db));
         return -1;
     }
 
-    sqlite3_finalize(snapshot_stmt);
+    return 1;
+}
+
+int kis_database_logfile::write_record(const kismetdb_datasource_record& r) {
+    sqlite3_bind_text(datasource_stmt, 1, r.uuid.data(), r.uuid.length(), SQLITE_STATIC);
+    sqlite3_bind_text(datasource_stmt, 2, r.typestring.data(), r.typestring.length(), SQLITE_STATIC);
+    sqlite3_bind_text(datasource_stmt, 3, r.definition.data(), r.definition.length(), SQLITE_STATIC);
+    sqlite3_bind_text(datasource_stmt, 4, r.name.data(), r.name.length(), SQLITE_STATIC);
+    sqlite3_bind_text(datasource_stmt, 5, r.interface.data(), r.interface.length(), SQLITE_STATIC);
+    sqlite3_bind_blob(datasource_stmt, 6, r.json.data(), r.json.length(), SQLITE_STATIC);
+
+    if (kismetdb_step(datasource_stmt) != SQLITE_DONE) {
+        _MSG_ERROR("kis_database_logfile unable to insert datasource in {}: {}", ds_dbfile, sqlite3_errmsg(db));
+        return -1;
+    }
 
     return 1;
 }
 
+std::shared_ptr<tracker_element> kis_database_logfile::writer_stats_endp_handler() {
+    auto ret = std::make_shared<tracker_element_string_map>();
+
+    auto commits = stat_commits.load();
+
+    ret->insert(std::make_pair("kismet.database.writer.queue_depth",
+                std::make_shared<tracker_element_uint64>(0, write_queue.size_approx())));
+    ret->insert(std::make_pair("kismet.database.writer.max_queue_depth",
+                std::make_shared<tracker_element_uint64>(0, stat_max_queue_depth.load())));
+    ret->insert(std::make_pair("kismet.database.writer.producer_waits",
+                std::make_shared<tracker_element_uint64>(0, stat_producer_waits.load())));
+    ret->insert(std::make_pair("kismet.database.writer.records_written",
+                std::make_shared<tracker_element_uint64>(0, stat_records_written.load())));
+    ret->insert(std::make_pair("kismet.database.writer.commits",
+                std::make_shared<tracker_element_uint64>(0, commits)));
+    ret->insert(std::make_pair("kismet.database.writer.last_commit_rows",
+                std::make_shared<tracker_element_uint64>(0, stat_last_commit_rows.load())));
+    ret->insert(std::make_pair("kismet.database.writer.last_commit_usec",
+                std::make_shared<tracker_element_uint64>(0, stat_last_commit_usec.load())));
+    ret->insert(std::make_pair("kismet.database.writer.max_commit_usec",
+                std::make_shared<tracker_element_uint64>(0, stat_max_commit_usec.load())));
+    ret->insert(std::make_pair("kismet.database.writer.avg_commit_usec",
+                std::make_shared<tracker_element_uint64>(0, 
+                    commits == 0 ? 0 : stat_total_commit_usec.load() / commits)));
+    ret->insert(std::make_pair("kismet.database.writer.checkpoints",
+                std::make_shared<tracker_element_uint64>(0, stat_checkpoints.load())));
+    ret->insert(std::make_pair("kismet.database.writer.last_checkpoint_usec",
+                std::make_shared<tracker_element_uint64>(0, stat_last_checkpoint_usec.load())));
+    ret->insert(std::make_pair("kismet.database.writer.max_checkpoint_usec",
+                std::make_shared<tracker_element_uint64>(0, stat_max_checkpoint_usec.load())));
+    ret->insert(std::make_pair("kismet.database.writer.last_checkpoint_frames",
+                std::make_shared<tracker_element_uint64>(0, stat_last_checkpoint_frames.load())));
+    ret->insert(std::make_pair("kismet.database.writer.wal_frames",
+                std::make_shared<tracker_element_uint64>(0, stat_wal_frames.load())));
+    ret->insert(std::make_pair("kismet.database.writer.rotations",
+                std::make_shared<tracker_element_uint64>(0, stat_rotations.load())));
+    ret->insert(std::make_pair("kismet.database.writer.dedup_packets",
+                std::make_shared<tracker_element_uint64>(0, stat_dedup_packets.load())));
+    ret->insert(std::make_pair("kismet.database.writer.dedup_bodies_written",
+                std::make_shared<tracker_element_uint64>(0, stat_dedup_bodies.load())));
+    ret->insert(std::make_pair("kismet.database.writer.dedup_bytes_saved",
+                std::make_shared<tracker_element_uint64>(0, stat_dedup_bytes_saved.load())));
+
+    return ret;
+}
+
 
 void kis_database_logfile::usage(const char *argv0) {
 
@@ -1374,7 +1912,8 @@ void kis_database_logfile::usage(const char *argv0) {
 void kis_database_logfile::pcapng_endp_handler(std::shared_ptr<kis_net_beast_httpd_connection> con) {
     using namespace kissqlite3;
 
-    auto query = _SELECT(db, "packets", {"ts_sec", "ts_usec", "datasource", "dlt", "packet"});
+    auto query = _SELECT(db, "packets", 
+            {"ts_sec", "ts_usec", "datasource", "dlt", "packet", "body_hash", "body_offset"});
 
     auto ts_start_k = con->http_variables().find("timestamp_start");
     if (ts_start_k != con->http_variables().end()) 
@@ -1384,9 +1923,15 @@ void kis_database_logfile::pcapng_endp_handler(std::shared_ptr<kis_net_beast_htt
     if (ts_end_k != con->http_variables().end()) 
         query.append_where(AND, _WHERE("ts_sec", LE, string_to_n<uint64_t>(ts_end_k->second)));
 
+    // Sqlite can't use an index for a LIKE match, so exact uuids and addresses (which are
+    // logged in upper case) are matched with EQ instead
     auto datasource_k = con->http_variables().find("datasource");
-    if (datasource_k != con->http_variables().end()) 
-        query.append_where(AND, _WHERE("datasource", LIKE, datasource_k->second));
+    if (datasource_k != con->http_variables().end()) {
+        if (datasource_k->second.find_first_of("%_") == std::string::npos)
+            query.append_where(AND, _WHERE("datasource", EQ, str_upper(datasource_k->second)));
+        else
+            query.append_where(AND, _WHERE("datasource", LIKE, datasource_k->second));
+    }
 
     auto deviceid_k = con->http_variables().find("device_id");
     if (deviceid_k != con->http_variables().end()) 
@@ -1417,16 +1962,28 @@ void kis_database_logfile::pcapng_endp_handler(std::shared_ptr<kis_net_beast_htt
         query.append_where(AND, _WHERE("signal_max", LE, string_to_n<unsigned int>(signal_max_k->second)));
 
     auto address_source_k = con->http_variables().find("address_source");
-    if (address_source_k != con->http_variables().end()) 
-        query.append_where(AND, _WHERE("address_source", LIKE, address_source_k->second));
+    if (address_source_k != con->http_variables().end()) {
+        if (address_source_k->second.find_first_of("%_") == std::string::npos)
+            query.append_where(AND, _WHERE("sourcemac", EQ, str_upper(address_source_k->second)));
+        else
+            query.append_where(AND, _WHERE("sourcemac", LIKE, address_source_k->second));
+    }
 
     auto address_dest_k = con->http_variables().find("address_dest");
-    if (address_dest_k != con->http_variables().end()) 
-        query.append_where(AND, _WHERE("address_dest", LIKE, address_dest_k->second));
+    if (address_dest_k != con->http_variables().end()) {
+        if (address_dest_k->second.find_first_of("%_") == std::string::npos)
+            query.append_where(AND, _WHERE("destmac", EQ, str_upper(address_dest_k->second)));
+        else
+            query.append_where(AND, _WHERE("destmac", LIKE, address_dest_k->second));
+    }
 
     auto address_trans_k = con->http_variables().find("address_trans");
-    if (address_trans_k != con->http_variables().end()) 
-        query.append_where(AND, _WHERE("address_trans", LIKE, address_trans_k->second));
+    if (address_trans_k != con->http_variables().end()) {
+        if (address_trans_k->second.find_first_of("%_") == std::string::npos)
+            query.append_where(AND, _WHERE("transmac", EQ, str_upper(address_trans_k->second)));
+        else
+            query.append_where(AND, _WHERE("transmac", LIKE, address_trans_k->second));
+    }
 
     auto location_lat_min_k = con->http_variables().find("location_lat_min");
     if (location_lat_min_k != con->http_variables().end()) 
@@ -1460,6 +2017,7 @@ void kis_database_logfile::pcapng_endp_handler(std::shared_ptr<kis_net_beast_htt
 
     con->set_target_file(fmt::format("{}.pcapng", con->uri_params()[":title"]));
     con->set_closure_cb([pcapng]() { pcapng->stop_stream("http connection lost"); });
+    con->set_streaming();
 
     auto streamtracker = Globalreg::fetch_mandatory_global_as<stream_tracker>();
     auto sid = 
@@ -1480,35 +2038,86 @@ void kis_database_logfile::pcapng_endp_handler(std::shared_ptr<kis_net_beast_htt
                 sqlite3_column_as<std::string>(ds, 2));
     }
 
+    // Shared bodies of deduplicated packets, fetched as they're first needed
+    std::unordered_map<std::string, std::string> bodies;
+    std::string frame;
+
+    // Deduplicated packets whose body is gone (such as after a packet drop) or which 
+    // couldn't be rebuilt; they can't be exported, but they're reported
+    size_t skipped = 0;
+
     // Database handler registers itself as timing out so this should be OK to just blitz through
     // now, we'll block as necessary
     for (auto p : query) {
+        auto packet = sqlite3_column_as<std::string>(p, 4);
+        auto body_hash = sqlite3_column_as<std::string>(p, 5);
+
+        if (body_hash.length() != 0) {
+            auto b = bodies.find(body_hash);
+
+            if (b == bodies.end()) {
+                auto body_query = _SELECT(db, "packet_bodies", {"body"}, _WHERE("hash", EQ, body_hash));
+                auto body_r = body_query.begin();
+
+                if (body_r == body_query.end()) {
+                    skipped++;
+                    continue;
+                }
+
+                b = bodies.emplace(body_hash, sqlite3_column_as<std::string>(*body_r, 0)).first;
+            }
+
+            if (!kismetdb_packet_dedup_restore(packet, sqlite3_column_as<unsigned long>(p, 6), 
+                        b->second, frame)) {
+                skipped++;
+                continue;
+            }
+
+            packet.swap(frame);
+        }
+
         if (pcapng->pcapng_write_database_packet(
                     sqlite3_column_as<std::uint64_t>(p, 0),
                     sqlite3_column_as<std::uint64_t>(p, 1),
                     sqlite3_column_as<std::string>(p, 2),
                     sqlite3_column_as<unsigned int>(p, 3),
-                    sqlite3_column_as<std::string>(p, 4)) < 0) {
+                    packet) < 0) {
             return;
         }
     }
 
+    if (skipped > 0)
+        _MSG_ERROR("The pcapng export of the kismetdb log {} is missing {} deduplicated packets "
+                "whose shared packet body is no longer in the log or could not be restored.",
+                ds_dbfile, skipped);
+
     streamtracker->remove_streamer(sid);
 }
 
 void kis_database_logfile::packet_drop_endpoint_handler(std::shared_ptr<kis_net_beast_httpd_connection> con) {
     std::ostream ostream(&con->response_stream());
 
-    using namespace kissqlite3;
-
     if (!db_enabled) {
         con->set_status(400);
         ostream << "Illegal request: kismetdb log not enabled\n";
         return;
     }
 
-        auto drop_query = 
-            _DELETE(db, "packets", _WHERE("ts_sec", LE, con->json()["drop_before"].asUInt64()));
+    auto drop_before = con->json()["drop_before"].asUInt64();
+
+    auto pkt_delete = 
+        fmt::format("DELETE FROM packets WHERE ts_sec <= {}", drop_before);
+
+    kis_lock_guard<kis_mutex> lk(ds_mutex, "kismetdb packet drop");
+    sqlite3_exec(db, pkt_delete.c_str(), NULL, NULL, NULL);
+
+    // Bodies are refreshed as they're used, so any body older than this has no packets left
+    if (drop_before > KISMETDB_DEDUP_REFRESH) {
+        auto body_delete =
+            fmt::format("DELETE FROM packet_bodies WHERE ts_sec < {}", 
+                    drop_before - KISMETDB_DEDUP_REFRESH);
+        sqlite3_exec(db, body_delete.c_str(), NULL, NULL, NULL);
+    }
 
     ostream << "Packets removed\n";
 }
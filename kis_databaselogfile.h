@@ -38,12 +38,19 @@
 #include "config.h"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <variant>
 
 #include "globalregistry.h"
 #include "kis_mutex.h"
 #include "kis_database.h"
+#include "kismetdb_device_codec.h"
+#include "kismetdb_packet_dedup.h"
 #include "devicetracker.h"
 #include "alertracker.h"
 #include "logtracker.h"
@@ -54,9 +61,90 @@
 #include "packet_filter.h"
 #include "messagebus.h"
 
+#include "moodycamel/blockingconcurrentqueue.h"
+
 // Kismetdb version
 
-#define KISMETDB_LOG_VERSION        7
+#define KISMETDB_LOG_VERSION        9
+
+// Log rows are copied into flat records by whichever thread logs them, and written
+// by the log writer thread, which owns the database while the log is open.  Nothing
+// in a record refers back to the packet or tracked element it came from.
+struct kismetdb_packet_record {
+    uint64_t ts_sec, ts_usec;
+    std::string phyname;
+    mac_addr sourcemac, destmac, transmac;
+    double frequency;
+    bool gps;
+    double lat, lon, alt, speed, heading;
+    uint64_t packet_len;
+    int signal;
+    uuid datasource;
+    unsigned int dlt;
+    std::string packet;
+    int error;
+    std::string tags;
+    double datarate;
+};
+
+struct kismetdb_data_record {
+    uint64_t ts_sec, ts_usec;
+    std::string phyname;
+    mac_addr devmac;
+    bool gps;
+    double lat, lon, alt, speed, heading;
+    uuid datasource;
+    std::string type;
+    std::string json;
+};
+
+struct kismetdb_snapshot_record {
+    uint64_t ts_sec, ts_usec;
+    double lat, lon;
+    std::string snaptype;
+    std::string json;
+};
+
+struct kismetdb_alert_record {
+    uint64_t ts_sec, ts_usec;
+    std::string phyname;
+    mac_addr devmac;
+    double lat, lon;
+    std::string header;
+    std::string json;
+};
+
+struct kismetdb_message_record {
+    uint64_t ts_sec;
+    double lat, lon;
+    std::string msgtype;
+    std::string message;
+};
+
+struct kismetdb_device_record {
+    uint64_t first_time, last_time;
+    std::string devkey;
+    std::string phyname;
+    mac_addr devmac;
+    int strongest_signal;
+    double min_lat, min_lon, max_lat, max_lon, avg_lat, avg_lon;
+    uint64_t bytes_data;
+    std::string type;
+    std::string device;
+};
+
+struct kismetdb_datasource_record {
+    std::string uuid;
+    std::string typestring;
+    std::string definition;
+    std::string name;
+    std::string interface;
+    std::string json;
+};
+
+using kismetdb_record = std::variant<kismetdb_packet_record, kismetdb_data_record,
+      kismetdb_snapshot_record, kismetdb_alert_record, kismetdb_message_record,
+      kismetdb_device_record, kismetdb_datasource_record>;
 
 // This is a bit of a unique case - because so many things plug into this, it has
 // to exist as a global record; we build it like we do any other global record;
@@ -100,6 +188,10 @@ public:
     // device logs so that we can update just the logs we need.
     virtual time_t get_last_device_log_ts() { return last_device_log; }
 
+    // Incremented each time the log is rotated to a new file; anything which only logs
+    // changes (like devices) needs to log everything again when this changes
+    unsigned int get_log_generation() { return log_generation; }
+
     // Log a packet
     virtual int log_packet(kis_packet *in_packet);
 
@@ -172,10 +264,94 @@ protected:
 
     int packet_handler_id;
 
-    // Keep track of our commit cycles; to avoid thrashing the filesystem with
-    // commit state we run a 10 second tranasction commit loop
-    kis_mutex transaction_mutex;
-    int transaction_timer;
+    // Log writer thread; records are queued by the loggers and written in transactions
+    // which commit after a number of rows or a number of seconds, whichever comes first
+    moodycamel::BlockingConcurrentQueue<kismetdb_record *> write_queue;
+    std::thread writer_thread;
+    std::atomic<bool> writer_shutdown;
+
+    size_t write_queue_max;
+    size_t commit_rows;
+    std::chrono::milliseconds commit_interval;
+
+    void writer_thread_fn();
+    void queue_record(kismetdb_record *record);
+
+    int write_record(const kismetdb_packet_record& r);
+    int write_record(const kismetdb_data_record& r);
+    int write_record(const kismetdb_snapshot_record& r);
+    int write_record(const kismetdb_alert_record& r);
+    int write_record(const kismetdb_message_record& r);
+    int write_record(const kismetdb_device_record& r);
+    int write_record(const kismetdb_datasource_record& r);
+
+    void commit_transaction();
+
+    // Insert statements, prepared once when the log is opened and reset for each row
+    bool prepare_statements();
+    void finalize_statements();
+
+    sqlite3_stmt *packet_stmt, *data_stmt, *snapshot_stmt, *alert_stmt,
+                 *message_stmt, *device_stmt, *datasource_stmt, *packet_body_stmt;
+
+    // Writer statistics
+    std::atomic<uint64_t> stat_records_written;
+    std::atomic<uint64_t> stat_max_queue_depth;
+    std::atomic<uint64_t> stat_commits;
+    std::atomic<uint64_t> stat_last_commit_rows;
+    std::atomic<uint64_t> stat_last_commit_usec;
+    std::atomic<uint64_t> stat_max_commit_usec;
+    std::atomic<uint64_t> stat_total_commit_usec;
+    std::atomic<uint64_t> stat_producer_waits;
+
+    std::shared_ptr<tracker_element> writer_stats_endp_handler();
+
+    // Open and configure a database file, and close it again; used when the log is opened 
+    // and closed, and by the writer to rotate the log.  Called with ds_mutex held.
+    bool open_database(const std::string& in_path);
+    void close_database();
+
+    // Journal and sync settings
+    bool journal_wal;
+    std::string log_synchronous;
+
+    // WAL checkpoints run on a separate connection in their own thread, so that commits 
+    // never stall behind a checkpoint
+    std::thread checkpoint_thread;
+    std::mutex checkpoint_mutex;
+    std::condition_variable checkpoint_cv;
+    bool checkpoint_shutdown;
+    std::chrono::seconds checkpoint_interval;
+
+    void start_checkpoint_thread(const std::string& in_path);
+    void stop_checkpoint_thread();
+
+    std::atomic<uint64_t> stat_checkpoints;
+    std::atomic<uint64_t> stat_last_checkpoint_usec;
+    std::atomic<uint64_t> stat_max_checkpoint_usec;
+    std::atomic<uint64_t> stat_last_checkpoint_frames;
+    std::atomic<uint64_t> stat_wal_frames;
+
+    // Rotation to a new log file by size (bytes) or age (seconds); the writer checks 
+    // and performs the rotation, so logging continues uninterrupted
+    uint64_t rotate_size;
+    unsigned int rotate_age;
+    time_t db_open_time;
+    std::atomic<unsigned int> log_generation;
+    std::atomic<uint64_t> stat_rotations;
+
+    bool rotation_due();
+    bool rotate_database();
+
+    // Secondary indices on the packets table; maintained as packets are written, built
+    // in bulk when the log file is closed, or not created at all
+    enum class packet_index_policy {
+        none, live, close
+    };
+
+    packet_index_policy packet_indexes;
+
+    void create_packet_indexes();
 
     // Packet time limit
     unsigned int packet_timeout;
@@ -222,6 +398,21 @@ protected:
     unsigned long alert_evt_id;
 
     bool log_duplicate_packets;
+
+    // Encoding of device records, and the writer's scratch buffer for encoding them
+    int device_format;
+    std::string device_encode_buf;
+
+    // Packet body deduplication; the writer remembers the bodies it has stored and the 
+    // timestamp they were last stored with, which is refreshed so that the packet timeout 
+    // can expire bodies along with the packets using them
+    bool packet_dedup;
+    std::unordered_map<std::string, uint64_t> packet_body_map;
+    std::string packet_fragment_buf;
+
+    std::atomic<uint64_t> stat_dedup_packets;
+    std::atomic<uint64_t> stat_dedup_bodies;
+    std::atomic<uint64_t> stat_dedup_bytes_saved;
 };
 
 class kis_database_logfile_builder : public kis_logfile_builder {
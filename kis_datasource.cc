@@ -1265,7 +1265,7 @@ void kis_datasource::handle_packet_data_report(uint32_t in_seqno, const std::str
 
     // Process the data chunk
     if (report->has_packet()) {
-        kis_datachunk *datachunk = new kis_datachunk();
+        kis_datachunk *datachunk = packet->new_component<kis_datachunk>();
 
         if (clobber_timestamp && get_source_remote()) {
             gettimeofday(&(packet->ts), NULL);
@@ -1293,7 +1293,7 @@ void kis_datasource::handle_packet_data_report(uint32_t in_seqno, const std::str
     // Process JSON
     if (report->has_json()) {
         // fprintf(stderr, "debug - got JSON report- %s\n", report.json().json().c_str());
-        kis_json_packinfo *jsoninfo = new kis_json_packinfo();
+        kis_json_packinfo *jsoninfo = packet->new_component<kis_json_packinfo>();
       
         if (clobber_timestamp && get_source_remote()) {
             gettimeofday(&(packet->ts), NULL);
@@ -1310,7 +1310,7 @@ void kis_datasource::handle_packet_data_report(uint32_t in_seqno, const std::str
 
     // Process protobufs
     if (report->has_buffer()) {
-        kis_protobuf_packinfo *bufinfo = new kis_protobuf_packinfo();
+        kis_protobuf_packinfo *bufinfo = packet->new_component<kis_protobuf_packinfo>();
 
         if (clobber_timestamp && get_source_remote()) {
             gettimeofday(&(packet->ts), NULL);
@@ -1348,7 +1348,7 @@ void kis_datasource::handle_packet_data_report(uint32_t in_seqno, const std::str
 }
 
 void kis_datasource::handle_rx_packet(kis_packet *packet) {
-    packetchain_comp_datasource *datasrcinfo = new packetchain_comp_datasource();
+    packetchain_comp_datasource *datasrcinfo = packet->new_component<packetchain_comp_datasource>();
     datasrcinfo->ref_source = this;
 
     packet->insert(pack_comp_datasrc, datasrcinfo);
@@ -1706,6 +1706,12 @@ void kis_datasource::register_fields() {
     register_field("kismet.datasource.num_error_packets", 
             "Number of invalid/error packets seen by source",
             &source_num_error_packets);
+    register_field("kismet.datasource.num_dropped_packets",
+            "Number of packets from this source dropped because the packet queue was full",
+            &source_num_dropped_packets);
+    register_field("kismet.datasource.num_queued_packets",
+            "Number of packets from this source waiting in the packet queue",
+            &source_num_queued_packets);
 
     packet_rate_rrd_id = 
         register_dynamic_field("kismet.datasource.packets_rrd", 
@@ -382,6 +382,22 @@ public:
     __ProxyM(source_num_error_packets, uint64_t, uint64_t, uint64_t, source_num_error_packets, ext_mutex);
     __ProxyIncDecM(Msource_num_error_packets, uint64_t, uint64_t, source_num_error_packets, ext_mutex);
 
+    // Packet queue admission accounting, maintained by the packet chain for every 
+    // packet without taking the source lock; reflected in the tracked record when
+    // the source is serialized.  enqueued/dequeued return the previous queue depth.
+    int64_t admission_enqueued() { 
+        return admission_queued.fetch_add(1, std::memory_order_relaxed); 
+    }
+    int64_t admission_dequeued() { 
+        return admission_queued.fetch_sub(1, std::memory_order_relaxed); 
+    }
+    int64_t get_admission_queued() const {
+        return admission_queued.load(std::memory_order_relaxed);
+    }
+    void admission_dropped() {
+        admission_drops.fetch_add(1, std::memory_order_relaxed);
+    }
+
     __ProxyDynamicTrackableM(source_packet_rrd, kis_tracked_rrd<>, 
             packet_rate_rrd, packet_rate_rrd_id, ext_mutex);
 
@@ -431,6 +447,8 @@ public:
 
     virtual void pre_serialize() override {
         kis_lock_guard<kis_mutex> lk(ext_mutex, kismet::retain_lock, "datasource preserialize");
+        source_num_dropped_packets->set(admission_drops.load(std::memory_order_relaxed));
+        source_num_queued_packets->set(std::max(get_admission_queued(), int64_t{0}));
     }
 
     virtual void post_serialize() override {
@@ -644,6 +662,11 @@ protected:
 
     std::shared_ptr<tracker_element_uint64> source_num_packets;
     std::shared_ptr<tracker_element_uint64> source_num_error_packets;
+    std::shared_ptr<tracker_element_uint64> source_num_dropped_packets;
+    std::shared_ptr<tracker_element_uint64> source_num_queued_packets;
+
+    std::atomic<int64_t> admission_queued{0};
+    std::atomic<uint64_t> admission_drops{0};
 
     int packet_rate_rrd_id;
     std::shared_ptr<kis_tracked_rrd<>> packet_rate_rrd;
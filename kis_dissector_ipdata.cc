@@ -84,7 +84,7 @@ kis_dissector_ip_data::kis_dissector_ip_data() {
         Globalreg::fetch_mandatory_global_as<packet_chain>();
 
     packetchain->register_handler(&ipdata_packethook, this,
-            CHAINPOS_DATADISSECT, -100);
+            CHAINPOS_DATADISSECT, -100, "kis_dissector_ipdata ipdata_packethook");
 
 	pack_comp_basicdata = 
 		packetchain->register_packet_component("BASICDATA");
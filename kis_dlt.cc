@@ -39,7 +39,7 @@ kis_dlt_handler::kis_dlt_handler() :
 
 	chainid = 
 		packetchain->register_handler(&kis_dlt_packethook, this,
-                CHAINPOS_POSTCAP, 0);
+                CHAINPOS_POSTCAP, 0, "kis_dlt kis_dlt_packethook");
 
 	pack_comp_linkframe =
 		packetchain->register_packet_component("LINKFRAME");
@@ -211,8 +211,8 @@ int kis_dlt_radiotap::handle_packet(kis_packet *in_pack) {
         return 0;
     }
 
-	decapchunk = new kis_datachunk;
-	radioheader = new kis_layer1_packinfo;
+	decapchunk = in_pack->new_component<kis_datachunk>();
+	radioheader = in_pack->new_component<kis_layer1_packinfo>();
 
 	decapchunk->dlt = KDLT_IEEE802_11;
 	
@@ -416,8 +416,8 @@ int kis_dlt_radiotap::handle_packet(kis_packet *in_pack) {
 		_MSG("Pcap Radiotap converter got corrupted Radiotap frame, not "
 			 "long enough for radiotap header plus indicated FCS", MSGFLAG_ERROR);
 		*/
-		delete decapchunk;
-		delete radioheader;
+		in_pack->destroy_component(decapchunk);
+		in_pack->destroy_component(radioheader);
         return 0;
 	}
 
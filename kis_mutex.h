@@ -30,6 +30,7 @@
 #include <mutex>
 #include <shared_mutex>
 #include <thread>
+#include <unordered_map>
 
 #include <limits.h>
 
@@ -37,7 +38,7 @@
 
 #define KIS_THREAD_TIMEOUT      30
 
-class kis_mutex : public std::recursive_timed_mutex {
+class kis_mutex : public std::recursive_mutex {
 private:
     std::string name;
 
@@ -60,9 +61,6 @@ public:
         return name;
     }
 
-    // Previous workaround for gcc try_lock_for bugs here, but now we require c++14 so we don't
-    // need them
-
     void lock_shared() {
         throw std::runtime_error("lock_shared called on non-shared mutex");
     }
@@ -155,6 +153,111 @@ public:
     }
 };
 
+#ifdef KIS_MUTEX_STATS
+// Per-mutex, per-op lock statistics, keyed by the mutex name and the op tag pointer handed
+// to the lock guards, so that locks taken with the default op on different mutexes are kept
+// apart.  Only compiled in with --enable-mutex-stats; ops are normally string literals or
+// __func__, so the pointer is stable for the life of the process.
+struct kis_mutex_op_stats {
+    kis_mutex_op_stats(const char *op, const std::string& mutex_name) :
+        op{op},
+        mutex_name{mutex_name} { }
+
+    const char *op;
+    std::string mutex_name;
+
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> contended{0};
+    std::atomic<uint64_t> wait_ns{0};
+    std::atomic<uint64_t> hold_ns{0};
+    std::atomic<uint64_t> max_hold_ns{0};
+
+    void add_hold(uint64_t ns) {
+        hold_ns.fetch_add(ns, std::memory_order_relaxed);
+
+        auto m = max_hold_ns.load(std::memory_order_relaxed);
+        while (ns > m && !max_hold_ns.compare_exchange_weak(m, ns, std::memory_order_relaxed))
+            ;
+    }
+};
+
+class kis_mutex_stats {
+public:
+    static kis_mutex_op_stats *get(const char *op, const std::string& mutex_name) {
+        // Cache the last entry by its own identity; mutex addresses are reused and mutexes
+        // can be renamed, so the address can't stand in for the name
+        thread_local kis_mutex_op_stats *last_stats = nullptr;
+
+        if (last_stats != nullptr && last_stats->op == op && last_stats->mutex_name == mutex_name)
+            return last_stats;
+
+        {
+            std::shared_lock<std::shared_mutex> lk(mutex);
+            auto k = ops.find(op);
+            if (k != ops.end()) {
+                auto n = k->second.find(mutex_name);
+                if (n != k->second.end()) {
+                    last_stats = n->second.get();
+                    return last_stats;
+                }
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lk(mutex);
+        auto& e = ops[op][mutex_name];
+        if (e == nullptr)
+            e = std::make_unique<kis_mutex_op_stats>(op, mutex_name);
+
+        last_stats = e.get();
+        return last_stats;
+    }
+
+    template<typename F>
+    static void for_each(F fn) {
+        std::shared_lock<std::shared_mutex> lk(mutex);
+        for (const auto& o : ops)
+            for (const auto& n : o.second)
+                fn(*n.second);
+    }
+
+    static uint64_t now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Lock m, recording contention and wait time against op; returns the time the lock was
+    // acquired
+    template<class M>
+    static uint64_t lock(M& m, const char *op) {
+        auto st = get(op, m.get_name());
+        st->count.fetch_add(1, std::memory_order_relaxed);
+
+        if (m.try_lock())
+            return now_ns();
+
+        auto start = now_ns();
+        m.lock();
+        auto acquired = now_ns();
+
+        st->contended.fetch_add(1, std::memory_order_relaxed);
+        st->wait_ns.fetch_add(acquired - start, std::memory_order_relaxed);
+
+        return acquired;
+    }
+
+    template<class M>
+    static void unlock(M& m, const char *op, uint64_t acquired) {
+        get(op, m.get_name())->add_hold(now_ns() - acquired);
+        m.unlock();
+    }
+
+private:
+    static inline std::shared_mutex mutex;
+    static inline std::unordered_map<const char *, 
+        std::unordered_map<std::string, std::unique_ptr<kis_mutex_op_stats>>> ops;
+};
+#endif
+
 namespace kismet {
     typedef struct { } retain_lock_t;
     constexpr retain_lock_t retain_lock;
@@ -163,52 +266,39 @@ namespace kismet {
     constexpr shared_lock_t shared_lock;
 }
 
+// Lock guards take the op as a const char *; callers pass string literals or __func__, and
+// the guards never copy it, so taking a lock does not allocate.
 template<class M>
 class kis_lock_guard {
 public:
-    kis_lock_guard(M& m, const std::string& op = "UNKNOWN") :
+    kis_lock_guard(M& m, const char *op = "UNKNOWN") :
         mutex{m},
         op{op},
         retain{false},
         shared{false} {
-            mutex.lock();
-            /*
-            if (!mutex.try_lock_for(std::chrono::seconds(KIS_THREAD_TIMEOUT)))
-                throw std::runtime_error(fmt::format("potential deadlock: mutex {} not available within "
-                            "timeout period for op {}", mutex.get_name(), op));
-                            */
+            do_lock();
         }
 
-    kis_lock_guard(M& m, std::adopt_lock_t t, const std::string& op = "UNKNOWN") :
+    kis_lock_guard(M& m, std::adopt_lock_t t, const char *op = "UNKNOWN") :
         mutex{m},
         op{op},
         retain{false},
         shared{false} { }
 
-    kis_lock_guard(M& m, kismet::retain_lock_t t, const std::string& op = "UNKNOWN") :
+    kis_lock_guard(M& m, kismet::retain_lock_t t, const char *op = "UNKNOWN") :
         mutex{m},
         op{op},
         retain{true},
         shared{false} {
-            mutex.lock();
-            /*
-            if (!mutex.try_lock_for(std::chrono::seconds(KIS_THREAD_TIMEOUT)))
-                throw std::runtime_error(fmt::format("potential deadlock: mutex {} not available within "
-                            "timeout period for op {}", mutex.get_name(), op));
-                            */
+            do_lock();
         }
 
-    kis_lock_guard(M& m, kismet::shared_lock_t t, const std::string& op = "UNKNOWN") :
+    kis_lock_guard(M& m, kismet::shared_lock_t t, const char *op = "UNKNOWN") :
         mutex{m},
         op{op},
         retain{false},
         shared{true} {
             mutex.lock_shared();
-            /*
-            if (!mutex.try_lock_shared_for(std::chrono::seconds(KIS_THREAD_TIMEOUT)))
-                throw std::runtime_error(fmt::format("potential deadlock: mutex {} not available within "
-                            "timeout period for op {}", mutex.get_name(), op));
-                            */
         }
 
     kis_lock_guard(const kis_lock_guard&) = delete;
@@ -218,38 +308,50 @@ public:
         if (shared) {
             mutex.unlock_shared();
         } else if (!retain) {
+#ifdef KIS_MUTEX_STATS
+            if (acquired != 0) {
+                kis_mutex_stats::unlock(mutex, op, acquired);
+                return;
+            }
+#endif
             mutex.unlock();
         }
     }
 
 protected:
+    void do_lock() {
+#ifdef KIS_MUTEX_STATS
+        acquired = kis_mutex_stats::lock(mutex, op);
+#else
+        mutex.lock();
+#endif
+    }
+
     M& mutex;
-    std::string op;
+    const char *op;
     bool retain;
     bool shared;
+
+#ifdef KIS_MUTEX_STATS
+    uint64_t acquired{0};
+#endif
 };
 
 template<class M>
 class kis_unique_lock {
 public:
-    kis_unique_lock(M& m, const std::string& op) :
+    kis_unique_lock(M& m, const char *op) :
         mutex{m},
         op{op} {
-            /*
-            if (!mutex.try_lock_for(std::chrono::seconds(KIS_THREAD_TIMEOUT)))
-                throw std::runtime_error(fmt::format("potential deadlock: mutex {} not available within "
-                            "timeout period for op {}", mutex.get_name(), op));
-                            */
-            mutex.lock();
-            locked = true;
+            do_lock();
         }
 
-    kis_unique_lock(M& m, std::defer_lock_t t, const std::string& op = "UNKNOWN") :
+    kis_unique_lock(M& m, std::defer_lock_t t, const char *op = "UNKNOWN") :
         mutex{m},
         op{op},
         locked{false} { }
 
-    kis_unique_lock(M& m, std::adopt_lock_t, const std::string& op = "UNKNOWN") :
+    kis_unique_lock(M& m, std::adopt_lock_t, const char *op = "UNKNOWN") :
         mutex{m},
         op{op},
         locked{true} { }
@@ -259,35 +361,37 @@ public:
 
     ~kis_unique_lock() {
         if (locked)
-            mutex.unlock();
+            do_unlock();
     }
 
-    void lock(const std::string& op = "UNKNOWN") {
+    void lock(const char *op = nullptr) {
         if (locked)
             throw std::runtime_error(fmt::format("invalid use: thread {} attempted to lock "
                         "unique lock {} when already locked fo {}", 
-                        std::this_thread::get_id(), mutex.get_name(), op));
+                        std::this_thread::get_id(), mutex.get_name(), this->op));
 
-        /*
-        if (!mutex.try_lock_for(std::chrono::seconds(KIS_THREAD_TIMEOUT)))
-            throw std::runtime_error(fmt::format("potential deadlock: mutex {} not available within "
-                        "timeout period for op {}", mutex.get_name(), op));
-                        */
-        mutex.lock();
-        locked = true;
+        if (op != nullptr)
+            this->op = op;
 
+        do_lock();
     }
 
-    bool try_lock(const std::string& op = "UNKNOWN") {
+    bool try_lock(const char *op = nullptr) {
         if (locked)
             throw std::runtime_error(fmt::format("invalid use: thread {} attempted to try_lock "
                         "unique lock {} when already locked for {}", 
-                        std::this_thread::get_id(), mutex.get_name(), op));
+                        std::this_thread::get_id(), mutex.get_name(), this->op));
 
-        // auto r = mutex.try_lock_for(std::chrono::seconds(KIS_THREAD_TIMEOUT));
         auto r = mutex.try_lock();
         locked = r;
 
+        if (r && op != nullptr)
+            this->op = op;
+
+#ifdef KIS_MUTEX_STATS
+        acquired = r ? kis_mutex_stats::now_ns() : 0;
+#endif
+
         return r;
     }
 
@@ -297,14 +401,39 @@ public:
                         "unique lock {} when not locked", std::this_thread::get_id(), 
                         mutex.get_name()));
 
+        do_unlock();
+    }
+
+protected:
+    void do_lock() {
+#ifdef KIS_MUTEX_STATS
+        acquired = kis_mutex_stats::lock(mutex, op);
+#else
+        mutex.lock();
+#endif
+        locked = true;
+    }
+
+    void do_unlock() {
+#ifdef KIS_MUTEX_STATS
+        if (acquired != 0) {
+            kis_mutex_stats::unlock(mutex, op, acquired);
+            acquired = 0;
+            locked = false;
+            return;
+        }
+#endif
         mutex.unlock();
         locked = false;
     }
 
-protected:
     M& mutex;
-    std::string op;
+    const char *op;
     bool locked{false};
+
+#ifdef KIS_MUTEX_STATS
+    uint64_t acquired{0};
+#endif
 };
 
 #endif
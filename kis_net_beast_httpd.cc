@@ -19,7 +19,9 @@
 #include "kis_net_beast_httpd.h"
 
 #include <iostream>
+#include <cctype>
 #include <fstream>
+#include <limits>
 #include <random>
 
 #include <stdio.h>
@@ -78,12 +80,15 @@ kis_net_beast_httpd::kis_net_beast_httpd(boost::asio::ip::tcp::endpoint& endpoin
     deferred_startup{},
     running{false},
     endpoint{endpoint},
-    acceptor{Globalreg::globalreg->io} {
+    acceptor{Globalreg::globalreg->io},
+    n_idle_connections{0},
+    n_rejected_requests{0} {
 
     mime_mutex.set_name("kis_net_beast_httpd MIME map");
     route_mutex.set_name("kis_net_beast_httpd route vector");
     auth_mutex.set_name("kis_net_beast_httpd auth");
     static_mutex.set_name("kis_net_beast_httpd static");
+    role_mutex.set_name("kis_net_beast_httpd role concurrency");
 }
 
 void kis_net_beast_httpd::trigger_deferred_startup() {
@@ -99,6 +104,8 @@ void kis_net_beast_httpd::trigger_deferred_startup() {
     register_mime_type("itjson", "application/json");
     register_mime_type("cmd", "application/json");
     register_mime_type("jcmd", "application/json");
+    register_mime_type("msgpack", "application/msgpack");
+    register_mime_type("cbor", "application/cbor");
     register_mime_type("xml", "application/xml");
     register_mime_type("png", "image/png");
     register_mime_type("jpg", "image/jpeg");
@@ -419,6 +426,36 @@ int kis_net_beast_httpd::start_httpd() {
         return -1;
     }
 
+    auto max_workers = 
+        Globalreg::globalreg->kismet_config->fetch_opt_as<unsigned int>("httpd_max_workers", 64);
+    auto max_queued = 
+        Globalreg::globalreg->kismet_config->fetch_opt_as<unsigned int>("httpd_max_queued_requests", 256);
+    auto max_streaming = 
+        Globalreg::globalreg->kismet_config->fetch_opt_as<unsigned int>("httpd_max_streaming", 64);
+
+    if (max_workers == 0)
+        max_workers = 1;
+
+    request_pool = std::make_shared<kis_net_beast_worker_pool>("beast request", 
+            max_workers, max_queued, max_streaming);
+
+    // A request runs at most one generator, so with as many generators as request workers
+    // a generator never has to wait for a thread
+    generator_pool = std::make_shared<kis_net_beast_worker_pool>("beast generator", 
+            max_workers, max_workers, max_streaming);
+
+    for (const auto& r : Globalreg::globalreg->kismet_config->fetch_opt_vec("httpd_role_concurrency")) {
+        auto comps = str_tokenize(r, ":");
+        unsigned int limit;
+
+        if (comps.size() != 2 || sscanf(comps[1].c_str(), "%u", &limit) != 1) {
+            _MSG_ERROR("Expected config option httpd_role_concurrency=role:limit, got {}", r);
+            continue;
+        }
+
+        role_limits[comps[0]] = limit;
+    }
+
     _MSG_INFO("(DEBUG) Beast server listening on {}:{}", endpoint.address(), endpoint.port());
 
     running = true;
@@ -443,6 +480,12 @@ int kis_net_beast_httpd::stop_httpd() {
         }
     }
 
+    if (request_pool != nullptr)
+        request_pool->stop();
+
+    if (generator_pool != nullptr)
+        generator_pool->stop();
+
     return 1;
 }
 
@@ -462,43 +505,149 @@ void kis_net_beast_httpd::handle_connection(const boost::system::error_code& ec,
     if (!running)
         return;
 
-    auto socket_moved = std::promise<bool>();
-    auto socket_moved_ft = socket_moved.get_future();
+    if (!ec) 
+        wait_connection_request(std::make_shared<connection_socket>(std::move(socket)));
 
-    if (!ec) {
-        std::thread conthread([this, &socket, &socket_moved]() {
-                thread_set_process_name("beast connection");
+    // Accept another connection
+    return start_accept();
+}
 
-                auto mv_socket = boost::beast::tcp_stream{std::move(socket)};
-                socket_moved.set_value(true);
+void kis_net_beast_httpd::wait_connection_request(std::shared_ptr<connection_socket> sock) {
+    auto self = shared_from_this();
 
-                while (mv_socket.socket().is_open()) {
-                    // Associate the socket
-                    auto conn = 
-                        std::make_shared<kis_net_beast_httpd_connection>(mv_socket, shared_from_this());
+    boost::asio::dispatch(sock->strand, [this, self, sock]() {
+        auto gen = ++sock->wait_gen;
 
-                    // Run the connection
-                    auto retain = conn->start();
+        sock->waiting = true;
+        n_idle_connections++;
 
-                    if (retain == false)
-                        break;
-                }
+        // Idle connections get the same timeout as a stalled request
+        sock->timer.expires_after(std::chrono::seconds(30));
+        sock->timer.async_wait([sock, gen](const boost::system::error_code& ec) {
+                if (ec || !sock->waiting || sock->wait_gen != gen)
+                    return;
 
-                try {
-                    mv_socket.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_send);
-                } catch (std::exception& e) {
-                    ;
-                }
+                boost::system::error_code cancel_ec;
+                sock->stream.socket().cancel(cancel_ec);
             });
 
-        conthread.detach();
+        sock->stream.socket().async_wait(boost::asio::ip::tcp::socket::wait_read,
+                boost::asio::bind_executor(sock->strand, 
+                    [this, self, sock](const boost::system::error_code& ec) {
+                        sock->waiting = false;
+                        n_idle_connections--;
+                        sock->timer.cancel();
+
+                        if (ec || !running)
+                            return close_connection(sock);
+
+                        auto queued = request_pool->submit([this, self, sock]() {
+                                run_connection_request(sock);
+                            });
+
+                        if (!queued)
+                            reject_connection_request(sock);
+                    }));
+    });
+}
+
+void kis_net_beast_httpd::run_connection_request(std::shared_ptr<connection_socket> sock) {
+    auto conn = std::make_shared<kis_net_beast_httpd_connection>(sock->stream, shared_from_this());
+
+    auto retain = conn->start();
+    conn.reset();
+
+    if (retain && running && sock->stream.socket().is_open())
+        return wait_connection_request(sock);
+
+    close_connection(sock);
+}
+
+void kis_net_beast_httpd::reject_connection_request(std::shared_ptr<connection_socket> sock) {
+    n_rejected_requests++;
+
+    boost::beast::http::response<boost::beast::http::string_body> 
+        res{boost::beast::http::status::service_unavailable, 11};
+
+    res.set(boost::beast::http::field::server, "Kismet");
+    res.set(boost::beast::http::field::content_type, "text/html");
+    res.set(boost::beast::http::field::retry_after, "1");
+    res.keep_alive(false);
+    res.body() = std::string("<html><head><title>503 Service unavailable</title></head><body>"
+            "<h1>503 Service unavailable</h1><br><p>The server is handling too many requests.</p>"
+            "</body></html>\n");
+    res.prepare_payload();
+
+    boost::system::error_code error;
+    boost::beast::http::write(sock->stream, res, error);
+
+    close_connection(sock);
+}
+
+void kis_net_beast_httpd::close_connection(std::shared_ptr<connection_socket> sock) {
+    try {
+        sock->stream.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_send);
+    } catch (std::exception& e) {
+        ;
     }
+}
 
-    // Make sure we know we've moved the socket inside the thread before we leave scope
-    socket_moved_ft.wait();
+std::shared_ptr<void> kis_net_beast_httpd::acquire_role_slot(const std::string& role) {
+    kis_lock_guard<kis_mutex> lk(role_mutex, "beast_httpd acquire_role_slot");
 
-    // Accept another connection
-    return start_accept();
+    auto limit_k = role_limits.find(role);
+    if (limit_k == role_limits.end())
+        limit_k = role_limits.find("*");
+
+    auto& active = role_active[role];
+
+    if (limit_k != role_limits.end() && limit_k->second > 0 && active >= limit_k->second)
+        return nullptr;
+
+    active++;
+
+    auto self = shared_from_this();
+
+    return std::shared_ptr<void>(static_cast<void *>(this), [self, role](void *) {
+            kis_lock_guard<kis_mutex> lk(self->role_mutex, "beast_httpd release_role_slot");
+            self->role_active[role]--;
+        });
+}
+
+bool kis_net_beast_httpd::launch_generator(std::function<void ()> generator,
+        std::function<void ()> abort) {
+    if (generator_pool == nullptr)
+        return false;
+
+    return generator_pool->submit(generator, abort);
+}
+
+size_t kis_net_beast_httpd::fetch_active_requests() {
+    if (request_pool == nullptr)
+        return 0;
+
+    return request_pool->active();
+}
+
+size_t kis_net_beast_httpd::fetch_queued_requests() {
+    if (request_pool == nullptr)
+        return 0;
+
+    return request_pool->queued();
+}
+
+size_t kis_net_beast_httpd::fetch_request_workers() {
+    if (request_pool == nullptr)
+        return 0;
+
+    return request_pool->workers();
+}
+
+size_t kis_net_beast_httpd::fetch_streaming_requests() {
+    if (request_pool == nullptr)
+        return 0;
+
+    return request_pool->released();
 }
 
 std::string kis_net_beast_httpd::decode_uri(boost::beast::string_view in, bool query) {
@@ -687,7 +836,7 @@ void kis_net_beast_httpd::register_route(const std::string& route, const std::li
     for (const auto& v : verbs) 
         b_verbs.emplace_back(boost::beast::http::string_to_verb(v));
 
-    route_vec.emplace_back(std::make_shared<kis_net_beast_route>(route, b_verbs, true, roles, handler));
+    route_trie.insert(std::make_shared<kis_net_beast_route>(route, b_verbs, true, roles, handler));
 }
 
 void kis_net_beast_httpd::register_route(const std::string& route, 
@@ -713,18 +862,13 @@ void kis_net_beast_httpd::register_route(const std::string& route,
     for (const auto& v : verbs) 
         b_verbs.emplace_back(boost::beast::http::string_to_verb(v));
 
-    route_vec.emplace_back(std::make_shared<kis_net_beast_route>(route, b_verbs, true, roles, extensions, handler));
+    route_trie.insert(std::make_shared<kis_net_beast_route>(route, b_verbs, true, roles, extensions, handler));
 }
 
 void kis_net_beast_httpd::remove_route(const std::string& route) {
     kis_lock_guard<kis_mutex> lk(route_mutex, "beast_httpd remove_route");
 
-    for (auto i = route_vec.begin(); i != route_vec.end(); ++i) {
-        if ((*i)->route() == route) {
-            route_vec.erase(i);
-            return;
-        }
-    }
+    route_trie.remove(route);
 }
 
 void kis_net_beast_httpd::register_unauth_route(const std::string& route, 
@@ -734,7 +878,7 @@ void kis_net_beast_httpd::register_unauth_route(const std::string& route,
     std::list<boost::beast::http::verb> b_verbs;
     for (const auto& v : verbs) 
         b_verbs.emplace_back(boost::beast::http::string_to_verb(v));
-    route_vec.emplace_back(std::make_shared<kis_net_beast_route>(route, b_verbs, false, 
+    route_trie.insert(std::make_shared<kis_net_beast_route>(route, b_verbs, false, 
                 std::list<std::string>{""}, handler));
 }
 
@@ -745,7 +889,7 @@ void kis_net_beast_httpd::register_unauth_route(const std::string& route,
     std::list<boost::beast::http::verb> b_verbs;
     for (const auto& v : verbs) 
         b_verbs.emplace_back(boost::beast::http::string_to_verb(v));
-    route_vec.emplace_back(std::make_shared<kis_net_beast_route>(route, b_verbs, false, 
+    route_trie.insert(std::make_shared<kis_net_beast_route>(route, b_verbs, false, 
                 std::list<std::string>{""},
                 extensions, handler));
 }
@@ -761,7 +905,7 @@ void kis_net_beast_httpd::register_websocket_route(const std::string& route,
         std::shared_ptr<kis_net_web_endpoint> handler) {
     kis_lock_guard<kis_mutex> lk(route_mutex, "beast_httpd register_websocket_route");
 
-    websocket_route_vec.emplace_back(std::make_shared<kis_net_beast_route>(route, 
+    websocket_route_trie.insert(std::make_shared<kis_net_beast_route>(route, 
                 std::list<boost::beast::http::verb>{}, true, roles, extensions, handler));
 
 }
@@ -918,23 +1062,13 @@ void kis_net_beast_httpd::load_auth() {
 std::shared_ptr<kis_net_beast_route> kis_net_beast_httpd::find_endpoint(std::shared_ptr<kis_net_beast_httpd_connection> con) {
     kis_lock_guard<kis_mutex> lk(route_mutex, "beast_httpd find_endpoint");
 
-    for (const auto& r : route_vec) {
-        if (r->match_url(static_cast<const std::string>(con->uri()), con->uri_params_, con->http_variables_)) 
-            return r;
-    }
-
-    return nullptr;
+    return route_trie.find(con->uri(), con->uri_params_);
 }
 
 std::shared_ptr<kis_net_beast_route> kis_net_beast_httpd::find_websocket_endpoint(std::shared_ptr<kis_net_beast_httpd_connection> con) {
     kis_lock_guard<kis_mutex> lk(route_mutex, "beast_httpd find_websocket_endpoint");
 
-    for (const auto& r : websocket_route_vec) {
-        if (r->match_url(static_cast<const std::string>(con->uri()), con->uri_params_, con->http_variables_))
-            return r;
-    }
-
-    return nullptr;
+    return websocket_route_trie.find(con->uri(), con->uri_params_);
 }
 
 void kis_net_beast_httpd::register_static_dir(const std::string& prefix, const std::string& path) {
@@ -1085,7 +1219,8 @@ kis_net_beast_httpd_connection::kis_net_beast_httpd_connection(boost::beast::tcp
     httpd{httpd},
     stream_{socket},
     login_valid_{false},
-    first_response_write{false} {
+    first_response_write{false},
+    streaming_{false} {
         Globalreg::n_tracked_http_connections++;
     }
 
@@ -1124,6 +1259,14 @@ void kis_net_beast_httpd_connection::set_target_file(const std::string& fname) {
             fmt::format("attachment; filename=\"{}\"", fname));
 }
 
+void kis_net_beast_httpd_connection::set_streaming() {
+    if (streaming_.exchange(true))
+        return;
+
+    // Called from the generator; the request thread releases itself when it sees the flag
+    kis_net_beast_worker_pool::release_current_worker();
+}
+
 void kis_net_beast_httpd_connection::clear_timeout() {
     boost::beast::get_lowest_layer(stream_).expires_never();
 }
@@ -1322,6 +1465,27 @@ bool kis_net_beast_httpd_connection::start() {
             return do_close();
         }
 
+        auto role_slot = httpd->acquire_role_slot(login_role_);
+
+        if (role_slot == nullptr) {
+            boost::beast::http::response<boost::beast::http::string_body> 
+                res{boost::beast::http::status::too_many_requests, request_.version()};
+
+            res.set(boost::beast::http::field::server, "Kismet");
+            res.set(boost::beast::http::field::content_type, "text/html");
+            res.set(boost::beast::http::field::retry_after, "1");
+            res.body() = std::string("<html><head><title>429 Too many requests</title></head><body>"
+                    "<h1>429 Too many requests</h1><br><p>Too many requests are already running "
+                    "for this role.</p></body></html>\n");
+            res.prepare_payload();
+
+            boost::system::error_code error;
+
+            boost::beast::http::write(stream_, res, error);
+
+            return do_close();
+        }
+
         boost::beast::get_lowest_layer(stream_).expires_never();
 
         route->invoke(shared_from_this());
@@ -1329,6 +1493,9 @@ bool kis_net_beast_httpd_connection::start() {
         return do_close();
     }
 
+    // Held until the request completes, counting against the concurrency limit of the role
+    std::shared_ptr<void> role_slot;
+
     // Look for a route
     auto route = httpd->find_endpoint(shared_from_this());
 
@@ -1382,6 +1549,30 @@ bool kis_net_beast_httpd_connection::start() {
 
             return true;
         }
+
+        role_slot = httpd->acquire_role_slot(login_role_);
+
+        if (role_slot == nullptr) {
+            boost::beast::http::response<boost::beast::http::string_body> 
+                res{boost::beast::http::status::too_many_requests, request_.version()};
+
+            res.set(boost::beast::http::field::server, "Kismet");
+            res.set(boost::beast::http::field::content_type, "text/html");
+            res.set(boost::beast::http::field::retry_after, "1");
+            res.body() = std::string("<html><head><title>429 Too many requests</title></head><body>"
+                    "<h1>429 Too many requests</h1><br><p>Too many requests are already running "
+                    "for this role.</p></body></html>\n");
+            res.prepare_payload();
+
+            boost::system::error_code error;
+
+            boost::beast::http::write(stream_, res, error);
+
+            if (error || client_req_close) 
+                return do_close();
+
+            return true;
+        }
     } else if (route == nullptr) {
         bool file_served = false;
         if (verb_ == boost::beast::http::verb::get || verb_ == boost::beast::http::verb::head)
@@ -1457,13 +1648,13 @@ bool kis_net_beast_httpd_connection::start() {
         boost::beast::http::fields> sr{response};
 
 
-    // Spawn the generator thread
+    // Run the generator on the generator pool
     auto generator_launched = std::promise<void>();
     auto generator_ft = generator_launched.get_future();
 
     auto self_ref = shared_from_this();
 
-    std::thread tr([this, route, &generator_launched, self_ref]() {
+    auto launched = httpd->launch_generator([this, route, &generator_launched, self_ref]() {
         generator_launched.set_value();
 
         try {
@@ -1480,13 +1671,40 @@ bool kis_net_beast_httpd_connection::start() {
         }
 
         response_stream_.complete();
+    }, [&generator_launched]() {
+        // The server stopped before the generator got a thread
+        generator_launched.set_exception(std::make_exception_ptr(std::runtime_error("httpd shutting down")));
     });
-    tr.detach();
 
-    generator_ft.wait();
+    if (!launched) {
+        boost::beast::http::response<boost::beast::http::string_body> 
+            res{boost::beast::http::status::service_unavailable, request_.version()};
+
+        res.set(boost::beast::http::field::server, "Kismet");
+        res.set(boost::beast::http::field::content_type, "text/html");
+        res.body() = std::string("<html><head><title>503 Service unavailable</title></head><body>"
+                "<h1>503 Service unavailable</h1><br><p>The server is handling too many requests.</p>"
+                "</body></html>\n");
+        res.prepare_payload();
+
+        boost::system::error_code error;
+
+        boost::beast::http::write(stream_, res, error);
+
+        return do_close();
+    }
+
+    try {
+        generator_ft.get();
+    } catch (const std::exception& e) {
+        return do_close();
+    }
 
     boost::system::error_code error;
     while (response_stream_.size() || response_stream_.running()) {
+        if (streaming_)
+            kis_net_beast_worker_pool::release_current_worker();
+
         auto sz = response_stream_.size();
 
         if (sz) {
@@ -1577,21 +1795,8 @@ kis_net_beast_route::kis_net_beast_route(const std::string& route,
     verbs_{verbs},
     login_{login},
     roles_{roles},
-    match_types{false} {
-
-    // Generate the keys list
-    for (auto i = std::sregex_token_iterator(route.begin(), route.end(), path_re); 
-            i != std::sregex_token_iterator(); i++) {
-        match_keys.push_back(static_cast<std::string>(*i));
-    }
-
-    match_keys.push_back("GETVARS");
-
-    // Generate the extractor expressions
-    auto ext_str = std::regex_replace(route, path_re, path_capture_pattern);
-    // Match the RE + http variables
-    match_re = std::regex(fmt::format("^{}(\\?.*?)?$", ext_str));
-}
+    match_types_{false},
+    segments_{split_route(route)} { }
 
 kis_net_beast_route::kis_net_beast_route(const std::string& route, 
         const std::list<boost::beast::http::verb>& verbs,
@@ -1602,73 +1807,54 @@ kis_net_beast_route::kis_net_beast_route(const std::string& route,
     verbs_{verbs},
     login_{login},
     roles_{roles},
-    match_types{true} {
+    match_types_{true},
+    extensions_{extensions.begin(), extensions.end()},
+    segments_{split_route(route)} { }
 
-    // Generate the keys list
-    for (auto i = std::sregex_token_iterator(route.begin(), route.end(), path_re); 
-            i != std::sregex_token_iterator(); i++) {
-        match_keys.push_back(static_cast<std::string>(*i));
-    }
+std::vector<kis_net_beast_route::segment> kis_net_beast_route::split_route(const std::string& route) {
+    std::vector<segment> ret;
 
-    match_keys.push_back("FILETYPE");
-    match_keys.push_back("GETVARS");
+    size_t start = 0;
 
-    // Generate the file type regex
-    auto ft_regex = std::string("\\.(");
-    if (extensions.size() == 0) {
-        // If passed an empty list we accept all types and resolve during serialization
-        ft_regex += "[A-Za-z0-9]+";
-    } else {
-        bool prepend_pipe = false;
-        for (const auto& i : extensions) {
-            if (prepend_pipe)
-                ft_regex += fmt::format("|{}", i);
-            else
-                ft_regex += fmt::format("{}", i);
-            prepend_pipe = true;
-        }
-    }
-    ft_regex += ")";
+    while (true) {
+        auto end = route.find('/', start);
+        auto seg = route.substr(start, end == std::string::npos ? std::string::npos : end - start);
 
-    // Generate the extractor expressions
-    auto ext_str = std::regex_replace(route, path_re, path_capture_pattern);
+        ret.emplace_back(segment{seg.length() > 1 && seg[0] == ':', seg});
 
-    // Match the RE + filetypes + http variables
-    match_re = std::regex(fmt::format("^{}{}(\\?.*?)?$", ext_str, ft_regex));
-}
+        if (end == std::string::npos)
+            break;
 
-bool kis_net_beast_route::match_url(const std::string& url, 
-        kis_net_beast_httpd_connection::uri_param_t& uri_params,
-        kis_net_beast_httpd::http_var_map_t& uri_variables) {
+        start = end + 1;
+    }
 
-    auto match_values = std::smatch();
+    return ret;
+}
 
-    if (!std::regex_match(url, match_values, match_re)) 
-        return false;
+bool kis_net_beast_route::match_extension(bool has_extension, 
+        const boost::beast::string_view& extension) const {
+    if (!match_types_)
+        return !has_extension;
 
-    if (match_values.size() != match_keys.size() + 1) {
-        // _MSG_ERROR("(DEBUG) HTTP req {} didn't match enough elements, {} wanted {}", url, match_values.size(), match_keys.size());
+    if (!has_extension || extension.length() == 0)
         return false;
-    }
 
-    size_t key_num = 0;
-    bool first = true;
-    for (const auto& i : match_values) {
-        if (first) {
-            first = false;
-            continue;
+    // If passed an empty list we accept all types and resolve during serialization
+    if (extensions_.size() == 0) {
+        for (const auto& c : extension) {
+            if (!std::isalnum(static_cast<unsigned char>(c)))
+                return false;
         }
 
-        if (key_num >= match_keys.size()) {
-            // _MSG_ERROR("(DEBUG) HTTP req {} matched more values than known keys in route, something is wrong key pos {}", url, key_num);
-            continue;
-        }
+        return true;
+    }
 
-        uri_params.emplace(std::make_pair(match_keys[key_num], static_cast<std::string>(i)));
-        key_num++;
+    for (const auto& e : extensions_) {
+        if (extension == boost::beast::string_view(e))
+            return true;
     }
 
-    return true;
+    return false;
 }
 
 bool kis_net_beast_route::match_verb(boost::beast::http::verb verb) {
@@ -1711,6 +1897,234 @@ void kis_net_beast_route::invoke(std::shared_ptr<kis_net_beast_httpd_connection>
 }
 
 
+kis_net_beast_route_trie::capture_type kis_net_beast_route_trie::capture_type_for(const std::string& key) {
+    if (key == ":uuid")
+        return capture_type::uuid;
+    if (key == ":key")
+        return capture_type::key;
+    if (key == ":mac")
+        return capture_type::mac;
+
+    return capture_type::any;
+}
+
+bool kis_net_beast_route_trie::match_capture(capture_type type, const boost::beast::string_view& value) {
+    if (value.length() == 0)
+        return false;
+
+    switch (type) {
+        case capture_type::any:
+            return true;
+        case capture_type::uuid:
+            for (const auto& c : value) 
+                if (!std::isxdigit(static_cast<unsigned char>(c)) && c != '-')
+                    return false;
+            return true;
+        case capture_type::key:
+            for (const auto& c : value) 
+                if (!std::isxdigit(static_cast<unsigned char>(c)) && c != '_')
+                    return false;
+            return true;
+        case capture_type::mac:
+            // Macs may be partial, and masked with a '*' or ':'-less mask
+            for (const auto& c : value) 
+                if (!std::isxdigit(static_cast<unsigned char>(c)) && c != ':' && c != '*')
+                    return false;
+            return true;
+    }
+
+    return false;
+}
+
+void kis_net_beast_route_trie::insert(std::shared_ptr<kis_net_beast_route> route) {
+    auto n = root.get();
+
+    for (const auto& s : route->segments()) {
+        if (s.capture) {
+            auto type = capture_type_for(s.value);
+
+            node *next = nullptr;
+            for (const auto& c : n->captures) {
+                if (c.first == type) {
+                    next = c.second.get();
+                    break;
+                }
+            }
+
+            if (next == nullptr) {
+                n->captures.emplace_back(std::make_pair(type, std::make_unique<node>()));
+                next = n->captures.back().second.get();
+            }
+
+            n = next;
+        } else {
+            auto& next = n->literals[s.value];
+            if (next == nullptr)
+                next = std::make_unique<node>();
+            n = next.get();
+        }
+    }
+
+    n->routes.emplace_back(std::make_pair(next_seq++, route));
+    size_++;
+}
+
+bool kis_net_beast_route_trie::remove(const std::string& route) {
+    auto n = root.get();
+
+    for (const auto& s : kis_net_beast_route::split_route(route)) {
+        node *next = nullptr;
+
+        if (s.capture) {
+            auto type = capture_type_for(s.value);
+            for (const auto& c : n->captures) {
+                if (c.first == type) {
+                    next = c.second.get();
+                    break;
+                }
+            }
+        } else {
+            auto k = n->literals.find(s.value);
+            if (k != n->literals.end())
+                next = k->second.get();
+        }
+
+        if (next == nullptr)
+            return false;
+
+        n = next;
+    }
+
+    for (auto i = n->routes.begin(); i != n->routes.end(); ++i) {
+        if (i->second->route() == route) {
+            n->routes.erase(i);
+            size_--;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::shared_ptr<kis_net_beast_route> kis_net_beast_route_trie::find(const boost::beast::string_view& url,
+        uri_param_t& uri_params) const {
+
+    // Variables have normally been stripped already, but preserve them if they're still present
+    auto path = url;
+    auto getvars = boost::beast::string_view{};
+    auto qpos = url.find('?');
+    if (qpos != boost::beast::string_view::npos) {
+        path = url.substr(0, qpos);
+        getvars = url.substr(qpos);
+    }
+
+    std::vector<boost::beast::string_view> segments;
+    size_t start = 0;
+    while (true) {
+        auto end = path.find('/', start);
+
+        if (end == boost::beast::string_view::npos) {
+            segments.emplace_back(path.substr(start));
+            break;
+        }
+
+        segments.emplace_back(path.substr(start, end - start));
+        start = end + 1;
+    }
+
+    match_state state{segments, {}, std::numeric_limits<uint64_t>::max(), nullptr, {}, {}};
+    find_recurse(root.get(), 0, state);
+
+    if (state.best == nullptr)
+        return nullptr;
+
+    size_t cnum = 0;
+    for (const auto& s : state.best->segments()) {
+        if (!s.capture)
+            continue;
+
+        if (cnum >= state.best_captures.size())
+            break;
+
+        uri_params.emplace(std::make_pair(s.value, static_cast<std::string>(state.best_captures[cnum])));
+        cnum++;
+    }
+
+    if (state.best->match_types())
+        uri_params.emplace(std::make_pair("FILETYPE", static_cast<std::string>(state.best_extension)));
+
+    uri_params.emplace(std::make_pair("GETVARS", static_cast<std::string>(getvars)));
+
+    return state.best;
+}
+
+void kis_net_beast_route_trie::find_recurse(const node *n, size_t depth, match_state& state) const {
+    const auto& segment = state.segments[depth];
+
+    if (depth + 1 == state.segments.size()) {
+        // The final segment is tried whole, and split at each '.' into a name and extension; 
+        // earlier splits win, matching the shortest name
+        descend(n, segment, boost::beast::string_view{}, false, state);
+
+        for (auto pos = segment.find('.'); pos != boost::beast::string_view::npos; 
+                pos = segment.find('.', pos + 1)) 
+            descend(n, segment.substr(0, pos), segment.substr(pos + 1), true, state);
+
+        return;
+    }
+
+    auto k = n->literals.find(static_cast<std::string>(segment));
+    if (k != n->literals.end())
+        find_recurse(k->second.get(), depth + 1, state);
+
+    for (const auto& c : n->captures) {
+        if (!match_capture(c.first, segment))
+            continue;
+
+        state.captures.push_back(segment);
+        find_recurse(c.second.get(), depth + 1, state);
+        state.captures.pop_back();
+    }
+}
+
+void kis_net_beast_route_trie::descend(const node *n, const boost::beast::string_view& segment,
+        const boost::beast::string_view& extension, bool has_extension, match_state& state) const {
+
+    auto k = n->literals.find(static_cast<std::string>(segment));
+    if (k != n->literals.end())
+        match_terminal(k->second.get(), extension, has_extension, state);
+
+    for (const auto& c : n->captures) {
+        if (!match_capture(c.first, segment))
+            continue;
+
+        state.captures.push_back(segment);
+        match_terminal(c.second.get(), extension, has_extension, state);
+        state.captures.pop_back();
+    }
+}
+
+void kis_net_beast_route_trie::match_terminal(const node *n, const boost::beast::string_view& extension,
+        bool has_extension, match_state& state) const {
+
+    // Routes are held in registration order, so the first acceptable one is the best at this node
+    for (const auto& r : n->routes) {
+        if (r.first >= state.best_seq)
+            return;
+
+        if (!r.second->match_extension(has_extension, extension))
+            continue;
+
+        state.best_seq = r.first;
+        state.best = r.second;
+        state.best_captures = state.captures;
+        state.best_extension = extension;
+
+        return;
+    }
+}
+
+
 
 kis_net_beast_auth::kis_net_beast_auth(const Json::Value& json)  {
     try {
@@ -1876,6 +2290,10 @@ void kis_net_web_websocket_endpoint::handle_request(std::shared_ptr<kis_net_beas
 
     ws_.accept(con->request());
 
+    // A websocket can stay open for as long as the client likes, so it doesn't hold a
+    // request worker
+    con->set_streaming();
+
     running = true;
 
     auto running_future = running_promise.get_future();
@@ -1886,3 +2304,152 @@ void kis_net_web_websocket_endpoint::handle_request(std::shared_ptr<kis_net_beas
     running_future.wait();
 }
 
+
+namespace {
+    // Pool the current thread is working for, if any, if it has been released from it, and
+    // if the pool refused to release it for the current work
+    thread_local kis_net_beast_worker_pool *local_worker_pool = nullptr;
+    thread_local bool local_worker_released = false;
+    thread_local bool local_worker_refused = false;
+}
+
+bool kis_net_beast_worker_pool::submit(std::function<void ()> work, std::function<void ()> abort) {
+    {
+        std::lock_guard<std::mutex> lk(mutex);
+
+        if (shutdown)
+            return false;
+
+        if (n_workers >= max_workers && queue.size() >= n_idle + max_queued)
+            return false;
+
+        queue.push_back(pool_work{std::move(work), std::move(abort)});
+
+        if (queue.size() > n_idle && n_workers < max_workers)
+            launch_worker();
+    }
+
+    cv.notify_one();
+
+    return true;
+}
+
+void kis_net_beast_worker_pool::launch_worker() {
+    // Called with the pool locked
+    n_workers++;
+
+    auto self = shared_from_this();
+    std::thread([self]() {
+            self->worker();
+            }).detach();
+}
+
+void kis_net_beast_worker_pool::stop() {
+    std::deque<pool_work> pending;
+
+    {
+        std::lock_guard<std::mutex> lk(mutex);
+        shutdown = true;
+        pending.swap(queue);
+    }
+
+    cv.notify_all();
+
+    // Work which never got a thread may still have someone waiting on it
+    for (auto& w : pending) {
+        if (w.abort == nullptr)
+            continue;
+
+        try {
+            w.abort();
+        } catch (const std::exception& e) {
+            ;
+        }
+    }
+}
+
+void kis_net_beast_worker_pool::release_current_worker() {
+    if (local_worker_pool == nullptr || local_worker_released || local_worker_refused)
+        return;
+
+    if (local_worker_pool->release_worker())
+        local_worker_released = true;
+    else
+        local_worker_refused = true;
+}
+
+bool kis_net_beast_worker_pool::release_worker() {
+    std::lock_guard<std::mutex> lk(mutex);
+
+    // Too many long-running workers already; this one stays counted against the pool
+    if (n_released >= max_released)
+        return false;
+
+    n_workers--;
+    n_active--;
+    n_released++;
+
+    // Replace this worker if there's work waiting for it
+    if (!shutdown && queue.size() > n_idle && n_workers < max_workers)
+        launch_worker();
+
+    return true;
+}
+
+size_t kis_net_beast_worker_pool::queued() {
+    std::lock_guard<std::mutex> lk(mutex);
+
+    if (queue.size() > n_idle)
+        return queue.size() - n_idle;
+
+    return 0;
+}
+
+void kis_net_beast_worker_pool::worker() {
+    thread_set_process_name(name);
+
+    local_worker_pool = this;
+
+    std::unique_lock<std::mutex> lk(mutex);
+
+    while (!shutdown) {
+        n_idle++;
+        cv.wait(lk, [this]() { return shutdown || !queue.empty(); });
+        n_idle--;
+
+        if (shutdown)
+            break;
+
+        auto work = std::move(queue.front().work);
+        queue.pop_front();
+
+        lk.unlock();
+
+        n_active++;
+
+        try {
+            work();
+        } catch (const std::exception& e) {
+            ;
+        }
+
+        // Release anything the work captured before waiting again
+        work = nullptr;
+
+        local_worker_refused = false;
+
+        if (local_worker_released) {
+            // Another worker may already have taken our place in the pool
+            local_worker_pool = nullptr;
+            local_worker_released = false;
+            n_released--;
+            return;
+        }
+
+        n_active--;
+
+        lk.lock();
+    }
+
+    n_workers--;
+}
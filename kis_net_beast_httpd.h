@@ -22,7 +22,11 @@
 #include "config.h"
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
 #include <list>
+#include <mutex>
 #include <regex>
 #include <string>
 #include <thread>
@@ -45,6 +49,135 @@ class kis_net_beast_route;
 class kis_net_beast_auth;
 class kis_net_web_endpoint;
 
+// Route table organized as a trie of path segments.  Literal segments are a direct
+// lookup at each level, and capture segments (:name) are tried after them.  Captures
+// named :uuid, :key, and :mac only match text which could be that type.
+//
+// The file extension of a request is split from the final segment and checked against
+// the extensions the route accepts.
+//
+// When more than one route matches a URL, the earliest registered wins, as it did
+// when routes were matched linearly.
+class kis_net_beast_route_trie {
+public:
+    using uri_param_t = std::unordered_map<std::string, std::string>;
+
+    enum class capture_type {
+        any, uuid, key, mac
+    };
+
+    kis_net_beast_route_trie() :
+        root{std::make_unique<node>()},
+        next_seq{0},
+        size_{0} { }
+
+    void insert(std::shared_ptr<kis_net_beast_route> route);
+
+    // Remove the earliest route registered with this path
+    bool remove(const std::string& route);
+
+    // Find the route matching a decoded URL, and populate the uri params
+    std::shared_ptr<kis_net_beast_route> find(const boost::beast::string_view& url,
+            uri_param_t& uri_params) const;
+
+    size_t size() const { return size_; }
+
+    static capture_type capture_type_for(const std::string& key);
+    static bool match_capture(capture_type type, const boost::beast::string_view& value);
+
+protected:
+    struct node {
+        std::unordered_map<std::string, std::unique_ptr<node>> literals;
+        std::vector<std::pair<capture_type, std::unique_ptr<node>>> captures;
+        // Routes terminating at this node, with their registration sequence
+        std::vector<std::pair<uint64_t, std::shared_ptr<kis_net_beast_route>>> routes;
+    };
+
+    struct match_state {
+        const std::vector<boost::beast::string_view>& segments;
+        std::vector<boost::beast::string_view> captures;
+
+        uint64_t best_seq;
+        std::shared_ptr<kis_net_beast_route> best;
+        std::vector<boost::beast::string_view> best_captures;
+        boost::beast::string_view best_extension;
+    };
+
+    void find_recurse(const node *n, size_t depth, match_state& state) const;
+    void match_terminal(const node *n, const boost::beast::string_view& extension,
+            bool has_extension, match_state& state) const;
+    void descend(const node *n, const boost::beast::string_view& segment,
+            const boost::beast::string_view& extension, bool has_extension, match_state& state) const;
+
+    std::unique_ptr<node> root;
+    uint64_t next_seq;
+    size_t size_;
+};
+
+// Bounded pool of threads for running http work.  Threads are launched as work arrives,
+// up to the maximum, and then remain to service later work.  Work beyond the maximum
+// waits in a queue, and work beyond the queue limit is refused.  Long-running work, such
+// as a websocket or a packet stream, releases its thread from the pool and no longer
+// counts against it, up to a separate limit of released threads; past that limit the
+// thread stays counted against the pool until its work completes.
+class kis_net_beast_worker_pool : public std::enable_shared_from_this<kis_net_beast_worker_pool> {
+public:
+    kis_net_beast_worker_pool(const std::string& name, size_t max_workers, size_t max_queued,
+            size_t max_released) :
+        name{name},
+        max_workers{max_workers},
+        max_queued{max_queued},
+        max_released{max_released},
+        shutdown{false},
+        n_workers{0},
+        n_idle{0},
+        n_active{0},
+        n_released{0} { }
+
+    // Queue work; returns false if the pool and queue are full.  If the pool is stopped
+    // before the work runs, abort is called instead so anything waiting on the work can
+    // give up.
+    bool submit(std::function<void ()> work, std::function<void ()> abort = nullptr);
+
+    // Stop idle workers and abort queued work; workers in a request exit when it completes
+    void stop();
+
+    // Release the calling thread from its pool, if it is a pool worker and the pool is under
+    // its release limit; the pool may start another worker in its place, and the calling
+    // thread exits when its work completes
+    static void release_current_worker();
+
+    size_t workers() { return n_workers; }
+    size_t active() { return n_active; }
+    size_t released() { return n_released; }
+    size_t queued();
+
+protected:
+    void worker();
+    bool release_worker();
+    void launch_worker();
+
+    struct pool_work {
+        std::function<void ()> work;
+        std::function<void ()> abort;
+    };
+
+    std::string name;
+    size_t max_workers;
+    size_t max_queued;
+    size_t max_released;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<pool_work> queue;
+    bool shutdown;
+
+    std::atomic<size_t> n_workers;
+    size_t n_idle;
+    std::atomic<size_t> n_active;
+    std::atomic<size_t> n_released;
+};
+
 class kis_net_beast_httpd : public lifetime_global, public deferred_startup,
     public std::enable_shared_from_this<kis_net_beast_httpd> {
 public:
@@ -148,6 +281,21 @@ public:
 
     bool serve_file(std::shared_ptr<kis_net_beast_httpd_connection> con);
 
+    // Count a request against the concurrency limit of its role; returns a slot which
+    // must be held for the duration of the request, or nullptr if the role is at its limit
+    std::shared_ptr<void> acquire_role_slot(const std::string& role);
+
+    // Run streaming response generators on the bounded generator pool; abort is called
+    // instead if the pool stops before the generator runs
+    bool launch_generator(std::function<void ()> generator, std::function<void ()> abort);
+
+    size_t fetch_active_requests();
+    size_t fetch_queued_requests();
+    size_t fetch_request_workers();
+    size_t fetch_streaming_requests();
+    size_t fetch_idle_connections() { return n_idle_connections; }
+    size_t fetch_rejected_requests() { return n_rejected_requests; }
+
     void strip_uri_prefix(boost::beast::string_view& uri_view);
 
 protected:
@@ -161,8 +309,8 @@ protected:
     std::unordered_map<std::string, std::string> mime_map;
 
     kis_mutex route_mutex;
-    std::vector<std::shared_ptr<kis_net_beast_route>> route_vec;
-    std::vector<std::shared_ptr<kis_net_beast_route>> websocket_route_vec;
+    kis_net_beast_route_trie route_trie;
+    kis_net_beast_route_trie websocket_route_trie;
 
     kis_mutex auth_mutex;
     std::vector<std::shared_ptr<kis_net_beast_auth>> auth_vec;
@@ -187,6 +335,38 @@ protected:
     void start_accept();
     void handle_connection(const boost::system::error_code& ec, boost::asio::ip::tcp::socket socket);
 
+    // An accepted connection; between requests it waits for data on the io context
+    // instead of holding a thread
+    struct connection_socket {
+        connection_socket(boost::asio::ip::tcp::socket socket) :
+            strand{boost::asio::make_strand(Globalreg::globalreg->io)},
+            stream{std::move(socket)},
+            timer{strand},
+            waiting{false},
+            wait_gen{0} { }
+
+        boost::asio::strand<boost::asio::io_context::executor_type> strand;
+        boost::beast::tcp_stream stream;
+        boost::asio::steady_timer timer;
+        bool waiting;
+        uint64_t wait_gen;
+    };
+
+    void wait_connection_request(std::shared_ptr<connection_socket> sock);
+    void run_connection_request(std::shared_ptr<connection_socket> sock);
+    void reject_connection_request(std::shared_ptr<connection_socket> sock);
+    void close_connection(std::shared_ptr<connection_socket> sock);
+
+    std::shared_ptr<kis_net_beast_worker_pool> request_pool;
+    std::shared_ptr<kis_net_beast_worker_pool> generator_pool;
+
+    std::atomic<size_t> n_idle_connections;
+    std::atomic<size_t> n_rejected_requests;
+
+    kis_mutex role_mutex;
+    std::unordered_map<std::string, size_t> role_limits;
+    std::unordered_map<std::string, size_t> role_active;
+
     bool use_ssl;
     bool serve_files;
 
@@ -259,6 +439,10 @@ public:
         closure_cb = cb;
     }
 
+    // Mark the response as long-running, such as a packet stream; the request and generator
+    // threads are released from the http worker pools so they don't hold up other requests
+    void set_streaming();
+
     static std::string escape_html(const boost::beast::string_view& html) {
         return kis_net_beast_httpd::escape_html(html);
     }
@@ -294,6 +478,7 @@ protected:
     boost::beast::string_view http_post;
 
     std::atomic<bool> first_response_write;
+    std::atomic<bool> streaming_;
 
     bool do_close();
 
@@ -572,9 +757,19 @@ public:
             const std::list<std::string>& extensions, 
             std::shared_ptr<kis_net_web_endpoint> handler);
 
-    // Does a URL match this route?  If so, populate uri params and uri variables
-    bool match_url(const std::string& url, kis_net_beast_httpd_connection::uri_param_t& uri_params,
-            kis_net_beast_httpd::http_var_map_t& uri_variables);
+    // A path segment of the route; captures hold their key (including the leading :)
+    struct segment {
+        bool capture;
+        std::string value;
+    };
+
+    const std::vector<segment>& segments() const { return segments_; }
+    static std::vector<segment> split_route(const std::string& route);
+
+    // Does this route accept a file extension?  Routes without extensions only
+    // match the exact path
+    bool match_extension(bool has_extension, const boost::beast::string_view& extension) const;
+    bool match_types() const { return match_types_; }
 
     // Is the verb compatible?
     bool match_verb(boost::beast::http::verb verb);
@@ -598,14 +793,10 @@ protected:
 
     std::list<std::string> roles_;
 
-    const std::string path_id_pattern = ":([^\\/]+)?";
-    const std::string path_capture_pattern = "(?:([^\\/]+?))";
-    const std::regex path_re = std::regex(path_id_pattern);
-
-    bool match_types;
-    std::vector<std::string> match_keys;
+    bool match_types_;
+    std::vector<std::string> extensions_;
 
-    std::regex match_re;
+    std::vector<segment> segments_;
 };
 
 struct auth_construction_error : public std::exception {
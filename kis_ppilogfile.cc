@@ -101,7 +101,8 @@ bool kis_ppi_logfile::open_log(std::string in_path) {
 
     lk.unlock();
 
-	packetchain->register_handler(&kis_ppi_logfile::packet_handler, this, CHAINPOS_LOGGING, -100);
+	packetchain->register_handler(&kis_ppi_logfile::packet_handler, this, CHAINPOS_LOGGING, -100,
+	        "kis_ppilogfile packet_handler");
 
     return true;
 }
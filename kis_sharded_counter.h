@@ -0,0 +1,128 @@
+/*
+    This file is part of Kismet
+
+    Kismet is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Kismet is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Kismet; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef __KIS_SHARDED_COUNTER_H__
+#define __KIS_SHARDED_COUNTER_H__
+
+#include "config.h"
+
+#include <atomic>
+#include <stdint.h>
+
+// Sharded counters for hot paths which are updated from many threads at once.
+//
+// Each thread is assigned a cache-line aligned shard the first time it touches
+// any sharded counter, so updates are a single relaxed atomic op on a line which
+// is (almost always) private to that thread.  Readers fold all the shards together,
+// which is much more expensive, and is intended to be done from a periodic timer.
+
+#define KIS_COUNTER_SHARDS      32
+
+namespace kismet {
+    inline unsigned int counter_shard() {
+        static std::atomic<unsigned int> next_shard{0};
+        thread_local unsigned int shard =
+            next_shard.fetch_add(1, std::memory_order_relaxed) % KIS_COUNTER_SHARDS;
+        return shard;
+    }
+}
+
+// Sum of all increments
+class kis_sharded_counter {
+public:
+    kis_sharded_counter() {
+        for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+            shards[i].v.store(0, std::memory_order_relaxed);
+    }
+
+    kis_sharded_counter(const kis_sharded_counter&) = delete;
+    kis_sharded_counter& operator=(const kis_sharded_counter&) = delete;
+
+    void add(int64_t n = 1) {
+        shards[kismet::counter_shard()].v.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    // Total of all shards, without resetting
+    int64_t get() const {
+        int64_t r = 0;
+
+        for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+            r += shards[i].v.load(std::memory_order_relaxed);
+
+        return r;
+    }
+
+    // Total of all shards since the last fetch_reset, resetting them
+    int64_t fetch_reset() {
+        int64_t r = 0;
+
+        for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+            r += shards[i].v.exchange(0, std::memory_order_relaxed);
+
+        return r;
+    }
+
+protected:
+    struct alignas(64) shard_t {
+        std::atomic<int64_t> v;
+    };
+
+    shard_t shards[KIS_COUNTER_SHARDS];
+};
+
+// Largest sample seen
+class kis_sharded_peak {
+public:
+    kis_sharded_peak() {
+        for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+            shards[i].v.store(0, std::memory_order_relaxed);
+    }
+
+    kis_sharded_peak(const kis_sharded_peak&) = delete;
+    kis_sharded_peak& operator=(const kis_sharded_peak&) = delete;
+
+    void sample(int64_t n) {
+        auto& s = shards[kismet::counter_shard()].v;
+        auto cur = s.load(std::memory_order_relaxed);
+
+        while (n > cur && !s.compare_exchange_weak(cur, n, std::memory_order_relaxed))
+            ;
+    }
+
+    // Largest sample across all shards since the last fetch_reset, resetting them
+    int64_t fetch_reset() {
+        int64_t r = 0;
+
+        for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++) {
+            auto v = shards[i].v.exchange(0, std::memory_order_relaxed);
+            if (v > r)
+                r = v;
+        }
+
+        return r;
+    }
+
+protected:
+    struct alignas(64) shard_t {
+        std::atomic<int64_t> v;
+    };
+
+    shard_t shards[KIS_COUNTER_SHARDS];
+};
+
+#endif
@@ -122,6 +122,7 @@
 #include "manuf.h"
 #include "entrytracker.h"
 #include "json_adapter.h"
+#include "binary_adapter.h"
 
 #include "kis_server_announce.h"
 
@@ -461,9 +462,6 @@ int main(int argc, char *argv[], char *envp[]) {
     globalregistry = Globalreg::globalreg;
     globalreg = globalregistry;
 
-    Globalreg::n_tracked_fields = 0;
-    Globalreg::n_tracked_components = 0;
-
     // Block all signals across all threads, then set up a signal handling service thread
     // to deal with them
     sigemptyset(&core_signal_mask);
@@ -786,6 +784,8 @@ int main(int argc, char *argv[], char *envp[]) {
     entrytracker->register_serializer("ekjson", std::make_shared<ek_json_adapter::serializer>());
     entrytracker->register_serializer("itjson", std::make_shared<it_json_adapter::serializer>());
     entrytracker->register_serializer("prettyjson", std::make_shared<pretty_json_adapter::serializer>());
+    entrytracker->register_serializer("msgpack", std::make_shared<msgpack_adapter::serializer>());
+    entrytracker->register_serializer("cbor", std::make_shared<cbor_adapter::serializer>());
 
     entrytracker->register_serializer("jcmd", std::make_shared<json_adapter::serializer>());
     entrytracker->register_serializer("cmd", std::make_shared<json_adapter::serializer>());
@@ -0,0 +1,213 @@
+/*
+    This file is part of Kismet
+
+    Kismet is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Kismet is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Kismet; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef __KISMETDB_DEVICE_CODEC_H__
+#define __KISMETDB_DEVICE_CODEC_H__
+
+#include "config.h"
+
+#include <string>
+
+#include <zlib.h>
+
+// Encoding of the 'device' column of the kismetdb devices table, recorded per row in
+// the 'device_format' column.  Logs older than kismetdb version 8 have no format
+// column and are always plain JSON.
+//
+// Compressed records are zlib streams of the same JSON, deflated against a preset
+// dictionary of the common device field names.  The dictionary is part of the
+// format:  it must never change once logs have been written with it; a new
+// dictionary needs a new format number.
+#define KISMETDB_DEVICE_FORMAT_JSON         0
+#define KISMETDB_DEVICE_FORMAT_JSON_DEFLATE 1
+
+// Field names, least common first; zlib favors matches near the end of the dictionary
+static const char kismetdb_device_dictionary_v1[] =
+    "\"dot11.advertisedssid.wps_config_methods\": "
+    "\"dot11.advertisedssid.wps_device_name\": \"dot11.advertisedssid.wps_manuf\": "
+    "\"dot11.advertisedssid.wps_model_name\": "
+    "\"dot11.advertisedssid.wps_model_number\": "
+    "\"dot11.advertisedssid.wps_serial_number\": \"dot11.advertisedssid.wps_state\": "
+    "\"dot11.advertisedssid.wps_uuid_e\": \"dot11.advertisedssid.wps_version\": "
+    "\"dot11.advertisedssid.owe_bssid\": \"dot11.advertisedssid.owe_ssid\": "
+    "\"dot11.advertisedssid.owe_ssid_len\": \"dot11.advertisedssid.dot11r_mobility\": "
+    "\"dot11.advertisedssid.dot11r_mobility_domain_id\": "
+    "\"dot11.advertisedssid.dot11e_channel_utilization_perc\": "
+    "\"dot11.advertisedssid.dot11e_qbss\": "
+    "\"dot11.advertisedssid.dot11e_qbss_stations\": "
+    "\"dot11.advertisedssid.dot11d_country\": \"dot11.advertisedssid.dot11d_list\": "
+    "\"dot11.advertisedssid.ccx_txpower\": \"dot11.advertisedssid.cisco_client_mfp\": "
+    "\"dot11.advertisedssid.wpa_mfp_required\": "
+    "\"dot11.advertisedssid.wpa_mfp_supported\": "
+    "\"dot11.advertisedssid.ie_tag_content\": \"dot11.advertisedssid.ie_tag_list\": "
+    "\"dot11.advertisedssid.ietag_checksum\": \"dot11.advertisedssid.beacon_info\": "
+    "\"dot11.advertisedssid.beaconrate\": \"dot11.advertisedssid.beacons_sec\": "
+    "\"dot11.advertisedssid.channel\": \"dot11.advertisedssid.cloaked\": "
+    "\"dot11.advertisedssid.crypt_set\": \"dot11.advertisedssid.ht_center_1\": "
+    "\"dot11.advertisedssid.ht_center_2\": \"dot11.advertisedssid.ht_mode\": "
+    "\"dot11.advertisedssid.maxrate\": \"dot11.advertisedssid.probe_response\": "
+    "\"dot11.advertisedssid.ssid\": \"dot11.advertisedssid.ssid_hash\": "
+    "\"dot11.advertisedssid.ssidlen\": \"dot11.advertisedssid.first_time\": "
+    "\"dot11.advertisedssid.last_time\": \"dot11.advertisedssid.location\": "
+    "\"dot11.advertisedssid.beacon\": \"dot11.device.wpa_anonce_list\": "
+    "\"dot11.device.wpa_handshake_list\": \"dot11.device.wpa_nonce_list\": "
+    "\"dot11.device.wpa_present_handshake\": \"dot11.device.wps_m3_count\": "
+    "\"dot11.device.wps_m3_last\": \"dot11.device.pmkid_packet\": "
+    "\"dot11.device.ssid_beacon_packet\": \"dot11.device.client_disconnects\": "
+    "\"dot11.device.client_disconnects_last\": \"dot11.device.extended_capabilities\": "
+    "\"dot11.device.link_measurement_capable\": "
+    "\"dot11.device.neighbor_report_capable\": \"dot11.device.max_tx_power\": "
+    "\"dot11.device.min_tx_power\": \"dot11.device.supported_channels\": "
+    "\"dot11.device.beacon_fingerprint\": \"dot11.device.probe_fingerprint\": "
+    "\"dot11.device.response_fingerprint\": \"dot11.device.bss_timestamp\": "
+    "\"dot11.device.last_beacon_timestamp\": "
+    "\"dot11.device.last_beaconed_ssid_record\": "
+    "\"dot11.device.last_probed_ssid_record\": \"dot11.device.last_bssid\": "
+    "\"dot11.device.last_sequence\": \"dot11.device.advertised_ssid_map\": "
+    "\"dot11.device.associated_client_map\": \"dot11.device.client_map\": "
+    "\"dot11.device.probed_ssid_map\": \"dot11.device.responded_ssid_map\": "
+    "\"dot11.device.num_advertised_ssids\": \"dot11.device.num_associated_clients\": "
+    "\"dot11.device.num_client_aps\": \"dot11.device.num_fragments\": "
+    "\"dot11.device.num_probed_ssids\": \"dot11.device.num_responded_ssids\": "
+    "\"dot11.device.num_retries\": \"dot11.device.datasize\": "
+    "\"dot11.device.datasize_retry\": \"dot11.device.typeset\": "
+    "\"kismet.common.location.error_v\": \"kismet.common.location.error_x\": "
+    "\"kismet.common.location.error_y\": \"kismet.common.location.heading\": "
+    "\"kismet.common.location.speed\": \"kismet.common.location.time_sec\": "
+    "\"kismet.common.location.time_usec\": \"kismet.common.location.fix\": "
+    "\"kismet.common.location.alt\": \"kismet.common.location.geopoint\": "
+    "\"kismet.common.location.last\": \"kismet.common.location.avg_loc\": "
+    "\"kismet.common.location.max_loc\": \"kismet.common.location.min_loc\": "
+    "\"kismet.device.base.location\": \"kismet.common.signal.carrierset\": "
+    "\"kismet.common.signal.encodingset\": \"kismet.common.signal.maxseenrate\": "
+    "\"kismet.common.signal.peak_loc\": \"kismet.common.signal.signal_rrd\": "
+    "\"kismet.common.signal.type\": \"kismet.common.signal.last_noise\": "
+    "\"kismet.common.signal.max_noise\": \"kismet.common.signal.min_noise\": "
+    "\"kismet.common.signal.last_signal\": \"kismet.common.signal.max_signal\": "
+    "\"kismet.common.signal.min_signal\": \"kismet.common.seenby.first_time\": "
+    "\"kismet.common.seenby.last_time\": \"kismet.common.seenby.num_packets\": "
+    "\"kismet.common.seenby.signal\": \"kismet.common.seenby.uuid\": "
+    "\"kismet.common.seenby.freq_khz_map\": \"kismet.device.base.basic_crypt_set\": "
+    "\"kismet.device.base.basic_type_set\": \"kismet.device.base.channel\": "
+    "\"kismet.device.base.commonname\": \"kismet.device.base.crypt\": "
+    "\"kismet.device.base.datasize\": \"kismet.device.base.first_time\": "
+    "\"kismet.device.base.freq_khz_map\": \"kismet.device.base.frequency\": "
+    "\"kismet.device.base.key\": \"kismet.device.base.last_time\": "
+    "\"kismet.device.base.macaddr\": \"kismet.device.base.manuf\": "
+    "\"kismet.device.base.mod_time\": \"kismet.device.base.name\": "
+    "\"kismet.device.base.num_alerts\": \"kismet.device.base.packets.crypt\": "
+    "\"kismet.device.base.packets.data\": \"kismet.device.base.packets.error\": "
+    "\"kismet.device.base.packets.filtered\": \"kismet.device.base.packets.llc\": "
+    "\"kismet.device.base.packets.rx\": \"kismet.device.base.packets.tx\": "
+    "\"kismet.device.base.packets.total\": \"kismet.device.base.phyname\": "
+    "\"kismet.device.base.related_devices\": \"kismet.device.base.seenby\": "
+    "\"kismet.device.base.signal\": \"kismet.device.base.type\": "
+    "\"kismet.device.base.packets.rrd\": \"kismet.device.base.datasize.rrd\": "
+    "\"kismet.common.rrd.blank_val\": \"kismet.common.rrd.serial_time\": "
+    "\"kismet.common.rrd.last_time\": \"kismet.common.rrd.day_vec\": "
+    "\"kismet.common.rrd.hour_vec\": \"kismet.common.rrd.minute_vec\": "
+    "[0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0]";
+
+// Encode a JSON device record in the requested format; returns false if the
+// format is unknown or compression fails
+inline bool kismetdb_device_encode(int format, const std::string& in_json, std::string& out) {
+    if (format == KISMETDB_DEVICE_FORMAT_JSON) {
+        out = in_json;
+        return true;
+    }
+
+    if (format != KISMETDB_DEVICE_FORMAT_JSON_DEFLATE)
+        return false;
+
+    z_stream zs{};
+
+    if (deflateInit(&zs, Z_DEFAULT_COMPRESSION) != Z_OK)
+        return false;
+
+    if (deflateSetDictionary(&zs, (const Bytef *) kismetdb_device_dictionary_v1,
+                sizeof(kismetdb_device_dictionary_v1) - 1) != Z_OK) {
+        deflateEnd(&zs);
+        return false;
+    }
+
+    out.resize(deflateBound(&zs, in_json.length()));
+
+    zs.next_in = (Bytef *) in_json.data();
+    zs.avail_in = in_json.length();
+    zs.next_out = (Bytef *) &out[0];
+    zs.avail_out = out.length();
+
+    auto r = deflate(&zs, Z_FINISH);
+
+    out.resize(zs.total_out);
+    deflateEnd(&zs);
+
+    return r == Z_STREAM_END;
+}
+
+// Decode a device record into JSON; returns false if the format is unknown or the
+// record is damaged
+inline bool kismetdb_device_decode(int format, const std::string& in, std::string& out_json) {
+    if (format == KISMETDB_DEVICE_FORMAT_JSON) {
+        out_json = in;
+        return true;
+    }
+
+    if (format != KISMETDB_DEVICE_FORMAT_JSON_DEFLATE)
+        return false;
+
+    z_stream zs{};
+
+    if (inflateInit(&zs) != Z_OK)
+        return false;
+
+    zs.next_in = (Bytef *) in.data();
+    zs.avail_in = in.length();
+
+    out_json.clear();
+
+    char chunk[16384];
+    int r;
+
+    do {
+        zs.next_out = (Bytef *) chunk;
+        zs.avail_out = sizeof(chunk);
+
+        r = inflate(&zs, Z_NO_FLUSH);
+
+        if (r == Z_NEED_DICT) {
+            if (inflateSetDictionary(&zs, (const Bytef *) kismetdb_device_dictionary_v1,
+                        sizeof(kismetdb_device_dictionary_v1) - 1) != Z_OK)
+                break;
+            r = Z_OK;
+            continue;
+        }
+
+        if (r != Z_OK && r != Z_STREAM_END)
+            break;
+
+        out_json.append(chunk, sizeof(chunk) - zs.avail_out);
+    } while (r != Z_STREAM_END);
+
+    inflateEnd(&zs);
+
+    return r == Z_STREAM_END;
+}
+
+#endif
+
@@ -0,0 +1,148 @@
+/*
+    This file is part of Kismet
+
+    Kismet is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    Kismet is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with Kismet; if not, write to the Free Software
+    Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+*/
+
+#ifndef __KISMETDB_PACKET_DEDUP_H__
+#define __KISMETDB_PACKET_DEDUP_H__
+
+#include "config.h"
+
+#include <string>
+
+#include <stdint.h>
+
+// Deduplication of repeated frame bodies in the kismetdb packets table.
+//
+// An AP sends the same beacon many times a second; only the capture header, sequence
+// number, timestamp, and FCS change between them.  When deduplication is enabled, the
+// tagged parameters of beacons and probe responses are stored once in the packet_bodies
+// table, keyed by their hash.  The packet row keeps the rest of the frame, the hash in
+// 'body_hash', and the offset the body was removed from in 'body_offset'.  Rows with no
+// body_hash hold the complete frame, as do all logs older than kismetdb version 9.
+
+#ifndef DLT_IEEE802_11
+#define DLT_IEEE802_11          105
+#endif
+
+#ifndef DLT_IEEE802_11_RADIO
+#define DLT_IEEE802_11_RADIO    127
+#endif
+
+#ifndef DLT_PPI
+#define DLT_PPI                 192
+#endif
+
+// Bodies shorter than this aren't worth storing separately
+#define KISMETDB_DEDUP_MIN_BODY 32
+
+// Stored bodies have their timestamp refreshed when they are used this many seconds
+// after it, so a body is never older than the packets using it by more than this
+#define KISMETDB_DEDUP_REFRESH  60
+
+// Find the shareable body of a frame; returns false if the frame has none
+inline bool kismetdb_packet_dedup_span(unsigned int dlt, const std::string& frame,
+        size_t& body_pos, size_t& body_len) {
+    auto data = reinterpret_cast<const uint8_t *>(frame.data());
+
+    size_t hdr_len = 0;
+    size_t fcs_len = 0;
+
+    if (dlt == DLT_IEEE802_11_RADIO) {
+        if (frame.length() < 8)
+            return false;
+
+        hdr_len = data[2] | (data[3] << 8);
+
+        if (hdr_len < 8 || hdr_len > frame.length())
+            return false;
+
+        // Walk the present bitmaps to find the flags field, which tells us if there
+        // is a FCS at the end of the frame
+        size_t pos = 4;
+        uint32_t first_present = 0, present = 0;
+
+        do {
+            if (pos + 4 > hdr_len)
+                return false;
+
+            present = data[pos] | (data[pos + 1] << 8) | (data[pos + 2] << 16) |
+                ((uint32_t) data[pos + 3] << 24);
+
+            if (pos == 4)
+                first_present = present;
+
+            pos += 4;
+        } while (present & (1U << 31));
+
+        if (first_present & (1U << 1)) {
+            // TSFT comes first, and is aligned to 8 bytes
+            if (first_present & (1U << 0))
+                pos = ((pos + 7) & ~((size_t) 7)) + 8;
+
+            if (pos >= hdr_len)
+                return false;
+
+            if (data[pos] & 0x10)
+                fcs_len = 4;
+        }
+    } else if (dlt == DLT_PPI) {
+        if (frame.length() < 8)
+            return false;
+
+        hdr_len = data[2] | (data[3] << 8);
+
+        if (hdr_len < 8 || hdr_len > frame.length())
+            return false;
+
+        uint32_t ppi_dlt = data[4] | (data[5] << 8) | (data[6] << 16) | ((uint32_t) data[7] << 24);
+
+        if (ppi_dlt != DLT_IEEE802_11)
+            return false;
+    } else if (dlt != DLT_IEEE802_11) {
+        return false;
+    }
+
+    // Beacons and probe responses; a 24 byte header then 12 bytes of timestamp,
+    // interval, and capabilities before the tagged parameters
+    if (frame.length() < hdr_len + 36 + fcs_len)
+        return false;
+
+    if (data[hdr_len] != 0x80 && data[hdr_len] != 0x50)
+        return false;
+
+    body_pos = hdr_len + 36;
+    body_len = frame.length() - body_pos - fcs_len;
+
+    return body_len >= KISMETDB_DEDUP_MIN_BODY;
+}
+
+// Rebuild the original frame from a packet row and its shared body
+inline bool kismetdb_packet_dedup_restore(const std::string& fragment, size_t body_pos,
+        const std::string& body, std::string& frame) {
+    if (body_pos > fragment.length())
+        return false;
+
+    frame.clear();
+    frame.reserve(fragment.length() + body.length());
+    frame.append(fragment, 0, body_pos);
+    frame.append(body);
+    frame.append(fragment, body_pos, std::string::npos);
+
+    return true;
+}
+
+#endif
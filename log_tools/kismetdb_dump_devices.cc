@@ -39,6 +39,7 @@
 #include "fmt.h"
 #include "json/json.h"
 #include "sqlite3_cpp11.h"
+#include "kismetdb_device_codec.h"
 
 void print_help(char *argv) {
     printf("Kismetdb to JSON\n");
@@ -249,7 +250,16 @@ int main(int argc, char *argv[]) {
     if (!ekjson)
         fprintf(ofile, "[\n");
 
-    auto query = _SELECT(db, "devices", {"device"});
+    // Device records may be encoded in kismetdb version 8 and newer
+    std::list<std::string> device_fields;
+
+    if (db_version < 8) {
+        device_fields = std::list<std::string>{"device"};
+    } else {
+        device_fields = std::list<std::string>{"device", "device_format"};
+    }
+
+    auto query = _SELECT(db, "devices", device_fields);
 
     unsigned long n_logs = 0;
     unsigned long n_division = (n_devices_db / 20);
@@ -269,7 +279,13 @@ int main(int argc, char *argv[]) {
 
         }
 
-        auto json = sqlite3_column_as<std::string>(d, 0);
+        std::string json;
+
+        if (!kismetdb_device_decode(db_version >= 8 ? sqlite3_column_as<int>(d, 1) : 
+                    KISMETDB_DEVICE_FORMAT_JSON, sqlite3_column_as<std::string>(d, 0), json)) {
+            fmt::print(stderr, "ERROR:  Could not decode device record\n");
+            continue;
+        }
 
         try {
             std::stringstream ss(json);
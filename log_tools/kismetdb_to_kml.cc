@@ -42,6 +42,7 @@
 #include "getopt.h"
 #include "json/json.h"
 #include "sqlite3_cpp11.h"
+#include "kismetdb_device_codec.h"
 #include "fmt.h"
 #include "packet_ieee80211.h"
 
@@ -438,10 +439,19 @@ int main(int argc, char *argv[]) {
     std::vector<kml_placemark> zigbee_placemark_vec;
     std::vector<kml_placemark> bluetooth_placemark_vec;
 
+    // Device records may be encoded in kismetdb version 8 and newer
+    std::list<std::string> location_fields{"min_lat", "min_lon", "max_lat", "max_lon", 
+        "avg_lat", "avg_lon", "device"};
+    std::list<std::string> device_fields{"phyname", "devmac", "device"};
+
+    if (db_version >= 8) {
+        location_fields.push_back("device_format");
+        device_fields.push_back("device_format");
+    }
+
     if (basiclocation) {
         auto basic_q = 
-            _SELECT(db, "devices", 
-                    {"min_lat", "min_lon", "max_lat", "max_lon", "avg_lat", "avg_lon", "device"}, 
+            _SELECT(db, "devices", location_fields,
                     _WHERE("avglat", NEQ, 0, AND, "avglon", NEQ, 0));
 
         for (auto d : basic_q) {
@@ -469,8 +479,16 @@ int main(int argc, char *argv[]) {
                 continue;
             }
 
+            std::string devjson;
+
+            if (!kismetdb_device_decode(db_version >= 8 ? sqlite3_column_as<int>(d, 7) : 
+                        KISMETDB_DEVICE_FORMAT_JSON, sqlite3_column_as<std::string>(d, 6), devjson)) {
+                fmt::print(stderr, "WARNING:  Could not decode device record, skipping\n");
+                continue;
+            }
+
             Json::Value json;
-            std::stringstream ss(sqlite3_column_as<std::string>(d, 6));
+            std::stringstream ss(devjson);
 
             try {
                 ss >> json;
@@ -509,7 +527,7 @@ int main(int argc, char *argv[]) {
         }
     } else {
         auto basic_q = 
-            _SELECT(db, "devices", {"phyname", "devmac", "device"});
+            _SELECT(db, "devices", device_fields);
 
         for (auto d : basic_q) {
             // Prep the packet list for different kismetdb versions
@@ -523,9 +541,17 @@ int main(int argc, char *argv[]) {
 
             auto phyname = sqlite3_column_as<std::string>(d, 0);
             auto devmac = sqlite3_column_as<std::string>(d, 1);
+            std::string devjson;
+
+            if (!kismetdb_device_decode(db_version >= 8 ? sqlite3_column_as<int>(d, 3) : 
+                        KISMETDB_DEVICE_FORMAT_JSON, sqlite3_column_as<std::string>(d, 2), devjson)) {
+                fmt::print(stderr, "WARNING:  Could not decode device record for {}, skipping\n", devmac);
+                continue;
+            }
+
             Json::Value json;
 
-            std::stringstream ss(sqlite3_column_as<std::string>(d, 2));
+            std::stringstream ss(devjson);
 
             kml_placemark pl;
 
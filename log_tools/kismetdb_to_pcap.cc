@@ -44,6 +44,7 @@
 #include "fmt.h"
 #include "getopt.h"
 #include "json/json.h"
+#include "kismetdb_packet_dedup.h"
 #include "packet_ieee80211.h"
 #include "pcapng.h"
 #include "sqlite3_cpp11.h"
@@ -1004,11 +1005,19 @@ int main(int argc, char *argv[]) {
     if (db_version < 6) {
         packet_fields = 
             std::list<std::string>{"ts_sec", "ts_usec", "dlt", "datasource", "packet", "lat", "lon", "alt"};
-    } else {
+    } else if (db_version < 9) {
         packet_fields = 
             std::list<std::string>{"ts_sec", "ts_usec", "dlt", "datasource", "packet", "lat", "lon", "alt", "tags"};
+    } else {
+        packet_fields = 
+            std::list<std::string>{"ts_sec", "ts_usec", "dlt", "datasource", "packet", "lat", "lon", "alt", "tags",
+                "body_hash", "body_offset"};
     }
 
+    // Shared bodies of deduplicated packets, fetched as they're first needed
+    std::map<std::string, std::string> packet_bodies;
+    std::string frame;
+
     auto packets_q = _SELECT(db, "packets", 
             packet_fields,
             packet_filter_q);
@@ -1054,6 +1063,44 @@ int main(int argc, char *argv[]) {
                 if (db_version >= 6)
                     tags = sqlite3_column_as<std::string>(*pkt, 8);
 
+                if (db_version >= 9) {
+                    auto body_hash = sqlite3_column_as<std::string>(*pkt, 9);
+
+                    if (body_hash.length() != 0) {
+                        auto body = packet_bodies.find(body_hash);
+
+                        if (body == packet_bodies.end()) {
+                            auto body_q = _SELECT(db, "packet_bodies", {"body"}, 
+                                    _WHERE("hash", EQ, body_hash));
+                            auto body_r = body_q.begin();
+
+                            if (body_r == body_q.end()) {
+                                fmt::print(stderr, "WARNING:  Packet at {}.{} refers to a missing packet "
+                                        "body, skipping it.\n", ts_sec, ts_usec);
+                                ++pkt;
+                                pkt_time = 0;
+                                pkt_time_us = 0;
+                                continue;
+                            }
+
+                            body = packet_bodies.emplace(body_hash, 
+                                    sqlite3_column_as<std::string>(*body_r, 0)).first;
+                        }
+
+                        if (!kismetdb_packet_dedup_restore(bytes, 
+                                    sqlite3_column_as<unsigned long>(*pkt, 10), body->second, frame)) {
+                            fmt::print(stderr, "WARNING:  Packet at {}.{} could not be reassembled, "
+                                    "skipping it.\n", ts_sec, ts_usec);
+                            ++pkt;
+                            pkt_time = 0;
+                            pkt_time_us = 0;
+                            continue;
+                        }
+
+                        bytes.swap(frame);
+                    }
+                }
+
                 if (!pcapng) {
                     std::shared_ptr<log_file> log_interface;
 
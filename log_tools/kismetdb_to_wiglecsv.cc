@@ -43,6 +43,7 @@
 #include "getopt.h"
 #include "json/json.h"
 #include "sqlite3_cpp11.h"
+#include "kismetdb_device_codec.h"
 #include "fmt.h"
 #include "packet_ieee80211.h"
 #include "version.h"
@@ -501,6 +502,15 @@ int main(int argc, char *argv[]) {
             "signal", "frequency", "alt", "speed"};
     }
 
+    // Device records may be encoded in kismetdb version 8 and newer
+    std::list<std::string> device_fields;
+
+    if (db_version < 8) {
+        device_fields = std::list<std::string>{"device"};
+    } else {
+        device_fields = std::list<std::string>{"device", "device_format"};
+    }
+
     std::list<std::string> bt_fields;
     switch (db_version) {
         case 1:
@@ -579,7 +589,7 @@ int main(int argc, char *argv[]) {
         if (ci != device_cache_map.end()) {
             cached = ci->second;
         } else {
-            auto dev_query = _SELECT(db, "devices", {"device"},
+            auto dev_query = _SELECT(db, "devices", device_fields,
                     _WHERE("devmac", EQ, sourcemac,
                         AND,
                         "phyname", EQ, phy));
@@ -605,8 +615,16 @@ int main(int argc, char *argv[]) {
                 continue;
             }
 
+            std::string devjson;
+
+            if (!kismetdb_device_decode(db_version >= 8 ? sqlite3_column_as<int>(*dev, 1) : 
+                        KISMETDB_DEVICE_FORMAT_JSON, sqlite3_column_as<std::string>(*dev, 0), devjson)) {
+                fmt::print(stderr, "ERROR:  Could not decode device record for {}\n", sourcemac);
+                continue;
+            }
+
             Json::Value json;
-            std::stringstream ss(sqlite3_column_as<std::string>(*dev, 0));
+            std::stringstream ss(devjson);
 
             try {
                 ss >> json;
@@ -757,7 +775,7 @@ int main(int argc, char *argv[]) {
         if (ci != device_cache_map.end()) {
             cached = ci->second;
         } else {
-            auto dev_query = _SELECT(db, "devices", {"device"},
+            auto dev_query = _SELECT(db, "devices", device_fields,
                     _WHERE("devmac", EQ, sourcemac,
                         AND,
                         "phyname", EQ, phy));
@@ -783,8 +801,16 @@ int main(int argc, char *argv[]) {
                 continue;
             }
 
+            std::string devjson;
+
+            if (!kismetdb_device_decode(db_version >= 8 ? sqlite3_column_as<int>(*dev, 1) : 
+                        KISMETDB_DEVICE_FORMAT_JSON, sqlite3_column_as<std::string>(*dev, 0), devjson)) {
+                fmt::print(stderr, "ERROR:  Could not decode device record for {}\n", sourcemac);
+                continue;
+            }
+
             Json::Value json;
-            std::stringstream ss(sqlite3_column_as<std::string>(*dev, 0));
+            std::stringstream ss(devjson);
 
             try {
                 ss >> json;
@@ -43,9 +43,15 @@ kis_packet::kis_packet() {
 	filtered = 0;
     duplicate = 0;
 
+    ts.tv_sec = 0;
+    ts.tv_usec = 0;
+
     content_vec = new packet_component *[MAX_PACKET_COMPONENTS];
     for (unsigned int x = 0; x < MAX_PACKET_COMPONENTS; x++)
         content_vec[x] = nullptr;
+
+    arena = new uint8_t[PACKET_ARENA_SIZE];
+    arena_pos = 0;
 }
 
 kis_packet::~kis_packet() {
@@ -53,11 +59,56 @@ kis_packet::~kis_packet() {
         if (content_vec[x] == nullptr)
             continue;
 
-        if (content_vec[x]->self_destruct)
-            delete content_vec[x];
+        destroy_component(content_vec[x]);
     }
 
     delete[] content_vec;
+    delete[] arena;
+}
+
+void kis_packet::reset() {
+    for (unsigned int x = 0; x < MAX_PACKET_COMPONENTS; x++) {
+        if (content_vec[x] == nullptr)
+            continue;
+
+        destroy_component(content_vec[x]);
+        content_vec[x] = nullptr;
+    }
+
+    // Everything in the arena has been destructed, release it in one go
+    arena_pos = 0;
+
+	error = 0;
+    crc_ok = 0;
+	filtered = 0;
+    duplicate = 0;
+
+    ts.tv_sec = 0;
+    ts.tv_usec = 0;
+
+    process_complete_events.clear();
+    tag_vec.clear();
+}
+
+void *kis_packet::arena_alloc(size_t sz, size_t align) {
+    size_t pos = (arena_pos + (align - 1)) & ~(align - 1);
+
+    if (pos + sz > PACKET_ARENA_SIZE)
+        return nullptr;
+
+    arena_pos = pos + sz;
+
+    return arena + pos;
+}
+
+void kis_packet::destroy_component(packet_component *c) {
+    if (c == nullptr)
+        return;
+
+    if (c->arena_backed)
+        c->~packet_component();
+    else if (c->self_destruct)
+        delete c;
 }
    
 void kis_packet::insert(const unsigned int index, packet_component *data) {
@@ -88,9 +139,7 @@ void kis_packet::erase(const unsigned int index) {
 	// memory.  Whatever inserted it had better expect this
 	// to happen or it will be very unhappy
 	if (content_vec[index] != nullptr) {
-		if (content_vec[index]->self_destruct)
-			delete content_vec[index];
-
+        destroy_component(content_vec[index]);
 		content_vec[index] = NULL;
 	}
 }
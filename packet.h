@@ -32,6 +32,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <new>
+#include <type_traits>
 
 #include "eventbus.h"
 #include "globalregistry.h"
@@ -48,16 +50,34 @@
 // Maximum length of a frame
 #define MAX_PACKET_LEN			8192
 
+// Size of the per-packet component arena; packet components allocated via 
+// kis_packet::new_component are carved from this block and released in bulk
+// when the packet is reset.  Components which don't fit fall back to the heap.
+#define PACKET_ARENA_SIZE       4096
+
 // Same as defined in libpcap/system, but we need to know the basic dot11 DLT
 // even when we don't have pcap
 #define KDLT_IEEE802_11			105
+#define KDLT_IEEE802_11_RADIO   127
+#define KDLT_PPI                192
 
 // High-level packet component so that we can provide our own destructors
 class packet_component {
 public:
-    packet_component() { self_destruct = 1; };
+    packet_component() { 
+        self_destruct = 1; 
+        arena_backed = false;
+    };
+    packet_component(const packet_component& c) {
+        self_destruct = c.self_destruct;
+        arena_backed = false;
+    }
     virtual ~packet_component() { }
     int self_destruct;
+
+    // Were we allocated from a packet arena?  Arena-backed components are
+    // destructed but never deleted; their memory belongs to the packet.
+    bool arena_backed;
 };
 
 // Overall packet container that holds packet information
@@ -91,6 +111,31 @@ public:
     kis_packet();
     ~kis_packet();
 
+    // Return the packet to a pristine state so it can be re-used from the packet 
+    // pool; all components are destroyed and the arena is released in bulk
+    void reset();
+
+    // Allocate a packet component from the packet arena; the component must only be
+    // inserted into this packet, and is released when the packet is reset or destroyed.
+    template<class T, typename... Args>
+    T *new_component(Args&& ...args) {
+        static_assert(std::is_base_of<packet_component, T>::value,
+                "new_component only allocates packet_component types");
+
+        auto mem = arena_alloc(sizeof(T), alignof(T));
+
+        if (mem == nullptr)
+            return new T(std::forward<Args>(args)...);
+
+        auto c = new (mem) T(std::forward<Args>(args)...);
+        c->arena_backed = true;
+        return c;
+    }
+
+    // Destroy a component which was never inserted, or which has already been removed
+    // from the packet, regardless of how it was allocated
+    void destroy_component(packet_component *c);
+
     void insert(const unsigned int index, packet_component *data);
     void *fetch(const unsigned int index) const;
     template<class T> T* fetch(const unsigned int index) {
@@ -107,6 +152,12 @@ public:
 
     // Tags applied to the packet
     std::vector<std::string> tag_vec;
+
+protected:
+    void *arena_alloc(size_t sz, size_t align);
+
+    uint8_t *arena;
+    size_t arena_pos;
 };
 
 
@@ -46,8 +46,8 @@ packet_filter::packet_filter(const std::string& in_id, const std::string& in_des
 
     httpd->register_route(url, {"GET", "POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(
-                [this, url](std::shared_ptr<kis_net_beast_httpd_connection> con) {
-                    kis_lock_guard<kis_mutex> lk(mutex, url);
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    kis_lock_guard<kis_mutex> lk(mutex, "packet_filter /filter");
                     return self_endp_handler();
                 }));
 
@@ -55,8 +55,8 @@ packet_filter::packet_filter(const std::string& in_id, const std::string& in_des
 
     httpd->register_route(url, {"POST"}, httpd->LOGON_ROLE, {"cmd"},
             std::make_shared<kis_net_web_function_endpoint>(
-                [this, posturl](std::shared_ptr<kis_net_beast_httpd_connection> con) {
-                    kis_lock_guard<kis_mutex> lk(mutex, posturl);
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    kis_lock_guard<kis_mutex> lk(mutex, "packet_filter /set_default");
                     return default_set_endp_handler(con);
                 }));
 }
@@ -135,15 +135,15 @@ packet_filter_mac_addr::packet_filter_mac_addr(const std::string& in_id, const s
 
     httpd->register_route(seturl, {"POST"}, httpd->LOGON_ROLE, {"cmd"},
             std::make_shared<kis_net_web_function_endpoint>(
-                [this, seturl](std::shared_ptr<kis_net_beast_httpd_connection> con) {
-                    kis_lock_guard<kis_mutex> lk(mutex, seturl);
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    kis_lock_guard<kis_mutex> lk(mutex, "packet_filter /set_filter");
                     return edit_endp_handler(con);
                 }));
 
     httpd->register_route(remurl, {"POST"}, httpd->LOGON_ROLE, {"cmd"},
             std::make_shared<kis_net_web_function_endpoint>(
-                [this, seturl](std::shared_ptr<kis_net_beast_httpd_connection> con) {
-                    kis_lock_guard<kis_mutex> lk(mutex, seturl);
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    kis_lock_guard<kis_mutex> lk(mutex, "packet_filter /remove_filter");
                     return remove_endp_handler(con);
                 }));
 
@@ -30,10 +30,56 @@
 #include "alertracker.h"
 #include "configfile.h"
 #include "globalregistry.h"
+#include "kis_datasource.h"
 #include "messagebus.h"
 #include "packet.h"
 #include "packetchain.h"
 
+namespace {
+    // Per-thread front cache of the packet pool; packets are generally created on
+    // datasource threads and destroyed on packet processing threads, so the local
+    // caches fill and drain via the shared pool
+    struct packet_pool_cache {
+        std::vector<kis_packet *> packets;
+
+        ~packet_pool_cache() {
+            for (auto p : packets)
+                delete p;
+        }
+    };
+
+    const size_t packet_pool_cache_max = 32;
+
+    thread_local packet_pool_cache local_packet_pool;
+
+    // Handler stats slot owned by this thread, if any
+    thread_local int local_stats_slot = -1;
+
+    // Dispatch epoch slot owned by this thread, if it is a packet thread
+    thread_local std::atomic<uint64_t> *local_dispatch_epoch = nullptr;
+
+    const char *chain_name(int in_chain) {
+        switch (in_chain) {
+            case CHAINPOS_POSTCAP:
+                return "postcap";
+            case CHAINPOS_LLCDISSECT:
+                return "llcdissect";
+            case CHAINPOS_DECRYPT:
+                return "decrypt";
+            case CHAINPOS_DATADISSECT:
+                return "datadissect";
+            case CHAINPOS_CLASSIFIER:
+                return "classifier";
+            case CHAINPOS_TRACKER:
+                return "tracker";
+            case CHAINPOS_LOGGING:
+                return "logging";
+        }
+
+        return "unknown";
+    }
+}
+
 class SortLinkPriority {
 public:
     inline bool operator() (const packet_chain::pc_link *x, 
@@ -58,6 +104,43 @@ packet_chain::packet_chain() {
         Globalreg::globalreg->kismet_config->fetch_opt_uint("packet_log_warning", 0);
     packet_queue_drop =
         Globalreg::globalreg->kismet_config->fetch_opt_uint("packet_backlog_limit", 8192);
+    packet_queue_hard_drop =
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("packet_backlog_hard_limit", 
+                packet_queue_drop * 2);
+
+    if (packet_queue_hard_drop < packet_queue_drop)
+        packet_queue_hard_drop = packet_queue_drop;
+    packet_pool_max =
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("packet_pool_size", 4096);
+    packet_batch_size =
+        Globalreg::globalreg->kismet_config->fetch_opt_uint("packet_batch_size", 1);
+
+    if (packet_batch_size < 1)
+        packet_batch_size = 1;
+
+    pack_comp_datasrc = register_packet_component("KISDATASRC");
+    pack_comp_linkframe = register_packet_component("LINKFRAME");
+
+    packet_backlog_priority =
+        Globalreg::globalreg->kismet_config->fetch_opt_bool("packet_backlog_priority", false);
+    admission_sources = 0;
+    admission_unsourced = 0;
+
+    handler_stats_enabled =
+        Globalreg::globalreg->kismet_config->fetch_opt_bool("packet_handler_stats", false);
+    packet_thread_count = std::max(1U, std::thread::hardware_concurrency());
+    handler_stats_slots = packet_thread_count;
+
+    dispatch_epochs.reset(new pc_dispatch_epoch[packet_thread_count]);
+    for (unsigned int n = 0; n < packet_thread_count; n++)
+        dispatch_epochs[n].generation = 0;
+
+    dispatch_table = nullptr;
+    dispatch_generation = 1;
+    rebuild_dispatch_table();
+
+    packet_pool_hits = 0;
+    packet_pool_misses = 0;
 
     auto entrytracker = 
         Globalreg::fetch_mandatory_global_as<entry_tracker>();
@@ -115,6 +198,17 @@ packet_chain::packet_chain() {
     packet_processed_rrd =
         std::make_shared<kis_tracked_rrd<>>(packet_processed_rrd_id);
 
+    packet_pool_hits_counter = 
+        std::make_shared<tracker_element_uint64>(
+                entrytracker->register_field("kismet.packetchain.pool_hits",
+                    tracker_element_factory<tracker_element_uint64>(),
+                    "packets recycled from the packet pool"));
+    packet_pool_misses_counter =
+        std::make_shared<tracker_element_uint64>(
+                entrytracker->register_field("kismet.packetchain.pool_misses",
+                    tracker_element_factory<tracker_element_uint64>(),
+                    "packets allocated because the packet pool was empty"));
+
     packet_stats_map = 
         std::make_shared<tracker_element_map>();
     packet_stats_map->insert(packet_peak_rrd);
@@ -124,6 +218,8 @@ packet_chain::packet_chain() {
     packet_stats_map->insert(packet_queue_rrd);
     packet_stats_map->insert(packet_drop_rrd);
     packet_stats_map->insert(packet_processed_rrd);
+    packet_stats_map->insert(packet_pool_hits_counter);
+    packet_stats_map->insert(packet_pool_misses_counter);
 
     auto httpd = Globalreg::fetch_mandatory_global_as<kis_net_beast_httpd>();
 
@@ -145,6 +241,26 @@ packet_chain::packet_chain() {
     httpd->register_route("/packetchain/packet_processed", {"GET", "POST"}, httpd->RO_ROLE, {},
             std::make_shared<kis_net_web_tracked_endpoint>(packet_processed_rrd));
 
+    httpd->register_route("/packetchain/handler_stats", {"GET", "POST"}, httpd->RO_ROLE, {},
+            std::make_shared<kis_net_web_tracked_endpoint>(
+                [this](std::shared_ptr<kis_net_beast_httpd_connection>) -> std::shared_ptr<tracker_element> {
+                    return handler_stats_endp_handler();
+                }));
+    httpd->register_route("/packetchain/handler_stats/enable", {"POST"}, httpd->LOGON_ROLE, {"cmd"},
+            std::make_shared<kis_net_web_function_endpoint>(
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    std::ostream os(&con->response_stream());
+                    set_handler_stats(true);
+                    os << "Packet handler stats enabled\n";
+                }));
+    httpd->register_route("/packetchain/handler_stats/disable", {"POST"}, httpd->LOGON_ROLE, {"cmd"},
+            std::make_shared<kis_net_web_function_endpoint>(
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    std::ostream os(&con->response_stream());
+                    set_handler_stats(false);
+                    os << "Packet handler stats disabled\n";
+                }));
+
     packetchain_shutdown = false;
 
    timetracker = Globalreg::fetch_mandatory_global_as<time_tracker>();
@@ -154,6 +270,11 @@ packet_chain::packet_chain() {
         timetracker->register_timer(std::chrono::seconds(1), true, 
                 [this](int) -> int {
 
+                fold_packet_counters();
+
+                packet_pool_hits_counter->set(packet_pool_hits.load(std::memory_order_relaxed));
+                packet_pool_misses_counter->set(packet_pool_misses.load(std::memory_order_relaxed));
+
                 auto evt = eventbus->get_eventbus_event(event_packetstats());
                 evt->get_event_content()->insert(event_packetstats(), packet_stats_map);
                 eventbus->publish(evt);
@@ -166,15 +287,19 @@ packet_chain::~packet_chain() {
     timetracker->remove_timer(event_timer_id);
 
     {
-        // Tell the packet thread we're dying and unlock it
+        // Tell the packet threads we're dying; they wake up from the queue at least
+        // every PACKETCHAIN_THREAD_POLL_USEC and exit
         packetchain_shutdown = true;
-        packet_queue.enqueue(nullptr);
 
         for (auto& t: packet_threads) {
             if (t.joinable())
                 t.join();
         }
 
+        kis_packet *queued;
+        while (packet_queue.try_dequeue(queued))
+            delete queued;
+
         // packet_thread.join();
     }
 
@@ -212,26 +337,50 @@ packet_chain::~packet_chain() {
             delete(i);
         logging_chain.clear();
 
+        // The packet threads are gone, so nothing can be running any table
+        for (auto& r : dispatch_retired) {
+            delete r.table;
+            for (auto l : r.removed)
+                delete l;
+        }
+        dispatch_retired.clear();
+
+        delete dispatch_table.load();
+        dispatch_table = nullptr;
     }
 
+    kis_packet *pooled;
+    while (packet_pool.try_dequeue(pooled))
+        delete pooled;
+
 }
 
 void packet_chain::start_processing() {
-#if 1
-    auto nt = static_cast<int>(std::thread::hardware_concurrency());
-#else
-    auto nt = int(1);
-#endif
+    auto nt = static_cast<int>(packet_thread_count);
 
     for (int n = 0; n < nt; n++) {
         packet_threads.emplace_back(std::thread([this, nt, n]() {
                 thread_set_process_name(fmt::format("packethandler {}/{}", n, nt));
+                assign_stats_slot(n);
+                local_dispatch_epoch = &dispatch_epochs[n].generation;
                 packet_queue_processor();
                 }));
     }
 
 }
 
+void packet_chain::assign_stats_slot(unsigned int slot) {
+    if (slot < handler_stats_slots) {
+        local_stats_slot = slot;
+        return;
+    }
+
+    // Never expected, since the slots are sized from the same thread counts, but don't
+    // let a thread silently vanish from the stats
+    _MSG_ERROR("Packet thread {} has no packet handler stats slot ({} slots); its handler "
+            "timing will not be included in the packet handler stats.", slot, handler_stats_slots);
+}
+
 int packet_chain::register_packet_component(std::string in_component) {
     kis_lock_guard<kis_mutex> lk(packetcomp_mutex);
 
@@ -282,103 +431,240 @@ std::string packet_chain::fetch_packet_component_name(int in_id) {
 }
 
 kis_packet *packet_chain::generate_packet() {
-    kis_packet *newpack = new kis_packet();
+    kis_packet *newpack = nullptr;
+
+    if (local_packet_pool.packets.size() > 0) {
+        newpack = local_packet_pool.packets.back();
+        local_packet_pool.packets.pop_back();
+    } else if (!packet_pool.try_dequeue(newpack)) {
+        newpack = nullptr;
+    }
 
-    return newpack;
+    if (newpack != nullptr) {
+        packet_pool_hits.fetch_add(1, std::memory_order_relaxed);
+        return newpack;
+    }
+
+    packet_pool_misses.fetch_add(1, std::memory_order_relaxed);
+
+    return new kis_packet();
+}
+
+void packet_chain::process_chain_batch(const pc_dispatch_table& table, 
+        int in_first, int in_last, kis_packet **batch, size_t batch_sz) {
+    // Chain positions are laid out back to back in the table, so a run of stages is
+    // one contiguous sweep
+    const auto *h = table.handlers.data() + table.chain_start[in_first];
+    const auto *end = table.handlers.data() + table.chain_start[in_last + 1];
+    auto globalreg = Globalreg::globalreg;
+
+    if (handler_stats_enabled.load(std::memory_order_relaxed) && local_stats_slot >= 0) {
+        process_chain_batch_stats(table, in_first, in_last, batch, batch_sz);
+        return;
+    }
+
+    for (; h != end; ++h) {
+        for (size_t i = 0; i < batch_sz; i++)
+            h->callback(globalreg, h->auxdata, batch[i]);
+    }
+}
+
+void packet_chain::process_chain_batch_stats(const pc_dispatch_table& table, 
+        int in_first, int in_last, kis_packet **batch, size_t batch_sz) {
+    const auto *h = table.handlers.data() + table.chain_start[in_first];
+    const auto *end = table.handlers.data() + table.chain_start[in_last + 1];
+    auto globalreg = Globalreg::globalreg;
+
+    for (; h != end; ++h) {
+        // Only this thread writes this slot, so plain load/store is enough
+        auto& st = h->link->stats[local_stats_slot];
+
+        for (size_t i = 0; i < batch_sz; i++) {
+            auto start = std::chrono::steady_clock::now();
+            h->callback(globalreg, h->auxdata, batch[i]);
+            uint64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start).count();
+
+            st.count.store(st.count.load(std::memory_order_relaxed) + 1, 
+                    std::memory_order_relaxed);
+            st.total_ns.store(st.total_ns.load(std::memory_order_relaxed) + ns, 
+                    std::memory_order_relaxed);
+            if (ns > st.max_ns.load(std::memory_order_relaxed))
+                st.max_ns.store(ns, std::memory_order_relaxed);
+
+            unsigned int bucket = 0;
+            if (ns > 1)
+                bucket = std::min(63 - __builtin_clzll(ns), PACKETCHAIN_HANDLER_HIST_BUCKETS - 1);
+            st.histogram[bucket].store(st.histogram[bucket].load(std::memory_order_relaxed) + 1,
+                    std::memory_order_relaxed);
+        }
+    }
+}
+
+std::shared_ptr<tracker_element> packet_chain::handler_stats_endp_handler() {
+    // Debug-grade endpoint, so build simple string maps instead of registering tracked
+    // fields for every value
+    auto ret = std::make_shared<tracker_element_string_map>();
+    auto handlers = std::make_shared<tracker_element_vector>();
+
+    ret->insert(std::make_pair("kismet.packetchain.handler_stats.enabled",
+                std::make_shared<tracker_element_uint8>(0, get_handler_stats())));
+    ret->insert(std::make_pair("kismet.packetchain.handler_stats.handlers", handlers));
+
+    kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, kismet::shared_lock, 
+            "handler_stats_endp_handler");
+
+    for (int c = CHAINPOS_POSTCAP; c <= CHAINPOS_LOGGING; c++) {
+        for (const auto& pcl : *fetch_chain(c)) {
+            uint64_t count = 0, total_ns = 0, max_ns = 0;
+            std::array<uint64_t, PACKETCHAIN_HANDLER_HIST_BUCKETS> histogram{};
+
+            for (unsigned int s = 0; s < handler_stats_slots; s++) {
+                const auto& st = pcl->stats[s];
+                count += st.count.load(std::memory_order_relaxed);
+                total_ns += st.total_ns.load(std::memory_order_relaxed);
+                max_ns = std::max(max_ns, st.max_ns.load(std::memory_order_relaxed));
+
+                for (unsigned int b = 0; b < PACKETCHAIN_HANDLER_HIST_BUCKETS; b++)
+                    histogram[b] += st.histogram[b].load(std::memory_order_relaxed);
+            }
+
+            auto hmap = std::make_shared<tracker_element_string_map>();
+            hmap->insert(std::make_pair("kismet.packetchain.handler.name",
+                        std::make_shared<tracker_element_string>(0, pcl->name)));
+            hmap->insert(std::make_pair("kismet.packetchain.handler.chain",
+                        std::make_shared<tracker_element_string>(0, chain_name(c))));
+            hmap->insert(std::make_pair("kismet.packetchain.handler.priority",
+                        std::make_shared<tracker_element_int32>(0, pcl->priority)));
+            hmap->insert(std::make_pair("kismet.packetchain.handler.count",
+                        std::make_shared<tracker_element_uint64>(0, count)));
+            hmap->insert(std::make_pair("kismet.packetchain.handler.total_ns",
+                        std::make_shared<tracker_element_uint64>(0, total_ns)));
+            hmap->insert(std::make_pair("kismet.packetchain.handler.max_ns",
+                        std::make_shared<tracker_element_uint64>(0, max_ns)));
+
+            auto hist = std::make_shared<tracker_element_vector_double>();
+            for (auto b : histogram)
+                hist->push_back(b);
+            hmap->insert(std::make_pair("kismet.packetchain.handler.latency_histogram", hist));
+
+            handlers->push_back(hmap);
+        }
+    }
+
+    return ret;
+}
+
+int packet_chain::dispatch_lambda(CHAINCALL_PARMS) {
+    return static_cast<pc_link *>(auxdata)->l_callback(in_pack);
 }
 
 void packet_chain::packet_queue_processor() {
-    kis_packet *packet = NULL;
+    std::vector<kis_packet *> batch(packet_batch_size, nullptr);
 
     while (!packetchain_shutdown && 
             !Globalreg::globalreg->spindown && 
             !Globalreg::globalreg->fatal_condition &&
             !Globalreg::globalreg->complete) {
 
-        packet_queue.wait_dequeue(packet);
+        size_t num_packets = 0;
 
-        if (packet == nullptr)
-            break;
+        if (packet_batch_size == 1) {
+            if (packet_queue.wait_dequeue_timed(batch[0], PACKETCHAIN_THREAD_POLL_USEC))
+                num_packets = 1;
+        } else {
+            num_packets = packet_queue.wait_dequeue_bulk_timed(batch.begin(), 
+                    packet_batch_size, PACKETCHAIN_THREAD_POLL_USEC);
+        }
+
+        if (num_packets == 0)
+            continue;
+
+        for (size_t i = 0; i < num_packets; i++)
+            release_admission(batch[i]);
 
         {
-            // Lock the chain mutexes until we're done processing this packet
-            // kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, kismet::shared_lock, "packet_queue_processor");
-            std::shared_lock<kis_shared_mutex> lk(packetchain_mutex);
-
-            // These can only be perturbed inside a sync, which can only occur when
-            // the worker thread is in the sync block above, so we shouldn't
-            // need to worry about the integrity of these vectors while running
-
-            for (const auto& pcl : postcap_chain) {
-                if (pcl->callback != nullptr)
-                    pcl->callback(Globalreg::globalreg, pcl->auxdata, packet);
-                else if (pcl->l_callback != nullptr)
-                    pcl->l_callback(packet);
-            }
+            // Publish the generation we're running before loading the table, and go idle
+            // again once the batch is done; handler removal waits for every thread to be 
+            // idle or past the generation of the removal before releasing the handlers.
+            // These are sequentially consistent so a table swapped out after we read the
+            // generation can't be freed before we see that we're running it.
+            //
+            // Each handler is run across the whole batch before moving to the next
+            // handler, which keeps each handler hot while it works through the batch.
+            local_dispatch_epoch->store(dispatch_generation.load());
+            auto table = dispatch_table.load();
+
+            process_chain_batch(*table, CHAINPOS_POSTCAP, CHAINPOS_LOGGING, 
+                    batch.data(), num_packets);
+
+            local_dispatch_epoch->store(0, std::memory_order_release);
+        }
 
-            for (const auto& pcl : llcdissect_chain) {
-                if (pcl->callback != nullptr)
-                    pcl->callback(Globalreg::globalreg, pcl->auxdata, packet);
-                else if (pcl->l_callback != nullptr)
-                    pcl->l_callback(packet);
-            }
+        complete_packet_batch(batch.data(), num_packets);
+    }
+}
 
-            for (const auto& pcl : decrypt_chain) {
-                if (pcl->callback != nullptr)
-                    pcl->callback(Globalreg::globalreg, pcl->auxdata, packet);
-                else if (pcl->l_callback != nullptr)
-                    pcl->l_callback(packet);
-            }
+void packet_chain::complete_packet_batch(kis_packet **batch, size_t batch_sz) {
+    int64_t num_error = 0, num_dupe = 0;
 
-            for (const auto& pcl : datadissect_chain) {
-                if (pcl->callback != nullptr)
-                    pcl->callback(Globalreg::globalreg, pcl->auxdata, packet);
-                else if (pcl->l_callback != nullptr)
-                    pcl->l_callback(packet);
-            }
+    for (size_t i = 0; i < batch_sz; i++) {
+        if (batch[i]->error)
+            num_error++;
 
-            for (const auto& pcl : classifier_chain) {
-                if (pcl->callback != nullptr)
-                    pcl->callback(Globalreg::globalreg, pcl->auxdata, packet);
-                else if (pcl->l_callback != nullptr)
-                    pcl->l_callback(packet);
-            }
+        if (batch[i]->duplicate)
+            num_dupe++;
 
-            for (const auto& pcl : tracker_chain) {
-                if (pcl->callback != nullptr)
-                    pcl->callback(Globalreg::globalreg, pcl->auxdata, packet);
-                else if (pcl->l_callback != nullptr)
-                    pcl->l_callback(packet);
-            }
+        destroy_packet(batch[i]);
+    }
 
-            for (const auto& pcl : logging_chain) {
-                if (pcl->callback != nullptr)
-                    pcl->callback(Globalreg::globalreg, pcl->auxdata, packet);
-                else if (pcl->l_callback != nullptr)
-                    pcl->l_callback(packet);
-            }
-        }
+    if (num_error)
+        packet_error_count.add(num_error);
 
-        if (packet->error)
-            packet_error_rrd->add_sample(1, time(0));
+    if (num_dupe)
+        packet_dupe_count.add(num_dupe);
 
-        if (packet->duplicate)
-            packet_dupe_rrd->add_sample(1, time(0));
+    packet_processed_count.add(batch_sz);
+}
 
-        packet_processed_rrd->add_sample(1, time(0));
+void packet_chain::fold_packet_counters() {
+    auto now = time(0);
 
-        destroy_packet(packet);
+    auto num_rate = packet_rate_count.fetch_reset();
+    auto num_error = packet_error_count.fetch_reset();
+    auto num_dupe = packet_dupe_count.fetch_reset();
+    auto num_drop = packet_drop_count.fetch_reset();
+    auto num_processed = packet_processed_count.fetch_reset();
+    auto queue_peak = packet_queue_peak.fetch_reset();
 
-        continue;
+    if (num_rate) {
+        packet_rate_rrd->add_sample(num_rate, now);
+        packet_peak_rrd->add_sample(num_rate, now);
     }
+
+    if (num_error)
+        packet_error_rrd->add_sample(num_error, now);
+
+    if (num_dupe)
+        packet_dupe_rrd->add_sample(num_dupe, now);
+
+    if (num_drop)
+        packet_drop_rrd->add_sample(num_drop, now);
+
+    if (num_processed)
+        packet_processed_rrd->add_sample(num_processed, now);
+
+    if (queue_peak)
+        packet_queue_rrd->add_sample(queue_peak, now);
 }
 
 int packet_chain::process_packet(kis_packet *in_pack) {
     // Total packet rate always gets added, even when we drop, so we can compare
-    packet_rate_rrd->add_sample(1, time(0));
-    packet_peak_rrd->add_sample(1, time(0));
+    packet_rate_count.add(1);
+
+    auto backlog = packet_backlog();
 
-    if (packet_queue_drop != 0 && packet_queue.size_approx() > packet_queue_drop) {
+    if (!admit_packet(in_pack, backlog)) {
         time_t offt = time(0) - last_packet_drop_user_warning;
 
         if (offt > 30) {
@@ -391,18 +677,19 @@ int packet_chain::process_packet(kis_packet *in_pack) {
                     fmt::format("The packet queue has exceeded the maximum size of {}; Kismet "
                         "will start dropping packets.  Your system may not have enough CPU to keep "
                         "up with the packet rate in your environment or other processes may be "
-                        "taking up the CPU.  You can increase the packet backlog with the "
+                        "taking up the CPU.  Packets are dropped first from the sources using "
+                        "the most of the queue.  You can increase the packet backlog with the "
                         "packet_backlog_limit configuration parameter.", packet_queue_drop), -1);
         }
 
         destroy_packet(in_pack);
 
-        packet_drop_rrd->add_sample(1, time(0));
+        packet_drop_count.add(1);
 
         return 1;
     }
 
-    if (packet_queue.size_approx() > packet_queue_warning && packet_queue_warning != 0) {
+    if (backlog > packet_queue_warning && packet_queue_warning != 0) {
         time_t offt = time(0) - last_packet_queue_user_warning;
 
         if (offt > 30) {
@@ -423,231 +710,284 @@ int packet_chain::process_packet(kis_packet *in_pack) {
     // Queue the packet
     packet_queue.enqueue(in_pack);
 
-    packet_queue_rrd->add_sample(packet_queue.size_approx(), time(0));
+    packet_queue_peak.sample(packet_backlog());
 
     return 1;
 }
 
-void packet_chain::destroy_packet(kis_packet *in_pack) {
+bool packet_chain::admit_packet(kis_packet *in_pack, size_t in_queue_sz) {
+    auto datasrc = in_pack->fetch<packetchain_comp_datasource>(pack_comp_datasrc);
+    auto source = datasrc != nullptr ? datasrc->ref_source : nullptr;
+
+    if (packet_queue_drop != 0 && 
+            (in_queue_sz >= packet_queue_drop || 
+             (packet_backlog_priority && in_queue_sz >= packet_queue_drop - packet_queue_drop / 4))) {
+        // Each source with packets in the queue is entitled to an equal share of the
+        // backlog; sources at or over their share are shed first, so that one busy
+        // source can't starve the others
+        int64_t share = packet_queue_drop / std::max(1, admission_sources.load(std::memory_order_relaxed));
+        int64_t queued = source != nullptr ? source->get_admission_queued() :
+            admission_unsourced.load(std::memory_order_relaxed);
+
+        bool drop;
+
+        if (in_queue_sz >= packet_queue_hard_drop) {
+            // Hard ceiling, regardless of share
+            drop = true;
+        } else if (in_queue_sz >= packet_queue_drop) {
+            drop = queued >= share || (packet_backlog_priority && !admission_priority(in_pack));
+        } else {
+            // Approaching the limit, start shedding low priority frames from sources 
+            // over their share
+            drop = queued >= share && !admission_priority(in_pack);
+        }
+
+        if (drop) {
+            if (source != nullptr)
+                source->admission_dropped();
+            return false;
+        }
+    }
 
-	delete in_pack;
+    if (source != nullptr) {
+        if (source->admission_enqueued() <= 0)
+            admission_sources.fetch_add(1, std::memory_order_relaxed);
+    } else if (admission_unsourced.fetch_add(1, std::memory_order_relaxed) <= 0) {
+        admission_sources.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return true;
 }
 
-int packet_chain::register_int_handler(pc_callback in_cb, void *in_aux,
-        std::function<int (kis_packet *)> in_l_cb, 
-        int in_chain, int in_prio) {
+void packet_chain::release_admission(kis_packet *in_pack) {
+    auto datasrc = in_pack->fetch<packetchain_comp_datasource>(pack_comp_datasrc);
 
-    kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, "register_int_handler");
+    if (datasrc != nullptr && datasrc->ref_source != nullptr) {
+        if (datasrc->ref_source->admission_dequeued() == 1)
+            admission_sources.fetch_sub(1, std::memory_order_relaxed);
+    } else if (admission_unsourced.fetch_sub(1, std::memory_order_relaxed) == 1) {
+        admission_sources.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
 
-    pc_link *link = NULL;
+bool packet_chain::admission_priority(kis_packet *in_pack) const {
+    auto chunk = in_pack->fetch<kis_datachunk>(pack_comp_linkframe);
 
-    // Generate packet, we'll nuke it if it's invalid later
-    link = new pc_link;
-    link->priority = in_prio;
-    link->callback = in_cb;
-    link->l_callback = in_l_cb;
-    link->auxdata = in_aux;
-    link->id = next_handlerid++;
+    // Anything which isn't an 802.11 frame is kept
+    if (chunk == nullptr || chunk->data == nullptr)
+        return true;
 
-    switch (in_chain) {
-        case CHAINPOS_POSTCAP:
-            postcap_chain.push_back(link);
-            stable_sort(postcap_chain.begin(), postcap_chain.end(), 
-                    SortLinkPriority());
-            break;
+    unsigned int offt = 0;
 
-        case CHAINPOS_LLCDISSECT:
-            llcdissect_chain.push_back(link);
-            stable_sort(llcdissect_chain.begin(), llcdissect_chain.end(), 
-                    SortLinkPriority());
+    switch (chunk->dlt) {
+        case KDLT_IEEE802_11:
             break;
-
-        case CHAINPOS_DECRYPT:
-            decrypt_chain.push_back(link);
-            stable_sort(decrypt_chain.begin(), decrypt_chain.end(), 
-                    SortLinkPriority());
+        case KDLT_IEEE802_11_RADIO:
+        case KDLT_PPI:
+            // Both radiotap and PPI carry the little-endian header length at offset 2
+            if (chunk->length < 4)
+                return true;
+            offt = chunk->data[2] | (chunk->data[3] << 8);
             break;
+        default:
+            return true;
+    }
 
-        case CHAINPOS_DATADISSECT:
-            datadissect_chain.push_back(link);
-            stable_sort(datadissect_chain.begin(), datadissect_chain.end(), 
-                    SortLinkPriority());
-            break;
+    if (offt >= chunk->length)
+        return true;
 
-        case CHAINPOS_CLASSIFIER:
-            classifier_chain.push_back(link);
-            stable_sort(classifier_chain.begin(), classifier_chain.end(), 
-                    SortLinkPriority());
-            break;
+    // Frame control type 2 is data; management and control frames are kept
+    return ((chunk->data[offt] >> 2) & 0x03) != 2;
+}
 
-        case CHAINPOS_TRACKER:
-            tracker_chain.push_back(link);
-            stable_sort(tracker_chain.begin(), tracker_chain.end(), 
-                    SortLinkPriority());
-            break;
+void packet_chain::destroy_packet(kis_packet *in_pack) {
+    if (packet_pool_max == 0) {
+        delete in_pack;
+        return;
+    }
 
-        case CHAINPOS_LOGGING:
-            logging_chain.push_back(link);
-            stable_sort(logging_chain.begin(), logging_chain.end(), 
-                    SortLinkPriority());
-            break;
+    in_pack->reset();
 
-        default:
-            delete link;
-            _MSG("packet_chain::register_handler requested unknown chain", MSGFLAG_ERROR);
-            return -1;
+    if (local_packet_pool.packets.size() < packet_pool_cache_max) {
+        local_packet_pool.packets.push_back(in_pack);
+        return;
     }
 
-    return link->id;
+    if (packet_pool.size_approx() < packet_pool_max && packet_pool.enqueue(in_pack))
+        return;
+
+    delete in_pack;
 }
 
-int packet_chain::register_handler(pc_callback in_cb, void *in_aux, int in_chain, int in_prio) {
-    return register_int_handler(in_cb, in_aux, NULL, in_chain, in_prio);
+std::vector<packet_chain::pc_link *> *packet_chain::fetch_chain(int in_chain) {
+    switch (in_chain) {
+        case CHAINPOS_POSTCAP:
+            return &postcap_chain;
+        case CHAINPOS_LLCDISSECT:
+            return &llcdissect_chain;
+        case CHAINPOS_DECRYPT:
+            return &decrypt_chain;
+        case CHAINPOS_DATADISSECT:
+            return &datadissect_chain;
+        case CHAINPOS_CLASSIFIER:
+            return &classifier_chain;
+        case CHAINPOS_TRACKER:
+            return &tracker_chain;
+        case CHAINPOS_LOGGING:
+            return &logging_chain;
+    }
+
+    return nullptr;
 }
 
-int packet_chain::register_handler(std::function<int (kis_packet *)> in_cb, int in_chain, int in_prio) {
-    return register_int_handler(NULL, NULL, in_cb, in_chain, in_prio);
+uint64_t packet_chain::rebuild_dispatch_table(std::vector<pc_link *> in_removed) {
+    auto table = new pc_dispatch_table();
+
+    for (int c = 0; c <= CHAINPOS_LOGGING + 1; c++) {
+        table->chain_start[c] = table->handlers.size();
+
+        auto chain = fetch_chain(c);
+
+        if (chain == nullptr)
+            continue;
+
+        for (const auto& pcl : *chain) {
+            if (pcl->callback != nullptr)
+                table->handlers.push_back(pc_dispatch{pcl->callback, pcl->auxdata, pcl});
+            else if (pcl->l_callback != nullptr)
+                table->handlers.push_back(pc_dispatch{&packet_chain::dispatch_lambda, pcl, pcl});
+        }
+    }
+
+    auto old_table = dispatch_table.exchange(table);
+    auto generation = dispatch_generation.fetch_add(1) + 1;
+
+    if (old_table != nullptr || in_removed.size())
+        dispatch_retired.push_back(pc_dispatch_retired{old_table, std::move(in_removed), generation});
+
+    reclaim_dispatch_tables();
+
+    return generation;
 }
 
-int packet_chain::remove_handler(int in_id, int in_chain) {
-    kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, "remove_handler");
+bool packet_chain::dispatch_quiescent(uint64_t in_generation) const {
+    for (unsigned int n = 0; n < packet_thread_count; n++) {
+        auto g = dispatch_epochs[n].generation.load();
 
-    unsigned int x;
+        if (g != 0 && g < in_generation)
+            return false;
+    }
 
-    switch (in_chain) {
-        case CHAINPOS_POSTCAP:
-            for (x = 0; x < postcap_chain.size(); x++) {
-                if (postcap_chain[x]->id == in_id) {
-                    postcap_chain.erase(postcap_chain.begin() + x);
-                }
-            }
-            break;
+    return true;
+}
 
-        case CHAINPOS_LLCDISSECT:
-            for (x = 0; x < llcdissect_chain.size(); x++) {
-                if (llcdissect_chain[x]->id == in_id) {
-                    llcdissect_chain.erase(llcdissect_chain.begin() + x);
-                }
-            }
-            break;
+void packet_chain::reclaim_dispatch_tables() {
+    for (auto i = dispatch_retired.begin(); i != dispatch_retired.end(); ) {
+        if (!dispatch_quiescent(i->generation)) {
+            ++i;
+            continue;
+        }
 
-        case CHAINPOS_DECRYPT:
-            for (x = 0; x < decrypt_chain.size(); x++) {
-                if (decrypt_chain[x]->id == in_id) {
-                    decrypt_chain.erase(decrypt_chain.begin() + x);
-                }
-            }
-            break;
+        delete i->table;
+        for (auto l : i->removed)
+            delete l;
 
-        case CHAINPOS_DATADISSECT:
-            for (x = 0; x < datadissect_chain.size(); x++) {
-                if (datadissect_chain[x]->id == in_id) {
-                    datadissect_chain.erase(datadissect_chain.begin() + x);
-                }
-            }
-            break;
+        i = dispatch_retired.erase(i);
+    }
+}
 
-        case CHAINPOS_CLASSIFIER:
-            for (x = 0; x < classifier_chain.size(); x++) {
-                if (classifier_chain[x]->id == in_id) {
-                    classifier_chain.erase(classifier_chain.begin() + x);
-                }
-            }
-            break;
+int packet_chain::register_int_handler(pc_callback in_cb, void *in_aux,
+        std::function<int (kis_packet *)> in_l_cb, 
+        int in_chain, int in_prio, const std::string& in_name) {
 
-        case CHAINPOS_TRACKER:
-            for (x = 0; x < tracker_chain.size(); x++) {
-                if (tracker_chain[x]->id == in_id) {
-                    tracker_chain.erase(tracker_chain.begin() + x);
-                }
-            }
-            break;
+    kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, "register_int_handler");
 
-        case CHAINPOS_LOGGING:
-            for (x = 0; x < logging_chain.size(); x++) {
-                if (logging_chain[x]->id == in_id) {
-                    logging_chain.erase(logging_chain.begin() + x);
-                }
-            }
-            break;
+    auto chain = fetch_chain(in_chain);
 
-        default:
-            _MSG("packet_chain::remove_handler requested unknown chain", 
-                    MSGFLAG_ERROR);
-            return -1;
+    if (chain == nullptr) {
+        _MSG("packet_chain::register_handler requested unknown chain", MSGFLAG_ERROR);
+        return -1;
     }
 
-    return 1;
+    auto link = new pc_link;
+    link->priority = in_prio;
+    link->callback = in_cb;
+    link->l_callback = in_l_cb;
+    link->auxdata = in_aux;
+    link->id = next_handlerid++;
+    link->name = in_name.length() ? in_name : fmt::format("handler {}", link->id);
+    link->stats.reset(new pc_handler_stats[handler_stats_slots]);
+
+    chain->push_back(link);
+    stable_sort(chain->begin(), chain->end(), SortLinkPriority());
+
+    // Nothing is being removed, so there's no need to wait for the old table
+    rebuild_dispatch_table();
+
+    return link->id;
 }
 
-int packet_chain::remove_handler(pc_callback in_cb, int in_chain) {
-    kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, "remove_handler");
+int packet_chain::register_handler(pc_callback in_cb, void *in_aux, int in_chain, int in_prio,
+        const std::string& in_name) {
+    return register_int_handler(in_cb, in_aux, NULL, in_chain, in_prio, in_name);
+}
 
-    unsigned int x;
+int packet_chain::register_handler(std::function<int (kis_packet *)> in_cb, int in_chain, int in_prio,
+        const std::string& in_name) {
+    return register_int_handler(NULL, NULL, in_cb, in_chain, in_prio, in_name);
+}
 
-    switch (in_chain) {
-        case CHAINPOS_POSTCAP:
-            for (x = 0; x < postcap_chain.size(); x++) {
-                if (postcap_chain[x]->callback == in_cb) {
-                    postcap_chain.erase(postcap_chain.begin() + x);
-                }
-            }
-            break;
+int packet_chain::remove_int_handler(std::function<bool (const pc_link *)> in_match, int in_chain) {
+    uint64_t generation;
 
-        case CHAINPOS_LLCDISSECT:
-            for (x = 0; x < llcdissect_chain.size(); x++) {
-                if (llcdissect_chain[x]->callback == in_cb) {
-                    llcdissect_chain.erase(llcdissect_chain.begin() + x);
-                }
-            }
-            break;
+    {
+        kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, "remove_handler");
 
-        case CHAINPOS_DECRYPT:
-            for (x = 0; x < decrypt_chain.size(); x++) {
-                if (decrypt_chain[x]->callback == in_cb) {
-                    decrypt_chain.erase(decrypt_chain.begin() + x);
-                }
-            }
-            break;
+        auto chain = fetch_chain(in_chain);
 
-        case CHAINPOS_DATADISSECT:
-            for (x = 0; x < datadissect_chain.size(); x++) {
-                if (datadissect_chain[x]->callback == in_cb) {
-                    datadissect_chain.erase(datadissect_chain.begin() + x);
-                }
-            }
-            break;
+        if (chain == nullptr) {
+            _MSG("packet_chain::remove_handler requested unknown chain", MSGFLAG_ERROR);
+            return -1;
+        }
 
-        case CHAINPOS_CLASSIFIER:
-            for (x = 0; x < classifier_chain.size(); x++) {
-                if (classifier_chain[x]->callback == in_cb) {
-                    classifier_chain.erase(classifier_chain.begin() + x);
-                }
-            }
-            break;
+        std::vector<pc_link *> removed;
 
-        case CHAINPOS_TRACKER:
-            for (x = 0; x < tracker_chain.size(); x++) {
-                if (tracker_chain[x]->callback == in_cb) {
-                    tracker_chain.erase(tracker_chain.begin() + x);
-                }
+        for (auto i = chain->begin(); i != chain->end(); ) {
+            if (in_match(*i)) {
+                removed.push_back(*i);
+                i = chain->erase(i);
+            } else {
+                ++i;
             }
-            break;
+        }
 
-        case CHAINPOS_LOGGING:
-            for (x = 0; x < logging_chain.size(); x++) {
-                if (logging_chain[x]->callback == in_cb) {
-                    logging_chain.erase(logging_chain.begin() + x);
-                }
-            }
-            break;
+        if (removed.size() == 0)
+            return 1;
 
-        default:
-            _MSG("packet_chain::remove_handler requested unknown chain", 
-                    MSGFLAG_ERROR);
-            return -1;
+        generation = rebuild_dispatch_table(std::move(removed));
     }
 
+    // A handler removing itself from a packet thread can't wait on its own batch; the
+    // removed handlers are released by a later rebuild instead
+    if (local_dispatch_epoch != nullptr)
+        return 1;
+
+    // Wait outside the chain lock for the packet threads to finish any batch which could
+    // still be running the removed handlers, so the caller can tear down whatever they use
+    while (!dispatch_quiescent(generation))
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+    kis_lock_guard<kis_shared_mutex> lk(packetchain_mutex, "remove_handler");
+    reclaim_dispatch_tables();
+
     return 1;
 }
 
+int packet_chain::remove_handler(int in_id, int in_chain) {
+    return remove_int_handler([in_id](const pc_link *l) { return l->id == in_id; }, in_chain);
+}
+
+int packet_chain::remove_handler(pc_callback in_cb, int in_chain) {
+    return remove_int_handler([in_cb](const pc_link *l) { return l->callback == in_cb; }, in_chain);
+}
+
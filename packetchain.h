@@ -29,6 +29,8 @@
 #endif
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <string>
 #include <vector>
 #include <map>
@@ -40,11 +42,14 @@
 #include "globalregistry.h"
 #include "kis_mutex.h"
 #include "kis_net_beast_httpd.h"
+#include "kis_sharded_counter.h"
+#include "macaddr.h"
 #include "timetracker.h"
 #include "trackedelement.h"
 #include "trackedrrd.h"
 
 #include "moodycamel/blockingconcurrentqueue.h"
+#include "moodycamel/concurrentqueue.h"
 
 /* Packets are added to the packet queue from any thread (including the main 
  * thread).
@@ -85,6 +90,13 @@
 #define CHAINPOS_TRACKER		7
 #define CHAINPOS_LOGGING        8
 
+// Log2 latency histogram buckets for per-handler stats; bucket N counts calls
+// taking [2^N, 2^(N+1)) nanoseconds
+#define PACKETCHAIN_HANDLER_HIST_BUCKETS    32
+
+// How often idle packet threads wake up to check for shutdown, in microseconds
+#define PACKETCHAIN_THREAD_POLL_USEC        100000
+
 #define CHAINCALL_PARMS global_registry *globalreg __attribute__ ((unused)), \
     void *auxdata __attribute__ ((unused)), \
     kis_packet *in_pack
@@ -115,13 +127,23 @@ public:
     int remove_packet_component(int in_id);
     std::string fetch_packet_component_name(int in_id);
 
-    // Generate a packet and hand it back
+    // Generate a packet and hand it back; packets are recycled from the packet pool
+    // whenever possible
     kis_packet *generate_packet();
     // Inject a packet into the chain
     int process_packet(kis_packet *in_pack);
-    // Destroy a packet at the end of its life
+    // Destroy a packet at the end of its life, returning it to the packet pool
     void destroy_packet(kis_packet *in_pack);
  
+    // Per-handler timing, one slot per packet processing thread so that each thread
+    // only ever writes its own slot
+    struct alignas(64) pc_handler_stats {
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+        std::array<std::atomic<uint64_t>, PACKETCHAIN_HANDLER_HIST_BUCKETS> histogram{};
+    };
+
     // Callback and information 
     typedef int (*pc_callback)(CHAINCALL_PARMS);
     typedef struct {
@@ -130,23 +152,106 @@ public:
         std::function<int (kis_packet *)> l_callback;
         void *auxdata;
 		int id;
+        std::string name;
+        std::unique_ptr<pc_handler_stats[]> stats;
     } pc_link;
 
-    // Register a callback, aux data, a chain to put it in, and the priority 
-    int register_handler(pc_callback in_cb, void *in_aux, int in_chain, int in_prio);
-    int register_handler(std::function<int (kis_packet *)> in_cb, int in_chain, int in_prio);
+    // Register a callback, aux data, a chain to put it in, and the priority; the name
+    // identifies the handler in the handler stats
+    int register_handler(pc_callback in_cb, void *in_aux, int in_chain, int in_prio,
+            const std::string& in_name = "");
+    int register_handler(std::function<int (kis_packet *)> in_cb, int in_chain, int in_prio,
+            const std::string& in_name = "");
     int remove_handler(pc_callback in_cb, int in_chain);
 	int remove_handler(int in_id, int in_chain);
 
+    // Registered handlers are compiled into a single flat dispatch table covering 
+    // every chain position, in chain and priority order, with lambda handlers called
+    // through a trampoline.  The table is rebuilt and swapped whenever a handler is 
+    // added or removed, so the packet threads run it without taking the chain lock.
+    typedef struct {
+        packet_chain::pc_callback callback;
+        void *auxdata;
+        pc_link *link;
+    } pc_dispatch;
+
+    typedef struct {
+        std::vector<pc_dispatch> handlers;
+        // Offset of the first handler of each chain position in handlers
+        std::array<size_t, CHAINPOS_LOGGING + 2> chain_start;
+    } pc_dispatch_table;
+
     static std::string event_packetstats() { return "PACKETCHAIN_STATS"; }
 
+    // Per-handler latency stats are only gathered while enabled; they can be 
+    // toggled at runtime and cost a single flag check per handler batch when off
+    void set_handler_stats(bool in_enable) { 
+        handler_stats_enabled.store(in_enable, std::memory_order_relaxed); 
+    }
+    bool get_handler_stats() const { 
+        return handler_stats_enabled.load(std::memory_order_relaxed); 
+    }
+
 protected:
     void packet_queue_processor();
 
+    // Fold the per-thread packet counters into the packet RRDs; called from the 
+    // stats timer once a second
+    void fold_packet_counters();
+
+    // Run chain positions in_first through in_last across a batch of packets
+    void process_chain_batch(const pc_dispatch_table& table, int in_first, int in_last,
+            kis_packet **batch, size_t batch_sz);
+
+    // Timed version of process_chain_batch used while handler stats are enabled
+    void process_chain_batch_stats(const pc_dispatch_table& table, int in_first, int in_last,
+            kis_packet **batch, size_t batch_sz);
+
+    // Give the calling packet thread its stats slot
+    void assign_stats_slot(unsigned int slot);
+
+    std::shared_ptr<tracker_element> handler_stats_endp_handler();
+
+    // Dispatch trampoline for std::function handlers; auxdata is the pc_link
+    static int dispatch_lambda(CHAINCALL_PARMS);
+
+    std::vector<packet_chain::pc_link *> *fetch_chain(int in_chain);
+
+    // Compile the chains into a new dispatch table and swap it in.  The previous table,
+    // and any handler links removed with it, are retired until every packet thread has
+    // finished the batch it was running.  Returns the generation the packet threads must
+    // pass before the retired table is unused.  Must be called with the chain mutex held.
+    uint64_t rebuild_dispatch_table(std::vector<pc_link *> in_removed = {});
+
+    // Have all packet threads passed a dispatch generation?
+    bool dispatch_quiescent(uint64_t in_generation) const;
+
+    // Free the retired tables no packet thread can still be running; must be called with
+    // the chain mutex held
+    void reclaim_dispatch_tables();
+
+    // Packet admission control; under backlog each source is held to a fair share of
+    // the queue, and with backlog priority enabled, data frames are shed before 
+    // management and control frames.  Returns false if the packet should be dropped.
+    bool admit_packet(kis_packet *in_pack, size_t in_queue_sz);
+    // Release the admission accounting for a packet leaving the queue
+    void release_admission(kis_packet *in_pack);
+    // Is this packet worth keeping over others under backlog?
+    bool admission_priority(kis_packet *in_pack) const;
+
+    // Account for and destroy a batch of packets which have completed the chain
+    void complete_packet_batch(kis_packet **batch, size_t batch_sz);
+
+    // Packets waiting in the packet queue
+    size_t packet_backlog() {
+        return packet_queue.size_approx();
+    }
+
     // Common function for both insertion methods
     int register_int_handler(pc_callback in_cb, void *in_aux, 
             std::function<int (kis_packet *)> in_l_cb, 
-            int in_chain, int in_prio);
+            int in_chain, int in_prio, const std::string& in_name);
+    int remove_int_handler(std::function<bool (const pc_link *)> in_match, int in_chain);
 
     int next_componentid, next_handlerid;
 
@@ -165,17 +270,59 @@ protected:
     // Packet component mutex
     kis_mutex packetcomp_mutex;
 
-    // Packet chain mutex
+    // Packet chain mutex, serializes handler registration and removal
     kis_shared_mutex packetchain_mutex;
 
+    // Current dispatch table.  Packet threads don't take a reference to it; each thread
+    // instead publishes the dispatch generation it saw when starting a batch, and 0 when
+    // idle, in its own epoch slot.  A swapped out table is freed once every slot is idle
+    // or has moved past the generation it was retired in.
+    std::atomic<const pc_dispatch_table *> dispatch_table;
+    std::atomic<uint64_t> dispatch_generation;
+
+    typedef struct alignas(64) {
+        std::atomic<uint64_t> generation;
+    } pc_dispatch_epoch;
+
+    std::unique_ptr<pc_dispatch_epoch[]> dispatch_epochs;
+
+    typedef struct {
+        const pc_dispatch_table *table;
+        std::vector<pc_link *> removed;
+        uint64_t generation;
+    } pc_dispatch_retired;
+
+    std::vector<pc_dispatch_retired> dispatch_retired;
+
     // std::thread packet_thread;
     std::list<std::thread> packet_threads;
+    unsigned int packet_thread_count;
 
     moodycamel::BlockingConcurrentQueue<kis_packet *> packet_queue;
-    bool packetchain_shutdown;
+
+    // Packet threads wait on the queue with a timeout and check this each time, so that
+    // every thread sees shutdown no matter how the queue is split between them
+    std::atomic<bool> packetchain_shutdown;
+
+    // Maximum number of packets a packet thread pulls from the queue and runs 
+    // through the chain stages at once
+    size_t packet_batch_size;
+
+    std::atomic<bool> handler_stats_enabled;
+    // Number of per-thread handler stats slots; one for each packet thread
+    unsigned int handler_stats_slots;
 
     // Warning and discard levels for packet queue being full
     unsigned int packet_queue_warning, packet_queue_drop;
+    // Backlog at which every packet is dropped, whatever its source's share
+    unsigned int packet_queue_hard_drop;
+
+    int pack_comp_datasrc, pack_comp_linkframe;
+    bool packet_backlog_priority;
+    // Number of sources with packets in the queue, and the queue depth of packets 
+    // with no source
+    std::atomic<int> admission_sources;
+    std::atomic<int64_t> admission_unsourced;
     time_t last_packet_queue_user_warning, last_packet_drop_user_warning;
 
     std::shared_ptr<kis_tracked_rrd<kis_tracked_rrd_default_aggregator,
@@ -203,6 +350,22 @@ protected:
 
     std::shared_ptr<tracker_element_map> packet_stats_map;
 
+    // Per-packet accounting is done in sharded per-thread counters and folded into
+    // the RRDs above once a second, so that packet threads never contend on the 
+    // RRD locks
+    kis_sharded_counter packet_rate_count, packet_error_count, packet_dupe_count,
+        packet_drop_count, packet_processed_count;
+    kis_sharded_peak packet_queue_peak;
+
+    // Recycled packets shared between all threads; each thread keeps a small local
+    // cache in front of this and spills into it
+    moodycamel::ConcurrentQueue<kis_packet *> packet_pool;
+    size_t packet_pool_max;
+
+    std::atomic<uint64_t> packet_pool_hits, packet_pool_misses;
+    std::shared_ptr<tracker_element_uint64> packet_pool_hits_counter;
+    std::shared_ptr<tracker_element_uint64> packet_pool_misses_counter;
+
     std::shared_ptr<time_tracker> timetracker;
     int event_timer_id;
     std::shared_ptr<event_bus> eventbus;
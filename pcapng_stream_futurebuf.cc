@@ -527,7 +527,7 @@ void pcapng_stream_packetchain::start_stream() {
         packetchain->register_handler([this](kis_packet *packet) {
             handle_packet(packet);
             return 1;
-        }, CHAINPOS_LOGGING, -100);
+        }, CHAINPOS_LOGGING, -100, "pcapng_stream packet");
 }
 
 void pcapng_stream_packetchain::stop_stream(std::string in_reason) {
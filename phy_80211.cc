@@ -102,10 +102,14 @@ kis_80211_phy::kis_80211_phy(int in_phyid) :
                 "IEEE802.11 device");
 
     // Packet classifier - makes basic records plus dot11 data
-    packetchain->register_handler(&packet_dot11_common_classifier, this, CHAINPOS_CLASSIFIER, -100);
-    packetchain->register_handler(&packet_dot11_scan_json_classifier, this, CHAINPOS_CLASSIFIER, -99);
-    packetchain->register_handler(&phydot11_packethook_wep, this, CHAINPOS_DECRYPT, -100);
-    packetchain->register_handler(&phydot11_packethook_dot11, this, CHAINPOS_LLCDISSECT, -100);
+    packetchain->register_handler(&packet_dot11_common_classifier, this, CHAINPOS_CLASSIFIER, -100,
+            "phy_80211 packet_dot11_common_classifier");
+    packetchain->register_handler(&packet_dot11_scan_json_classifier, this, CHAINPOS_CLASSIFIER, -99,
+            "phy_80211 packet_dot11_scan_json_classifier");
+    packetchain->register_handler(&phydot11_packethook_wep, this, CHAINPOS_DECRYPT, -100,
+            "phy_80211 phydot11_packethook_wep");
+    packetchain->register_handler(&phydot11_packethook_dot11, this, CHAINPOS_LLCDISSECT, -100,
+            "phy_80211 phydot11_packethook_dot11");
 
     // If we haven't registered packet components yet, do so.  We have to
     // co-exist with the old tracker core for some time
@@ -735,13 +739,14 @@ kis_80211_phy::kis_80211_phy(int in_phyid) :
                     return false;
                     });
         devicetracker->add_view(ap_view);
-
-        bss_ts_group_usec = Globalreg::globalreg->kismet_config->fetch_opt_ulong("dot11_related_bss_window", 10'000'000);
     } else {
-        _MSG_INFO("Phy80211 access point views are turned off; this will prevent matching related devices by timestamp "
-                "and other features.");
+        _MSG_INFO("Phy80211 access point views are turned off; this may break some aspects of the web UI.");
     }
 
+    bss_ts_group_usec = Globalreg::globalreg->kismet_config->fetch_opt_ulong("dot11_related_bss_window", 10'000'000);
+    bssts_index_mutex.set_name("kis_80211_phy bssts_index");
+    probe_index_mutex.set_name("kis_80211_phy probe_index");
+
     // Register js module for UI
     std::shared_ptr<kis_httpd_registry> httpregistry = 
         Globalreg::fetch_mandatory_global_as<kis_httpd_registry>();
@@ -831,7 +836,48 @@ kis_80211_phy::kis_80211_phy(int in_phyid) :
                     find_clients(dev);
 
                     return cl;
-                }, devicetracker->get_devicelist_mutex()));
+                }, devicetracker->get_devicelist_mutex().reader_mutex()));
+
+    httpd->register_route("/phy/phy80211/by-wps-uuid/:uuid/devices", {"GET", "POST"}, httpd->RO_ROLE, {},
+            std::make_shared<kis_net_web_tracked_endpoint>(
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    auto cl = std::make_shared<tracker_element_vector>();
+                    auto uuid = con->uri_params()[":uuid"];
+
+                    for (const auto& k : find_wps_uuid(uuid)) {
+                        auto d = devicetracker->fetch_device(k);
+
+                        if (d == nullptr) {
+                            remove_wps_uuid_index(k, uuid);
+                            continue;
+                        }
+
+                        cl->push_back(d);
+                    }
+
+                    return cl;
+                }, devicetracker->get_devicelist_mutex().reader_mutex()));
+
+    httpd->register_route("/phy/phy80211/by-probe-fingerprint/:fingerprint/devices", {"GET", "POST"}, 
+            httpd->RO_ROLE, {},
+            std::make_shared<kis_net_web_tracked_endpoint>(
+                [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
+                    auto cl = std::make_shared<tracker_element_vector>();
+                    auto fingerprint = string_to_n<uint32_t>(con->uri_params()[":fingerprint"]);
+
+                    for (const auto& k : find_probe_fingerprint(fingerprint)) {
+                        auto d = devicetracker->fetch_device(k);
+
+                        if (d == nullptr) {
+                            remove_probe_fingerprint_index(k);
+                            continue;
+                        }
+
+                        cl->push_back(d);
+                    }
+
+                    return cl;
+                }, devicetracker->get_devicelist_mutex().reader_mutex()));
 
     httpd->register_route("/phy/phy80211/by-key/:key/pcap/handshake", {"GET"}, httpd->RO_ROLE, {"pcap"},
             std::make_shared<kis_net_web_function_endpoint>(
@@ -904,6 +950,7 @@ kis_80211_phy::kis_80211_phy(int in_phyid) :
                     con->clear_timeout();
                     con->set_target_file(fmt::format("kismet-80211-bssid-{}.pcapng", mac));
                     con->set_closure_cb([pcapng]() { pcapng->stop_stream("http connection lost"); });
+                    con->set_streaming();
 
                     auto sid = 
                         streamtracker->register_streamer(pcapng, fmt::format("kismet-80211-bssid{}.pcapng", mac),
@@ -1088,7 +1135,7 @@ int kis_80211_phy::packet_dot11_common_classifier(CHAINCALL_PARMS) {
     std::shared_ptr<dot11_tracked_device> receive_dot11;
     std::shared_ptr<dot11_tracked_device> transmit_dot11;
 
-    kis_unique_lock<kis_mutex> list_locker(d11phy->devicetracker->get_devicelist_mutex(),
+    kis_unique_lock<kis_devicelist_mutex> list_locker(d11phy->devicetracker->get_devicelist_mutex(),
             "phy80211 common_classifier");
 
     if (dot11info->type == packet_management) {
@@ -1152,6 +1199,7 @@ int kis_80211_phy::packet_dot11_common_classifier(CHAINCALL_PARMS) {
         // Do we have a worker we have to call later?  We must defer workers until we release the locks
         // on devices
         bool associate_bssts = false;
+        int64_t bss_epoch = 0;
         bool handle_probed_ssid = false;
         std::function<void ()> handle_probed_ssid_f;
 
@@ -1190,8 +1238,15 @@ int kis_80211_phy::packet_dot11_common_classifier(CHAINCALL_PARMS) {
                 auto bsts = bssid_dot11->get_bss_timestamp();
                 bssid_dot11->set_bss_timestamp(dot11info->timestamp);
 
-                // If we have a new device, look for related devices; use the apview to search other APs
-                if ((bsts == 0 || dot11info->new_device) && d11phy->ap_view != nullptr) {
+                // Keep the BSS timestamp index current, and if we have a new device, look for 
+                // related devices
+                bss_epoch = 
+                    ((int64_t) in_pack->ts.tv_sec * 1'000'000 + in_pack->ts.tv_usec) - 
+                    (int64_t) dot11info->timestamp;
+
+                d11phy->update_bssts_index(bssid_dev->get_key(), bss_epoch);
+
+                if (bsts == 0 || dot11info->new_device) {
                     associate_bssts = true;
                 }
 
@@ -1406,54 +1461,19 @@ int kis_80211_phy::packet_dot11_common_classifier(CHAINCALL_PARMS) {
 
         }
 
-        // BSSTS relationship worker
+        // BSSTS relationship
         if (associate_bssts) {
-            auto bss_worker = 
-                device_tracker_view_function_worker([in_pack, dot11info, d11phy, bssid_dev](std::shared_ptr<kis_tracked_device_base> dev) -> bool {
-                        auto bssid_dot11 =
-                            dev->get_sub_as<dot11_tracked_device>(d11phy->dot11_device_entry_id);
-
-                        if (bssid_dot11 == nullptr)
-                            return false;
-
-                        if (dev->get_key() == bssid_dev->get_key())
-                            return false;
-
-                        auto bsts = bssid_dot11->get_bss_timestamp();
-                        auto last_time = dev->get_last_time();
+            for (const auto& rk : d11phy->find_bssts_similar(bssid_dev->get_key(), bss_epoch)) {
+                auto rdev = d11phy->devicetracker->fetch_device(rk);
 
-                        // Guesstimate the time shift from the last time we saw the AP to now, at
-                        // second precision
-                        if (last_time < in_pack->ts.tv_sec)
-                            bsts += (in_pack->ts.tv_sec - last_time) * 1'000'000;
-                        else
-                            bsts -= (last_time - in_pack->ts.tv_sec) * 1'000'000;
-
-                        uint64_t diff;
-
-                        if (dot11info->timestamp < bsts)
-                            diff = bsts - dot11info->timestamp;
-                        else
-                            diff = dot11info->timestamp - bsts;
-
-                        return diff < d11phy->bss_ts_group_usec;
-                });
-
-            // We have to do write work because we're still holding the device list 
-            // write state 
-            d11phy->ap_view->do_device_work(bss_worker);
+                // The AP has since timed out; otherwise fetching it under the device list
+                // locks it for the rest of our hold
+                if (rdev == nullptr) {
+                    d11phy->remove_bssts_index(rk);
+                    continue;
+                }
 
-            for (const auto& ri : *(bss_worker.getMatchedDevices())) {
-                auto rdev = std::static_pointer_cast<kis_tracked_device_base>(ri);
                 bssid_dev->add_related_device("dot11_bssts_similar", rdev->get_key());
-            }
-
-            // bssid_lk.unlock();
-
-            // Assign the reverse map for each device under individual lock
-            for (const auto& ri : *(bss_worker.getMatchedDevices())) {
-                auto rdev = std::static_pointer_cast<kis_tracked_device_base>(ri);
-
                 rdev->add_related_device("dot11_bssts_similar", bssid_dev->get_key());
             }
         }
@@ -1985,8 +2005,9 @@ int kis_80211_phy::packet_dot11_scan_json_classifier(CHAINCALL_PARMS) {
                      UCD_UPDATE_SEENBY | UCD_UPDATE_ENCRYPTION),
                     "Wi-Fi Device");
 
-        kis_unique_lock<kis_mutex> list_locker(d11phy->devicetracker->get_devicelist_mutex(),
+        kis_unique_lock<kis_devicelist_mutex> list_locker(d11phy->devicetracker->get_devicelist_mutex(),
                 "phy80211 json_classifier");
+        d11phy->devicetracker->pin_device(bssid_dev);
 
         auto bssid_dot11 =
             bssid_dev->get_sub_as<dot11_tracked_device>(d11phy->dot11_device_entry_id);
@@ -2934,6 +2955,238 @@ void kis_80211_phy::handle_ssid(std::shared_ptr<kis_tracked_device_base> basedev
     }
 }
 
+void kis_80211_phy::remove_bssts_bucket_entry(const device_key& in_key, int64_t in_epoch) {
+    auto bi = bssts_index.find(in_epoch / (int64_t) bss_ts_group_usec);
+
+    if (bi == bssts_index.end())
+        return;
+
+    auto& entries = bi->second;
+
+    for (auto i = entries.begin(); i != entries.end(); ++i) {
+        if (i->first == in_key) {
+            entries.erase(i);
+            break;
+        }
+    }
+
+    if (entries.size() == 0)
+        bssts_index.erase(bi);
+}
+
+void kis_80211_phy::update_bssts_index(const device_key& in_key, int64_t in_epoch) {
+    kis_lock_guard<kis_mutex> lk(bssts_index_mutex, "kis_80211_phy update_bssts_index");
+
+    auto window = (int64_t) bss_ts_group_usec;
+
+    if (window <= 0)
+        return;
+
+    auto ei = bssts_index_epoch.find(in_key);
+
+    if (ei != bssts_index_epoch.end()) {
+        // The epoch of an AP only wanders by the jitter in when we timestamp its beacons;
+        // leave it where it is unless it has moved a meaningful fraction of the window, 
+        // usually because the AP rebooted
+        auto drift = in_epoch - ei->second;
+
+        if (drift < 0)
+            drift = -drift;
+
+        if (drift < window / 4)
+            return;
+
+        remove_bssts_bucket_entry(in_key, ei->second);
+        ei->second = in_epoch;
+    } else {
+        bssts_index_epoch[in_key] = in_epoch;
+    }
+
+    bssts_index[in_epoch / window].push_back(std::make_pair(in_key, in_epoch));
+}
+
+void kis_80211_phy::remove_bssts_index(const device_key& in_key) {
+    kis_lock_guard<kis_mutex> lk(bssts_index_mutex, "kis_80211_phy remove_bssts_index");
+
+    auto ei = bssts_index_epoch.find(in_key);
+
+    if (ei == bssts_index_epoch.end() || bss_ts_group_usec == 0)
+        return;
+
+    remove_bssts_bucket_entry(in_key, ei->second);
+    bssts_index_epoch.erase(ei);
+}
+
+std::vector<device_key> kis_80211_phy::find_bssts_similar(const device_key& in_key, int64_t in_epoch) {
+    kis_lock_guard<kis_mutex> lk(bssts_index_mutex, "kis_80211_phy find_bssts_similar");
+
+    auto ret = std::vector<device_key>{};
+    auto window = (int64_t) bss_ts_group_usec;
+
+    if (window <= 0)
+        return ret;
+
+    auto bucket = in_epoch / window;
+
+    // Anything within the window of our epoch is in our bucket or one of its neighbors
+    for (auto b = bucket - 1; b <= bucket + 1; b++) {
+        auto bi = bssts_index.find(b);
+
+        if (bi == bssts_index.end())
+            continue;
+
+        for (const auto& e : bi->second) {
+            if (e.first == in_key)
+                continue;
+
+            auto diff = e.second - in_epoch;
+
+            if (diff < 0)
+                diff = -diff;
+
+            if (diff < window)
+                ret.push_back(e.first);
+        }
+    }
+
+    return ret;
+}
+
+std::vector<device_key> kis_80211_phy::update_wps_uuid_index(const device_key& in_key, 
+        const std::string& in_uuid) {
+    kis_lock_guard<kis_mutex> lk(probe_index_mutex, "kis_80211_phy update_wps_uuid_index");
+
+    auto ret = std::vector<device_key>{};
+    auto& keys = wps_uuid_index[in_uuid];
+
+    for (const auto& k : keys) {
+        if (k == in_key)
+            continue;
+
+        ret.push_back(k);
+    }
+
+    keys.insert(in_key);
+    wps_uuid_current[in_key].insert(in_uuid);
+
+    return ret;
+}
+
+void kis_80211_phy::remove_wps_uuid_index(const device_key& in_key, const std::string& in_uuid) {
+    kis_lock_guard<kis_mutex> lk(probe_index_mutex, "kis_80211_phy remove_wps_uuid_index");
+
+    auto ci = wps_uuid_current.find(in_key);
+
+    if (ci != wps_uuid_current.end()) {
+        ci->second.erase(in_uuid);
+
+        if (ci->second.size() == 0)
+            wps_uuid_current.erase(ci);
+    }
+
+    auto ui = wps_uuid_index.find(in_uuid);
+
+    if (ui == wps_uuid_index.end())
+        return;
+
+    ui->second.erase(in_key);
+
+    if (ui->second.size() == 0)
+        wps_uuid_index.erase(ui);
+}
+
+void kis_80211_phy::remove_wps_uuid_index(const device_key& in_key) {
+    kis_lock_guard<kis_mutex> lk(probe_index_mutex, "kis_80211_phy remove_wps_uuid_index key");
+
+    auto ci = wps_uuid_current.find(in_key);
+
+    if (ci == wps_uuid_current.end())
+        return;
+
+    for (const auto& uuid : ci->second) {
+        auto ui = wps_uuid_index.find(uuid);
+
+        if (ui == wps_uuid_index.end())
+            continue;
+
+        ui->second.erase(in_key);
+
+        if (ui->second.size() == 0)
+            wps_uuid_index.erase(ui);
+    }
+
+    wps_uuid_current.erase(ci);
+}
+
+std::vector<device_key> kis_80211_phy::find_wps_uuid(const std::string& in_uuid) {
+    kis_lock_guard<kis_mutex> lk(probe_index_mutex, "kis_80211_phy find_wps_uuid");
+
+    auto ui = wps_uuid_index.find(in_uuid);
+
+    if (ui == wps_uuid_index.end())
+        return std::vector<device_key>{};
+
+    return std::vector<device_key>(ui->second.begin(), ui->second.end());
+}
+
+void kis_80211_phy::update_probe_fingerprint_index(const device_key& in_key, uint32_t in_fingerprint) {
+    kis_lock_guard<kis_mutex> lk(probe_index_mutex, "kis_80211_phy update_probe_fingerprint_index");
+
+    auto ci = probe_fingerprint_current.find(in_key);
+
+    if (ci != probe_fingerprint_current.end()) {
+        if (ci->second == in_fingerprint)
+            return;
+
+        // A device is only listed under the fingerprint of its most recent probe
+        auto fi = probe_fingerprint_index.find(ci->second);
+
+        if (fi != probe_fingerprint_index.end()) {
+            fi->second.erase(in_key);
+
+            if (fi->second.size() == 0)
+                probe_fingerprint_index.erase(fi);
+        }
+
+        ci->second = in_fingerprint;
+    } else {
+        probe_fingerprint_current[in_key] = in_fingerprint;
+    }
+
+    probe_fingerprint_index[in_fingerprint].insert(in_key);
+}
+
+void kis_80211_phy::remove_probe_fingerprint_index(const device_key& in_key) {
+    kis_lock_guard<kis_mutex> lk(probe_index_mutex, "kis_80211_phy remove_probe_fingerprint_index");
+
+    auto ci = probe_fingerprint_current.find(in_key);
+
+    if (ci == probe_fingerprint_current.end())
+        return;
+
+    auto fi = probe_fingerprint_index.find(ci->second);
+
+    if (fi != probe_fingerprint_index.end()) {
+        fi->second.erase(in_key);
+
+        if (fi->second.size() == 0)
+            probe_fingerprint_index.erase(fi);
+    }
+
+    probe_fingerprint_current.erase(ci);
+}
+
+std::vector<device_key> kis_80211_phy::find_probe_fingerprint(uint32_t in_fingerprint) {
+    kis_lock_guard<kis_mutex> lk(probe_index_mutex, "kis_80211_phy find_probe_fingerprint");
+
+    auto fi = probe_fingerprint_index.find(in_fingerprint);
+
+    if (fi == probe_fingerprint_index.end())
+        return std::vector<device_key>{};
+
+    return std::vector<device_key>(fi->second.begin(), fi->second.end());
+}
+
 void kis_80211_phy::handle_probed_ssid(std::shared_ptr<kis_tracked_device_base> basedev,
         std::shared_ptr<dot11_tracked_device> dot11dev,
         kis_packet *in_pack,
@@ -2962,8 +3215,9 @@ void kis_80211_phy::handle_probed_ssid(std::shared_ptr<kis_tracked_device_base>
             dot11info->subtype == packet_sub_association_req ||
             dot11info->subtype == packet_sub_reassociation_req) {
 
-        kis_unique_lock<kis_mutex> list_locker(devicetracker->get_devicelist_mutex(),
+        kis_unique_lock<kis_devicelist_mutex> list_locker(devicetracker->get_devicelist_mutex(),
                 "phy80211 handle_probed_ssid");
+        devicetracker->pin_device(basedev);
 
         auto probemap(dot11dev->get_probed_ssid_map());
 
@@ -3058,47 +3312,26 @@ void kis_80211_phy::handle_probed_ssid(std::shared_ptr<kis_tracked_device_base>
         }
 
         // XXHash32 says the canonical representation of the hash is little-endian
-        dot11dev->set_probe_fingerprint(htole32(tag_hash.hash()));
+        auto probe_fingerprint = htole32(tag_hash.hash());
+        dot11dev->set_probe_fingerprint(probe_fingerprint);
+        update_probe_fingerprint_index(basedev->get_key(), probe_fingerprint);
 
         if (dot11info->wps_uuid_e != "") {
             if (probessid->get_wps_uuid_e() != dot11info->wps_uuid_e) {
-                // lk.unlock();
-
-                device_tracker_view_function_worker dev_worker(
-                        [this, dot11info, basedev, dot11dev](std::shared_ptr<kis_tracked_device_base> dev) -> bool {
-                            auto bssid_dot11 =
-                                dev->get_sub_as<dot11_tracked_device>(dot11_device_entry_id);
-
-                            if (bssid_dot11 == nullptr) {
-                                return false;
-                            }
-
-                            if (bssid_dot11->has_probed_ssid_map()) {
-                                for (const auto& pi : *bssid_dot11->probed_ssid_map) {
-                                    auto ps = std::static_pointer_cast<dot11_probed_ssid>(pi.second);
-
-                                    if (ps->get_wps_uuid_e() == dot11info->wps_uuid_e)
-                                        return true;
-                                }
-                            }
+                probessid->set_wps_uuid_e(dot11info->wps_uuid_e);
 
-                        return false;
-                        });
-                devicetracker->do_device_work(dev_worker);
+                // Set a bidirectional relationship with every other device using this UUID-E
+                for (const auto& rk : update_wps_uuid_index(basedev->get_key(), dot11info->wps_uuid_e)) {
+                    auto rdev = devicetracker->fetch_device(rk);
 
-                // Update main device under lock
-                // lk.lock();
-                probessid->set_wps_uuid_e(dot11info->wps_uuid_e);
-                // Set a bidirectional relationship
-                for (const auto& ri : *(dev_worker.getMatchedDevices())) {
-                    auto rdev = std::static_pointer_cast<kis_tracked_device_base>(ri);
-                    basedev->add_related_device("dot11_uuid_e", rdev->get_key());
-                }
-                // lk.unlock();
+                    // The device has since timed out; otherwise fetching it under the device 
+                    // list locks it for the rest of our hold
+                    if (rdev == nullptr) {
+                        remove_wps_uuid_index(rk, dot11info->wps_uuid_e);
+                        continue;
+                    }
 
-                // Update associated devices under single device lock
-                for (const auto& ri : *(dev_worker.getMatchedDevices())) {
-                    auto rdev = std::static_pointer_cast<kis_tracked_device_base>(ri);
+                    basedev->add_related_device("dot11_uuid_e", rk);
                     rdev->add_related_device("dot11_uuid_e", basedev->get_key());
                 }
             }
@@ -3702,7 +3935,7 @@ void kis_80211_phy::generate_handshake_pcap(std::shared_ptr<kis_net_beast_httpd_
 
     stream.write((const char *) &hdr, sizeof(hdr));
 
-    kis_unique_lock<kis_mutex> list_locker(devicetracker->get_devicelist_mutex(),
+    kis_unique_lock<kis_devicelist_mutex> list_locker(devicetracker->get_devicelist_mutex(),
             "phy80211 generate_handshake_pcap");
 
 
@@ -3886,6 +4119,12 @@ int kis_80211_phy::timetracker_event(int eventid) {
     return 1;
 }
 
+void kis_80211_phy::device_removed(std::shared_ptr<kis_tracked_device_base> in_device) {
+    remove_wps_uuid_index(in_device->get_key());
+    remove_probe_fingerprint_index(in_device->get_key());
+    remove_bssts_index(in_device->get_key());
+}
+
 void kis_80211_phy::load_phy_storage(shared_tracker_element in_storage, shared_tracker_element in_device) {
     if (in_storage == NULL || in_device == NULL)
         return;
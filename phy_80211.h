@@ -27,6 +27,8 @@
 #include <time.h>
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <algorithm>
 #include <string>
@@ -380,6 +382,9 @@ public:
     virtual void load_phy_storage(shared_tracker_element in_storage,
             shared_tracker_element in_device) override;
 
+    // Forget a removed device from the probe and BSS timestamp indices
+    virtual void device_removed(std::shared_ptr<kis_tracked_device_base> in_device) override;
+
     // Convert a frequency in KHz to an IEEE 80211 channel name; MAY THROW AN EXCEPTION
     // if this cannot be converted or is an invalid frequency
     static const std::string khz_to_channel(const double in_khz);
@@ -537,6 +542,39 @@ protected:
     // bssts time for grouping, in usec
     uint64_t bss_ts_group_usec;
 
+    // BSS timestamp index.  Each AP is filed under its BSS epoch, the wall clock time its 
+    // BSS timestamp would have read zero; APs running on the same radio share a BSS 
+    // timestamp and so share an epoch.  Epochs are bucketed by the grouping window, so
+    // similar APs are found by looking in the neighboring buckets instead of comparing
+    // every AP.  APs are removed when the device tracker removes them, and empty buckets
+    // are dropped.
+    kis_mutex bssts_index_mutex;
+    std::unordered_map<int64_t, std::vector<std::pair<device_key, int64_t>>> bssts_index;
+    std::unordered_map<device_key, int64_t> bssts_index_epoch;
+
+    void update_bssts_index(const device_key& in_key, int64_t in_epoch);
+    void remove_bssts_index(const device_key& in_key);
+    void remove_bssts_bucket_entry(const device_key& in_key, int64_t in_epoch);
+    std::vector<device_key> find_bssts_similar(const device_key& in_key, int64_t in_epoch);
+
+    // Reverse indices from the WPS UUID-E and the probe fingerprint to the devices which
+    // have sent them, maintained as probes are processed.  Devices are removed from the
+    // indices when the device tracker removes them.
+    kis_mutex probe_index_mutex;
+    std::unordered_map<std::string, std::unordered_set<device_key>> wps_uuid_index;
+    std::unordered_map<device_key, std::unordered_set<std::string>> wps_uuid_current;
+    std::unordered_map<uint32_t, std::unordered_set<device_key>> probe_fingerprint_index;
+    std::unordered_map<device_key, uint32_t> probe_fingerprint_current;
+
+    // Index a device under a UUID-E, returning the other devices known to use it
+    std::vector<device_key> update_wps_uuid_index(const device_key& in_key, const std::string& in_uuid);
+    void update_probe_fingerprint_index(const device_key& in_key, uint32_t in_fingerprint);
+    void remove_wps_uuid_index(const device_key& in_key, const std::string& in_uuid);
+    void remove_wps_uuid_index(const device_key& in_key);
+    void remove_probe_fingerprint_index(const device_key& in_key);
+    std::vector<device_key> find_wps_uuid(const std::string& in_uuid);
+    std::vector<device_key> find_probe_fingerprint(uint32_t in_fingerprint);
+
     // Do we store the last beaconed tags in the ssid record?
     bool keep_ie_tags_per_bssid;
 
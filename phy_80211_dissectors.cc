@@ -335,7 +335,7 @@ int kis_80211_phy::packet_dot11_dissector(kis_packet *in_pack) {
         (kis_common_info *) in_pack->fetch(pack_comp_common);
 
     if (common == NULL) {
-        common = new kis_common_info;
+        common = in_pack->new_component<kis_common_info>();
         in_pack->insert(pack_comp_common, common);
     }
 
@@ -344,7 +344,7 @@ int kis_80211_phy::packet_dot11_dissector(kis_packet *in_pack) {
     if (pack_l1info != NULL)
         common->freq_khz = pack_l1info->freq_khz;
 
-    packinfo = new dot11_packinfo;
+    packinfo = in_pack->new_component<dot11_packinfo>();
 
     frame_control *fc = (frame_control *) chunk->data;
 
@@ -1029,7 +1029,7 @@ int kis_80211_phy::packet_dot11_dissector(kis_packet *in_pack) {
             if (datachunk == NULL) {
                 // Don't set a DLT on the data payload, since we don't know what it is
                 // but it's not 802.11.
-                datachunk = new kis_datachunk;
+                datachunk = in_pack->new_component<kis_datachunk>();
                 datachunk->set_data(chunk->data + packinfo->header_offset,
                                     chunk->length - packinfo->header_offset, false);
                 in_pack->insert(pack_comp_datapayload, datachunk);
@@ -2481,16 +2481,12 @@ int kis_80211_phy::packet_wep_decryptor(kis_packet *in_pack) {
 
     in_pack->insert(pack_comp_mangleframe, manglechunk);
 
-    kis_datachunk *datachunk = 
-        (kis_datachunk *) in_pack->fetch(pack_comp_datapayload);
+    kis_datachunk *datachunk = nullptr;
 
-    in_pack->insert(pack_comp_datapayload, NULL);
-
-    if (datachunk != NULL)
-        delete datachunk;
+    in_pack->erase(pack_comp_datapayload);
 
     if (manglechunk->length > packinfo->header_offset) {
-        datachunk = new kis_datachunk;
+        datachunk = in_pack->new_component<kis_datachunk>();
 
         datachunk->set_data(manglechunk->data + packinfo->header_offset,
                             manglechunk->length - packinfo->header_offset,
@@ -95,8 +95,10 @@ kis_802154_phy::kis_802154_phy(int in_phyid) :
         Globalreg::fetch_mandatory_global_as<dlt_tracker>("DLTTRACKER");
     dlt = KDLT_IEEE802_15_4_NOFCS;
 
-    packetchain->register_handler(&dissector802154, this, CHAINPOS_LLCDISSECT, -100);
-    packetchain->register_handler(&commonclassifier802154, this, CHAINPOS_CLASSIFIER, -100);
+    packetchain->register_handler(&dissector802154, this, CHAINPOS_LLCDISSECT, -100,
+            "phy_802154 dissector802154");
+    packetchain->register_handler(&commonclassifier802154, this, CHAINPOS_CLASSIFIER, -100,
+            "phy_802154 commonclassifier802154");
 }
 
 kis_802154_phy::~kis_802154_phy() {
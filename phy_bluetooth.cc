@@ -54,9 +54,12 @@ kis_bluetooth_phy::kis_bluetooth_phy(int in_phyid) :
                 tracker_element_factory<bluetooth_tracked_device>(),
                 "Bluetooth device");
 
-    packetchain->register_handler(&common_classifier_bluetooth, this, CHAINPOS_CLASSIFIER, -100);
-    packetchain->register_handler(&packet_tracker_bluetooth, this, CHAINPOS_TRACKER, -100);
-    packetchain->register_handler(&packet_bluetooth_scan_json_classifier, this, CHAINPOS_CLASSIFIER, -99);
+    packetchain->register_handler(&common_classifier_bluetooth, this, CHAINPOS_CLASSIFIER, -100,
+            "phy_bluetooth common_classifier_bluetooth");
+    packetchain->register_handler(&packet_tracker_bluetooth, this, CHAINPOS_TRACKER, -100,
+            "phy_bluetooth packet_tracker_bluetooth");
+    packetchain->register_handler(&packet_bluetooth_scan_json_classifier, this, CHAINPOS_CLASSIFIER, -99,
+            "phy_bluetooth packet_bluetooth_scan_json_classifier");
     
     pack_comp_btdevice = packetchain->register_packet_component("BTDEVICE");
 	pack_comp_common = packetchain->register_packet_component("COMMON");
@@ -150,7 +153,7 @@ int kis_bluetooth_phy::packet_bluetooth_scan_json_classifier(CHAINCALL_PARMS) {
 
         in_pack->insert(btphy->pack_comp_common, commoninfo);
 
-        kis_lock_guard<kis_mutex> lk(btphy->devicetracker->get_devicelist_mutex(), 
+        kis_lock_guard<kis_devicelist_mutex> lk(btphy->devicetracker->get_devicelist_mutex(), 
                 "packet_bluetooth_scan_json_classifier");
 
         auto btdev =
@@ -252,7 +255,7 @@ int kis_bluetooth_phy::packet_tracker_bluetooth(CHAINCALL_PARMS) {
     if (ci == NULL)
         return 0;
 
-    kis_lock_guard<kis_mutex> lk(btphy->devicetracker->get_devicelist_mutex(), 
+    kis_lock_guard<kis_devicelist_mutex> lk(btphy->devicetracker->get_devicelist_mutex(), 
             "packet_tracker_bluetooth");
 
     std::shared_ptr<kis_tracked_device_base> basedev =
@@ -191,8 +191,10 @@ kis_btle_phy::kis_btle_phy(int in_phyid) :
                 "BleedingTooth attacks use over-sized advertisement packets.",
                 phyid);
 
-    packetchain->register_handler(&dissector, this, CHAINPOS_LLCDISSECT, -100);
-    packetchain->register_handler(&common_classifier, this, CHAINPOS_CLASSIFIER, -100);
+    packetchain->register_handler(&dissector, this, CHAINPOS_LLCDISSECT, -100,
+            "phy_btle dissector");
+    packetchain->register_handler(&common_classifier, this, CHAINPOS_CLASSIFIER, -100,
+            "phy_btle common_classifier");
 
     btle_device_id = 
         entrytracker->register_field("btle.device",
@@ -323,7 +325,8 @@ int kis_btle_phy::common_classifier(CHAINCALL_PARMS) {
                  UCD_UPDATE_SEENBY | UCD_UPDATE_ENCRYPTION),
                 "BTLE Device");
 
-    kis_lock_guard<kis_mutex> lk(mphy->devicetracker->get_devicelist_mutex(), "btle_common_classifier");
+    kis_lock_guard<kis_devicelist_mutex> lk(mphy->devicetracker->get_devicelist_mutex(), "btle_common_classifier");
+    mphy->devicetracker->pin_device(device);
 
     auto new_dev = false;
 
@@ -73,8 +73,10 @@ Kis_Mousejack_Phy::Kis_Mousejack_Phy(int in_phyid) :
     mj_manuf_microsoft = Globalreg::globalreg->manufdb->make_manuf("Microsoft");
     mj_manuf_nrf = Globalreg::globalreg->manufdb->make_manuf("nRF/Mousejack HID");
 
-    packetchain->register_handler(&DissectorMousejack, this, CHAINPOS_LLCDISSECT, -100);
-    packetchain->register_handler(&CommonClassifierMousejack, this, CHAINPOS_CLASSIFIER, -100);
+    packetchain->register_handler(&DissectorMousejack, this, CHAINPOS_LLCDISSECT, -100,
+            "phy_nrf_mousejack DissectorMousejack");
+    packetchain->register_handler(&CommonClassifierMousejack, this, CHAINPOS_CLASSIFIER, -100,
+            "phy_nrf_mousejack CommonClassifierMousejack");
 }
 
 Kis_Mousejack_Phy::~Kis_Mousejack_Phy() {
@@ -143,7 +145,8 @@ int Kis_Mousejack_Phy::CommonClassifierMousejack(CHAINCALL_PARMS) {
                  UCD_UPDATE_SEENBY | UCD_UPDATE_ENCRYPTION),
                 "KB/Mouse");
 
-    kis_lock_guard<kis_mutex> lk(mphy->devicetracker->get_devicelist_mutex(), "common_classifier_mousejack");
+    kis_lock_guard<kis_devicelist_mutex> lk(mphy->devicetracker->get_devicelist_mutex(), "common_classifier_mousejack");
+    mphy->devicetracker->pin_device(device);
 
     // Figure out what we think it could be; this isn't very precise.  Fingerprinting
     // based on methods in mousejack python.
@@ -40,7 +40,8 @@ kis_radiation_phy::kis_radiation_phy(int in_phyid) :
     pack_comp_meta =
         packetchain->register_packet_component("METABLOB");
 
-	packetchain->register_handler(&packet_handler, this, CHAINPOS_CLASSIFIER, -100);
+	packetchain->register_handler(&packet_handler, this, CHAINPOS_CLASSIFIER, -100,
+	        "phy_radiation packet_handler");
 }
 
 kis_radiation_phy::~kis_radiation_phy() {
@@ -89,7 +89,8 @@ Kis_RTL433_Phy::Kis_RTL433_Phy(int in_phyid) :
         Globalreg::fetch_mandatory_global_as<kis_httpd_registry>();
     httpregistry->register_js_module("kismet_ui_rtl433", "js/kismet.ui.rtl433.js");
 
-	packetchain->register_handler(&PacketHandler, this, CHAINPOS_CLASSIFIER, -100);
+	packetchain->register_handler(&PacketHandler, this, CHAINPOS_CLASSIFIER, -100,
+	        "phy_rtl433 PacketHandler");
 }
 
 Kis_RTL433_Phy::~Kis_RTL433_Phy() {
@@ -194,7 +195,8 @@ bool Kis_RTL433_Phy::json_to_rtl(Json::Value json, kis_packet *packet) {
                 (UCD_UPDATE_FREQUENCIES | UCD_UPDATE_PACKETS | UCD_UPDATE_LOCATION |
                  UCD_UPDATE_SEENBY), "RTL433 Sensor");
 
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), "rtl433_json_to_rtl");
+    kis_lock_guard<kis_devicelist_mutex> lk(devicetracker->get_devicelist_mutex(), "rtl433_json_to_rtl");
+    devicetracker->pin_device(basedev);
 
     std::string dn = "Sensor";
 
@@ -89,7 +89,8 @@ kis_rtladsb_phy::kis_rtladsb_phy(int in_phyid) :
         Globalreg::fetch_mandatory_global_as<kis_httpd_registry>();
     httpregistry->register_js_module("kismet_ui_rtladsb", "js/kismet.ui.rtladsb.js");
 
-	packetchain->register_handler(&packet_handler, this, CHAINPOS_CLASSIFIER, -100);
+	packetchain->register_handler(&packet_handler, this, CHAINPOS_CLASSIFIER, -100,
+	        "phy_rtladsb packet_handler");
 
     icaodb = std::make_shared<kis_adsb_icao>();
 
@@ -199,7 +200,7 @@ kis_rtladsb_phy::kis_rtladsb_phy(int in_phyid) :
             std::make_shared<kis_net_web_tracked_endpoint>(
                 [this](std::shared_ptr<kis_net_beast_httpd_connection> con) {
                     return adsb_map_endp_handler(con);
-                }, devicetracker->get_devicelist_mutex()));
+                }, devicetracker->get_devicelist_mutex().reader_mutex()));
 
     httpd->register_websocket_route("/phy/RTLADSB/beast", {httpd->RO_ROLE, "ADSB"}, {"ws"},
             std::make_shared<kis_net_web_function_endpoint>(
@@ -273,7 +274,7 @@ kis_rtladsb_phy::kis_rtladsb_phy(int in_phyid) :
 
 
                             return 1;
-                    }, CHAINPOS_LOGGING, 1000);
+                    }, CHAINPOS_LOGGING, 1000, "phy_rtladsb beast_stream");
 
                 try {
                     ws->handle_request(con);
@@ -326,7 +327,7 @@ kis_rtladsb_phy::kis_rtladsb_phy(int in_phyid) :
 
 
                             return 1;
-                    }, CHAINPOS_LOGGING, 1000);
+                    }, CHAINPOS_LOGGING, 1000, "phy_rtladsb raw_stream");
 
                 try {
                     ws->handle_request(con);
@@ -393,7 +394,7 @@ kis_rtladsb_phy::kis_rtladsb_phy(int in_phyid) :
 
 
                             return 1;
-                    }, CHAINPOS_LOGGING, 1000);
+                    }, CHAINPOS_LOGGING, 1000, "phy_rtladsb raw_stream_source");
 
                 try {
                     ws->handle_request(con);
@@ -509,7 +510,8 @@ bool kis_rtladsb_phy::json_to_rtl(Json::Value json, kis_packet *packet) {
                 (UCD_UPDATE_FREQUENCIES | UCD_UPDATE_PACKETS |
                  UCD_UPDATE_SEENBY), "ADSB");
 
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), "rtladsb_json_to_rtl");
+    kis_lock_guard<kis_devicelist_mutex> lk(devicetracker->get_devicelist_mutex(), "rtladsb_json_to_rtl");
+    devicetracker->pin_device(basedev);
 
     std::string dn = "Airplane";
 
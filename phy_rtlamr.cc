@@ -58,7 +58,8 @@ kis_rtlamr_phy::kis_rtlamr_phy(int in_phyid) :
     auto httpregistry = Globalreg::fetch_mandatory_global_as<kis_httpd_registry>();
     httpregistry->register_js_module("kismet_ui_rtlamr", "js/kismet.ui.rtlamr.js");
 
-	packetchain->register_handler(&PacketHandler, this, CHAINPOS_CLASSIFIER, -100);
+	packetchain->register_handler(&PacketHandler, this, CHAINPOS_CLASSIFIER, -100,
+	        "phy_rtlamr PacketHandler");
 }
 
 kis_rtlamr_phy::~kis_rtlamr_phy() {
@@ -145,7 +146,8 @@ bool kis_rtlamr_phy::json_to_rtl(Json::Value json, kis_packet *packet) {
                 (UCD_UPDATE_FREQUENCIES | UCD_UPDATE_PACKETS | UCD_UPDATE_LOCATION |
                  UCD_UPDATE_SEENBY), "AMR Meter");
 
-    kis_lock_guard<kis_mutex> lk(devicetracker->get_devicelist_mutex(), "rtlamr_json_to_rtl");
+    kis_lock_guard<kis_devicelist_mutex> lk(devicetracker->get_devicelist_mutex(), "rtlamr_json_to_rtl");
+    devicetracker->pin_device(basedev);
 
     auto meterdev = 
         basedev->get_sub_as<rtlamr_tracked_meter>(rtlamr_meter_id);
@@ -105,7 +105,8 @@ Kis_UAV_Phy::Kis_UAV_Phy(int in_phyid) :
 
     // Tag into the packet chain at the very end so we've gotten all the other tracker
     // elements already
-    packetchain->register_handler(Kis_UAV_Phy::CommonClassifier, this, CHAINPOS_TRACKER, 65535);
+    packetchain->register_handler(Kis_UAV_Phy::CommonClassifier, this, CHAINPOS_TRACKER, 65535,
+            "phy_uav_drone CommonClassifier");
 
     // Register js module for UI
     auto httpregistry = 
@@ -167,7 +168,7 @@ int Kis_UAV_Phy::CommonClassifier(CHAINCALL_PARMS) {
     if (commoninfo == NULL || dot11info == NULL)
         return 1;
 
-    kis_lock_guard<kis_mutex> lk(uavphy->devicetracker->get_devicelist_mutex(), "uav_phy common_classifier");
+    kis_lock_guard<kis_devicelist_mutex> lk(uavphy->devicetracker->get_devicelist_mutex(), "uav_phy common_classifier");
 
     for (auto di : devinfo->devrefs) {
         auto basedev = di.second;
@@ -175,6 +176,8 @@ int Kis_UAV_Phy::CommonClassifier(CHAINCALL_PARMS) {
         if (basedev == NULL)
             return 1;
 
+        uavphy->devicetracker->pin_device(basedev);
+
         // Only compare to the AP device for droneid and SSID matching
         if (basedev->get_macaddr() != dot11info->bssid_mac)
             continue;
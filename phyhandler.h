@@ -57,6 +57,10 @@ public:
     virtual void load_phy_storage(shared_tracker_element in_storage __attribute__((unused)), 
             shared_tracker_element in_device __attribute__((unused))) { }
 
+    // Called for the phy of a device when the device tracker removes it, such as when it
+    // times out; phys must forget any index or reference they hold to the device
+    virtual void device_removed(std::shared_ptr<kis_tracked_device_base> in_device __attribute__((unused))) { }
+
 protected:
     void set_phy_name(std::string in_phyname) {
         phyname = in_phyname;
@@ -83,7 +83,7 @@ int alertsyslog_openlog(global_registry *in_globalreg) {
     openlog(in_globalreg->servername.c_str(), LOG_NDELAY, LOG_USER);
 
     packetchain->register_handler(&alertsyslog_chain_hook, NULL,
-            CHAINPOS_LOGGING, -100);
+            CHAINPOS_LOGGING, -100, "alertsyslog alertsyslog_chain_hook");
 
     return 1;
 }
@@ -0,0 +1,9179 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: datasource.proto
+
+#include "datasource.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace KismetDatasource {
+PROTOBUF_CONSTEXPR SubChannels::SubChannels(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.channels_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SubChannelsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubChannelsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubChannelsDefaultTypeInternal() {}
+  union {
+    SubChannels _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubChannelsDefaultTypeInternal _SubChannels_default_instance_;
+PROTOBUF_CONSTEXPR SubChanset::SubChanset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct SubChansetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubChansetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubChansetDefaultTypeInternal() {}
+  union {
+    SubChanset _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubChansetDefaultTypeInternal _SubChanset_default_instance_;
+PROTOBUF_CONSTEXPR SubChanhop::SubChanhop(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channels_)*/{}
+  , /*decltype(_impl_.rate_)*/0
+  , /*decltype(_impl_.shuffle_)*/false
+  , /*decltype(_impl_.shuffle_skip_)*/0u
+  , /*decltype(_impl_.offset_)*/0u} {}
+struct SubChanhopDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubChanhopDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubChanhopDefaultTypeInternal() {}
+  union {
+    SubChanhop _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubChanhopDefaultTypeInternal _SubChanhop_default_instance_;
+PROTOBUF_CONSTEXPR SubGps::SubGps(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.lat_)*/0
+  , /*decltype(_impl_.lon_)*/0
+  , /*decltype(_impl_.alt_)*/0
+  , /*decltype(_impl_.speed_)*/0
+  , /*decltype(_impl_.heading_)*/0
+  , /*decltype(_impl_.precision_)*/0
+  , /*decltype(_impl_.time_sec_)*/uint64_t{0u}
+  , /*decltype(_impl_.time_usec_)*/uint64_t{0u}
+  , /*decltype(_impl_.high_prec_time_)*/0
+  , /*decltype(_impl_.fix_)*/0u} {}
+struct SubGpsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubGpsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubGpsDefaultTypeInternal() {}
+  union {
+    SubGps _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubGpsDefaultTypeInternal _SubGps_default_instance_;
+PROTOBUF_CONSTEXPR SubInterface::SubInterface(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.interface_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.flags_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hardware_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.capinterface_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct SubInterfaceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubInterfaceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubInterfaceDefaultTypeInternal() {}
+  union {
+    SubInterface _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubInterfaceDefaultTypeInternal _SubInterface_default_instance_;
+PROTOBUF_CONSTEXPR SubPacket::SubPacket(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_sec_)*/uint64_t{0u}
+  , /*decltype(_impl_.time_usec_)*/uint64_t{0u}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.dlt_)*/0u} {}
+struct SubPacketDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubPacketDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubPacketDefaultTypeInternal() {}
+  union {
+    SubPacket _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubPacketDefaultTypeInternal _SubPacket_default_instance_;
+PROTOBUF_CONSTEXPR SubJson::SubJson(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.json_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_sec_)*/uint64_t{0u}
+  , /*decltype(_impl_.time_usec_)*/uint64_t{0u}} {}
+struct SubJsonDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubJsonDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubJsonDefaultTypeInternal() {}
+  union {
+    SubJson _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubJsonDefaultTypeInternal _SubJson_default_instance_;
+PROTOBUF_CONSTEXPR SubBuffer::SubBuffer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.buffer_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_sec_)*/uint64_t{0u}
+  , /*decltype(_impl_.time_usec_)*/uint64_t{0u}} {}
+struct SubBufferDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubBufferDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubBufferDefaultTypeInternal() {}
+  union {
+    SubBuffer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubBufferDefaultTypeInternal _SubBuffer_default_instance_;
+PROTOBUF_CONSTEXPR SubSignal::SubSignal(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channel_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.signal_dbm_)*/0
+  , /*decltype(_impl_.noise_dbm_)*/0
+  , /*decltype(_impl_.signal_rssi_)*/0
+  , /*decltype(_impl_.noise_rssi_)*/0
+  , /*decltype(_impl_.freq_khz_)*/0
+  , /*decltype(_impl_.datarate_)*/0} {}
+struct SubSignalDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubSignalDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubSignalDefaultTypeInternal() {}
+  union {
+    SubSignal _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubSignalDefaultTypeInternal _SubSignal_default_instance_;
+PROTOBUF_CONSTEXPR SubSpecset::SubSpecset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.start_mhz_)*/0
+  , /*decltype(_impl_.end_mhz_)*/0
+  , /*decltype(_impl_.samples_per_bucket_)*/0
+  , /*decltype(_impl_.bucket_width_hz_)*/0
+  , /*decltype(_impl_.if_amp_)*/uint64_t{0u}
+  , /*decltype(_impl_.baseband_amp_)*/uint64_t{0u}
+  , /*decltype(_impl_.enable_amp_)*/false} {}
+struct SubSpecsetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubSpecsetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubSpecsetDefaultTypeInternal() {}
+  union {
+    SubSpecset _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubSpecsetDefaultTypeInternal _SubSpecset_default_instance_;
+PROTOBUF_CONSTEXPR SubSpectrum::SubSpectrum(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.data_)*/{}
+  , /*decltype(_impl_.time_sec_)*/uint64_t{0u}
+  , /*decltype(_impl_.time_usec_)*/uint64_t{0u}
+  , /*decltype(_impl_.start_mhz_)*/0
+  , /*decltype(_impl_.end_mhz_)*/0
+  , /*decltype(_impl_.bucket_width_hz_)*/0} {}
+struct SubSpectrumDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubSpectrumDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubSpectrumDefaultTypeInternal() {}
+  union {
+    SubSpectrum _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubSpectrumDefaultTypeInternal _SubSpectrum_default_instance_;
+PROTOBUF_CONSTEXPR SubSuccess::SubSuccess(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.success_)*/false
+  , /*decltype(_impl_.seqno_)*/0u} {}
+struct SubSuccessDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubSuccessDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubSuccessDefaultTypeInternal() {}
+  union {
+    SubSuccess _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubSuccessDefaultTypeInternal _SubSuccess_default_instance_;
+PROTOBUF_CONSTEXPR CloseDatasource::CloseDatasource(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._cached_size_)*/{}} {}
+struct CloseDatasourceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CloseDatasourceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CloseDatasourceDefaultTypeInternal() {}
+  union {
+    CloseDatasource _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CloseDatasourceDefaultTypeInternal _CloseDatasource_default_instance_;
+PROTOBUF_CONSTEXPR Configure::Configure(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.channel_)*/nullptr
+  , /*decltype(_impl_.hopping_)*/nullptr
+  , /*decltype(_impl_.spectrum_)*/nullptr} {}
+struct ConfigureDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigureDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigureDefaultTypeInternal() {}
+  union {
+    Configure _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigureDefaultTypeInternal _Configure_default_instance_;
+PROTOBUF_CONSTEXPR ConfigureReport::ConfigureReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.warning_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/nullptr
+  , /*decltype(_impl_.channel_)*/nullptr
+  , /*decltype(_impl_.hopping_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr} {}
+struct ConfigureReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ConfigureReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ConfigureReportDefaultTypeInternal() {}
+  union {
+    ConfigureReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ConfigureReportDefaultTypeInternal _ConfigureReport_default_instance_;
+PROTOBUF_CONSTEXPR DataReport::DataReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.warning_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gps_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.packet_)*/nullptr
+  , /*decltype(_impl_.signal_)*/nullptr
+  , /*decltype(_impl_.spectrum_)*/nullptr
+  , /*decltype(_impl_.json_)*/nullptr
+  , /*decltype(_impl_.buffer_)*/nullptr
+  , /*decltype(_impl_.high_prec_time_)*/0} {}
+struct DataReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DataReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DataReportDefaultTypeInternal() {}
+  union {
+    DataReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DataReportDefaultTypeInternal _DataReport_default_instance_;
+PROTOBUF_CONSTEXPR ErrorReport::ErrorReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.success_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr} {}
+struct ErrorReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ErrorReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ErrorReportDefaultTypeInternal() {}
+  union {
+    ErrorReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ErrorReportDefaultTypeInternal _ErrorReport_default_instance_;
+PROTOBUF_CONSTEXPR ListInterfaces::ListInterfaces(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._cached_size_)*/{}} {}
+struct ListInterfacesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ListInterfacesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ListInterfacesDefaultTypeInternal() {}
+  union {
+    ListInterfaces _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ListInterfacesDefaultTypeInternal _ListInterfaces_default_instance_;
+PROTOBUF_CONSTEXPR InterfacesReport::InterfacesReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.interfaces_)*/{}
+  , /*decltype(_impl_.success_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr} {}
+struct InterfacesReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InterfacesReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InterfacesReportDefaultTypeInternal() {}
+  union {
+    InterfacesReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InterfacesReportDefaultTypeInternal _InterfacesReport_default_instance_;
+PROTOBUF_CONSTEXPR NewSource::NewSource(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.definition_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sourcetype_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct NewSourceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NewSourceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NewSourceDefaultTypeInternal() {}
+  union {
+    NewSource _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NewSourceDefaultTypeInternal _NewSource_default_instance_;
+PROTOBUF_CONSTEXPR OpenSource::OpenSource(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.definition_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct OpenSourceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OpenSourceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OpenSourceDefaultTypeInternal() {}
+  union {
+    OpenSource _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OpenSourceDefaultTypeInternal _OpenSource_default_instance_;
+PROTOBUF_CONSTEXPR OpenSourceReport::OpenSourceReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.capture_interface_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.hardware_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.uuid_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.warning_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/nullptr
+  , /*decltype(_impl_.channels_)*/nullptr
+  , /*decltype(_impl_.channel_)*/nullptr
+  , /*decltype(_impl_.hop_config_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.spectrum_)*/nullptr
+  , /*decltype(_impl_.dlt_)*/0u} {}
+struct OpenSourceReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OpenSourceReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OpenSourceReportDefaultTypeInternal() {}
+  union {
+    OpenSourceReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OpenSourceReportDefaultTypeInternal _OpenSourceReport_default_instance_;
+PROTOBUF_CONSTEXPR ProbeSource::ProbeSource(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.definition_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct ProbeSourceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProbeSourceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProbeSourceDefaultTypeInternal() {}
+  union {
+    ProbeSource _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProbeSourceDefaultTypeInternal _ProbeSource_default_instance_;
+PROTOBUF_CONSTEXPR ProbeSourceReport::ProbeSourceReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.hardware_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.success_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.channels_)*/nullptr
+  , /*decltype(_impl_.channel_)*/nullptr
+  , /*decltype(_impl_.spectrum_)*/nullptr} {}
+struct ProbeSourceReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ProbeSourceReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ProbeSourceReportDefaultTypeInternal() {}
+  union {
+    ProbeSourceReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ProbeSourceReportDefaultTypeInternal _ProbeSourceReport_default_instance_;
+PROTOBUF_CONSTEXPR WarningReport::WarningReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.warning_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct WarningReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WarningReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WarningReportDefaultTypeInternal() {}
+  union {
+    WarningReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WarningReportDefaultTypeInternal _WarningReport_default_instance_;
+}  // namespace KismetDatasource
+namespace KismetDatasource {
+
+// ===================================================================
+
+class SubChannels::_Internal {
+ public:
+};
+
+SubChannels::SubChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubChannels)
+}
+SubChannels::SubChannels(const SubChannels& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubChannels* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channels_){from._impl_.channels_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubChannels)
+}
+
+inline void SubChannels::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.channels_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SubChannels::~SubChannels() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubChannels)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubChannels::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channels_.~RepeatedPtrField();
+}
+
+void SubChannels::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubChannels::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubChannels)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.channels_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubChannels::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string channels = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_channels();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubChannels::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubChannels)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string channels = 1;
+  for (int i = 0, n = this->_internal_channels_size(); i < n; i++) {
+    const auto& s = this->_internal_channels(i);
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubChannels)
+  return target;
+}
+
+size_t SubChannels::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubChannels)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string channels = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.channels_.size());
+  for (int i = 0, n = _impl_.channels_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.channels_.Get(i));
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubChannels::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubChannels*>(
+      &from));
+}
+
+void SubChannels::MergeFrom(const SubChannels& from) {
+  SubChannels* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubChannels)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.channels_.MergeFrom(from._impl_.channels_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubChannels::CopyFrom(const SubChannels& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubChannels)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubChannels::IsInitialized() const {
+  return true;
+}
+
+void SubChannels::InternalSwap(SubChannels* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.channels_.InternalSwap(&other->_impl_.channels_);
+}
+
+std::string SubChannels::GetTypeName() const {
+  return "KismetDatasource.SubChannels";
+}
+
+
+// ===================================================================
+
+class SubChanset::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubChanset>()._impl_._has_bits_);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+SubChanset::SubChanset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubChanset)
+}
+SubChanset::SubChanset(const SubChanset& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubChanset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubChanset)
+}
+
+inline void SubChanset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+  };
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubChanset::~SubChanset() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubChanset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubChanset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_.Destroy();
+}
+
+void SubChanset::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubChanset::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubChanset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.channel_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubChanset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubChanset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubChanset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string channel = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_channel(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubChanset)
+  return target;
+}
+
+size_t SubChanset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubChanset)
+  size_t total_size = 0;
+
+  // required string channel = 1;
+  if (_internal_has_channel()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_channel());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubChanset::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubChanset*>(
+      &from));
+}
+
+void SubChanset::MergeFrom(const SubChanset& from) {
+  SubChanset* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubChanset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_channel()) {
+    _this->_internal_set_channel(from._internal_channel());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubChanset::CopyFrom(const SubChanset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubChanset)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubChanset::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubChanset::InternalSwap(SubChanset* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+}
+
+std::string SubChanset::GetTypeName() const {
+  return "KismetDatasource.SubChanset";
+}
+
+
+// ===================================================================
+
+class SubChanhop::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubChanhop>()._impl_._has_bits_);
+  static void set_has_rate(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_shuffle(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_shuffle_skip(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+};
+
+SubChanhop::SubChanhop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubChanhop)
+}
+SubChanhop::SubChanhop(const SubChanhop& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubChanhop* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channels_){from._impl_.channels_}
+    , decltype(_impl_.rate_){}
+    , decltype(_impl_.shuffle_){}
+    , decltype(_impl_.shuffle_skip_){}
+    , decltype(_impl_.offset_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.rate_, &from._impl_.rate_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.offset_) -
+    reinterpret_cast<char*>(&_impl_.rate_)) + sizeof(_impl_.offset_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubChanhop)
+}
+
+inline void SubChanhop::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channels_){arena}
+    , decltype(_impl_.rate_){0}
+    , decltype(_impl_.shuffle_){false}
+    , decltype(_impl_.shuffle_skip_){0u}
+    , decltype(_impl_.offset_){0u}
+  };
+}
+
+SubChanhop::~SubChanhop() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubChanhop)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubChanhop::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channels_.~RepeatedPtrField();
+}
+
+void SubChanhop::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubChanhop::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubChanhop)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.channels_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&_impl_.rate_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.offset_) -
+        reinterpret_cast<char*>(&_impl_.rate_)) + sizeof(_impl_.offset_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubChanhop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string channels = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_channels();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double rate = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_rate(&has_bits);
+          _impl_.rate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool shuffle = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_shuffle(&has_bits);
+          _impl_.shuffle_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 shuffle_skip = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_shuffle_skip(&has_bits);
+          _impl_.shuffle_skip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 offset = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_offset(&has_bits);
+          _impl_.offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubChanhop::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubChanhop)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string channels = 1;
+  for (int i = 0, n = this->_internal_channels_size(); i < n; i++) {
+    const auto& s = this->_internal_channels(i);
+    target = stream->WriteString(1, s, target);
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double rate = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_rate(), target);
+  }
+
+  // optional bool shuffle = 3;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_shuffle(), target);
+  }
+
+  // optional uint32 shuffle_skip = 4;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_shuffle_skip(), target);
+  }
+
+  // optional uint32 offset = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_offset(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubChanhop)
+  return target;
+}
+
+size_t SubChanhop::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubChanhop)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string channels = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.channels_.size());
+  for (int i = 0, n = _impl_.channels_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.channels_.Get(i));
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional double rate = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional bool shuffle = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 1;
+    }
+
+    // optional uint32 shuffle_skip = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_shuffle_skip());
+    }
+
+    // optional uint32 offset = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_offset());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubChanhop::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubChanhop*>(
+      &from));
+}
+
+void SubChanhop::MergeFrom(const SubChanhop& from) {
+  SubChanhop* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubChanhop)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.channels_.MergeFrom(from._impl_.channels_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.rate_ = from._impl_.rate_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.shuffle_ = from._impl_.shuffle_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.shuffle_skip_ = from._impl_.shuffle_skip_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.offset_ = from._impl_.offset_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubChanhop::CopyFrom(const SubChanhop& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubChanhop)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubChanhop::IsInitialized() const {
+  return true;
+}
+
+void SubChanhop::InternalSwap(SubChanhop* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.channels_.InternalSwap(&other->_impl_.channels_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubChanhop, _impl_.offset_)
+      + sizeof(SubChanhop::_impl_.offset_)
+      - PROTOBUF_FIELD_OFFSET(SubChanhop, _impl_.rate_)>(
+          reinterpret_cast<char*>(&_impl_.rate_),
+          reinterpret_cast<char*>(&other->_impl_.rate_));
+}
+
+std::string SubChanhop::GetTypeName() const {
+  return "KismetDatasource.SubChanhop";
+}
+
+
+// ===================================================================
+
+class SubGps::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubGps>()._impl_._has_bits_);
+  static void set_has_lat(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_lon(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_alt(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_speed(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_heading(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_precision(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_fix(HasBits* has_bits) {
+    (*has_bits)[0] |= 2048u;
+  }
+  static void set_has_time_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_time_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_high_prec_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000bff) ^ 0x00000bff) != 0;
+  }
+};
+
+SubGps::SubGps(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubGps)
+}
+SubGps::SubGps(const SubGps& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubGps* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.lat_){}
+    , decltype(_impl_.lon_){}
+    , decltype(_impl_.alt_){}
+    , decltype(_impl_.speed_){}
+    , decltype(_impl_.heading_){}
+    , decltype(_impl_.precision_){}
+    , decltype(_impl_.time_sec_){}
+    , decltype(_impl_.time_usec_){}
+    , decltype(_impl_.high_prec_time_){}
+    , decltype(_impl_.fix_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.lat_, &from._impl_.lat_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.fix_) -
+    reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.fix_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubGps)
+}
+
+inline void SubGps::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.lat_){0}
+    , decltype(_impl_.lon_){0}
+    , decltype(_impl_.alt_){0}
+    , decltype(_impl_.speed_){0}
+    , decltype(_impl_.heading_){0}
+    , decltype(_impl_.precision_){0}
+    , decltype(_impl_.time_sec_){uint64_t{0u}}
+    , decltype(_impl_.time_usec_){uint64_t{0u}}
+    , decltype(_impl_.high_prec_time_){0}
+    , decltype(_impl_.fix_){0u}
+  };
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubGps::~SubGps() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubGps)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubGps::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.type_.Destroy();
+  _impl_.name_.Destroy();
+}
+
+void SubGps::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubGps::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubGps)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x000000fcu) {
+    ::memset(&_impl_.lat_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.precision_) -
+        reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.precision_));
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    ::memset(&_impl_.time_sec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.fix_) -
+        reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.fix_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubGps::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required double lat = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_lat(&has_bits);
+          _impl_.lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double lon = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_lon(&has_bits);
+          _impl_.lon_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double alt = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_alt(&has_bits);
+          _impl_.alt_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double speed = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_speed(&has_bits);
+          _impl_.speed_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double heading = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_heading(&has_bits);
+          _impl_.heading_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required double precision = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 49)) {
+          _Internal::set_has_precision(&has_bits);
+          _impl_.precision_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 fix = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_fix(&has_bits);
+          _impl_.fix_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 time_sec = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_time_sec(&has_bits);
+          _impl_.time_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 time_usec = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _Internal::set_has_time_usec(&has_bits);
+          _impl_.time_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string type = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string name = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double high_prec_time = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 97)) {
+          _Internal::set_has_high_prec_time(&has_bits);
+          _impl_.high_prec_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubGps::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubGps)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required double lat = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
+  }
+
+  // required double lon = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lon(), target);
+  }
+
+  // required double alt = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_alt(), target);
+  }
+
+  // required double speed = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_speed(), target);
+  }
+
+  // required double heading = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_heading(), target);
+  }
+
+  // required double precision = 6;
+  if (cached_has_bits & 0x00000080u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(6, this->_internal_precision(), target);
+  }
+
+  // required uint32 fix = 7;
+  if (cached_has_bits & 0x00000800u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(7, this->_internal_fix(), target);
+  }
+
+  // required uint64 time_sec = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_time_sec(), target);
+  }
+
+  // required uint64 time_usec = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_time_usec(), target);
+  }
+
+  // required string type = 10;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_type(), target);
+  }
+
+  // required string name = 11;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_name(), target);
+  }
+
+  // optional double high_prec_time = 12;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(12, this->_internal_high_prec_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubGps)
+  return target;
+}
+
+size_t SubGps::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetDatasource.SubGps)
+  size_t total_size = 0;
+
+  if (_internal_has_type()) {
+    // required string type = 10;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+  }
+
+  if (_internal_has_name()) {
+    // required string name = 11;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (_internal_has_lat()) {
+    // required double lat = 1;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_lon()) {
+    // required double lon = 2;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_alt()) {
+    // required double alt = 3;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_speed()) {
+    // required double speed = 4;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_heading()) {
+    // required double heading = 5;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_precision()) {
+    // required double precision = 6;
+    total_size += 1 + 8;
+  }
+
+  if (_internal_has_time_sec()) {
+    // required uint64 time_sec = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+  }
+
+  if (_internal_has_time_usec()) {
+    // required uint64 time_usec = 9;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+  }
+
+  if (_internal_has_fix()) {
+    // required uint32 fix = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_fix());
+  }
+
+  return total_size;
+}
+size_t SubGps::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubGps)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000bff) ^ 0x00000bff) == 0) {  // All required fields are present.
+    // required string type = 10;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+
+    // required string name = 11;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required double lat = 1;
+    total_size += 1 + 8;
+
+    // required double lon = 2;
+    total_size += 1 + 8;
+
+    // required double alt = 3;
+    total_size += 1 + 8;
+
+    // required double speed = 4;
+    total_size += 1 + 8;
+
+    // required double heading = 5;
+    total_size += 1 + 8;
+
+    // required double precision = 6;
+    total_size += 1 + 8;
+
+    // required uint64 time_sec = 8;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+
+    // required uint64 time_usec = 9;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+
+    // required uint32 fix = 7;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_fix());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional double high_prec_time = 12;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000400u) {
+    total_size += 1 + 8;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubGps::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubGps*>(
+      &from));
+}
+
+void SubGps::MergeFrom(const SubGps& from) {
+  SubGps* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubGps)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.lat_ = from._impl_.lat_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.lon_ = from._impl_.lon_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.alt_ = from._impl_.alt_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.speed_ = from._impl_.speed_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.heading_ = from._impl_.heading_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_impl_.precision_ = from._impl_.precision_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000f00u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_impl_.time_sec_ = from._impl_.time_sec_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_impl_.time_usec_ = from._impl_.time_usec_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.high_prec_time_ = from._impl_.high_prec_time_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      _this->_impl_.fix_ = from._impl_.fix_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubGps::CopyFrom(const SubGps& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubGps)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubGps::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubGps::InternalSwap(SubGps* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubGps, _impl_.fix_)
+      + sizeof(SubGps::_impl_.fix_)
+      - PROTOBUF_FIELD_OFFSET(SubGps, _impl_.lat_)>(
+          reinterpret_cast<char*>(&_impl_.lat_),
+          reinterpret_cast<char*>(&other->_impl_.lat_));
+}
+
+std::string SubGps::GetTypeName() const {
+  return "KismetDatasource.SubGps";
+}
+
+
+// ===================================================================
+
+class SubInterface::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubInterface>()._impl_._has_bits_);
+  static void set_has_interface(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_flags(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_hardware(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_capinterface(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SubInterface::SubInterface(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubInterface)
+}
+SubInterface::SubInterface(const SubInterface& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubInterface* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.interface_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.hardware_){}
+    , decltype(_impl_.capinterface_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.interface_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.interface_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_interface()) {
+    _this->_impl_.interface_.Set(from._internal_interface(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.flags_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.flags_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_flags()) {
+    _this->_impl_.flags_.Set(from._internal_flags(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.hardware_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hardware()) {
+    _this->_impl_.hardware_.Set(from._internal_hardware(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.capinterface_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.capinterface_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_capinterface()) {
+    _this->_impl_.capinterface_.Set(from._internal_capinterface(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubInterface)
+}
+
+inline void SubInterface::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.interface_){}
+    , decltype(_impl_.flags_){}
+    , decltype(_impl_.hardware_){}
+    , decltype(_impl_.capinterface_){}
+  };
+  _impl_.interface_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.interface_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.flags_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.flags_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.hardware_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.capinterface_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.capinterface_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubInterface::~SubInterface() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubInterface)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubInterface::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.interface_.Destroy();
+  _impl_.flags_.Destroy();
+  _impl_.hardware_.Destroy();
+  _impl_.capinterface_.Destroy();
+}
+
+void SubInterface::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubInterface::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubInterface)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.interface_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.flags_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.hardware_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.capinterface_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubInterface::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string interface = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_interface();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string flags = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_flags();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string hardware = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_hardware();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string capinterface = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_capinterface();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubInterface::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubInterface)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string interface = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_interface(), target);
+  }
+
+  // required string flags = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_flags(), target);
+  }
+
+  // optional string hardware = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_hardware(), target);
+  }
+
+  // optional string capinterface = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_capinterface(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubInterface)
+  return target;
+}
+
+size_t SubInterface::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetDatasource.SubInterface)
+  size_t total_size = 0;
+
+  if (_internal_has_interface()) {
+    // required string interface = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_interface());
+  }
+
+  if (_internal_has_flags()) {
+    // required string flags = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_flags());
+  }
+
+  return total_size;
+}
+size_t SubInterface::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubInterface)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string interface = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_interface());
+
+    // required string flags = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_flags());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000cu) {
+    // optional string hardware = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_hardware());
+    }
+
+    // optional string capinterface = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_capinterface());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubInterface::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubInterface*>(
+      &from));
+}
+
+void SubInterface::MergeFrom(const SubInterface& from) {
+  SubInterface* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubInterface)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_interface(from._internal_interface());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_flags(from._internal_flags());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_hardware(from._internal_hardware());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_capinterface(from._internal_capinterface());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubInterface::CopyFrom(const SubInterface& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubInterface)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubInterface::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubInterface::InternalSwap(SubInterface* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.interface_, lhs_arena,
+      &other->_impl_.interface_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.flags_, lhs_arena,
+      &other->_impl_.flags_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hardware_, lhs_arena,
+      &other->_impl_.hardware_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.capinterface_, lhs_arena,
+      &other->_impl_.capinterface_, rhs_arena
+  );
+}
+
+std::string SubInterface::GetTypeName() const {
+  return "KismetDatasource.SubInterface";
+}
+
+
+// ===================================================================
+
+class SubPacket::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubPacket>()._impl_._has_bits_);
+  static void set_has_time_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_time_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_dlt(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000001f) ^ 0x0000001f) != 0;
+  }
+};
+
+SubPacket::SubPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubPacket)
+}
+SubPacket::SubPacket(const SubPacket& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubPacket* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.time_sec_){}
+    , decltype(_impl_.time_usec_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.dlt_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    _this->_impl_.data_.Set(from._internal_data(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.time_sec_, &from._impl_.time_sec_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.dlt_) -
+    reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.dlt_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubPacket)
+}
+
+inline void SubPacket::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){}
+    , decltype(_impl_.time_sec_){uint64_t{0u}}
+    , decltype(_impl_.time_usec_){uint64_t{0u}}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.dlt_){0u}
+  };
+  _impl_.data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubPacket::~SubPacket() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubPacket)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubPacket::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.Destroy();
+}
+
+void SubPacket::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubPacket::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubPacket)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.data_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000001eu) {
+    ::memset(&_impl_.time_sec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.dlt_) -
+        reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.dlt_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubPacket::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 time_sec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_time_sec(&has_bits);
+          _impl_.time_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 time_usec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_time_usec(&has_bits);
+          _impl_.time_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 dlt = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_dlt(&has_bits);
+          _impl_.dlt_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_size(&has_bits);
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes data = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_data();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubPacket::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubPacket)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 time_sec = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_time_sec(), target);
+  }
+
+  // required uint64 time_usec = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_time_usec(), target);
+  }
+
+  // required uint32 dlt = 3;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_dlt(), target);
+  }
+
+  // required uint64 size = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_size(), target);
+  }
+
+  // required bytes data = 5;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_data(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubPacket)
+  return target;
+}
+
+size_t SubPacket::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetDatasource.SubPacket)
+  size_t total_size = 0;
+
+  if (_internal_has_data()) {
+    // required bytes data = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+  }
+
+  if (_internal_has_time_sec()) {
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+  }
+
+  if (_internal_has_time_usec()) {
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+  }
+
+  if (_internal_has_size()) {
+    // required uint64 size = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  if (_internal_has_dlt()) {
+    // required uint32 dlt = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dlt());
+  }
+
+  return total_size;
+}
+size_t SubPacket::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubPacket)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000001f) ^ 0x0000001f) == 0) {  // All required fields are present.
+    // required bytes data = 5;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
+
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+
+    // required uint64 size = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+
+    // required uint32 dlt = 3;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dlt());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubPacket::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubPacket*>(
+      &from));
+}
+
+void SubPacket::MergeFrom(const SubPacket& from) {
+  SubPacket* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubPacket)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_data(from._internal_data());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.time_sec_ = from._impl_.time_sec_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.time_usec_ = from._impl_.time_usec_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.size_ = from._impl_.size_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.dlt_ = from._impl_.dlt_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubPacket::CopyFrom(const SubPacket& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubPacket)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubPacket::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubPacket::InternalSwap(SubPacket* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.data_, lhs_arena,
+      &other->_impl_.data_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubPacket, _impl_.dlt_)
+      + sizeof(SubPacket::_impl_.dlt_)
+      - PROTOBUF_FIELD_OFFSET(SubPacket, _impl_.time_sec_)>(
+          reinterpret_cast<char*>(&_impl_.time_sec_),
+          reinterpret_cast<char*>(&other->_impl_.time_sec_));
+}
+
+std::string SubPacket::GetTypeName() const {
+  return "KismetDatasource.SubPacket";
+}
+
+
+// ===================================================================
+
+class SubJson::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubJson>()._impl_._has_bits_);
+  static void set_has_time_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_time_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_json(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+SubJson::SubJson(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubJson)
+}
+SubJson::SubJson(const SubJson& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubJson* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.json_){}
+    , decltype(_impl_.time_sec_){}
+    , decltype(_impl_.time_usec_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_json()) {
+    _this->_impl_.json_.Set(from._internal_json(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.time_sec_, &from._impl_.time_sec_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.time_usec_) -
+    reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.time_usec_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubJson)
+}
+
+inline void SubJson::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.json_){}
+    , decltype(_impl_.time_sec_){uint64_t{0u}}
+    , decltype(_impl_.time_usec_){uint64_t{0u}}
+  };
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubJson::~SubJson() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubJson)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubJson::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.type_.Destroy();
+  _impl_.json_.Destroy();
+}
+
+void SubJson::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubJson::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubJson)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.json_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.time_sec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.time_usec_) -
+        reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.time_usec_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubJson::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 time_sec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_time_sec(&has_bits);
+          _impl_.time_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 time_usec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_time_usec(&has_bits);
+          _impl_.time_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string json = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_json();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubJson::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubJson)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 time_sec = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_time_sec(), target);
+  }
+
+  // required uint64 time_usec = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_time_usec(), target);
+  }
+
+  // required string type = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_type(), target);
+  }
+
+  // required string json = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_json(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubJson)
+  return target;
+}
+
+size_t SubJson::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetDatasource.SubJson)
+  size_t total_size = 0;
+
+  if (_internal_has_type()) {
+    // required string type = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+  }
+
+  if (_internal_has_json()) {
+    // required string json = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_json());
+  }
+
+  if (_internal_has_time_sec()) {
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+  }
+
+  if (_internal_has_time_usec()) {
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+  }
+
+  return total_size;
+}
+size_t SubJson::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubJson)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string type = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+
+    // required string json = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_json());
+
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubJson::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubJson*>(
+      &from));
+}
+
+void SubJson::MergeFrom(const SubJson& from) {
+  SubJson* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubJson)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_json(from._internal_json());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.time_sec_ = from._impl_.time_sec_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.time_usec_ = from._impl_.time_usec_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubJson::CopyFrom(const SubJson& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubJson)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubJson::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubJson::InternalSwap(SubJson* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.json_, lhs_arena,
+      &other->_impl_.json_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubJson, _impl_.time_usec_)
+      + sizeof(SubJson::_impl_.time_usec_)
+      - PROTOBUF_FIELD_OFFSET(SubJson, _impl_.time_sec_)>(
+          reinterpret_cast<char*>(&_impl_.time_sec_),
+          reinterpret_cast<char*>(&other->_impl_.time_sec_));
+}
+
+std::string SubJson::GetTypeName() const {
+  return "KismetDatasource.SubJson";
+}
+
+
+// ===================================================================
+
+class SubBuffer::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubBuffer>()._impl_._has_bits_);
+  static void set_has_time_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_time_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_buffer(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+SubBuffer::SubBuffer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubBuffer)
+}
+SubBuffer::SubBuffer(const SubBuffer& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubBuffer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.buffer_){}
+    , decltype(_impl_.time_sec_){}
+    , decltype(_impl_.time_usec_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_type()) {
+    _this->_impl_.type_.Set(from._internal_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.buffer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.buffer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_buffer()) {
+    _this->_impl_.buffer_.Set(from._internal_buffer(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.time_sec_, &from._impl_.time_sec_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.time_usec_) -
+    reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.time_usec_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubBuffer)
+}
+
+inline void SubBuffer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.type_){}
+    , decltype(_impl_.buffer_){}
+    , decltype(_impl_.time_sec_){uint64_t{0u}}
+    , decltype(_impl_.time_usec_){uint64_t{0u}}
+  };
+  _impl_.type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.buffer_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.buffer_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubBuffer::~SubBuffer() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubBuffer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubBuffer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.type_.Destroy();
+  _impl_.buffer_.Destroy();
+}
+
+void SubBuffer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubBuffer::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubBuffer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.buffer_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.time_sec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.time_usec_) -
+        reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.time_usec_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubBuffer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 time_sec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_time_sec(&has_bits);
+          _impl_.time_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 time_usec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_time_usec(&has_bits);
+          _impl_.time_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required bytes buffer = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_buffer();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubBuffer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubBuffer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 time_sec = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_time_sec(), target);
+  }
+
+  // required uint64 time_usec = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_time_usec(), target);
+  }
+
+  // required string type = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_type(), target);
+  }
+
+  // required bytes buffer = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_buffer(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubBuffer)
+  return target;
+}
+
+size_t SubBuffer::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetDatasource.SubBuffer)
+  size_t total_size = 0;
+
+  if (_internal_has_type()) {
+    // required string type = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+  }
+
+  if (_internal_has_buffer()) {
+    // required bytes buffer = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_buffer());
+  }
+
+  if (_internal_has_time_sec()) {
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+  }
+
+  if (_internal_has_time_usec()) {
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+  }
+
+  return total_size;
+}
+size_t SubBuffer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubBuffer)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required string type = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_type());
+
+    // required bytes buffer = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_buffer());
+
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubBuffer::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubBuffer*>(
+      &from));
+}
+
+void SubBuffer::MergeFrom(const SubBuffer& from) {
+  SubBuffer* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubBuffer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_type(from._internal_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_buffer(from._internal_buffer());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.time_sec_ = from._impl_.time_sec_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.time_usec_ = from._impl_.time_usec_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubBuffer::CopyFrom(const SubBuffer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubBuffer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubBuffer::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubBuffer::InternalSwap(SubBuffer* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.type_, lhs_arena,
+      &other->_impl_.type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.buffer_, lhs_arena,
+      &other->_impl_.buffer_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubBuffer, _impl_.time_usec_)
+      + sizeof(SubBuffer::_impl_.time_usec_)
+      - PROTOBUF_FIELD_OFFSET(SubBuffer, _impl_.time_sec_)>(
+          reinterpret_cast<char*>(&_impl_.time_sec_),
+          reinterpret_cast<char*>(&other->_impl_.time_sec_));
+}
+
+std::string SubBuffer::GetTypeName() const {
+  return "KismetDatasource.SubBuffer";
+}
+
+
+// ===================================================================
+
+class SubSignal::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubSignal>()._impl_._has_bits_);
+  static void set_has_signal_dbm(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_noise_dbm(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_signal_rssi(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_noise_rssi(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_freq_khz(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_datarate(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+};
+
+SubSignal::SubSignal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubSignal)
+}
+SubSignal::SubSignal(const SubSignal& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubSignal* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.signal_dbm_){}
+    , decltype(_impl_.noise_dbm_){}
+    , decltype(_impl_.signal_rssi_){}
+    , decltype(_impl_.noise_rssi_){}
+    , decltype(_impl_.freq_khz_){}
+    , decltype(_impl_.datarate_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_.Set(from._internal_channel(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.signal_dbm_, &from._impl_.signal_dbm_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.datarate_) -
+    reinterpret_cast<char*>(&_impl_.signal_dbm_)) + sizeof(_impl_.datarate_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubSignal)
+}
+
+inline void SubSignal::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){}
+    , decltype(_impl_.signal_dbm_){0}
+    , decltype(_impl_.noise_dbm_){0}
+    , decltype(_impl_.signal_rssi_){0}
+    , decltype(_impl_.noise_rssi_){0}
+    , decltype(_impl_.freq_khz_){0}
+    , decltype(_impl_.datarate_){0}
+  };
+  _impl_.channel_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubSignal::~SubSignal() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubSignal)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubSignal::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.channel_.Destroy();
+}
+
+void SubSignal::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubSignal::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubSignal)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.channel_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&_impl_.signal_dbm_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.datarate_) -
+        reinterpret_cast<char*>(&_impl_.signal_dbm_)) + sizeof(_impl_.datarate_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubSignal::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double signal_dbm = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_signal_dbm(&has_bits);
+          _impl_.signal_dbm_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double noise_dbm = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_noise_dbm(&has_bits);
+          _impl_.noise_dbm_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double signal_rssi = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_signal_rssi(&has_bits);
+          _impl_.signal_rssi_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double noise_rssi = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_noise_rssi(&has_bits);
+          _impl_.noise_rssi_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double freq_khz = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_freq_khz(&has_bits);
+          _impl_.freq_khz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string channel = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_channel();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double datarate = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 57)) {
+          _Internal::set_has_datarate(&has_bits);
+          _impl_.datarate_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubSignal::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubSignal)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double signal_dbm = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_signal_dbm(), target);
+  }
+
+  // optional double noise_dbm = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_noise_dbm(), target);
+  }
+
+  // optional double signal_rssi = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_signal_rssi(), target);
+  }
+
+  // optional double noise_rssi = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_noise_rssi(), target);
+  }
+
+  // optional double freq_khz = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_freq_khz(), target);
+  }
+
+  // optional string channel = 6;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_channel(), target);
+  }
+
+  // optional double datarate = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(7, this->_internal_datarate(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubSignal)
+  return target;
+}
+
+size_t SubSignal::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubSignal)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional string channel = 6;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_channel());
+    }
+
+    // optional double signal_dbm = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double noise_dbm = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double signal_rssi = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double noise_rssi = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double freq_khz = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double datarate = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubSignal::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubSignal*>(
+      &from));
+}
+
+void SubSignal::MergeFrom(const SubSignal& from) {
+  SubSignal* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubSignal)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_channel(from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.signal_dbm_ = from._impl_.signal_dbm_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.noise_dbm_ = from._impl_.noise_dbm_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.signal_rssi_ = from._impl_.signal_rssi_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.noise_rssi_ = from._impl_.noise_rssi_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.freq_khz_ = from._impl_.freq_khz_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.datarate_ = from._impl_.datarate_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubSignal::CopyFrom(const SubSignal& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubSignal)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubSignal::IsInitialized() const {
+  return true;
+}
+
+void SubSignal::InternalSwap(SubSignal* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.channel_, lhs_arena,
+      &other->_impl_.channel_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubSignal, _impl_.datarate_)
+      + sizeof(SubSignal::_impl_.datarate_)
+      - PROTOBUF_FIELD_OFFSET(SubSignal, _impl_.signal_dbm_)>(
+          reinterpret_cast<char*>(&_impl_.signal_dbm_),
+          reinterpret_cast<char*>(&other->_impl_.signal_dbm_));
+}
+
+std::string SubSignal::GetTypeName() const {
+  return "KismetDatasource.SubSignal";
+}
+
+
+// ===================================================================
+
+class SubSpecset::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubSpecset>()._impl_._has_bits_);
+  static void set_has_start_mhz(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_end_mhz(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_samples_per_bucket(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_bucket_width_hz(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_enable_amp(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_if_amp(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_baseband_amp(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+};
+
+SubSpecset::SubSpecset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubSpecset)
+}
+SubSpecset::SubSpecset(const SubSpecset& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubSpecset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_mhz_){}
+    , decltype(_impl_.end_mhz_){}
+    , decltype(_impl_.samples_per_bucket_){}
+    , decltype(_impl_.bucket_width_hz_){}
+    , decltype(_impl_.if_amp_){}
+    , decltype(_impl_.baseband_amp_){}
+    , decltype(_impl_.enable_amp_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.start_mhz_, &from._impl_.start_mhz_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.enable_amp_) -
+    reinterpret_cast<char*>(&_impl_.start_mhz_)) + sizeof(_impl_.enable_amp_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubSpecset)
+}
+
+inline void SubSpecset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_mhz_){0}
+    , decltype(_impl_.end_mhz_){0}
+    , decltype(_impl_.samples_per_bucket_){0}
+    , decltype(_impl_.bucket_width_hz_){0}
+    , decltype(_impl_.if_amp_){uint64_t{0u}}
+    , decltype(_impl_.baseband_amp_){uint64_t{0u}}
+    , decltype(_impl_.enable_amp_){false}
+  };
+}
+
+SubSpecset::~SubSpecset() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubSpecset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubSpecset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SubSpecset::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubSpecset::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubSpecset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    ::memset(&_impl_.start_mhz_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.enable_amp_) -
+        reinterpret_cast<char*>(&_impl_.start_mhz_)) + sizeof(_impl_.enable_amp_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubSpecset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional double start_mhz = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _Internal::set_has_start_mhz(&has_bits);
+          _impl_.start_mhz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double end_mhz = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _Internal::set_has_end_mhz(&has_bits);
+          _impl_.end_mhz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double samples_per_bucket = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_samples_per_bucket(&has_bits);
+          _impl_.samples_per_bucket_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double bucket_width_hz = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_bucket_width_hz(&has_bits);
+          _impl_.bucket_width_hz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bool enable_amp = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_enable_amp(&has_bits);
+          _impl_.enable_amp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 if_amp = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_if_amp(&has_bits);
+          _impl_.if_amp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 baseband_amp = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_baseband_amp(&has_bits);
+          _impl_.baseband_amp_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubSpecset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubSpecset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional double start_mhz = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_start_mhz(), target);
+  }
+
+  // optional double end_mhz = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_end_mhz(), target);
+  }
+
+  // optional double samples_per_bucket = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_samples_per_bucket(), target);
+  }
+
+  // optional double bucket_width_hz = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_bucket_width_hz(), target);
+  }
+
+  // optional bool enable_amp = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(5, this->_internal_enable_amp(), target);
+  }
+
+  // optional uint64 if_amp = 6;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_if_amp(), target);
+  }
+
+  // optional uint64 baseband_amp = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_baseband_amp(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubSpecset)
+  return target;
+}
+
+size_t SubSpecset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubSpecset)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    // optional double start_mhz = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double end_mhz = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double samples_per_bucket = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double bucket_width_hz = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional uint64 if_amp = 6;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_if_amp());
+    }
+
+    // optional uint64 baseband_amp = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_baseband_amp());
+    }
+
+    // optional bool enable_amp = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 + 1;
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubSpecset::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubSpecset*>(
+      &from));
+}
+
+void SubSpecset::MergeFrom(const SubSpecset& from) {
+  SubSpecset* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubSpecset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.start_mhz_ = from._impl_.start_mhz_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.end_mhz_ = from._impl_.end_mhz_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.samples_per_bucket_ = from._impl_.samples_per_bucket_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.bucket_width_hz_ = from._impl_.bucket_width_hz_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.if_amp_ = from._impl_.if_amp_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.baseband_amp_ = from._impl_.baseband_amp_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_impl_.enable_amp_ = from._impl_.enable_amp_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubSpecset::CopyFrom(const SubSpecset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubSpecset)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubSpecset::IsInitialized() const {
+  return true;
+}
+
+void SubSpecset::InternalSwap(SubSpecset* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubSpecset, _impl_.enable_amp_)
+      + sizeof(SubSpecset::_impl_.enable_amp_)
+      - PROTOBUF_FIELD_OFFSET(SubSpecset, _impl_.start_mhz_)>(
+          reinterpret_cast<char*>(&_impl_.start_mhz_),
+          reinterpret_cast<char*>(&other->_impl_.start_mhz_));
+}
+
+std::string SubSpecset::GetTypeName() const {
+  return "KismetDatasource.SubSpecset";
+}
+
+
+// ===================================================================
+
+class SubSpectrum::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubSpectrum>()._impl_._has_bits_);
+  static void set_has_time_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_time_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_start_mhz(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_end_mhz(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_bucket_width_hz(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+};
+
+SubSpectrum::SubSpectrum(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubSpectrum)
+}
+SubSpectrum::SubSpectrum(const SubSpectrum& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubSpectrum* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){from._impl_.data_}
+    , decltype(_impl_.time_sec_){}
+    , decltype(_impl_.time_usec_){}
+    , decltype(_impl_.start_mhz_){}
+    , decltype(_impl_.end_mhz_){}
+    , decltype(_impl_.bucket_width_hz_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.time_sec_, &from._impl_.time_sec_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bucket_width_hz_) -
+    reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.bucket_width_hz_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubSpectrum)
+}
+
+inline void SubSpectrum::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.data_){arena}
+    , decltype(_impl_.time_sec_){uint64_t{0u}}
+    , decltype(_impl_.time_usec_){uint64_t{0u}}
+    , decltype(_impl_.start_mhz_){0}
+    , decltype(_impl_.end_mhz_){0}
+    , decltype(_impl_.bucket_width_hz_){0}
+  };
+}
+
+SubSpectrum::~SubSpectrum() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubSpectrum)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubSpectrum::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.data_.~RepeatedField();
+}
+
+void SubSpectrum::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubSpectrum::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubSpectrum)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.data_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    ::memset(&_impl_.time_sec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.bucket_width_hz_) -
+        reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.bucket_width_hz_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubSpectrum::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint64 time_sec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_time_sec(&has_bits);
+          _impl_.time_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 time_usec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_time_usec(&has_bits);
+          _impl_.time_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double start_mhz = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _Internal::set_has_start_mhz(&has_bits);
+          _impl_.start_mhz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double end_mhz = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _Internal::set_has_end_mhz(&has_bits);
+          _impl_.end_mhz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double bucket_width_hz = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 41)) {
+          _Internal::set_has_bucket_width_hz(&has_bits);
+          _impl_.bucket_width_hz_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated int32 data = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            _internal_add_data(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<48>(ptr));
+        } else if (static_cast<uint8_t>(tag) == 50) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedInt32Parser(_internal_mutable_data(), ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubSpectrum::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubSpectrum)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional uint64 time_sec = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_time_sec(), target);
+  }
+
+  // optional uint64 time_usec = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_time_usec(), target);
+  }
+
+  // optional double start_mhz = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_start_mhz(), target);
+  }
+
+  // optional double end_mhz = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_end_mhz(), target);
+  }
+
+  // optional double bucket_width_hz = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(5, this->_internal_bucket_width_hz(), target);
+  }
+
+  // repeated int32 data = 6;
+  for (int i = 0, n = this->_internal_data_size(); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_data(i), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubSpectrum)
+  return target;
+}
+
+size_t SubSpectrum::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubSpectrum)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated int32 data = 6;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      Int32Size(this->_impl_.data_);
+    total_size += 1 *
+                  ::_pbi::FromIntSize(this->_internal_data_size());
+    total_size += data_size;
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    // optional uint64 time_sec = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+    }
+
+    // optional uint64 time_usec = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+    }
+
+    // optional double start_mhz = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double end_mhz = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 + 8;
+    }
+
+    // optional double bucket_width_hz = 5;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 + 8;
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubSpectrum::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubSpectrum*>(
+      &from));
+}
+
+void SubSpectrum::MergeFrom(const SubSpectrum& from) {
+  SubSpectrum* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubSpectrum)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.data_.MergeFrom(from._impl_.data_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.time_sec_ = from._impl_.time_sec_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.time_usec_ = from._impl_.time_usec_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.start_mhz_ = from._impl_.start_mhz_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.end_mhz_ = from._impl_.end_mhz_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.bucket_width_hz_ = from._impl_.bucket_width_hz_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubSpectrum::CopyFrom(const SubSpectrum& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubSpectrum)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubSpectrum::IsInitialized() const {
+  return true;
+}
+
+void SubSpectrum::InternalSwap(SubSpectrum* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.data_.InternalSwap(&other->_impl_.data_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubSpectrum, _impl_.bucket_width_hz_)
+      + sizeof(SubSpectrum::_impl_.bucket_width_hz_)
+      - PROTOBUF_FIELD_OFFSET(SubSpectrum, _impl_.time_sec_)>(
+          reinterpret_cast<char*>(&_impl_.time_sec_),
+          reinterpret_cast<char*>(&other->_impl_.time_sec_));
+}
+
+std::string SubSpectrum::GetTypeName() const {
+  return "KismetDatasource.SubSpectrum";
+}
+
+
+// ===================================================================
+
+class SubSuccess::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubSuccess>()._impl_._has_bits_);
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_seqno(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+SubSuccess::SubSuccess(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.SubSuccess)
+}
+SubSuccess::SubSuccess(const SubSuccess& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubSuccess* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.success_){}
+    , decltype(_impl_.seqno_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&_impl_.success_, &from._impl_.success_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.seqno_) -
+    reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.seqno_));
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.SubSuccess)
+}
+
+inline void SubSuccess::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.success_){false}
+    , decltype(_impl_.seqno_){0u}
+  };
+}
+
+SubSuccess::~SubSuccess() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.SubSuccess)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubSuccess::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void SubSuccess::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubSuccess::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.SubSuccess)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&_impl_.success_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.seqno_) -
+        reinterpret_cast<char*>(&_impl_.success_)) + sizeof(_impl_.seqno_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubSuccess::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required bool success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_success(&has_bits);
+          _impl_.success_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint32 seqno = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_seqno(&has_bits);
+          _impl_.seqno_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubSuccess::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.SubSuccess)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required bool success = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_success(), target);
+  }
+
+  // required uint32 seqno = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_seqno(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.SubSuccess)
+  return target;
+}
+
+size_t SubSuccess::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetDatasource.SubSuccess)
+  size_t total_size = 0;
+
+  if (_internal_has_success()) {
+    // required bool success = 1;
+    total_size += 1 + 1;
+  }
+
+  if (_internal_has_seqno()) {
+    // required uint32 seqno = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_seqno());
+  }
+
+  return total_size;
+}
+size_t SubSuccess::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.SubSuccess)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required bool success = 1;
+    total_size += 1 + 1;
+
+    // required uint32 seqno = 2;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_seqno());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubSuccess::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubSuccess*>(
+      &from));
+}
+
+void SubSuccess::MergeFrom(const SubSuccess& from) {
+  SubSuccess* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.SubSuccess)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_impl_.success_ = from._impl_.success_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.seqno_ = from._impl_.seqno_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubSuccess::CopyFrom(const SubSuccess& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.SubSuccess)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubSuccess::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubSuccess::InternalSwap(SubSuccess* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubSuccess, _impl_.seqno_)
+      + sizeof(SubSuccess::_impl_.seqno_)
+      - PROTOBUF_FIELD_OFFSET(SubSuccess, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+std::string SubSuccess::GetTypeName() const {
+  return "KismetDatasource.SubSuccess";
+}
+
+
+// ===================================================================
+
+class CloseDatasource::_Internal {
+ public:
+};
+
+CloseDatasource::CloseDatasource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.CloseDatasource)
+}
+CloseDatasource::CloseDatasource(const CloseDatasource& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  CloseDatasource* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.CloseDatasource)
+}
+
+inline void CloseDatasource::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+CloseDatasource::~CloseDatasource() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.CloseDatasource)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void CloseDatasource::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void CloseDatasource::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void CloseDatasource::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.CloseDatasource)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* CloseDatasource::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* CloseDatasource::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.CloseDatasource)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.CloseDatasource)
+  return target;
+}
+
+size_t CloseDatasource::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.CloseDatasource)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void CloseDatasource::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const CloseDatasource*>(
+      &from));
+}
+
+void CloseDatasource::MergeFrom(const CloseDatasource& from) {
+  CloseDatasource* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.CloseDatasource)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void CloseDatasource::CopyFrom(const CloseDatasource& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.CloseDatasource)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool CloseDatasource::IsInitialized() const {
+  return true;
+}
+
+void CloseDatasource::InternalSwap(CloseDatasource* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+}
+
+std::string CloseDatasource::GetTypeName() const {
+  return "KismetDatasource.CloseDatasource";
+}
+
+
+// ===================================================================
+
+class Configure::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Configure>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubChanset& channel(const Configure* msg);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::KismetDatasource::SubChanhop& hopping(const Configure* msg);
+  static void set_has_hopping(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::KismetDatasource::SubSpecset& spectrum(const Configure* msg);
+  static void set_has_spectrum(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+const ::KismetDatasource::SubChanset&
+Configure::_Internal::channel(const Configure* msg) {
+  return *msg->_impl_.channel_;
+}
+const ::KismetDatasource::SubChanhop&
+Configure::_Internal::hopping(const Configure* msg) {
+  return *msg->_impl_.hopping_;
+}
+const ::KismetDatasource::SubSpecset&
+Configure::_Internal::spectrum(const Configure* msg) {
+  return *msg->_impl_.spectrum_;
+}
+Configure::Configure(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.Configure)
+}
+Configure::Configure(const Configure& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  Configure* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.hopping_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_ = new ::KismetDatasource::SubChanset(*from._impl_.channel_);
+  }
+  if (from._internal_has_hopping()) {
+    _this->_impl_.hopping_ = new ::KismetDatasource::SubChanhop(*from._impl_.hopping_);
+  }
+  if (from._internal_has_spectrum()) {
+    _this->_impl_.spectrum_ = new ::KismetDatasource::SubSpecset(*from._impl_.spectrum_);
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.Configure)
+}
+
+inline void Configure::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.hopping_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}
+  };
+}
+
+Configure::~Configure() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.Configure)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Configure::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.channel_;
+  if (this != internal_default_instance()) delete _impl_.hopping_;
+  if (this != internal_default_instance()) delete _impl_.spectrum_;
+}
+
+void Configure::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Configure::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.Configure)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.channel_ != nullptr);
+      _impl_.channel_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.hopping_ != nullptr);
+      _impl_.hopping_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.spectrum_ != nullptr);
+      _impl_.spectrum_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Configure::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .KismetDatasource.SubChanset channel = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChanhop hopping = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hopping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubSpecset spectrum = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spectrum(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Configure::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.Configure)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .KismetDatasource.SubChanset channel = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::channel(this),
+        _Internal::channel(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubChanhop hopping = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::hopping(this),
+        _Internal::hopping(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubSpecset spectrum = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::spectrum(this),
+        _Internal::spectrum(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.Configure)
+  return target;
+}
+
+size_t Configure::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.Configure)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional .KismetDatasource.SubChanset channel = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channel_);
+    }
+
+    // optional .KismetDatasource.SubChanhop hopping = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hopping_);
+    }
+
+    // optional .KismetDatasource.SubSpecset spectrum = 3;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.spectrum_);
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Configure::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Configure*>(
+      &from));
+}
+
+void Configure::MergeFrom(const Configure& from) {
+  Configure* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.Configure)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_channel()->::KismetDatasource::SubChanset::MergeFrom(
+          from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_hopping()->::KismetDatasource::SubChanhop::MergeFrom(
+          from._internal_hopping());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_spectrum()->::KismetDatasource::SubSpecset::MergeFrom(
+          from._internal_spectrum());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Configure::CopyFrom(const Configure& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.Configure)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Configure::IsInitialized() const {
+  if (_internal_has_channel()) {
+    if (!_impl_.channel_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Configure::InternalSwap(Configure* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Configure, _impl_.spectrum_)
+      + sizeof(Configure::_impl_.spectrum_)
+      - PROTOBUF_FIELD_OFFSET(Configure, _impl_.channel_)>(
+          reinterpret_cast<char*>(&_impl_.channel_),
+          reinterpret_cast<char*>(&other->_impl_.channel_));
+}
+
+std::string Configure::GetTypeName() const {
+  return "KismetDatasource.Configure";
+}
+
+
+// ===================================================================
+
+class ConfigureReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ConfigureReport>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubSuccess& success(const ConfigureReport* msg);
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::KismetDatasource::SubChanset& channel(const ConfigureReport* msg);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::KismetDatasource::SubChanhop& hopping(const ConfigureReport* msg);
+  static void set_has_hopping(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::KismetExternal::MsgbusMessage& message(const ConfigureReport* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_warning(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+const ::KismetDatasource::SubSuccess&
+ConfigureReport::_Internal::success(const ConfigureReport* msg) {
+  return *msg->_impl_.success_;
+}
+const ::KismetDatasource::SubChanset&
+ConfigureReport::_Internal::channel(const ConfigureReport* msg) {
+  return *msg->_impl_.channel_;
+}
+const ::KismetDatasource::SubChanhop&
+ConfigureReport::_Internal::hopping(const ConfigureReport* msg) {
+  return *msg->_impl_.hopping_;
+}
+const ::KismetExternal::MsgbusMessage&
+ConfigureReport::_Internal::message(const ConfigureReport* msg) {
+  return *msg->_impl_.message_;
+}
+void ConfigureReport::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+ConfigureReport::ConfigureReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.ConfigureReport)
+}
+ConfigureReport::ConfigureReport(const ConfigureReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ConfigureReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.hopping_){nullptr}
+    , decltype(_impl_.message_){nullptr}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_warning()) {
+    _this->_impl_.warning_.Set(from._internal_warning(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_success()) {
+    _this->_impl_.success_ = new ::KismetDatasource::SubSuccess(*from._impl_.success_);
+  }
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_ = new ::KismetDatasource::SubChanset(*from._impl_.channel_);
+  }
+  if (from._internal_has_hopping()) {
+    _this->_impl_.hopping_ = new ::KismetDatasource::SubChanhop(*from._impl_.hopping_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::KismetExternal::MsgbusMessage(*from._impl_.message_);
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.ConfigureReport)
+}
+
+inline void ConfigureReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.hopping_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+  };
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ConfigureReport::~ConfigureReport() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.ConfigureReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ConfigureReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.warning_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.success_;
+  if (this != internal_default_instance()) delete _impl_.channel_;
+  if (this != internal_default_instance()) delete _impl_.hopping_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void ConfigureReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ConfigureReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.ConfigureReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.warning_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.success_ != nullptr);
+      _impl_.success_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.channel_ != nullptr);
+      _impl_.channel_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.hopping_ != nullptr);
+      _impl_.hopping_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ConfigureReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .KismetDatasource.SubSuccess success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_success(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChanset channel = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChanhop hopping = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hopping(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetExternal.MsgbusMessage message = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string warning = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_warning();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ConfigureReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.ConfigureReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::success(this),
+        _Internal::success(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubChanset channel = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::channel(this),
+        _Internal::channel(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubChanhop hopping = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::hopping(this),
+        _Internal::hopping(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string warning = 5;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_warning(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.ConfigureReport)
+  return target;
+}
+
+size_t ConfigureReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.ConfigureReport)
+  size_t total_size = 0;
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (_internal_has_success()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.success_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string warning = 5;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_warning());
+  }
+
+  if (cached_has_bits & 0x0000001cu) {
+    // optional .KismetDatasource.SubChanset channel = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channel_);
+    }
+
+    // optional .KismetDatasource.SubChanhop hopping = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hopping_);
+    }
+
+    // optional .KismetExternal.MsgbusMessage message = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_);
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ConfigureReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ConfigureReport*>(
+      &from));
+}
+
+void ConfigureReport::MergeFrom(const ConfigureReport& from) {
+  ConfigureReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.ConfigureReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_warning(from._internal_warning());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_success()->::KismetDatasource::SubSuccess::MergeFrom(
+          from._internal_success());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_channel()->::KismetDatasource::SubChanset::MergeFrom(
+          from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_hopping()->::KismetDatasource::SubChanhop::MergeFrom(
+          from._internal_hopping());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_message()->::KismetExternal::MsgbusMessage::MergeFrom(
+          from._internal_message());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ConfigureReport::CopyFrom(const ConfigureReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.ConfigureReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ConfigureReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_success()) {
+    if (!_impl_.success_->IsInitialized()) return false;
+  }
+  if (_internal_has_channel()) {
+    if (!_impl_.channel_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ConfigureReport::InternalSwap(ConfigureReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.warning_, lhs_arena,
+      &other->_impl_.warning_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ConfigureReport, _impl_.message_)
+      + sizeof(ConfigureReport::_impl_.message_)
+      - PROTOBUF_FIELD_OFFSET(ConfigureReport, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+std::string ConfigureReport::GetTypeName() const {
+  return "KismetDatasource.ConfigureReport";
+}
+
+
+// ===================================================================
+
+class DataReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<DataReport>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubGps& gps(const DataReport* msg);
+  static void set_has_gps(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::KismetExternal::MsgbusMessage& message(const DataReport* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::KismetDatasource::SubPacket& packet(const DataReport* msg);
+  static void set_has_packet(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::KismetDatasource::SubSignal& signal(const DataReport* msg);
+  static void set_has_signal(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::KismetDatasource::SubSpectrum& spectrum(const DataReport* msg);
+  static void set_has_spectrum(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_warning(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::KismetDatasource::SubJson& json(const DataReport* msg);
+  static void set_has_json(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::KismetDatasource::SubBuffer& buffer(const DataReport* msg);
+  static void set_has_buffer(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_high_prec_time(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+};
+
+const ::KismetDatasource::SubGps&
+DataReport::_Internal::gps(const DataReport* msg) {
+  return *msg->_impl_.gps_;
+}
+const ::KismetExternal::MsgbusMessage&
+DataReport::_Internal::message(const DataReport* msg) {
+  return *msg->_impl_.message_;
+}
+const ::KismetDatasource::SubPacket&
+DataReport::_Internal::packet(const DataReport* msg) {
+  return *msg->_impl_.packet_;
+}
+const ::KismetDatasource::SubSignal&
+DataReport::_Internal::signal(const DataReport* msg) {
+  return *msg->_impl_.signal_;
+}
+const ::KismetDatasource::SubSpectrum&
+DataReport::_Internal::spectrum(const DataReport* msg) {
+  return *msg->_impl_.spectrum_;
+}
+const ::KismetDatasource::SubJson&
+DataReport::_Internal::json(const DataReport* msg) {
+  return *msg->_impl_.json_;
+}
+const ::KismetDatasource::SubBuffer&
+DataReport::_Internal::buffer(const DataReport* msg) {
+  return *msg->_impl_.buffer_;
+}
+void DataReport::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+DataReport::DataReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.DataReport)
+}
+DataReport::DataReport(const DataReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  DataReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.gps_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.signal_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}
+    , decltype(_impl_.json_){nullptr}
+    , decltype(_impl_.buffer_){nullptr}
+    , decltype(_impl_.high_prec_time_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_warning()) {
+    _this->_impl_.warning_.Set(from._internal_warning(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_gps()) {
+    _this->_impl_.gps_ = new ::KismetDatasource::SubGps(*from._impl_.gps_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::KismetExternal::MsgbusMessage(*from._impl_.message_);
+  }
+  if (from._internal_has_packet()) {
+    _this->_impl_.packet_ = new ::KismetDatasource::SubPacket(*from._impl_.packet_);
+  }
+  if (from._internal_has_signal()) {
+    _this->_impl_.signal_ = new ::KismetDatasource::SubSignal(*from._impl_.signal_);
+  }
+  if (from._internal_has_spectrum()) {
+    _this->_impl_.spectrum_ = new ::KismetDatasource::SubSpectrum(*from._impl_.spectrum_);
+  }
+  if (from._internal_has_json()) {
+    _this->_impl_.json_ = new ::KismetDatasource::SubJson(*from._impl_.json_);
+  }
+  if (from._internal_has_buffer()) {
+    _this->_impl_.buffer_ = new ::KismetDatasource::SubBuffer(*from._impl_.buffer_);
+  }
+  _this->_impl_.high_prec_time_ = from._impl_.high_prec_time_;
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.DataReport)
+}
+
+inline void DataReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.gps_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.packet_){nullptr}
+    , decltype(_impl_.signal_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}
+    , decltype(_impl_.json_){nullptr}
+    , decltype(_impl_.buffer_){nullptr}
+    , decltype(_impl_.high_prec_time_){0}
+  };
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DataReport::~DataReport() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.DataReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DataReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.warning_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.gps_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+  if (this != internal_default_instance()) delete _impl_.packet_;
+  if (this != internal_default_instance()) delete _impl_.signal_;
+  if (this != internal_default_instance()) delete _impl_.spectrum_;
+  if (this != internal_default_instance()) delete _impl_.json_;
+  if (this != internal_default_instance()) delete _impl_.buffer_;
+}
+
+void DataReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DataReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.DataReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.warning_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.gps_ != nullptr);
+      _impl_.gps_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.packet_ != nullptr);
+      _impl_.packet_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.signal_ != nullptr);
+      _impl_.signal_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.spectrum_ != nullptr);
+      _impl_.spectrum_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.json_ != nullptr);
+      _impl_.json_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.buffer_ != nullptr);
+      _impl_.buffer_->Clear();
+    }
+  }
+  _impl_.high_prec_time_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* DataReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .KismetDatasource.SubGps gps = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gps(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetExternal.MsgbusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubPacket packet = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_packet(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubSignal signal = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_signal(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubSpectrum spectrum = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spectrum(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string warning = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_warning();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubJson json = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_json(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubBuffer buffer = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_buffer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional double high_prec_time = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 73)) {
+          _Internal::set_has_high_prec_time(&has_bits);
+          _impl_.high_prec_time_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DataReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.DataReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .KismetDatasource.SubGps gps = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gps(this),
+        _Internal::gps(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubPacket packet = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::packet(this),
+        _Internal::packet(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubSignal signal = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::signal(this),
+        _Internal::signal(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubSpectrum spectrum = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::spectrum(this),
+        _Internal::spectrum(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string warning = 6;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_warning(), target);
+  }
+
+  // optional .KismetDatasource.SubJson json = 7;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::json(this),
+        _Internal::json(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubBuffer buffer = 8;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::buffer(this),
+        _Internal::buffer(this).GetCachedSize(), target, stream);
+  }
+
+  // optional double high_prec_time = 9;
+  if (cached_has_bits & 0x00000100u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(9, this->_internal_high_prec_time(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.DataReport)
+  return target;
+}
+
+size_t DataReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.DataReport)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    // optional string warning = 6;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_warning());
+    }
+
+    // optional .KismetDatasource.SubGps gps = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.gps_);
+    }
+
+    // optional .KismetExternal.MsgbusMessage message = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_);
+    }
+
+    // optional .KismetDatasource.SubPacket packet = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.packet_);
+    }
+
+    // optional .KismetDatasource.SubSignal signal = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.signal_);
+    }
+
+    // optional .KismetDatasource.SubSpectrum spectrum = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.spectrum_);
+    }
+
+    // optional .KismetDatasource.SubJson json = 7;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.json_);
+    }
+
+    // optional .KismetDatasource.SubBuffer buffer = 8;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.buffer_);
+    }
+
+  }
+  // optional double high_prec_time = 9;
+  if (cached_has_bits & 0x00000100u) {
+    total_size += 1 + 8;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void DataReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const DataReport*>(
+      &from));
+}
+
+void DataReport::MergeFrom(const DataReport& from) {
+  DataReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.DataReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_warning(from._internal_warning());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_gps()->::KismetDatasource::SubGps::MergeFrom(
+          from._internal_gps());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_message()->::KismetExternal::MsgbusMessage::MergeFrom(
+          from._internal_message());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_packet()->::KismetDatasource::SubPacket::MergeFrom(
+          from._internal_packet());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_signal()->::KismetDatasource::SubSignal::MergeFrom(
+          from._internal_signal());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_spectrum()->::KismetDatasource::SubSpectrum::MergeFrom(
+          from._internal_spectrum());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_json()->::KismetDatasource::SubJson::MergeFrom(
+          from._internal_json());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_buffer()->::KismetDatasource::SubBuffer::MergeFrom(
+          from._internal_buffer());
+    }
+  }
+  if (cached_has_bits & 0x00000100u) {
+    _this->_internal_set_high_prec_time(from._internal_high_prec_time());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void DataReport::CopyFrom(const DataReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.DataReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DataReport::IsInitialized() const {
+  if (_internal_has_gps()) {
+    if (!_impl_.gps_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  if (_internal_has_packet()) {
+    if (!_impl_.packet_->IsInitialized()) return false;
+  }
+  if (_internal_has_json()) {
+    if (!_impl_.json_->IsInitialized()) return false;
+  }
+  if (_internal_has_buffer()) {
+    if (!_impl_.buffer_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void DataReport::InternalSwap(DataReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.warning_, lhs_arena,
+      &other->_impl_.warning_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DataReport, _impl_.high_prec_time_)
+      + sizeof(DataReport::_impl_.high_prec_time_)
+      - PROTOBUF_FIELD_OFFSET(DataReport, _impl_.gps_)>(
+          reinterpret_cast<char*>(&_impl_.gps_),
+          reinterpret_cast<char*>(&other->_impl_.gps_));
+}
+
+std::string DataReport::GetTypeName() const {
+  return "KismetDatasource.DataReport";
+}
+
+
+// ===================================================================
+
+class ErrorReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ErrorReport>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubSuccess& success(const ErrorReport* msg);
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::KismetExternal::MsgbusMessage& message(const ErrorReport* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::KismetDatasource::SubSuccess&
+ErrorReport::_Internal::success(const ErrorReport* msg) {
+  return *msg->_impl_.success_;
+}
+const ::KismetExternal::MsgbusMessage&
+ErrorReport::_Internal::message(const ErrorReport* msg) {
+  return *msg->_impl_.message_;
+}
+void ErrorReport::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+ErrorReport::ErrorReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.ErrorReport)
+}
+ErrorReport::ErrorReport(const ErrorReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ErrorReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.message_){nullptr}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_success()) {
+    _this->_impl_.success_ = new ::KismetDatasource::SubSuccess(*from._impl_.success_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::KismetExternal::MsgbusMessage(*from._impl_.message_);
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.ErrorReport)
+}
+
+inline void ErrorReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+  };
+}
+
+ErrorReport::~ErrorReport() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.ErrorReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ErrorReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.success_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void ErrorReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ErrorReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.ErrorReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.success_ != nullptr);
+      _impl_.success_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ErrorReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .KismetDatasource.SubSuccess success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_success(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetExternal.MsgbusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ErrorReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.ErrorReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::success(this),
+        _Internal::success(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.ErrorReport)
+  return target;
+}
+
+size_t ErrorReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.ErrorReport)
+  size_t total_size = 0;
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (_internal_has_success()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.success_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ErrorReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ErrorReport*>(
+      &from));
+}
+
+void ErrorReport::MergeFrom(const ErrorReport& from) {
+  ErrorReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.ErrorReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_success()->::KismetDatasource::SubSuccess::MergeFrom(
+          from._internal_success());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_message()->::KismetExternal::MsgbusMessage::MergeFrom(
+          from._internal_message());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ErrorReport::CopyFrom(const ErrorReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.ErrorReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ErrorReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_success()) {
+    if (!_impl_.success_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ErrorReport::InternalSwap(ErrorReport* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ErrorReport, _impl_.message_)
+      + sizeof(ErrorReport::_impl_.message_)
+      - PROTOBUF_FIELD_OFFSET(ErrorReport, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+std::string ErrorReport::GetTypeName() const {
+  return "KismetDatasource.ErrorReport";
+}
+
+
+// ===================================================================
+
+class ListInterfaces::_Internal {
+ public:
+};
+
+ListInterfaces::ListInterfaces(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.ListInterfaces)
+}
+ListInterfaces::ListInterfaces(const ListInterfaces& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ListInterfaces* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.ListInterfaces)
+}
+
+inline void ListInterfaces::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ListInterfaces::~ListInterfaces() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.ListInterfaces)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ListInterfaces::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void ListInterfaces::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ListInterfaces::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.ListInterfaces)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ListInterfaces::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ListInterfaces::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.ListInterfaces)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.ListInterfaces)
+  return target;
+}
+
+size_t ListInterfaces::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.ListInterfaces)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ListInterfaces::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ListInterfaces*>(
+      &from));
+}
+
+void ListInterfaces::MergeFrom(const ListInterfaces& from) {
+  ListInterfaces* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.ListInterfaces)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ListInterfaces::CopyFrom(const ListInterfaces& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.ListInterfaces)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ListInterfaces::IsInitialized() const {
+  return true;
+}
+
+void ListInterfaces::InternalSwap(ListInterfaces* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+}
+
+std::string ListInterfaces::GetTypeName() const {
+  return "KismetDatasource.ListInterfaces";
+}
+
+
+// ===================================================================
+
+class InterfacesReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<InterfacesReport>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubSuccess& success(const InterfacesReport* msg);
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::KismetExternal::MsgbusMessage& message(const InterfacesReport* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+const ::KismetDatasource::SubSuccess&
+InterfacesReport::_Internal::success(const InterfacesReport* msg) {
+  return *msg->_impl_.success_;
+}
+const ::KismetExternal::MsgbusMessage&
+InterfacesReport::_Internal::message(const InterfacesReport* msg) {
+  return *msg->_impl_.message_;
+}
+void InterfacesReport::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+InterfacesReport::InterfacesReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.InterfacesReport)
+}
+InterfacesReport::InterfacesReport(const InterfacesReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  InterfacesReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.interfaces_){from._impl_.interfaces_}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.message_){nullptr}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  if (from._internal_has_success()) {
+    _this->_impl_.success_ = new ::KismetDatasource::SubSuccess(*from._impl_.success_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::KismetExternal::MsgbusMessage(*from._impl_.message_);
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.InterfacesReport)
+}
+
+inline void InterfacesReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.interfaces_){arena}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+  };
+}
+
+InterfacesReport::~InterfacesReport() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.InterfacesReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void InterfacesReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.interfaces_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.success_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+}
+
+void InterfacesReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void InterfacesReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.InterfacesReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.interfaces_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      GOOGLE_DCHECK(_impl_.success_ != nullptr);
+      _impl_.success_->Clear();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* InterfacesReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .KismetDatasource.SubSuccess success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_success(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetExternal.MsgbusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .KismetDatasource.SubInterface interfaces = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_interfaces(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* InterfacesReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.InterfacesReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::success(this),
+        _Internal::success(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .KismetDatasource.SubInterface interfaces = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_interfaces_size()); i < n; i++) {
+    const auto& repfield = this->_internal_interfaces(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.InterfacesReport)
+  return target;
+}
+
+size_t InterfacesReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.InterfacesReport)
+  size_t total_size = 0;
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (_internal_has_success()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.success_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .KismetDatasource.SubInterface interfaces = 3;
+  total_size += 1UL * this->_internal_interfaces_size();
+  for (const auto& msg : this->_impl_.interfaces_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.message_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void InterfacesReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const InterfacesReport*>(
+      &from));
+}
+
+void InterfacesReport::MergeFrom(const InterfacesReport& from) {
+  InterfacesReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.InterfacesReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.interfaces_.MergeFrom(from._impl_.interfaces_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_mutable_success()->::KismetDatasource::SubSuccess::MergeFrom(
+          from._internal_success());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_message()->::KismetExternal::MsgbusMessage::MergeFrom(
+          from._internal_message());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void InterfacesReport::CopyFrom(const InterfacesReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.InterfacesReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool InterfacesReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(_impl_.interfaces_))
+    return false;
+  if (_internal_has_success()) {
+    if (!_impl_.success_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void InterfacesReport::InternalSwap(InterfacesReport* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.interfaces_.InternalSwap(&other->_impl_.interfaces_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(InterfacesReport, _impl_.message_)
+      + sizeof(InterfacesReport::_impl_.message_)
+      - PROTOBUF_FIELD_OFFSET(InterfacesReport, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+std::string InterfacesReport::GetTypeName() const {
+  return "KismetDatasource.InterfacesReport";
+}
+
+
+// ===================================================================
+
+class NewSource::_Internal {
+ public:
+  using HasBits = decltype(std::declval<NewSource>()._impl_._has_bits_);
+  static void set_has_definition(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_sourcetype(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_uuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000007) ^ 0x00000007) != 0;
+  }
+};
+
+NewSource::NewSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.NewSource)
+}
+NewSource::NewSource(const NewSource& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  NewSource* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.definition_){}
+    , decltype(_impl_.sourcetype_){}
+    , decltype(_impl_.uuid_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.definition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_definition()) {
+    _this->_impl_.definition_.Set(from._internal_definition(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.sourcetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sourcetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_sourcetype()) {
+    _this->_impl_.sourcetype_.Set(from._internal_sourcetype(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uuid()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.NewSource)
+}
+
+inline void NewSource::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.definition_){}
+    , decltype(_impl_.sourcetype_){}
+    , decltype(_impl_.uuid_){}
+  };
+  _impl_.definition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.sourcetype_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sourcetype_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NewSource::~NewSource() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.NewSource)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NewSource::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.definition_.Destroy();
+  _impl_.sourcetype_.Destroy();
+  _impl_.uuid_.Destroy();
+}
+
+void NewSource::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NewSource::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.NewSource)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.definition_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.sourcetype_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.uuid_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* NewSource::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string definition = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_definition();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string sourcetype = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_sourcetype();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string uuid = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NewSource::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.NewSource)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string definition = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_definition(), target);
+  }
+
+  // required string sourcetype = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_sourcetype(), target);
+  }
+
+  // required string uuid = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_uuid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.NewSource)
+  return target;
+}
+
+size_t NewSource::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetDatasource.NewSource)
+  size_t total_size = 0;
+
+  if (_internal_has_definition()) {
+    // required string definition = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_definition());
+  }
+
+  if (_internal_has_sourcetype()) {
+    // required string sourcetype = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sourcetype());
+  }
+
+  if (_internal_has_uuid()) {
+    // required string uuid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
+  }
+
+  return total_size;
+}
+size_t NewSource::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.NewSource)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000007) ^ 0x00000007) == 0) {  // All required fields are present.
+    // required string definition = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_definition());
+
+    // required string sourcetype = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sourcetype());
+
+    // required string uuid = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_uuid());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void NewSource::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const NewSource*>(
+      &from));
+}
+
+void NewSource::MergeFrom(const NewSource& from) {
+  NewSource* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.NewSource)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_definition(from._internal_definition());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_sourcetype(from._internal_sourcetype());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_uuid(from._internal_uuid());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void NewSource::CopyFrom(const NewSource& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.NewSource)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NewSource::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void NewSource::InternalSwap(NewSource* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.definition_, lhs_arena,
+      &other->_impl_.definition_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sourcetype_, lhs_arena,
+      &other->_impl_.sourcetype_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+}
+
+std::string NewSource::GetTypeName() const {
+  return "KismetDatasource.NewSource";
+}
+
+
+// ===================================================================
+
+class OpenSource::_Internal {
+ public:
+  using HasBits = decltype(std::declval<OpenSource>()._impl_._has_bits_);
+  static void set_has_definition(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+OpenSource::OpenSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.OpenSource)
+}
+OpenSource::OpenSource(const OpenSource& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  OpenSource* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.definition_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.definition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_definition()) {
+    _this->_impl_.definition_.Set(from._internal_definition(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.OpenSource)
+}
+
+inline void OpenSource::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.definition_){}
+  };
+  _impl_.definition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OpenSource::~OpenSource() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.OpenSource)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OpenSource::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.definition_.Destroy();
+}
+
+void OpenSource::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OpenSource::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.OpenSource)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.definition_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* OpenSource::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string definition = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_definition();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OpenSource::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.OpenSource)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string definition = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_definition(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.OpenSource)
+  return target;
+}
+
+size_t OpenSource::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.OpenSource)
+  size_t total_size = 0;
+
+  // required string definition = 1;
+  if (_internal_has_definition()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_definition());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void OpenSource::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const OpenSource*>(
+      &from));
+}
+
+void OpenSource::MergeFrom(const OpenSource& from) {
+  OpenSource* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.OpenSource)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_definition()) {
+    _this->_internal_set_definition(from._internal_definition());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void OpenSource::CopyFrom(const OpenSource& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.OpenSource)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OpenSource::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void OpenSource::InternalSwap(OpenSource* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.definition_, lhs_arena,
+      &other->_impl_.definition_, rhs_arena
+  );
+}
+
+std::string OpenSource::GetTypeName() const {
+  return "KismetDatasource.OpenSource";
+}
+
+
+// ===================================================================
+
+class OpenSourceReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<OpenSourceReport>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubSuccess& success(const OpenSourceReport* msg);
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_dlt(HasBits* has_bits) {
+    (*has_bits)[0] |= 1024u;
+  }
+  static void set_has_capture_interface(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::KismetDatasource::SubChannels& channels(const OpenSourceReport* msg);
+  static void set_has_channels(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static const ::KismetDatasource::SubChanset& channel(const OpenSourceReport* msg);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static const ::KismetDatasource::SubChanhop& hop_config(const OpenSourceReport* msg);
+  static void set_has_hop_config(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static void set_has_hardware(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::KismetExternal::MsgbusMessage& message(const OpenSourceReport* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static const ::KismetDatasource::SubSpecset& spectrum(const OpenSourceReport* msg);
+  static void set_has_spectrum(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_uuid(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_warning(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000010) ^ 0x00000010) != 0;
+  }
+};
+
+const ::KismetDatasource::SubSuccess&
+OpenSourceReport::_Internal::success(const OpenSourceReport* msg) {
+  return *msg->_impl_.success_;
+}
+const ::KismetDatasource::SubChannels&
+OpenSourceReport::_Internal::channels(const OpenSourceReport* msg) {
+  return *msg->_impl_.channels_;
+}
+const ::KismetDatasource::SubChanset&
+OpenSourceReport::_Internal::channel(const OpenSourceReport* msg) {
+  return *msg->_impl_.channel_;
+}
+const ::KismetDatasource::SubChanhop&
+OpenSourceReport::_Internal::hop_config(const OpenSourceReport* msg) {
+  return *msg->_impl_.hop_config_;
+}
+const ::KismetExternal::MsgbusMessage&
+OpenSourceReport::_Internal::message(const OpenSourceReport* msg) {
+  return *msg->_impl_.message_;
+}
+const ::KismetDatasource::SubSpecset&
+OpenSourceReport::_Internal::spectrum(const OpenSourceReport* msg) {
+  return *msg->_impl_.spectrum_;
+}
+void OpenSourceReport::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+OpenSourceReport::OpenSourceReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.OpenSourceReport)
+}
+OpenSourceReport::OpenSourceReport(const OpenSourceReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  OpenSourceReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.capture_interface_){}
+    , decltype(_impl_.hardware_){}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.channels_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.hop_config_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}
+    , decltype(_impl_.dlt_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.capture_interface_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.capture_interface_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_capture_interface()) {
+    _this->_impl_.capture_interface_.Set(from._internal_capture_interface(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.hardware_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hardware()) {
+    _this->_impl_.hardware_.Set(from._internal_hardware(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_uuid()) {
+    _this->_impl_.uuid_.Set(from._internal_uuid(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_warning()) {
+    _this->_impl_.warning_.Set(from._internal_warning(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_success()) {
+    _this->_impl_.success_ = new ::KismetDatasource::SubSuccess(*from._impl_.success_);
+  }
+  if (from._internal_has_channels()) {
+    _this->_impl_.channels_ = new ::KismetDatasource::SubChannels(*from._impl_.channels_);
+  }
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_ = new ::KismetDatasource::SubChanset(*from._impl_.channel_);
+  }
+  if (from._internal_has_hop_config()) {
+    _this->_impl_.hop_config_ = new ::KismetDatasource::SubChanhop(*from._impl_.hop_config_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::KismetExternal::MsgbusMessage(*from._impl_.message_);
+  }
+  if (from._internal_has_spectrum()) {
+    _this->_impl_.spectrum_ = new ::KismetDatasource::SubSpecset(*from._impl_.spectrum_);
+  }
+  _this->_impl_.dlt_ = from._impl_.dlt_;
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.OpenSourceReport)
+}
+
+inline void OpenSourceReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.capture_interface_){}
+    , decltype(_impl_.hardware_){}
+    , decltype(_impl_.uuid_){}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.channels_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.hop_config_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}
+    , decltype(_impl_.dlt_){0u}
+  };
+  _impl_.capture_interface_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.capture_interface_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.hardware_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.uuid_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+OpenSourceReport::~OpenSourceReport() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.OpenSourceReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OpenSourceReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.capture_interface_.Destroy();
+  _impl_.hardware_.Destroy();
+  _impl_.uuid_.Destroy();
+  _impl_.warning_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.success_;
+  if (this != internal_default_instance()) delete _impl_.channels_;
+  if (this != internal_default_instance()) delete _impl_.channel_;
+  if (this != internal_default_instance()) delete _impl_.hop_config_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+  if (this != internal_default_instance()) delete _impl_.spectrum_;
+}
+
+void OpenSourceReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OpenSourceReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.OpenSourceReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.capture_interface_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.hardware_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _impl_.uuid_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _impl_.warning_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.success_ != nullptr);
+      _impl_.success_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.channels_ != nullptr);
+      _impl_.channels_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(_impl_.channel_ != nullptr);
+      _impl_.channel_->Clear();
+    }
+    if (cached_has_bits & 0x00000080u) {
+      GOOGLE_DCHECK(_impl_.hop_config_ != nullptr);
+      _impl_.hop_config_->Clear();
+    }
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+    if (cached_has_bits & 0x00000200u) {
+      GOOGLE_DCHECK(_impl_.spectrum_ != nullptr);
+      _impl_.spectrum_->Clear();
+    }
+  }
+  _impl_.dlt_ = 0u;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* OpenSourceReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .KismetDatasource.SubSuccess success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_success(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 dlt = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_dlt(&has_bits);
+          _impl_.dlt_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string capture_interface = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_capture_interface();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChannels channels = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channels(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChanset channel = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChanhop hop_config = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hop_config(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string hardware = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_hardware();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetExternal.MsgbusMessage message = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubSpecset spectrum = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spectrum(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string uuid = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_uuid();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string warning = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_warning();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OpenSourceReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.OpenSourceReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::success(this),
+        _Internal::success(this).GetCachedSize(), target, stream);
+  }
+
+  // optional uint32 dlt = 2;
+  if (cached_has_bits & 0x00000400u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_dlt(), target);
+  }
+
+  // optional string capture_interface = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_capture_interface(), target);
+  }
+
+  // optional .KismetDatasource.SubChannels channels = 4;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::channels(this),
+        _Internal::channels(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubChanset channel = 5;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::channel(this),
+        _Internal::channel(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubChanhop hop_config = 6;
+  if (cached_has_bits & 0x00000080u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::hop_config(this),
+        _Internal::hop_config(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string hardware = 7;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteStringMaybeAliased(
+        7, this->_internal_hardware(), target);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 8;
+  if (cached_has_bits & 0x00000100u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubSpecset spectrum = 9;
+  if (cached_has_bits & 0x00000200u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::spectrum(this),
+        _Internal::spectrum(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string uuid = 10;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->WriteStringMaybeAliased(
+        10, this->_internal_uuid(), target);
+  }
+
+  // optional string warning = 11;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_warning(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.OpenSourceReport)
+  return target;
+}
+
+size_t OpenSourceReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.OpenSourceReport)
+  size_t total_size = 0;
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (_internal_has_success()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.success_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string capture_interface = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_capture_interface());
+    }
+
+    // optional string hardware = 7;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_hardware());
+    }
+
+    // optional string uuid = 10;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_uuid());
+    }
+
+    // optional string warning = 11;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_warning());
+    }
+
+  }
+  if (cached_has_bits & 0x000000e0u) {
+    // optional .KismetDatasource.SubChannels channels = 4;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channels_);
+    }
+
+    // optional .KismetDatasource.SubChanset channel = 5;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channel_);
+    }
+
+    // optional .KismetDatasource.SubChanhop hop_config = 6;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.hop_config_);
+    }
+
+  }
+  if (cached_has_bits & 0x00000700u) {
+    // optional .KismetExternal.MsgbusMessage message = 8;
+    if (cached_has_bits & 0x00000100u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_);
+    }
+
+    // optional .KismetDatasource.SubSpecset spectrum = 9;
+    if (cached_has_bits & 0x00000200u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.spectrum_);
+    }
+
+    // optional uint32 dlt = 2;
+    if (cached_has_bits & 0x00000400u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dlt());
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void OpenSourceReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const OpenSourceReport*>(
+      &from));
+}
+
+void OpenSourceReport::MergeFrom(const OpenSourceReport& from) {
+  OpenSourceReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.OpenSourceReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_capture_interface(from._internal_capture_interface());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_hardware(from._internal_hardware());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_set_uuid(from._internal_uuid());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_set_warning(from._internal_warning());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_success()->::KismetDatasource::SubSuccess::MergeFrom(
+          from._internal_success());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_channels()->::KismetDatasource::SubChannels::MergeFrom(
+          from._internal_channels());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _this->_internal_mutable_channel()->::KismetDatasource::SubChanset::MergeFrom(
+          from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      _this->_internal_mutable_hop_config()->::KismetDatasource::SubChanhop::MergeFrom(
+          from._internal_hop_config());
+    }
+  }
+  if (cached_has_bits & 0x00000700u) {
+    if (cached_has_bits & 0x00000100u) {
+      _this->_internal_mutable_message()->::KismetExternal::MsgbusMessage::MergeFrom(
+          from._internal_message());
+    }
+    if (cached_has_bits & 0x00000200u) {
+      _this->_internal_mutable_spectrum()->::KismetDatasource::SubSpecset::MergeFrom(
+          from._internal_spectrum());
+    }
+    if (cached_has_bits & 0x00000400u) {
+      _this->_impl_.dlt_ = from._impl_.dlt_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void OpenSourceReport::CopyFrom(const OpenSourceReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.OpenSourceReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OpenSourceReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_success()) {
+    if (!_impl_.success_->IsInitialized()) return false;
+  }
+  if (_internal_has_channel()) {
+    if (!_impl_.channel_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void OpenSourceReport::InternalSwap(OpenSourceReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.capture_interface_, lhs_arena,
+      &other->_impl_.capture_interface_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hardware_, lhs_arena,
+      &other->_impl_.hardware_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.uuid_, lhs_arena,
+      &other->_impl_.uuid_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.warning_, lhs_arena,
+      &other->_impl_.warning_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OpenSourceReport, _impl_.dlt_)
+      + sizeof(OpenSourceReport::_impl_.dlt_)
+      - PROTOBUF_FIELD_OFFSET(OpenSourceReport, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+std::string OpenSourceReport::GetTypeName() const {
+  return "KismetDatasource.OpenSourceReport";
+}
+
+
+// ===================================================================
+
+class ProbeSource::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProbeSource>()._impl_._has_bits_);
+  static void set_has_definition(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+ProbeSource::ProbeSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.ProbeSource)
+}
+ProbeSource::ProbeSource(const ProbeSource& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ProbeSource* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.definition_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.definition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_definition()) {
+    _this->_impl_.definition_.Set(from._internal_definition(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.ProbeSource)
+}
+
+inline void ProbeSource::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.definition_){}
+  };
+  _impl_.definition_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ProbeSource::~ProbeSource() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.ProbeSource)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProbeSource::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.definition_.Destroy();
+}
+
+void ProbeSource::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProbeSource::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.ProbeSource)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.definition_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ProbeSource::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string definition = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_definition();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProbeSource::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.ProbeSource)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string definition = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_definition(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.ProbeSource)
+  return target;
+}
+
+size_t ProbeSource::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.ProbeSource)
+  size_t total_size = 0;
+
+  // required string definition = 1;
+  if (_internal_has_definition()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_definition());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ProbeSource::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ProbeSource*>(
+      &from));
+}
+
+void ProbeSource::MergeFrom(const ProbeSource& from) {
+  ProbeSource* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.ProbeSource)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_definition()) {
+    _this->_internal_set_definition(from._internal_definition());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ProbeSource::CopyFrom(const ProbeSource& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.ProbeSource)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProbeSource::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void ProbeSource::InternalSwap(ProbeSource* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.definition_, lhs_arena,
+      &other->_impl_.definition_, rhs_arena
+  );
+}
+
+std::string ProbeSource::GetTypeName() const {
+  return "KismetDatasource.ProbeSource";
+}
+
+
+// ===================================================================
+
+class ProbeSourceReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ProbeSourceReport>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubSuccess& success(const ProbeSourceReport* msg);
+  static void set_has_success(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::KismetExternal::MsgbusMessage& message(const ProbeSourceReport* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static const ::KismetDatasource::SubChannels& channels(const ProbeSourceReport* msg);
+  static void set_has_channels(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::KismetDatasource::SubChanset& channel(const ProbeSourceReport* msg);
+  static void set_has_channel(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static const ::KismetDatasource::SubSpecset& spectrum(const ProbeSourceReport* msg);
+  static void set_has_spectrum(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_hardware(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000002) ^ 0x00000002) != 0;
+  }
+};
+
+const ::KismetDatasource::SubSuccess&
+ProbeSourceReport::_Internal::success(const ProbeSourceReport* msg) {
+  return *msg->_impl_.success_;
+}
+const ::KismetExternal::MsgbusMessage&
+ProbeSourceReport::_Internal::message(const ProbeSourceReport* msg) {
+  return *msg->_impl_.message_;
+}
+const ::KismetDatasource::SubChannels&
+ProbeSourceReport::_Internal::channels(const ProbeSourceReport* msg) {
+  return *msg->_impl_.channels_;
+}
+const ::KismetDatasource::SubChanset&
+ProbeSourceReport::_Internal::channel(const ProbeSourceReport* msg) {
+  return *msg->_impl_.channel_;
+}
+const ::KismetDatasource::SubSpecset&
+ProbeSourceReport::_Internal::spectrum(const ProbeSourceReport* msg) {
+  return *msg->_impl_.spectrum_;
+}
+void ProbeSourceReport::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+ProbeSourceReport::ProbeSourceReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.ProbeSourceReport)
+}
+ProbeSourceReport::ProbeSourceReport(const ProbeSourceReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  ProbeSourceReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hardware_){}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.channels_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.hardware_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hardware()) {
+    _this->_impl_.hardware_.Set(from._internal_hardware(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_success()) {
+    _this->_impl_.success_ = new ::KismetDatasource::SubSuccess(*from._impl_.success_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::KismetExternal::MsgbusMessage(*from._impl_.message_);
+  }
+  if (from._internal_has_channels()) {
+    _this->_impl_.channels_ = new ::KismetDatasource::SubChannels(*from._impl_.channels_);
+  }
+  if (from._internal_has_channel()) {
+    _this->_impl_.channel_ = new ::KismetDatasource::SubChanset(*from._impl_.channel_);
+  }
+  if (from._internal_has_spectrum()) {
+    _this->_impl_.spectrum_ = new ::KismetDatasource::SubSpecset(*from._impl_.spectrum_);
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.ProbeSourceReport)
+}
+
+inline void ProbeSourceReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.hardware_){}
+    , decltype(_impl_.success_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.channels_){nullptr}
+    , decltype(_impl_.channel_){nullptr}
+    , decltype(_impl_.spectrum_){nullptr}
+  };
+  _impl_.hardware_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ProbeSourceReport::~ProbeSourceReport() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.ProbeSourceReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ProbeSourceReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.hardware_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.success_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+  if (this != internal_default_instance()) delete _impl_.channels_;
+  if (this != internal_default_instance()) delete _impl_.channel_;
+  if (this != internal_default_instance()) delete _impl_.spectrum_;
+}
+
+void ProbeSourceReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ProbeSourceReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.ProbeSourceReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.hardware_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.success_ != nullptr);
+      _impl_.success_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.channels_ != nullptr);
+      _impl_.channels_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.channel_ != nullptr);
+      _impl_.channel_->Clear();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(_impl_.spectrum_ != nullptr);
+      _impl_.spectrum_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* ProbeSourceReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required .KismetDatasource.SubSuccess success = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_success(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetExternal.MsgbusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChannels channels = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channels(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubChanset channel = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_channel(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubSpecset spectrum = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_spectrum(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string hardware = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_hardware();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ProbeSourceReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.ProbeSourceReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::success(this),
+        _Internal::success(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubChannels channels = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::channels(this),
+        _Internal::channels(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubChanset channel = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::channel(this),
+        _Internal::channel(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetDatasource.SubSpecset spectrum = 5;
+  if (cached_has_bits & 0x00000020u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::spectrum(this),
+        _Internal::spectrum(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string hardware = 6;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_hardware(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.ProbeSourceReport)
+  return target;
+}
+
+size_t ProbeSourceReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.ProbeSourceReport)
+  size_t total_size = 0;
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  if (_internal_has_success()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.success_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // optional string hardware = 6;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_hardware());
+  }
+
+  if (cached_has_bits & 0x0000003cu) {
+    // optional .KismetExternal.MsgbusMessage message = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_);
+    }
+
+    // optional .KismetDatasource.SubChannels channels = 3;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channels_);
+    }
+
+    // optional .KismetDatasource.SubChanset channel = 4;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.channel_);
+    }
+
+    // optional .KismetDatasource.SubSpecset spectrum = 5;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.spectrum_);
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void ProbeSourceReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const ProbeSourceReport*>(
+      &from));
+}
+
+void ProbeSourceReport::MergeFrom(const ProbeSourceReport& from) {
+  ProbeSourceReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.ProbeSourceReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_hardware(from._internal_hardware());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_success()->::KismetDatasource::SubSuccess::MergeFrom(
+          from._internal_success());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_message()->::KismetExternal::MsgbusMessage::MergeFrom(
+          from._internal_message());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_channels()->::KismetDatasource::SubChannels::MergeFrom(
+          from._internal_channels());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_channel()->::KismetDatasource::SubChanset::MergeFrom(
+          from._internal_channel());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_internal_mutable_spectrum()->::KismetDatasource::SubSpecset::MergeFrom(
+          from._internal_spectrum());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void ProbeSourceReport::CopyFrom(const ProbeSourceReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.ProbeSourceReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ProbeSourceReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_success()) {
+    if (!_impl_.success_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  if (_internal_has_channel()) {
+    if (!_impl_.channel_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void ProbeSourceReport::InternalSwap(ProbeSourceReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.hardware_, lhs_arena,
+      &other->_impl_.hardware_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ProbeSourceReport, _impl_.spectrum_)
+      + sizeof(ProbeSourceReport::_impl_.spectrum_)
+      - PROTOBUF_FIELD_OFFSET(ProbeSourceReport, _impl_.success_)>(
+          reinterpret_cast<char*>(&_impl_.success_),
+          reinterpret_cast<char*>(&other->_impl_.success_));
+}
+
+std::string ProbeSourceReport::GetTypeName() const {
+  return "KismetDatasource.ProbeSourceReport";
+}
+
+
+// ===================================================================
+
+class WarningReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<WarningReport>()._impl_._has_bits_);
+  static void set_has_warning(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+WarningReport::WarningReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetDatasource.WarningReport)
+}
+WarningReport::WarningReport(const WarningReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  WarningReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_warning()) {
+    _this->_impl_.warning_.Set(from._internal_warning(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetDatasource.WarningReport)
+}
+
+inline void WarningReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}
+  };
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+WarningReport::~WarningReport() {
+  // @@protoc_insertion_point(destructor:KismetDatasource.WarningReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void WarningReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.warning_.Destroy();
+}
+
+void WarningReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void WarningReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetDatasource.WarningReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.warning_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* WarningReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string warning = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_warning();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* WarningReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetDatasource.WarningReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string warning = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_warning(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetDatasource.WarningReport)
+  return target;
+}
+
+size_t WarningReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetDatasource.WarningReport)
+  size_t total_size = 0;
+
+  // required string warning = 1;
+  if (_internal_has_warning()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_warning());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void WarningReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const WarningReport*>(
+      &from));
+}
+
+void WarningReport::MergeFrom(const WarningReport& from) {
+  WarningReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetDatasource.WarningReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_warning()) {
+    _this->_internal_set_warning(from._internal_warning());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void WarningReport::CopyFrom(const WarningReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetDatasource.WarningReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool WarningReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void WarningReport::InternalSwap(WarningReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.warning_, lhs_arena,
+      &other->_impl_.warning_, rhs_arena
+  );
+}
+
+std::string WarningReport::GetTypeName() const {
+  return "KismetDatasource.WarningReport";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace KismetDatasource
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubChannels*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubChannels >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubChannels >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubChanset*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubChanset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubChanset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubChanhop*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubChanhop >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubChanhop >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubGps*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubGps >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubGps >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubInterface*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubInterface >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubInterface >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubPacket*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubPacket >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubPacket >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubJson*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubJson >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubJson >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubBuffer*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubBuffer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubBuffer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubSignal*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubSignal >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubSignal >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubSpecset*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubSpecset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubSpecset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubSpectrum*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubSpectrum >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubSpectrum >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::SubSuccess*
+Arena::CreateMaybeMessage< ::KismetDatasource::SubSuccess >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::SubSuccess >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::CloseDatasource*
+Arena::CreateMaybeMessage< ::KismetDatasource::CloseDatasource >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::CloseDatasource >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::Configure*
+Arena::CreateMaybeMessage< ::KismetDatasource::Configure >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::Configure >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::ConfigureReport*
+Arena::CreateMaybeMessage< ::KismetDatasource::ConfigureReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::ConfigureReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::DataReport*
+Arena::CreateMaybeMessage< ::KismetDatasource::DataReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::DataReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::ErrorReport*
+Arena::CreateMaybeMessage< ::KismetDatasource::ErrorReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::ErrorReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::ListInterfaces*
+Arena::CreateMaybeMessage< ::KismetDatasource::ListInterfaces >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::ListInterfaces >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::InterfacesReport*
+Arena::CreateMaybeMessage< ::KismetDatasource::InterfacesReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::InterfacesReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::NewSource*
+Arena::CreateMaybeMessage< ::KismetDatasource::NewSource >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::NewSource >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::OpenSource*
+Arena::CreateMaybeMessage< ::KismetDatasource::OpenSource >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::OpenSource >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::OpenSourceReport*
+Arena::CreateMaybeMessage< ::KismetDatasource::OpenSourceReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::OpenSourceReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::ProbeSource*
+Arena::CreateMaybeMessage< ::KismetDatasource::ProbeSource >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::ProbeSource >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::ProbeSourceReport*
+Arena::CreateMaybeMessage< ::KismetDatasource::ProbeSourceReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::ProbeSourceReport >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetDatasource::WarningReport*
+Arena::CreateMaybeMessage< ::KismetDatasource::WarningReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetDatasource::WarningReport >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,11191 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: datasource.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_datasource_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_datasource_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include "kismet.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_datasource_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_datasource_2eproto {
+  static const uint32_t offsets[];
+};
+namespace KismetDatasource {
+class CloseDatasource;
+struct CloseDatasourceDefaultTypeInternal;
+extern CloseDatasourceDefaultTypeInternal _CloseDatasource_default_instance_;
+class Configure;
+struct ConfigureDefaultTypeInternal;
+extern ConfigureDefaultTypeInternal _Configure_default_instance_;
+class ConfigureReport;
+struct ConfigureReportDefaultTypeInternal;
+extern ConfigureReportDefaultTypeInternal _ConfigureReport_default_instance_;
+class DataReport;
+struct DataReportDefaultTypeInternal;
+extern DataReportDefaultTypeInternal _DataReport_default_instance_;
+class ErrorReport;
+struct ErrorReportDefaultTypeInternal;
+extern ErrorReportDefaultTypeInternal _ErrorReport_default_instance_;
+class InterfacesReport;
+struct InterfacesReportDefaultTypeInternal;
+extern InterfacesReportDefaultTypeInternal _InterfacesReport_default_instance_;
+class ListInterfaces;
+struct ListInterfacesDefaultTypeInternal;
+extern ListInterfacesDefaultTypeInternal _ListInterfaces_default_instance_;
+class NewSource;
+struct NewSourceDefaultTypeInternal;
+extern NewSourceDefaultTypeInternal _NewSource_default_instance_;
+class OpenSource;
+struct OpenSourceDefaultTypeInternal;
+extern OpenSourceDefaultTypeInternal _OpenSource_default_instance_;
+class OpenSourceReport;
+struct OpenSourceReportDefaultTypeInternal;
+extern OpenSourceReportDefaultTypeInternal _OpenSourceReport_default_instance_;
+class ProbeSource;
+struct ProbeSourceDefaultTypeInternal;
+extern ProbeSourceDefaultTypeInternal _ProbeSource_default_instance_;
+class ProbeSourceReport;
+struct ProbeSourceReportDefaultTypeInternal;
+extern ProbeSourceReportDefaultTypeInternal _ProbeSourceReport_default_instance_;
+class SubBuffer;
+struct SubBufferDefaultTypeInternal;
+extern SubBufferDefaultTypeInternal _SubBuffer_default_instance_;
+class SubChanhop;
+struct SubChanhopDefaultTypeInternal;
+extern SubChanhopDefaultTypeInternal _SubChanhop_default_instance_;
+class SubChannels;
+struct SubChannelsDefaultTypeInternal;
+extern SubChannelsDefaultTypeInternal _SubChannels_default_instance_;
+class SubChanset;
+struct SubChansetDefaultTypeInternal;
+extern SubChansetDefaultTypeInternal _SubChanset_default_instance_;
+class SubGps;
+struct SubGpsDefaultTypeInternal;
+extern SubGpsDefaultTypeInternal _SubGps_default_instance_;
+class SubInterface;
+struct SubInterfaceDefaultTypeInternal;
+extern SubInterfaceDefaultTypeInternal _SubInterface_default_instance_;
+class SubJson;
+struct SubJsonDefaultTypeInternal;
+extern SubJsonDefaultTypeInternal _SubJson_default_instance_;
+class SubPacket;
+struct SubPacketDefaultTypeInternal;
+extern SubPacketDefaultTypeInternal _SubPacket_default_instance_;
+class SubSignal;
+struct SubSignalDefaultTypeInternal;
+extern SubSignalDefaultTypeInternal _SubSignal_default_instance_;
+class SubSpecset;
+struct SubSpecsetDefaultTypeInternal;
+extern SubSpecsetDefaultTypeInternal _SubSpecset_default_instance_;
+class SubSpectrum;
+struct SubSpectrumDefaultTypeInternal;
+extern SubSpectrumDefaultTypeInternal _SubSpectrum_default_instance_;
+class SubSuccess;
+struct SubSuccessDefaultTypeInternal;
+extern SubSuccessDefaultTypeInternal _SubSuccess_default_instance_;
+class WarningReport;
+struct WarningReportDefaultTypeInternal;
+extern WarningReportDefaultTypeInternal _WarningReport_default_instance_;
+}  // namespace KismetDatasource
+PROTOBUF_NAMESPACE_OPEN
+template<> ::KismetDatasource::CloseDatasource* Arena::CreateMaybeMessage<::KismetDatasource::CloseDatasource>(Arena*);
+template<> ::KismetDatasource::Configure* Arena::CreateMaybeMessage<::KismetDatasource::Configure>(Arena*);
+template<> ::KismetDatasource::ConfigureReport* Arena::CreateMaybeMessage<::KismetDatasource::ConfigureReport>(Arena*);
+template<> ::KismetDatasource::DataReport* Arena::CreateMaybeMessage<::KismetDatasource::DataReport>(Arena*);
+template<> ::KismetDatasource::ErrorReport* Arena::CreateMaybeMessage<::KismetDatasource::ErrorReport>(Arena*);
+template<> ::KismetDatasource::InterfacesReport* Arena::CreateMaybeMessage<::KismetDatasource::InterfacesReport>(Arena*);
+template<> ::KismetDatasource::ListInterfaces* Arena::CreateMaybeMessage<::KismetDatasource::ListInterfaces>(Arena*);
+template<> ::KismetDatasource::NewSource* Arena::CreateMaybeMessage<::KismetDatasource::NewSource>(Arena*);
+template<> ::KismetDatasource::OpenSource* Arena::CreateMaybeMessage<::KismetDatasource::OpenSource>(Arena*);
+template<> ::KismetDatasource::OpenSourceReport* Arena::CreateMaybeMessage<::KismetDatasource::OpenSourceReport>(Arena*);
+template<> ::KismetDatasource::ProbeSource* Arena::CreateMaybeMessage<::KismetDatasource::ProbeSource>(Arena*);
+template<> ::KismetDatasource::ProbeSourceReport* Arena::CreateMaybeMessage<::KismetDatasource::ProbeSourceReport>(Arena*);
+template<> ::KismetDatasource::SubBuffer* Arena::CreateMaybeMessage<::KismetDatasource::SubBuffer>(Arena*);
+template<> ::KismetDatasource::SubChanhop* Arena::CreateMaybeMessage<::KismetDatasource::SubChanhop>(Arena*);
+template<> ::KismetDatasource::SubChannels* Arena::CreateMaybeMessage<::KismetDatasource::SubChannels>(Arena*);
+template<> ::KismetDatasource::SubChanset* Arena::CreateMaybeMessage<::KismetDatasource::SubChanset>(Arena*);
+template<> ::KismetDatasource::SubGps* Arena::CreateMaybeMessage<::KismetDatasource::SubGps>(Arena*);
+template<> ::KismetDatasource::SubInterface* Arena::CreateMaybeMessage<::KismetDatasource::SubInterface>(Arena*);
+template<> ::KismetDatasource::SubJson* Arena::CreateMaybeMessage<::KismetDatasource::SubJson>(Arena*);
+template<> ::KismetDatasource::SubPacket* Arena::CreateMaybeMessage<::KismetDatasource::SubPacket>(Arena*);
+template<> ::KismetDatasource::SubSignal* Arena::CreateMaybeMessage<::KismetDatasource::SubSignal>(Arena*);
+template<> ::KismetDatasource::SubSpecset* Arena::CreateMaybeMessage<::KismetDatasource::SubSpecset>(Arena*);
+template<> ::KismetDatasource::SubSpectrum* Arena::CreateMaybeMessage<::KismetDatasource::SubSpectrum>(Arena*);
+template<> ::KismetDatasource::SubSuccess* Arena::CreateMaybeMessage<::KismetDatasource::SubSuccess>(Arena*);
+template<> ::KismetDatasource::WarningReport* Arena::CreateMaybeMessage<::KismetDatasource::WarningReport>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace KismetDatasource {
+
+// ===================================================================
+
+class SubChannels final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubChannels) */ {
+ public:
+  inline SubChannels() : SubChannels(nullptr) {}
+  ~SubChannels() override;
+  explicit PROTOBUF_CONSTEXPR SubChannels(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubChannels(const SubChannels& from);
+  SubChannels(SubChannels&& from) noexcept
+    : SubChannels() {
+    *this = ::std::move(from);
+  }
+
+  inline SubChannels& operator=(const SubChannels& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubChannels& operator=(SubChannels&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubChannels& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubChannels* internal_default_instance() {
+    return reinterpret_cast<const SubChannels*>(
+               &_SubChannels_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(SubChannels& a, SubChannels& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubChannels* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubChannels* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubChannels* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubChannels>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubChannels& from);
+  void MergeFrom(const SubChannels& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubChannels* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubChannels";
+  }
+  protected:
+  explicit SubChannels(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelsFieldNumber = 1,
+  };
+  // repeated string channels = 1;
+  int channels_size() const;
+  private:
+  int _internal_channels_size() const;
+  public:
+  void clear_channels();
+  const std::string& channels(int index) const;
+  std::string* mutable_channels(int index);
+  void set_channels(int index, const std::string& value);
+  void set_channels(int index, std::string&& value);
+  void set_channels(int index, const char* value);
+  void set_channels(int index, const char* value, size_t size);
+  std::string* add_channels();
+  void add_channels(const std::string& value);
+  void add_channels(std::string&& value);
+  void add_channels(const char* value);
+  void add_channels(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& channels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_channels();
+  private:
+  const std::string& _internal_channels(int index) const;
+  std::string* _internal_add_channels();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubChannels)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> channels_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubChanset final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubChanset) */ {
+ public:
+  inline SubChanset() : SubChanset(nullptr) {}
+  ~SubChanset() override;
+  explicit PROTOBUF_CONSTEXPR SubChanset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubChanset(const SubChanset& from);
+  SubChanset(SubChanset&& from) noexcept
+    : SubChanset() {
+    *this = ::std::move(from);
+  }
+
+  inline SubChanset& operator=(const SubChanset& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubChanset& operator=(SubChanset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubChanset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubChanset* internal_default_instance() {
+    return reinterpret_cast<const SubChanset*>(
+               &_SubChanset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(SubChanset& a, SubChanset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubChanset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubChanset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubChanset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubChanset>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubChanset& from);
+  void MergeFrom(const SubChanset& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubChanset* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubChanset";
+  }
+  protected:
+  explicit SubChanset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+  };
+  // required string channel = 1;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubChanset)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubChanhop final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubChanhop) */ {
+ public:
+  inline SubChanhop() : SubChanhop(nullptr) {}
+  ~SubChanhop() override;
+  explicit PROTOBUF_CONSTEXPR SubChanhop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubChanhop(const SubChanhop& from);
+  SubChanhop(SubChanhop&& from) noexcept
+    : SubChanhop() {
+    *this = ::std::move(from);
+  }
+
+  inline SubChanhop& operator=(const SubChanhop& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubChanhop& operator=(SubChanhop&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubChanhop& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubChanhop* internal_default_instance() {
+    return reinterpret_cast<const SubChanhop*>(
+               &_SubChanhop_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(SubChanhop& a, SubChanhop& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubChanhop* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubChanhop* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubChanhop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubChanhop>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubChanhop& from);
+  void MergeFrom(const SubChanhop& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubChanhop* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubChanhop";
+  }
+  protected:
+  explicit SubChanhop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelsFieldNumber = 1,
+    kRateFieldNumber = 2,
+    kShuffleFieldNumber = 3,
+    kShuffleSkipFieldNumber = 4,
+    kOffsetFieldNumber = 5,
+  };
+  // repeated string channels = 1;
+  int channels_size() const;
+  private:
+  int _internal_channels_size() const;
+  public:
+  void clear_channels();
+  const std::string& channels(int index) const;
+  std::string* mutable_channels(int index);
+  void set_channels(int index, const std::string& value);
+  void set_channels(int index, std::string&& value);
+  void set_channels(int index, const char* value);
+  void set_channels(int index, const char* value, size_t size);
+  std::string* add_channels();
+  void add_channels(const std::string& value);
+  void add_channels(std::string&& value);
+  void add_channels(const char* value);
+  void add_channels(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& channels() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_channels();
+  private:
+  const std::string& _internal_channels(int index) const;
+  std::string* _internal_add_channels();
+  public:
+
+  // optional double rate = 2;
+  bool has_rate() const;
+  private:
+  bool _internal_has_rate() const;
+  public:
+  void clear_rate();
+  double rate() const;
+  void set_rate(double value);
+  private:
+  double _internal_rate() const;
+  void _internal_set_rate(double value);
+  public:
+
+  // optional bool shuffle = 3;
+  bool has_shuffle() const;
+  private:
+  bool _internal_has_shuffle() const;
+  public:
+  void clear_shuffle();
+  bool shuffle() const;
+  void set_shuffle(bool value);
+  private:
+  bool _internal_shuffle() const;
+  void _internal_set_shuffle(bool value);
+  public:
+
+  // optional uint32 shuffle_skip = 4;
+  bool has_shuffle_skip() const;
+  private:
+  bool _internal_has_shuffle_skip() const;
+  public:
+  void clear_shuffle_skip();
+  uint32_t shuffle_skip() const;
+  void set_shuffle_skip(uint32_t value);
+  private:
+  uint32_t _internal_shuffle_skip() const;
+  void _internal_set_shuffle_skip(uint32_t value);
+  public:
+
+  // optional uint32 offset = 5;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  uint32_t offset() const;
+  void set_offset(uint32_t value);
+  private:
+  uint32_t _internal_offset() const;
+  void _internal_set_offset(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubChanhop)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> channels_;
+    double rate_;
+    bool shuffle_;
+    uint32_t shuffle_skip_;
+    uint32_t offset_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubGps final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubGps) */ {
+ public:
+  inline SubGps() : SubGps(nullptr) {}
+  ~SubGps() override;
+  explicit PROTOBUF_CONSTEXPR SubGps(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubGps(const SubGps& from);
+  SubGps(SubGps&& from) noexcept
+    : SubGps() {
+    *this = ::std::move(from);
+  }
+
+  inline SubGps& operator=(const SubGps& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubGps& operator=(SubGps&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubGps& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubGps* internal_default_instance() {
+    return reinterpret_cast<const SubGps*>(
+               &_SubGps_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SubGps& a, SubGps& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubGps* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubGps* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubGps* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubGps>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubGps& from);
+  void MergeFrom(const SubGps& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubGps* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubGps";
+  }
+  protected:
+  explicit SubGps(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 10,
+    kNameFieldNumber = 11,
+    kLatFieldNumber = 1,
+    kLonFieldNumber = 2,
+    kAltFieldNumber = 3,
+    kSpeedFieldNumber = 4,
+    kHeadingFieldNumber = 5,
+    kPrecisionFieldNumber = 6,
+    kTimeSecFieldNumber = 8,
+    kTimeUsecFieldNumber = 9,
+    kHighPrecTimeFieldNumber = 12,
+    kFixFieldNumber = 7,
+  };
+  // required string type = 10;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // required string name = 11;
+  bool has_name() const;
+  private:
+  bool _internal_has_name() const;
+  public:
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // required double lat = 1;
+  bool has_lat() const;
+  private:
+  bool _internal_has_lat() const;
+  public:
+  void clear_lat();
+  double lat() const;
+  void set_lat(double value);
+  private:
+  double _internal_lat() const;
+  void _internal_set_lat(double value);
+  public:
+
+  // required double lon = 2;
+  bool has_lon() const;
+  private:
+  bool _internal_has_lon() const;
+  public:
+  void clear_lon();
+  double lon() const;
+  void set_lon(double value);
+  private:
+  double _internal_lon() const;
+  void _internal_set_lon(double value);
+  public:
+
+  // required double alt = 3;
+  bool has_alt() const;
+  private:
+  bool _internal_has_alt() const;
+  public:
+  void clear_alt();
+  double alt() const;
+  void set_alt(double value);
+  private:
+  double _internal_alt() const;
+  void _internal_set_alt(double value);
+  public:
+
+  // required double speed = 4;
+  bool has_speed() const;
+  private:
+  bool _internal_has_speed() const;
+  public:
+  void clear_speed();
+  double speed() const;
+  void set_speed(double value);
+  private:
+  double _internal_speed() const;
+  void _internal_set_speed(double value);
+  public:
+
+  // required double heading = 5;
+  bool has_heading() const;
+  private:
+  bool _internal_has_heading() const;
+  public:
+  void clear_heading();
+  double heading() const;
+  void set_heading(double value);
+  private:
+  double _internal_heading() const;
+  void _internal_set_heading(double value);
+  public:
+
+  // required double precision = 6;
+  bool has_precision() const;
+  private:
+  bool _internal_has_precision() const;
+  public:
+  void clear_precision();
+  double precision() const;
+  void set_precision(double value);
+  private:
+  double _internal_precision() const;
+  void _internal_set_precision(double value);
+  public:
+
+  // required uint64 time_sec = 8;
+  bool has_time_sec() const;
+  private:
+  bool _internal_has_time_sec() const;
+  public:
+  void clear_time_sec();
+  uint64_t time_sec() const;
+  void set_time_sec(uint64_t value);
+  private:
+  uint64_t _internal_time_sec() const;
+  void _internal_set_time_sec(uint64_t value);
+  public:
+
+  // required uint64 time_usec = 9;
+  bool has_time_usec() const;
+  private:
+  bool _internal_has_time_usec() const;
+  public:
+  void clear_time_usec();
+  uint64_t time_usec() const;
+  void set_time_usec(uint64_t value);
+  private:
+  uint64_t _internal_time_usec() const;
+  void _internal_set_time_usec(uint64_t value);
+  public:
+
+  // optional double high_prec_time = 12;
+  bool has_high_prec_time() const;
+  private:
+  bool _internal_has_high_prec_time() const;
+  public:
+  void clear_high_prec_time();
+  double high_prec_time() const;
+  void set_high_prec_time(double value);
+  private:
+  double _internal_high_prec_time() const;
+  void _internal_set_high_prec_time(double value);
+  public:
+
+  // required uint32 fix = 7;
+  bool has_fix() const;
+  private:
+  bool _internal_has_fix() const;
+  public:
+  void clear_fix();
+  uint32_t fix() const;
+  void set_fix(uint32_t value);
+  private:
+  uint32_t _internal_fix() const;
+  void _internal_set_fix(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubGps)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    double lat_;
+    double lon_;
+    double alt_;
+    double speed_;
+    double heading_;
+    double precision_;
+    uint64_t time_sec_;
+    uint64_t time_usec_;
+    double high_prec_time_;
+    uint32_t fix_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubInterface final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubInterface) */ {
+ public:
+  inline SubInterface() : SubInterface(nullptr) {}
+  ~SubInterface() override;
+  explicit PROTOBUF_CONSTEXPR SubInterface(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubInterface(const SubInterface& from);
+  SubInterface(SubInterface&& from) noexcept
+    : SubInterface() {
+    *this = ::std::move(from);
+  }
+
+  inline SubInterface& operator=(const SubInterface& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubInterface& operator=(SubInterface&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubInterface& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubInterface* internal_default_instance() {
+    return reinterpret_cast<const SubInterface*>(
+               &_SubInterface_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(SubInterface& a, SubInterface& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubInterface* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubInterface* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubInterface* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubInterface>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubInterface& from);
+  void MergeFrom(const SubInterface& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubInterface* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubInterface";
+  }
+  protected:
+  explicit SubInterface(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInterfaceFieldNumber = 1,
+    kFlagsFieldNumber = 2,
+    kHardwareFieldNumber = 3,
+    kCapinterfaceFieldNumber = 4,
+  };
+  // required string interface = 1;
+  bool has_interface() const;
+  private:
+  bool _internal_has_interface() const;
+  public:
+  void clear_interface();
+  const std::string& interface() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_interface(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_interface();
+  PROTOBUF_NODISCARD std::string* release_interface();
+  void set_allocated_interface(std::string* interface);
+  private:
+  const std::string& _internal_interface() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_interface(const std::string& value);
+  std::string* _internal_mutable_interface();
+  public:
+
+  // required string flags = 2;
+  bool has_flags() const;
+  private:
+  bool _internal_has_flags() const;
+  public:
+  void clear_flags();
+  const std::string& flags() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_flags(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_flags();
+  PROTOBUF_NODISCARD std::string* release_flags();
+  void set_allocated_flags(std::string* flags);
+  private:
+  const std::string& _internal_flags() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_flags(const std::string& value);
+  std::string* _internal_mutable_flags();
+  public:
+
+  // optional string hardware = 3;
+  bool has_hardware() const;
+  private:
+  bool _internal_has_hardware() const;
+  public:
+  void clear_hardware();
+  const std::string& hardware() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hardware(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hardware();
+  PROTOBUF_NODISCARD std::string* release_hardware();
+  void set_allocated_hardware(std::string* hardware);
+  private:
+  const std::string& _internal_hardware() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hardware(const std::string& value);
+  std::string* _internal_mutable_hardware();
+  public:
+
+  // optional string capinterface = 4;
+  bool has_capinterface() const;
+  private:
+  bool _internal_has_capinterface() const;
+  public:
+  void clear_capinterface();
+  const std::string& capinterface() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_capinterface(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_capinterface();
+  PROTOBUF_NODISCARD std::string* release_capinterface();
+  void set_allocated_capinterface(std::string* capinterface);
+  private:
+  const std::string& _internal_capinterface() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_capinterface(const std::string& value);
+  std::string* _internal_mutable_capinterface();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubInterface)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr interface_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr flags_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hardware_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr capinterface_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubPacket final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubPacket) */ {
+ public:
+  inline SubPacket() : SubPacket(nullptr) {}
+  ~SubPacket() override;
+  explicit PROTOBUF_CONSTEXPR SubPacket(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubPacket(const SubPacket& from);
+  SubPacket(SubPacket&& from) noexcept
+    : SubPacket() {
+    *this = ::std::move(from);
+  }
+
+  inline SubPacket& operator=(const SubPacket& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubPacket& operator=(SubPacket&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubPacket& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubPacket* internal_default_instance() {
+    return reinterpret_cast<const SubPacket*>(
+               &_SubPacket_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SubPacket& a, SubPacket& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubPacket* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubPacket* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubPacket* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubPacket>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubPacket& from);
+  void MergeFrom(const SubPacket& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubPacket* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubPacket";
+  }
+  protected:
+  explicit SubPacket(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 5,
+    kTimeSecFieldNumber = 1,
+    kTimeUsecFieldNumber = 2,
+    kSizeFieldNumber = 4,
+    kDltFieldNumber = 3,
+  };
+  // required bytes data = 5;
+  bool has_data() const;
+  private:
+  bool _internal_has_data() const;
+  public:
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
+  private:
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
+  public:
+
+  // required uint64 time_sec = 1;
+  bool has_time_sec() const;
+  private:
+  bool _internal_has_time_sec() const;
+  public:
+  void clear_time_sec();
+  uint64_t time_sec() const;
+  void set_time_sec(uint64_t value);
+  private:
+  uint64_t _internal_time_sec() const;
+  void _internal_set_time_sec(uint64_t value);
+  public:
+
+  // required uint64 time_usec = 2;
+  bool has_time_usec() const;
+  private:
+  bool _internal_has_time_usec() const;
+  public:
+  void clear_time_usec();
+  uint64_t time_usec() const;
+  void set_time_usec(uint64_t value);
+  private:
+  uint64_t _internal_time_usec() const;
+  void _internal_set_time_usec(uint64_t value);
+  public:
+
+  // required uint64 size = 4;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // required uint32 dlt = 3;
+  bool has_dlt() const;
+  private:
+  bool _internal_has_dlt() const;
+  public:
+  void clear_dlt();
+  uint32_t dlt() const;
+  void set_dlt(uint32_t value);
+  private:
+  uint32_t _internal_dlt() const;
+  void _internal_set_dlt(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubPacket)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+    uint64_t time_sec_;
+    uint64_t time_usec_;
+    uint64_t size_;
+    uint32_t dlt_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubJson final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubJson) */ {
+ public:
+  inline SubJson() : SubJson(nullptr) {}
+  ~SubJson() override;
+  explicit PROTOBUF_CONSTEXPR SubJson(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubJson(const SubJson& from);
+  SubJson(SubJson&& from) noexcept
+    : SubJson() {
+    *this = ::std::move(from);
+  }
+
+  inline SubJson& operator=(const SubJson& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubJson& operator=(SubJson&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubJson& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubJson* internal_default_instance() {
+    return reinterpret_cast<const SubJson*>(
+               &_SubJson_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SubJson& a, SubJson& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubJson* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubJson* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubJson* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubJson>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubJson& from);
+  void MergeFrom(const SubJson& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubJson* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubJson";
+  }
+  protected:
+  explicit SubJson(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 3,
+    kJsonFieldNumber = 4,
+    kTimeSecFieldNumber = 1,
+    kTimeUsecFieldNumber = 2,
+  };
+  // required string type = 3;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // required string json = 4;
+  bool has_json() const;
+  private:
+  bool _internal_has_json() const;
+  public:
+  void clear_json();
+  const std::string& json() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_json(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_json();
+  PROTOBUF_NODISCARD std::string* release_json();
+  void set_allocated_json(std::string* json);
+  private:
+  const std::string& _internal_json() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_json(const std::string& value);
+  std::string* _internal_mutable_json();
+  public:
+
+  // required uint64 time_sec = 1;
+  bool has_time_sec() const;
+  private:
+  bool _internal_has_time_sec() const;
+  public:
+  void clear_time_sec();
+  uint64_t time_sec() const;
+  void set_time_sec(uint64_t value);
+  private:
+  uint64_t _internal_time_sec() const;
+  void _internal_set_time_sec(uint64_t value);
+  public:
+
+  // required uint64 time_usec = 2;
+  bool has_time_usec() const;
+  private:
+  bool _internal_has_time_usec() const;
+  public:
+  void clear_time_usec();
+  uint64_t time_usec() const;
+  void set_time_usec(uint64_t value);
+  private:
+  uint64_t _internal_time_usec() const;
+  void _internal_set_time_usec(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubJson)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr json_;
+    uint64_t time_sec_;
+    uint64_t time_usec_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubBuffer final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubBuffer) */ {
+ public:
+  inline SubBuffer() : SubBuffer(nullptr) {}
+  ~SubBuffer() override;
+  explicit PROTOBUF_CONSTEXPR SubBuffer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubBuffer(const SubBuffer& from);
+  SubBuffer(SubBuffer&& from) noexcept
+    : SubBuffer() {
+    *this = ::std::move(from);
+  }
+
+  inline SubBuffer& operator=(const SubBuffer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubBuffer& operator=(SubBuffer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubBuffer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubBuffer* internal_default_instance() {
+    return reinterpret_cast<const SubBuffer*>(
+               &_SubBuffer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(SubBuffer& a, SubBuffer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubBuffer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubBuffer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubBuffer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubBuffer>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubBuffer& from);
+  void MergeFrom(const SubBuffer& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubBuffer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubBuffer";
+  }
+  protected:
+  explicit SubBuffer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTypeFieldNumber = 3,
+    kBufferFieldNumber = 4,
+    kTimeSecFieldNumber = 1,
+    kTimeUsecFieldNumber = 2,
+  };
+  // required string type = 3;
+  bool has_type() const;
+  private:
+  bool _internal_has_type() const;
+  public:
+  void clear_type();
+  const std::string& type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_type();
+  PROTOBUF_NODISCARD std::string* release_type();
+  void set_allocated_type(std::string* type);
+  private:
+  const std::string& _internal_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_type(const std::string& value);
+  std::string* _internal_mutable_type();
+  public:
+
+  // required bytes buffer = 4;
+  bool has_buffer() const;
+  private:
+  bool _internal_has_buffer() const;
+  public:
+  void clear_buffer();
+  const std::string& buffer() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_buffer(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_buffer();
+  PROTOBUF_NODISCARD std::string* release_buffer();
+  void set_allocated_buffer(std::string* buffer);
+  private:
+  const std::string& _internal_buffer() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_buffer(const std::string& value);
+  std::string* _internal_mutable_buffer();
+  public:
+
+  // required uint64 time_sec = 1;
+  bool has_time_sec() const;
+  private:
+  bool _internal_has_time_sec() const;
+  public:
+  void clear_time_sec();
+  uint64_t time_sec() const;
+  void set_time_sec(uint64_t value);
+  private:
+  uint64_t _internal_time_sec() const;
+  void _internal_set_time_sec(uint64_t value);
+  public:
+
+  // required uint64 time_usec = 2;
+  bool has_time_usec() const;
+  private:
+  bool _internal_has_time_usec() const;
+  public:
+  void clear_time_usec();
+  uint64_t time_usec() const;
+  void set_time_usec(uint64_t value);
+  private:
+  uint64_t _internal_time_usec() const;
+  void _internal_set_time_usec(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubBuffer)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr buffer_;
+    uint64_t time_sec_;
+    uint64_t time_usec_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubSignal final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubSignal) */ {
+ public:
+  inline SubSignal() : SubSignal(nullptr) {}
+  ~SubSignal() override;
+  explicit PROTOBUF_CONSTEXPR SubSignal(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubSignal(const SubSignal& from);
+  SubSignal(SubSignal&& from) noexcept
+    : SubSignal() {
+    *this = ::std::move(from);
+  }
+
+  inline SubSignal& operator=(const SubSignal& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubSignal& operator=(SubSignal&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubSignal& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubSignal* internal_default_instance() {
+    return reinterpret_cast<const SubSignal*>(
+               &_SubSignal_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(SubSignal& a, SubSignal& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubSignal* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubSignal* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubSignal* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubSignal>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubSignal& from);
+  void MergeFrom(const SubSignal& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubSignal* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubSignal";
+  }
+  protected:
+  explicit SubSignal(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 6,
+    kSignalDbmFieldNumber = 1,
+    kNoiseDbmFieldNumber = 2,
+    kSignalRssiFieldNumber = 3,
+    kNoiseRssiFieldNumber = 4,
+    kFreqKhzFieldNumber = 5,
+    kDatarateFieldNumber = 7,
+  };
+  // optional string channel = 6;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const std::string& channel() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_channel(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_channel();
+  PROTOBUF_NODISCARD std::string* release_channel();
+  void set_allocated_channel(std::string* channel);
+  private:
+  const std::string& _internal_channel() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_channel(const std::string& value);
+  std::string* _internal_mutable_channel();
+  public:
+
+  // optional double signal_dbm = 1;
+  bool has_signal_dbm() const;
+  private:
+  bool _internal_has_signal_dbm() const;
+  public:
+  void clear_signal_dbm();
+  double signal_dbm() const;
+  void set_signal_dbm(double value);
+  private:
+  double _internal_signal_dbm() const;
+  void _internal_set_signal_dbm(double value);
+  public:
+
+  // optional double noise_dbm = 2;
+  bool has_noise_dbm() const;
+  private:
+  bool _internal_has_noise_dbm() const;
+  public:
+  void clear_noise_dbm();
+  double noise_dbm() const;
+  void set_noise_dbm(double value);
+  private:
+  double _internal_noise_dbm() const;
+  void _internal_set_noise_dbm(double value);
+  public:
+
+  // optional double signal_rssi = 3;
+  bool has_signal_rssi() const;
+  private:
+  bool _internal_has_signal_rssi() const;
+  public:
+  void clear_signal_rssi();
+  double signal_rssi() const;
+  void set_signal_rssi(double value);
+  private:
+  double _internal_signal_rssi() const;
+  void _internal_set_signal_rssi(double value);
+  public:
+
+  // optional double noise_rssi = 4;
+  bool has_noise_rssi() const;
+  private:
+  bool _internal_has_noise_rssi() const;
+  public:
+  void clear_noise_rssi();
+  double noise_rssi() const;
+  void set_noise_rssi(double value);
+  private:
+  double _internal_noise_rssi() const;
+  void _internal_set_noise_rssi(double value);
+  public:
+
+  // optional double freq_khz = 5;
+  bool has_freq_khz() const;
+  private:
+  bool _internal_has_freq_khz() const;
+  public:
+  void clear_freq_khz();
+  double freq_khz() const;
+  void set_freq_khz(double value);
+  private:
+  double _internal_freq_khz() const;
+  void _internal_set_freq_khz(double value);
+  public:
+
+  // optional double datarate = 7;
+  bool has_datarate() const;
+  private:
+  bool _internal_has_datarate() const;
+  public:
+  void clear_datarate();
+  double datarate() const;
+  void set_datarate(double value);
+  private:
+  double _internal_datarate() const;
+  void _internal_set_datarate(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubSignal)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr channel_;
+    double signal_dbm_;
+    double noise_dbm_;
+    double signal_rssi_;
+    double noise_rssi_;
+    double freq_khz_;
+    double datarate_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubSpecset final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubSpecset) */ {
+ public:
+  inline SubSpecset() : SubSpecset(nullptr) {}
+  ~SubSpecset() override;
+  explicit PROTOBUF_CONSTEXPR SubSpecset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubSpecset(const SubSpecset& from);
+  SubSpecset(SubSpecset&& from) noexcept
+    : SubSpecset() {
+    *this = ::std::move(from);
+  }
+
+  inline SubSpecset& operator=(const SubSpecset& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubSpecset& operator=(SubSpecset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubSpecset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubSpecset* internal_default_instance() {
+    return reinterpret_cast<const SubSpecset*>(
+               &_SubSpecset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(SubSpecset& a, SubSpecset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubSpecset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubSpecset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubSpecset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubSpecset>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubSpecset& from);
+  void MergeFrom(const SubSpecset& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubSpecset* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubSpecset";
+  }
+  protected:
+  explicit SubSpecset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStartMhzFieldNumber = 1,
+    kEndMhzFieldNumber = 2,
+    kSamplesPerBucketFieldNumber = 3,
+    kBucketWidthHzFieldNumber = 4,
+    kIfAmpFieldNumber = 6,
+    kBasebandAmpFieldNumber = 7,
+    kEnableAmpFieldNumber = 5,
+  };
+  // optional double start_mhz = 1;
+  bool has_start_mhz() const;
+  private:
+  bool _internal_has_start_mhz() const;
+  public:
+  void clear_start_mhz();
+  double start_mhz() const;
+  void set_start_mhz(double value);
+  private:
+  double _internal_start_mhz() const;
+  void _internal_set_start_mhz(double value);
+  public:
+
+  // optional double end_mhz = 2;
+  bool has_end_mhz() const;
+  private:
+  bool _internal_has_end_mhz() const;
+  public:
+  void clear_end_mhz();
+  double end_mhz() const;
+  void set_end_mhz(double value);
+  private:
+  double _internal_end_mhz() const;
+  void _internal_set_end_mhz(double value);
+  public:
+
+  // optional double samples_per_bucket = 3;
+  bool has_samples_per_bucket() const;
+  private:
+  bool _internal_has_samples_per_bucket() const;
+  public:
+  void clear_samples_per_bucket();
+  double samples_per_bucket() const;
+  void set_samples_per_bucket(double value);
+  private:
+  double _internal_samples_per_bucket() const;
+  void _internal_set_samples_per_bucket(double value);
+  public:
+
+  // optional double bucket_width_hz = 4;
+  bool has_bucket_width_hz() const;
+  private:
+  bool _internal_has_bucket_width_hz() const;
+  public:
+  void clear_bucket_width_hz();
+  double bucket_width_hz() const;
+  void set_bucket_width_hz(double value);
+  private:
+  double _internal_bucket_width_hz() const;
+  void _internal_set_bucket_width_hz(double value);
+  public:
+
+  // optional uint64 if_amp = 6;
+  bool has_if_amp() const;
+  private:
+  bool _internal_has_if_amp() const;
+  public:
+  void clear_if_amp();
+  uint64_t if_amp() const;
+  void set_if_amp(uint64_t value);
+  private:
+  uint64_t _internal_if_amp() const;
+  void _internal_set_if_amp(uint64_t value);
+  public:
+
+  // optional uint64 baseband_amp = 7;
+  bool has_baseband_amp() const;
+  private:
+  bool _internal_has_baseband_amp() const;
+  public:
+  void clear_baseband_amp();
+  uint64_t baseband_amp() const;
+  void set_baseband_amp(uint64_t value);
+  private:
+  uint64_t _internal_baseband_amp() const;
+  void _internal_set_baseband_amp(uint64_t value);
+  public:
+
+  // optional bool enable_amp = 5;
+  bool has_enable_amp() const;
+  private:
+  bool _internal_has_enable_amp() const;
+  public:
+  void clear_enable_amp();
+  bool enable_amp() const;
+  void set_enable_amp(bool value);
+  private:
+  bool _internal_enable_amp() const;
+  void _internal_set_enable_amp(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubSpecset)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    double start_mhz_;
+    double end_mhz_;
+    double samples_per_bucket_;
+    double bucket_width_hz_;
+    uint64_t if_amp_;
+    uint64_t baseband_amp_;
+    bool enable_amp_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubSpectrum final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubSpectrum) */ {
+ public:
+  inline SubSpectrum() : SubSpectrum(nullptr) {}
+  ~SubSpectrum() override;
+  explicit PROTOBUF_CONSTEXPR SubSpectrum(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubSpectrum(const SubSpectrum& from);
+  SubSpectrum(SubSpectrum&& from) noexcept
+    : SubSpectrum() {
+    *this = ::std::move(from);
+  }
+
+  inline SubSpectrum& operator=(const SubSpectrum& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubSpectrum& operator=(SubSpectrum&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubSpectrum& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubSpectrum* internal_default_instance() {
+    return reinterpret_cast<const SubSpectrum*>(
+               &_SubSpectrum_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(SubSpectrum& a, SubSpectrum& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubSpectrum* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubSpectrum* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubSpectrum* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubSpectrum>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubSpectrum& from);
+  void MergeFrom(const SubSpectrum& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubSpectrum* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubSpectrum";
+  }
+  protected:
+  explicit SubSpectrum(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 6,
+    kTimeSecFieldNumber = 1,
+    kTimeUsecFieldNumber = 2,
+    kStartMhzFieldNumber = 3,
+    kEndMhzFieldNumber = 4,
+    kBucketWidthHzFieldNumber = 5,
+  };
+  // repeated int32 data = 6;
+  int data_size() const;
+  private:
+  int _internal_data_size() const;
+  public:
+  void clear_data();
+  private:
+  int32_t _internal_data(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      _internal_data() const;
+  void _internal_add_data(int32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      _internal_mutable_data();
+  public:
+  int32_t data(int index) const;
+  void set_data(int index, int32_t value);
+  void add_data(int32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+      data() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+      mutable_data();
+
+  // optional uint64 time_sec = 1;
+  bool has_time_sec() const;
+  private:
+  bool _internal_has_time_sec() const;
+  public:
+  void clear_time_sec();
+  uint64_t time_sec() const;
+  void set_time_sec(uint64_t value);
+  private:
+  uint64_t _internal_time_sec() const;
+  void _internal_set_time_sec(uint64_t value);
+  public:
+
+  // optional uint64 time_usec = 2;
+  bool has_time_usec() const;
+  private:
+  bool _internal_has_time_usec() const;
+  public:
+  void clear_time_usec();
+  uint64_t time_usec() const;
+  void set_time_usec(uint64_t value);
+  private:
+  uint64_t _internal_time_usec() const;
+  void _internal_set_time_usec(uint64_t value);
+  public:
+
+  // optional double start_mhz = 3;
+  bool has_start_mhz() const;
+  private:
+  bool _internal_has_start_mhz() const;
+  public:
+  void clear_start_mhz();
+  double start_mhz() const;
+  void set_start_mhz(double value);
+  private:
+  double _internal_start_mhz() const;
+  void _internal_set_start_mhz(double value);
+  public:
+
+  // optional double end_mhz = 4;
+  bool has_end_mhz() const;
+  private:
+  bool _internal_has_end_mhz() const;
+  public:
+  void clear_end_mhz();
+  double end_mhz() const;
+  void set_end_mhz(double value);
+  private:
+  double _internal_end_mhz() const;
+  void _internal_set_end_mhz(double value);
+  public:
+
+  // optional double bucket_width_hz = 5;
+  bool has_bucket_width_hz() const;
+  private:
+  bool _internal_has_bucket_width_hz() const;
+  public:
+  void clear_bucket_width_hz();
+  double bucket_width_hz() const;
+  void set_bucket_width_hz(double value);
+  private:
+  double _internal_bucket_width_hz() const;
+  void _internal_set_bucket_width_hz(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubSpectrum)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t > data_;
+    uint64_t time_sec_;
+    uint64_t time_usec_;
+    double start_mhz_;
+    double end_mhz_;
+    double bucket_width_hz_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubSuccess final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.SubSuccess) */ {
+ public:
+  inline SubSuccess() : SubSuccess(nullptr) {}
+  ~SubSuccess() override;
+  explicit PROTOBUF_CONSTEXPR SubSuccess(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubSuccess(const SubSuccess& from);
+  SubSuccess(SubSuccess&& from) noexcept
+    : SubSuccess() {
+    *this = ::std::move(from);
+  }
+
+  inline SubSuccess& operator=(const SubSuccess& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubSuccess& operator=(SubSuccess&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubSuccess& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubSuccess* internal_default_instance() {
+    return reinterpret_cast<const SubSuccess*>(
+               &_SubSuccess_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(SubSuccess& a, SubSuccess& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubSuccess* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubSuccess* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubSuccess* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubSuccess>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubSuccess& from);
+  void MergeFrom(const SubSuccess& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubSuccess* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.SubSuccess";
+  }
+  protected:
+  explicit SubSuccess(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSuccessFieldNumber = 1,
+    kSeqnoFieldNumber = 2,
+  };
+  // required bool success = 1;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  bool success() const;
+  void set_success(bool value);
+  private:
+  bool _internal_success() const;
+  void _internal_set_success(bool value);
+  public:
+
+  // required uint32 seqno = 2;
+  bool has_seqno() const;
+  private:
+  bool _internal_has_seqno() const;
+  public:
+  void clear_seqno();
+  uint32_t seqno() const;
+  void set_seqno(uint32_t value);
+  private:
+  uint32_t _internal_seqno() const;
+  void _internal_set_seqno(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.SubSuccess)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    bool success_;
+    uint32_t seqno_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class CloseDatasource final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.CloseDatasource) */ {
+ public:
+  inline CloseDatasource() : CloseDatasource(nullptr) {}
+  ~CloseDatasource() override;
+  explicit PROTOBUF_CONSTEXPR CloseDatasource(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  CloseDatasource(const CloseDatasource& from);
+  CloseDatasource(CloseDatasource&& from) noexcept
+    : CloseDatasource() {
+    *this = ::std::move(from);
+  }
+
+  inline CloseDatasource& operator=(const CloseDatasource& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline CloseDatasource& operator=(CloseDatasource&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const CloseDatasource& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const CloseDatasource* internal_default_instance() {
+    return reinterpret_cast<const CloseDatasource*>(
+               &_CloseDatasource_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(CloseDatasource& a, CloseDatasource& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(CloseDatasource* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(CloseDatasource* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  CloseDatasource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<CloseDatasource>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const CloseDatasource& from);
+  void MergeFrom(const CloseDatasource& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(CloseDatasource* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.CloseDatasource";
+  }
+  protected:
+  explicit CloseDatasource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.CloseDatasource)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Configure final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.Configure) */ {
+ public:
+  inline Configure() : Configure(nullptr) {}
+  ~Configure() override;
+  explicit PROTOBUF_CONSTEXPR Configure(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Configure(const Configure& from);
+  Configure(Configure&& from) noexcept
+    : Configure() {
+    *this = ::std::move(from);
+  }
+
+  inline Configure& operator=(const Configure& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Configure& operator=(Configure&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const Configure& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Configure* internal_default_instance() {
+    return reinterpret_cast<const Configure*>(
+               &_Configure_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(Configure& a, Configure& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Configure* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Configure* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Configure* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Configure>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Configure& from);
+  void MergeFrom(const Configure& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Configure* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.Configure";
+  }
+  protected:
+  explicit Configure(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChannelFieldNumber = 1,
+    kHoppingFieldNumber = 2,
+    kSpectrumFieldNumber = 3,
+  };
+  // optional .KismetDatasource.SubChanset channel = 1;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const ::KismetDatasource::SubChanset& channel() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChanset* release_channel();
+  ::KismetDatasource::SubChanset* mutable_channel();
+  void set_allocated_channel(::KismetDatasource::SubChanset* channel);
+  private:
+  const ::KismetDatasource::SubChanset& _internal_channel() const;
+  ::KismetDatasource::SubChanset* _internal_mutable_channel();
+  public:
+  void unsafe_arena_set_allocated_channel(
+      ::KismetDatasource::SubChanset* channel);
+  ::KismetDatasource::SubChanset* unsafe_arena_release_channel();
+
+  // optional .KismetDatasource.SubChanhop hopping = 2;
+  bool has_hopping() const;
+  private:
+  bool _internal_has_hopping() const;
+  public:
+  void clear_hopping();
+  const ::KismetDatasource::SubChanhop& hopping() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChanhop* release_hopping();
+  ::KismetDatasource::SubChanhop* mutable_hopping();
+  void set_allocated_hopping(::KismetDatasource::SubChanhop* hopping);
+  private:
+  const ::KismetDatasource::SubChanhop& _internal_hopping() const;
+  ::KismetDatasource::SubChanhop* _internal_mutable_hopping();
+  public:
+  void unsafe_arena_set_allocated_hopping(
+      ::KismetDatasource::SubChanhop* hopping);
+  ::KismetDatasource::SubChanhop* unsafe_arena_release_hopping();
+
+  // optional .KismetDatasource.SubSpecset spectrum = 3;
+  bool has_spectrum() const;
+  private:
+  bool _internal_has_spectrum() const;
+  public:
+  void clear_spectrum();
+  const ::KismetDatasource::SubSpecset& spectrum() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSpecset* release_spectrum();
+  ::KismetDatasource::SubSpecset* mutable_spectrum();
+  void set_allocated_spectrum(::KismetDatasource::SubSpecset* spectrum);
+  private:
+  const ::KismetDatasource::SubSpecset& _internal_spectrum() const;
+  ::KismetDatasource::SubSpecset* _internal_mutable_spectrum();
+  public:
+  void unsafe_arena_set_allocated_spectrum(
+      ::KismetDatasource::SubSpecset* spectrum);
+  ::KismetDatasource::SubSpecset* unsafe_arena_release_spectrum();
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.Configure)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::KismetDatasource::SubChanset* channel_;
+    ::KismetDatasource::SubChanhop* hopping_;
+    ::KismetDatasource::SubSpecset* spectrum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ConfigureReport final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.ConfigureReport) */ {
+ public:
+  inline ConfigureReport() : ConfigureReport(nullptr) {}
+  ~ConfigureReport() override;
+  explicit PROTOBUF_CONSTEXPR ConfigureReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ConfigureReport(const ConfigureReport& from);
+  ConfigureReport(ConfigureReport&& from) noexcept
+    : ConfigureReport() {
+    *this = ::std::move(from);
+  }
+
+  inline ConfigureReport& operator=(const ConfigureReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ConfigureReport& operator=(ConfigureReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ConfigureReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ConfigureReport* internal_default_instance() {
+    return reinterpret_cast<const ConfigureReport*>(
+               &_ConfigureReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(ConfigureReport& a, ConfigureReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ConfigureReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ConfigureReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ConfigureReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ConfigureReport>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ConfigureReport& from);
+  void MergeFrom(const ConfigureReport& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ConfigureReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.ConfigureReport";
+  }
+  protected:
+  explicit ConfigureReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWarningFieldNumber = 5,
+    kSuccessFieldNumber = 1,
+    kChannelFieldNumber = 2,
+    kHoppingFieldNumber = 3,
+    kMessageFieldNumber = 4,
+  };
+  // optional string warning = 5;
+  bool has_warning() const;
+  private:
+  bool _internal_has_warning() const;
+  public:
+  void clear_warning();
+  const std::string& warning() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_warning(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_warning();
+  PROTOBUF_NODISCARD std::string* release_warning();
+  void set_allocated_warning(std::string* warning);
+  private:
+  const std::string& _internal_warning() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_warning(const std::string& value);
+  std::string* _internal_mutable_warning();
+  public:
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  const ::KismetDatasource::SubSuccess& success() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSuccess* release_success();
+  ::KismetDatasource::SubSuccess* mutable_success();
+  void set_allocated_success(::KismetDatasource::SubSuccess* success);
+  private:
+  const ::KismetDatasource::SubSuccess& _internal_success() const;
+  ::KismetDatasource::SubSuccess* _internal_mutable_success();
+  public:
+  void unsafe_arena_set_allocated_success(
+      ::KismetDatasource::SubSuccess* success);
+  ::KismetDatasource::SubSuccess* unsafe_arena_release_success();
+
+  // optional .KismetDatasource.SubChanset channel = 2;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const ::KismetDatasource::SubChanset& channel() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChanset* release_channel();
+  ::KismetDatasource::SubChanset* mutable_channel();
+  void set_allocated_channel(::KismetDatasource::SubChanset* channel);
+  private:
+  const ::KismetDatasource::SubChanset& _internal_channel() const;
+  ::KismetDatasource::SubChanset* _internal_mutable_channel();
+  public:
+  void unsafe_arena_set_allocated_channel(
+      ::KismetDatasource::SubChanset* channel);
+  ::KismetDatasource::SubChanset* unsafe_arena_release_channel();
+
+  // optional .KismetDatasource.SubChanhop hopping = 3;
+  bool has_hopping() const;
+  private:
+  bool _internal_has_hopping() const;
+  public:
+  void clear_hopping();
+  const ::KismetDatasource::SubChanhop& hopping() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChanhop* release_hopping();
+  ::KismetDatasource::SubChanhop* mutable_hopping();
+  void set_allocated_hopping(::KismetDatasource::SubChanhop* hopping);
+  private:
+  const ::KismetDatasource::SubChanhop& _internal_hopping() const;
+  ::KismetDatasource::SubChanhop* _internal_mutable_hopping();
+  public:
+  void unsafe_arena_set_allocated_hopping(
+      ::KismetDatasource::SubChanhop* hopping);
+  ::KismetDatasource::SubChanhop* unsafe_arena_release_hopping();
+
+  // optional .KismetExternal.MsgbusMessage message = 4;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::KismetExternal::MsgbusMessage& message() const;
+  PROTOBUF_NODISCARD ::KismetExternal::MsgbusMessage* release_message();
+  ::KismetExternal::MsgbusMessage* mutable_message();
+  void set_allocated_message(::KismetExternal::MsgbusMessage* message);
+  private:
+  const ::KismetExternal::MsgbusMessage& _internal_message() const;
+  ::KismetExternal::MsgbusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::KismetExternal::MsgbusMessage* message);
+  ::KismetExternal::MsgbusMessage* unsafe_arena_release_message();
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.ConfigureReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr warning_;
+    ::KismetDatasource::SubSuccess* success_;
+    ::KismetDatasource::SubChanset* channel_;
+    ::KismetDatasource::SubChanhop* hopping_;
+    ::KismetExternal::MsgbusMessage* message_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DataReport final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.DataReport) */ {
+ public:
+  inline DataReport() : DataReport(nullptr) {}
+  ~DataReport() override;
+  explicit PROTOBUF_CONSTEXPR DataReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DataReport(const DataReport& from);
+  DataReport(DataReport&& from) noexcept
+    : DataReport() {
+    *this = ::std::move(from);
+  }
+
+  inline DataReport& operator=(const DataReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DataReport& operator=(DataReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const DataReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DataReport* internal_default_instance() {
+    return reinterpret_cast<const DataReport*>(
+               &_DataReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(DataReport& a, DataReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DataReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DataReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DataReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DataReport>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const DataReport& from);
+  void MergeFrom(const DataReport& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(DataReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.DataReport";
+  }
+  protected:
+  explicit DataReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWarningFieldNumber = 6,
+    kGpsFieldNumber = 1,
+    kMessageFieldNumber = 2,
+    kPacketFieldNumber = 3,
+    kSignalFieldNumber = 4,
+    kSpectrumFieldNumber = 5,
+    kJsonFieldNumber = 7,
+    kBufferFieldNumber = 8,
+    kHighPrecTimeFieldNumber = 9,
+  };
+  // optional string warning = 6;
+  bool has_warning() const;
+  private:
+  bool _internal_has_warning() const;
+  public:
+  void clear_warning();
+  const std::string& warning() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_warning(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_warning();
+  PROTOBUF_NODISCARD std::string* release_warning();
+  void set_allocated_warning(std::string* warning);
+  private:
+  const std::string& _internal_warning() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_warning(const std::string& value);
+  std::string* _internal_mutable_warning();
+  public:
+
+  // optional .KismetDatasource.SubGps gps = 1;
+  bool has_gps() const;
+  private:
+  bool _internal_has_gps() const;
+  public:
+  void clear_gps();
+  const ::KismetDatasource::SubGps& gps() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubGps* release_gps();
+  ::KismetDatasource::SubGps* mutable_gps();
+  void set_allocated_gps(::KismetDatasource::SubGps* gps);
+  private:
+  const ::KismetDatasource::SubGps& _internal_gps() const;
+  ::KismetDatasource::SubGps* _internal_mutable_gps();
+  public:
+  void unsafe_arena_set_allocated_gps(
+      ::KismetDatasource::SubGps* gps);
+  ::KismetDatasource::SubGps* unsafe_arena_release_gps();
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::KismetExternal::MsgbusMessage& message() const;
+  PROTOBUF_NODISCARD ::KismetExternal::MsgbusMessage* release_message();
+  ::KismetExternal::MsgbusMessage* mutable_message();
+  void set_allocated_message(::KismetExternal::MsgbusMessage* message);
+  private:
+  const ::KismetExternal::MsgbusMessage& _internal_message() const;
+  ::KismetExternal::MsgbusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::KismetExternal::MsgbusMessage* message);
+  ::KismetExternal::MsgbusMessage* unsafe_arena_release_message();
+
+  // optional .KismetDatasource.SubPacket packet = 3;
+  bool has_packet() const;
+  private:
+  bool _internal_has_packet() const;
+  public:
+  void clear_packet();
+  const ::KismetDatasource::SubPacket& packet() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubPacket* release_packet();
+  ::KismetDatasource::SubPacket* mutable_packet();
+  void set_allocated_packet(::KismetDatasource::SubPacket* packet);
+  private:
+  const ::KismetDatasource::SubPacket& _internal_packet() const;
+  ::KismetDatasource::SubPacket* _internal_mutable_packet();
+  public:
+  void unsafe_arena_set_allocated_packet(
+      ::KismetDatasource::SubPacket* packet);
+  ::KismetDatasource::SubPacket* unsafe_arena_release_packet();
+
+  // optional .KismetDatasource.SubSignal signal = 4;
+  bool has_signal() const;
+  private:
+  bool _internal_has_signal() const;
+  public:
+  void clear_signal();
+  const ::KismetDatasource::SubSignal& signal() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSignal* release_signal();
+  ::KismetDatasource::SubSignal* mutable_signal();
+  void set_allocated_signal(::KismetDatasource::SubSignal* signal);
+  private:
+  const ::KismetDatasource::SubSignal& _internal_signal() const;
+  ::KismetDatasource::SubSignal* _internal_mutable_signal();
+  public:
+  void unsafe_arena_set_allocated_signal(
+      ::KismetDatasource::SubSignal* signal);
+  ::KismetDatasource::SubSignal* unsafe_arena_release_signal();
+
+  // optional .KismetDatasource.SubSpectrum spectrum = 5;
+  bool has_spectrum() const;
+  private:
+  bool _internal_has_spectrum() const;
+  public:
+  void clear_spectrum();
+  const ::KismetDatasource::SubSpectrum& spectrum() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSpectrum* release_spectrum();
+  ::KismetDatasource::SubSpectrum* mutable_spectrum();
+  void set_allocated_spectrum(::KismetDatasource::SubSpectrum* spectrum);
+  private:
+  const ::KismetDatasource::SubSpectrum& _internal_spectrum() const;
+  ::KismetDatasource::SubSpectrum* _internal_mutable_spectrum();
+  public:
+  void unsafe_arena_set_allocated_spectrum(
+      ::KismetDatasource::SubSpectrum* spectrum);
+  ::KismetDatasource::SubSpectrum* unsafe_arena_release_spectrum();
+
+  // optional .KismetDatasource.SubJson json = 7;
+  bool has_json() const;
+  private:
+  bool _internal_has_json() const;
+  public:
+  void clear_json();
+  const ::KismetDatasource::SubJson& json() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubJson* release_json();
+  ::KismetDatasource::SubJson* mutable_json();
+  void set_allocated_json(::KismetDatasource::SubJson* json);
+  private:
+  const ::KismetDatasource::SubJson& _internal_json() const;
+  ::KismetDatasource::SubJson* _internal_mutable_json();
+  public:
+  void unsafe_arena_set_allocated_json(
+      ::KismetDatasource::SubJson* json);
+  ::KismetDatasource::SubJson* unsafe_arena_release_json();
+
+  // optional .KismetDatasource.SubBuffer buffer = 8;
+  bool has_buffer() const;
+  private:
+  bool _internal_has_buffer() const;
+  public:
+  void clear_buffer();
+  const ::KismetDatasource::SubBuffer& buffer() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubBuffer* release_buffer();
+  ::KismetDatasource::SubBuffer* mutable_buffer();
+  void set_allocated_buffer(::KismetDatasource::SubBuffer* buffer);
+  private:
+  const ::KismetDatasource::SubBuffer& _internal_buffer() const;
+  ::KismetDatasource::SubBuffer* _internal_mutable_buffer();
+  public:
+  void unsafe_arena_set_allocated_buffer(
+      ::KismetDatasource::SubBuffer* buffer);
+  ::KismetDatasource::SubBuffer* unsafe_arena_release_buffer();
+
+  // optional double high_prec_time = 9;
+  bool has_high_prec_time() const;
+  private:
+  bool _internal_has_high_prec_time() const;
+  public:
+  void clear_high_prec_time();
+  double high_prec_time() const;
+  void set_high_prec_time(double value);
+  private:
+  double _internal_high_prec_time() const;
+  void _internal_set_high_prec_time(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.DataReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr warning_;
+    ::KismetDatasource::SubGps* gps_;
+    ::KismetExternal::MsgbusMessage* message_;
+    ::KismetDatasource::SubPacket* packet_;
+    ::KismetDatasource::SubSignal* signal_;
+    ::KismetDatasource::SubSpectrum* spectrum_;
+    ::KismetDatasource::SubJson* json_;
+    ::KismetDatasource::SubBuffer* buffer_;
+    double high_prec_time_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ErrorReport final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.ErrorReport) */ {
+ public:
+  inline ErrorReport() : ErrorReport(nullptr) {}
+  ~ErrorReport() override;
+  explicit PROTOBUF_CONSTEXPR ErrorReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ErrorReport(const ErrorReport& from);
+  ErrorReport(ErrorReport&& from) noexcept
+    : ErrorReport() {
+    *this = ::std::move(from);
+  }
+
+  inline ErrorReport& operator=(const ErrorReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ErrorReport& operator=(ErrorReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ErrorReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ErrorReport* internal_default_instance() {
+    return reinterpret_cast<const ErrorReport*>(
+               &_ErrorReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(ErrorReport& a, ErrorReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ErrorReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ErrorReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ErrorReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ErrorReport>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ErrorReport& from);
+  void MergeFrom(const ErrorReport& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ErrorReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.ErrorReport";
+  }
+  protected:
+  explicit ErrorReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSuccessFieldNumber = 1,
+    kMessageFieldNumber = 2,
+  };
+  // required .KismetDatasource.SubSuccess success = 1;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  const ::KismetDatasource::SubSuccess& success() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSuccess* release_success();
+  ::KismetDatasource::SubSuccess* mutable_success();
+  void set_allocated_success(::KismetDatasource::SubSuccess* success);
+  private:
+  const ::KismetDatasource::SubSuccess& _internal_success() const;
+  ::KismetDatasource::SubSuccess* _internal_mutable_success();
+  public:
+  void unsafe_arena_set_allocated_success(
+      ::KismetDatasource::SubSuccess* success);
+  ::KismetDatasource::SubSuccess* unsafe_arena_release_success();
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::KismetExternal::MsgbusMessage& message() const;
+  PROTOBUF_NODISCARD ::KismetExternal::MsgbusMessage* release_message();
+  ::KismetExternal::MsgbusMessage* mutable_message();
+  void set_allocated_message(::KismetExternal::MsgbusMessage* message);
+  private:
+  const ::KismetExternal::MsgbusMessage& _internal_message() const;
+  ::KismetExternal::MsgbusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::KismetExternal::MsgbusMessage* message);
+  ::KismetExternal::MsgbusMessage* unsafe_arena_release_message();
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.ErrorReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::KismetDatasource::SubSuccess* success_;
+    ::KismetExternal::MsgbusMessage* message_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ListInterfaces final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.ListInterfaces) */ {
+ public:
+  inline ListInterfaces() : ListInterfaces(nullptr) {}
+  ~ListInterfaces() override;
+  explicit PROTOBUF_CONSTEXPR ListInterfaces(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ListInterfaces(const ListInterfaces& from);
+  ListInterfaces(ListInterfaces&& from) noexcept
+    : ListInterfaces() {
+    *this = ::std::move(from);
+  }
+
+  inline ListInterfaces& operator=(const ListInterfaces& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ListInterfaces& operator=(ListInterfaces&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ListInterfaces& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ListInterfaces* internal_default_instance() {
+    return reinterpret_cast<const ListInterfaces*>(
+               &_ListInterfaces_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(ListInterfaces& a, ListInterfaces& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ListInterfaces* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ListInterfaces* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ListInterfaces* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ListInterfaces>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ListInterfaces& from);
+  void MergeFrom(const ListInterfaces& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ListInterfaces* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.ListInterfaces";
+  }
+  protected:
+  explicit ListInterfaces(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.ListInterfaces)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class InterfacesReport final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.InterfacesReport) */ {
+ public:
+  inline InterfacesReport() : InterfacesReport(nullptr) {}
+  ~InterfacesReport() override;
+  explicit PROTOBUF_CONSTEXPR InterfacesReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  InterfacesReport(const InterfacesReport& from);
+  InterfacesReport(InterfacesReport&& from) noexcept
+    : InterfacesReport() {
+    *this = ::std::move(from);
+  }
+
+  inline InterfacesReport& operator=(const InterfacesReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline InterfacesReport& operator=(InterfacesReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const InterfacesReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const InterfacesReport* internal_default_instance() {
+    return reinterpret_cast<const InterfacesReport*>(
+               &_InterfacesReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(InterfacesReport& a, InterfacesReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(InterfacesReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(InterfacesReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  InterfacesReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<InterfacesReport>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const InterfacesReport& from);
+  void MergeFrom(const InterfacesReport& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(InterfacesReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.InterfacesReport";
+  }
+  protected:
+  explicit InterfacesReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kInterfacesFieldNumber = 3,
+    kSuccessFieldNumber = 1,
+    kMessageFieldNumber = 2,
+  };
+  // repeated .KismetDatasource.SubInterface interfaces = 3;
+  int interfaces_size() const;
+  private:
+  int _internal_interfaces_size() const;
+  public:
+  void clear_interfaces();
+  ::KismetDatasource::SubInterface* mutable_interfaces(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetDatasource::SubInterface >*
+      mutable_interfaces();
+  private:
+  const ::KismetDatasource::SubInterface& _internal_interfaces(int index) const;
+  ::KismetDatasource::SubInterface* _internal_add_interfaces();
+  public:
+  const ::KismetDatasource::SubInterface& interfaces(int index) const;
+  ::KismetDatasource::SubInterface* add_interfaces();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetDatasource::SubInterface >&
+      interfaces() const;
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  const ::KismetDatasource::SubSuccess& success() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSuccess* release_success();
+  ::KismetDatasource::SubSuccess* mutable_success();
+  void set_allocated_success(::KismetDatasource::SubSuccess* success);
+  private:
+  const ::KismetDatasource::SubSuccess& _internal_success() const;
+  ::KismetDatasource::SubSuccess* _internal_mutable_success();
+  public:
+  void unsafe_arena_set_allocated_success(
+      ::KismetDatasource::SubSuccess* success);
+  ::KismetDatasource::SubSuccess* unsafe_arena_release_success();
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::KismetExternal::MsgbusMessage& message() const;
+  PROTOBUF_NODISCARD ::KismetExternal::MsgbusMessage* release_message();
+  ::KismetExternal::MsgbusMessage* mutable_message();
+  void set_allocated_message(::KismetExternal::MsgbusMessage* message);
+  private:
+  const ::KismetExternal::MsgbusMessage& _internal_message() const;
+  ::KismetExternal::MsgbusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::KismetExternal::MsgbusMessage* message);
+  ::KismetExternal::MsgbusMessage* unsafe_arena_release_message();
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.InterfacesReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetDatasource::SubInterface > interfaces_;
+    ::KismetDatasource::SubSuccess* success_;
+    ::KismetExternal::MsgbusMessage* message_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NewSource final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.NewSource) */ {
+ public:
+  inline NewSource() : NewSource(nullptr) {}
+  ~NewSource() override;
+  explicit PROTOBUF_CONSTEXPR NewSource(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NewSource(const NewSource& from);
+  NewSource(NewSource&& from) noexcept
+    : NewSource() {
+    *this = ::std::move(from);
+  }
+
+  inline NewSource& operator=(const NewSource& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NewSource& operator=(NewSource&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const NewSource& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NewSource* internal_default_instance() {
+    return reinterpret_cast<const NewSource*>(
+               &_NewSource_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(NewSource& a, NewSource& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NewSource* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NewSource* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NewSource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NewSource>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const NewSource& from);
+  void MergeFrom(const NewSource& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(NewSource* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.NewSource";
+  }
+  protected:
+  explicit NewSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDefinitionFieldNumber = 1,
+    kSourcetypeFieldNumber = 2,
+    kUuidFieldNumber = 3,
+  };
+  // required string definition = 1;
+  bool has_definition() const;
+  private:
+  bool _internal_has_definition() const;
+  public:
+  void clear_definition();
+  const std::string& definition() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_definition(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_definition();
+  PROTOBUF_NODISCARD std::string* release_definition();
+  void set_allocated_definition(std::string* definition);
+  private:
+  const std::string& _internal_definition() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_definition(const std::string& value);
+  std::string* _internal_mutable_definition();
+  public:
+
+  // required string sourcetype = 2;
+  bool has_sourcetype() const;
+  private:
+  bool _internal_has_sourcetype() const;
+  public:
+  void clear_sourcetype();
+  const std::string& sourcetype() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sourcetype(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sourcetype();
+  PROTOBUF_NODISCARD std::string* release_sourcetype();
+  void set_allocated_sourcetype(std::string* sourcetype);
+  private:
+  const std::string& _internal_sourcetype() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sourcetype(const std::string& value);
+  std::string* _internal_mutable_sourcetype();
+  public:
+
+  // required string uuid = 3;
+  bool has_uuid() const;
+  private:
+  bool _internal_has_uuid() const;
+  public:
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.NewSource)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr definition_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sourcetype_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpenSource final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.OpenSource) */ {
+ public:
+  inline OpenSource() : OpenSource(nullptr) {}
+  ~OpenSource() override;
+  explicit PROTOBUF_CONSTEXPR OpenSource(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpenSource(const OpenSource& from);
+  OpenSource(OpenSource&& from) noexcept
+    : OpenSource() {
+    *this = ::std::move(from);
+  }
+
+  inline OpenSource& operator=(const OpenSource& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpenSource& operator=(OpenSource&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const OpenSource& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpenSource* internal_default_instance() {
+    return reinterpret_cast<const OpenSource*>(
+               &_OpenSource_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(OpenSource& a, OpenSource& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpenSource* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpenSource* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpenSource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpenSource>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const OpenSource& from);
+  void MergeFrom(const OpenSource& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(OpenSource* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.OpenSource";
+  }
+  protected:
+  explicit OpenSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDefinitionFieldNumber = 1,
+  };
+  // required string definition = 1;
+  bool has_definition() const;
+  private:
+  bool _internal_has_definition() const;
+  public:
+  void clear_definition();
+  const std::string& definition() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_definition(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_definition();
+  PROTOBUF_NODISCARD std::string* release_definition();
+  void set_allocated_definition(std::string* definition);
+  private:
+  const std::string& _internal_definition() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_definition(const std::string& value);
+  std::string* _internal_mutable_definition();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.OpenSource)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr definition_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OpenSourceReport final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.OpenSourceReport) */ {
+ public:
+  inline OpenSourceReport() : OpenSourceReport(nullptr) {}
+  ~OpenSourceReport() override;
+  explicit PROTOBUF_CONSTEXPR OpenSourceReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OpenSourceReport(const OpenSourceReport& from);
+  OpenSourceReport(OpenSourceReport&& from) noexcept
+    : OpenSourceReport() {
+    *this = ::std::move(from);
+  }
+
+  inline OpenSourceReport& operator=(const OpenSourceReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OpenSourceReport& operator=(OpenSourceReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const OpenSourceReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OpenSourceReport* internal_default_instance() {
+    return reinterpret_cast<const OpenSourceReport*>(
+               &_OpenSourceReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(OpenSourceReport& a, OpenSourceReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OpenSourceReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OpenSourceReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OpenSourceReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OpenSourceReport>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const OpenSourceReport& from);
+  void MergeFrom(const OpenSourceReport& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(OpenSourceReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.OpenSourceReport";
+  }
+  protected:
+  explicit OpenSourceReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCaptureInterfaceFieldNumber = 3,
+    kHardwareFieldNumber = 7,
+    kUuidFieldNumber = 10,
+    kWarningFieldNumber = 11,
+    kSuccessFieldNumber = 1,
+    kChannelsFieldNumber = 4,
+    kChannelFieldNumber = 5,
+    kHopConfigFieldNumber = 6,
+    kMessageFieldNumber = 8,
+    kSpectrumFieldNumber = 9,
+    kDltFieldNumber = 2,
+  };
+  // optional string capture_interface = 3;
+  bool has_capture_interface() const;
+  private:
+  bool _internal_has_capture_interface() const;
+  public:
+  void clear_capture_interface();
+  const std::string& capture_interface() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_capture_interface(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_capture_interface();
+  PROTOBUF_NODISCARD std::string* release_capture_interface();
+  void set_allocated_capture_interface(std::string* capture_interface);
+  private:
+  const std::string& _internal_capture_interface() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_capture_interface(const std::string& value);
+  std::string* _internal_mutable_capture_interface();
+  public:
+
+  // optional string hardware = 7;
+  bool has_hardware() const;
+  private:
+  bool _internal_has_hardware() const;
+  public:
+  void clear_hardware();
+  const std::string& hardware() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hardware(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hardware();
+  PROTOBUF_NODISCARD std::string* release_hardware();
+  void set_allocated_hardware(std::string* hardware);
+  private:
+  const std::string& _internal_hardware() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hardware(const std::string& value);
+  std::string* _internal_mutable_hardware();
+  public:
+
+  // optional string uuid = 10;
+  bool has_uuid() const;
+  private:
+  bool _internal_has_uuid() const;
+  public:
+  void clear_uuid();
+  const std::string& uuid() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uuid(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uuid();
+  PROTOBUF_NODISCARD std::string* release_uuid();
+  void set_allocated_uuid(std::string* uuid);
+  private:
+  const std::string& _internal_uuid() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uuid(const std::string& value);
+  std::string* _internal_mutable_uuid();
+  public:
+
+  // optional string warning = 11;
+  bool has_warning() const;
+  private:
+  bool _internal_has_warning() const;
+  public:
+  void clear_warning();
+  const std::string& warning() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_warning(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_warning();
+  PROTOBUF_NODISCARD std::string* release_warning();
+  void set_allocated_warning(std::string* warning);
+  private:
+  const std::string& _internal_warning() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_warning(const std::string& value);
+  std::string* _internal_mutable_warning();
+  public:
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  const ::KismetDatasource::SubSuccess& success() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSuccess* release_success();
+  ::KismetDatasource::SubSuccess* mutable_success();
+  void set_allocated_success(::KismetDatasource::SubSuccess* success);
+  private:
+  const ::KismetDatasource::SubSuccess& _internal_success() const;
+  ::KismetDatasource::SubSuccess* _internal_mutable_success();
+  public:
+  void unsafe_arena_set_allocated_success(
+      ::KismetDatasource::SubSuccess* success);
+  ::KismetDatasource::SubSuccess* unsafe_arena_release_success();
+
+  // optional .KismetDatasource.SubChannels channels = 4;
+  bool has_channels() const;
+  private:
+  bool _internal_has_channels() const;
+  public:
+  void clear_channels();
+  const ::KismetDatasource::SubChannels& channels() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChannels* release_channels();
+  ::KismetDatasource::SubChannels* mutable_channels();
+  void set_allocated_channels(::KismetDatasource::SubChannels* channels);
+  private:
+  const ::KismetDatasource::SubChannels& _internal_channels() const;
+  ::KismetDatasource::SubChannels* _internal_mutable_channels();
+  public:
+  void unsafe_arena_set_allocated_channels(
+      ::KismetDatasource::SubChannels* channels);
+  ::KismetDatasource::SubChannels* unsafe_arena_release_channels();
+
+  // optional .KismetDatasource.SubChanset channel = 5;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const ::KismetDatasource::SubChanset& channel() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChanset* release_channel();
+  ::KismetDatasource::SubChanset* mutable_channel();
+  void set_allocated_channel(::KismetDatasource::SubChanset* channel);
+  private:
+  const ::KismetDatasource::SubChanset& _internal_channel() const;
+  ::KismetDatasource::SubChanset* _internal_mutable_channel();
+  public:
+  void unsafe_arena_set_allocated_channel(
+      ::KismetDatasource::SubChanset* channel);
+  ::KismetDatasource::SubChanset* unsafe_arena_release_channel();
+
+  // optional .KismetDatasource.SubChanhop hop_config = 6;
+  bool has_hop_config() const;
+  private:
+  bool _internal_has_hop_config() const;
+  public:
+  void clear_hop_config();
+  const ::KismetDatasource::SubChanhop& hop_config() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChanhop* release_hop_config();
+  ::KismetDatasource::SubChanhop* mutable_hop_config();
+  void set_allocated_hop_config(::KismetDatasource::SubChanhop* hop_config);
+  private:
+  const ::KismetDatasource::SubChanhop& _internal_hop_config() const;
+  ::KismetDatasource::SubChanhop* _internal_mutable_hop_config();
+  public:
+  void unsafe_arena_set_allocated_hop_config(
+      ::KismetDatasource::SubChanhop* hop_config);
+  ::KismetDatasource::SubChanhop* unsafe_arena_release_hop_config();
+
+  // optional .KismetExternal.MsgbusMessage message = 8;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::KismetExternal::MsgbusMessage& message() const;
+  PROTOBUF_NODISCARD ::KismetExternal::MsgbusMessage* release_message();
+  ::KismetExternal::MsgbusMessage* mutable_message();
+  void set_allocated_message(::KismetExternal::MsgbusMessage* message);
+  private:
+  const ::KismetExternal::MsgbusMessage& _internal_message() const;
+  ::KismetExternal::MsgbusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::KismetExternal::MsgbusMessage* message);
+  ::KismetExternal::MsgbusMessage* unsafe_arena_release_message();
+
+  // optional .KismetDatasource.SubSpecset spectrum = 9;
+  bool has_spectrum() const;
+  private:
+  bool _internal_has_spectrum() const;
+  public:
+  void clear_spectrum();
+  const ::KismetDatasource::SubSpecset& spectrum() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSpecset* release_spectrum();
+  ::KismetDatasource::SubSpecset* mutable_spectrum();
+  void set_allocated_spectrum(::KismetDatasource::SubSpecset* spectrum);
+  private:
+  const ::KismetDatasource::SubSpecset& _internal_spectrum() const;
+  ::KismetDatasource::SubSpecset* _internal_mutable_spectrum();
+  public:
+  void unsafe_arena_set_allocated_spectrum(
+      ::KismetDatasource::SubSpecset* spectrum);
+  ::KismetDatasource::SubSpecset* unsafe_arena_release_spectrum();
+
+  // optional uint32 dlt = 2;
+  bool has_dlt() const;
+  private:
+  bool _internal_has_dlt() const;
+  public:
+  void clear_dlt();
+  uint32_t dlt() const;
+  void set_dlt(uint32_t value);
+  private:
+  uint32_t _internal_dlt() const;
+  void _internal_set_dlt(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.OpenSourceReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr capture_interface_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hardware_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uuid_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr warning_;
+    ::KismetDatasource::SubSuccess* success_;
+    ::KismetDatasource::SubChannels* channels_;
+    ::KismetDatasource::SubChanset* channel_;
+    ::KismetDatasource::SubChanhop* hop_config_;
+    ::KismetExternal::MsgbusMessage* message_;
+    ::KismetDatasource::SubSpecset* spectrum_;
+    uint32_t dlt_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProbeSource final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.ProbeSource) */ {
+ public:
+  inline ProbeSource() : ProbeSource(nullptr) {}
+  ~ProbeSource() override;
+  explicit PROTOBUF_CONSTEXPR ProbeSource(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProbeSource(const ProbeSource& from);
+  ProbeSource(ProbeSource&& from) noexcept
+    : ProbeSource() {
+    *this = ::std::move(from);
+  }
+
+  inline ProbeSource& operator=(const ProbeSource& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProbeSource& operator=(ProbeSource&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ProbeSource& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProbeSource* internal_default_instance() {
+    return reinterpret_cast<const ProbeSource*>(
+               &_ProbeSource_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(ProbeSource& a, ProbeSource& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProbeSource* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProbeSource* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProbeSource* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProbeSource>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ProbeSource& from);
+  void MergeFrom(const ProbeSource& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ProbeSource* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.ProbeSource";
+  }
+  protected:
+  explicit ProbeSource(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDefinitionFieldNumber = 1,
+  };
+  // required string definition = 1;
+  bool has_definition() const;
+  private:
+  bool _internal_has_definition() const;
+  public:
+  void clear_definition();
+  const std::string& definition() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_definition(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_definition();
+  PROTOBUF_NODISCARD std::string* release_definition();
+  void set_allocated_definition(std::string* definition);
+  private:
+  const std::string& _internal_definition() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_definition(const std::string& value);
+  std::string* _internal_mutable_definition();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.ProbeSource)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr definition_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ProbeSourceReport final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.ProbeSourceReport) */ {
+ public:
+  inline ProbeSourceReport() : ProbeSourceReport(nullptr) {}
+  ~ProbeSourceReport() override;
+  explicit PROTOBUF_CONSTEXPR ProbeSourceReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ProbeSourceReport(const ProbeSourceReport& from);
+  ProbeSourceReport(ProbeSourceReport&& from) noexcept
+    : ProbeSourceReport() {
+    *this = ::std::move(from);
+  }
+
+  inline ProbeSourceReport& operator=(const ProbeSourceReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ProbeSourceReport& operator=(ProbeSourceReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const ProbeSourceReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ProbeSourceReport* internal_default_instance() {
+    return reinterpret_cast<const ProbeSourceReport*>(
+               &_ProbeSourceReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    23;
+
+  friend void swap(ProbeSourceReport& a, ProbeSourceReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ProbeSourceReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ProbeSourceReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ProbeSourceReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ProbeSourceReport>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const ProbeSourceReport& from);
+  void MergeFrom(const ProbeSourceReport& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(ProbeSourceReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.ProbeSourceReport";
+  }
+  protected:
+  explicit ProbeSourceReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHardwareFieldNumber = 6,
+    kSuccessFieldNumber = 1,
+    kMessageFieldNumber = 2,
+    kChannelsFieldNumber = 3,
+    kChannelFieldNumber = 4,
+    kSpectrumFieldNumber = 5,
+  };
+  // optional string hardware = 6;
+  bool has_hardware() const;
+  private:
+  bool _internal_has_hardware() const;
+  public:
+  void clear_hardware();
+  const std::string& hardware() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hardware(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hardware();
+  PROTOBUF_NODISCARD std::string* release_hardware();
+  void set_allocated_hardware(std::string* hardware);
+  private:
+  const std::string& _internal_hardware() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hardware(const std::string& value);
+  std::string* _internal_mutable_hardware();
+  public:
+
+  // required .KismetDatasource.SubSuccess success = 1;
+  bool has_success() const;
+  private:
+  bool _internal_has_success() const;
+  public:
+  void clear_success();
+  const ::KismetDatasource::SubSuccess& success() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSuccess* release_success();
+  ::KismetDatasource::SubSuccess* mutable_success();
+  void set_allocated_success(::KismetDatasource::SubSuccess* success);
+  private:
+  const ::KismetDatasource::SubSuccess& _internal_success() const;
+  ::KismetDatasource::SubSuccess* _internal_mutable_success();
+  public:
+  void unsafe_arena_set_allocated_success(
+      ::KismetDatasource::SubSuccess* success);
+  ::KismetDatasource::SubSuccess* unsafe_arena_release_success();
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  bool has_message() const;
+  private:
+  bool _internal_has_message() const;
+  public:
+  void clear_message();
+  const ::KismetExternal::MsgbusMessage& message() const;
+  PROTOBUF_NODISCARD ::KismetExternal::MsgbusMessage* release_message();
+  ::KismetExternal::MsgbusMessage* mutable_message();
+  void set_allocated_message(::KismetExternal::MsgbusMessage* message);
+  private:
+  const ::KismetExternal::MsgbusMessage& _internal_message() const;
+  ::KismetExternal::MsgbusMessage* _internal_mutable_message();
+  public:
+  void unsafe_arena_set_allocated_message(
+      ::KismetExternal::MsgbusMessage* message);
+  ::KismetExternal::MsgbusMessage* unsafe_arena_release_message();
+
+  // optional .KismetDatasource.SubChannels channels = 3;
+  bool has_channels() const;
+  private:
+  bool _internal_has_channels() const;
+  public:
+  void clear_channels();
+  const ::KismetDatasource::SubChannels& channels() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChannels* release_channels();
+  ::KismetDatasource::SubChannels* mutable_channels();
+  void set_allocated_channels(::KismetDatasource::SubChannels* channels);
+  private:
+  const ::KismetDatasource::SubChannels& _internal_channels() const;
+  ::KismetDatasource::SubChannels* _internal_mutable_channels();
+  public:
+  void unsafe_arena_set_allocated_channels(
+      ::KismetDatasource::SubChannels* channels);
+  ::KismetDatasource::SubChannels* unsafe_arena_release_channels();
+
+  // optional .KismetDatasource.SubChanset channel = 4;
+  bool has_channel() const;
+  private:
+  bool _internal_has_channel() const;
+  public:
+  void clear_channel();
+  const ::KismetDatasource::SubChanset& channel() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubChanset* release_channel();
+  ::KismetDatasource::SubChanset* mutable_channel();
+  void set_allocated_channel(::KismetDatasource::SubChanset* channel);
+  private:
+  const ::KismetDatasource::SubChanset& _internal_channel() const;
+  ::KismetDatasource::SubChanset* _internal_mutable_channel();
+  public:
+  void unsafe_arena_set_allocated_channel(
+      ::KismetDatasource::SubChanset* channel);
+  ::KismetDatasource::SubChanset* unsafe_arena_release_channel();
+
+  // optional .KismetDatasource.SubSpecset spectrum = 5;
+  bool has_spectrum() const;
+  private:
+  bool _internal_has_spectrum() const;
+  public:
+  void clear_spectrum();
+  const ::KismetDatasource::SubSpecset& spectrum() const;
+  PROTOBUF_NODISCARD ::KismetDatasource::SubSpecset* release_spectrum();
+  ::KismetDatasource::SubSpecset* mutable_spectrum();
+  void set_allocated_spectrum(::KismetDatasource::SubSpecset* spectrum);
+  private:
+  const ::KismetDatasource::SubSpecset& _internal_spectrum() const;
+  ::KismetDatasource::SubSpecset* _internal_mutable_spectrum();
+  public:
+  void unsafe_arena_set_allocated_spectrum(
+      ::KismetDatasource::SubSpecset* spectrum);
+  ::KismetDatasource::SubSpecset* unsafe_arena_release_spectrum();
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.ProbeSourceReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hardware_;
+    ::KismetDatasource::SubSuccess* success_;
+    ::KismetExternal::MsgbusMessage* message_;
+    ::KismetDatasource::SubChannels* channels_;
+    ::KismetDatasource::SubChanset* channel_;
+    ::KismetDatasource::SubSpecset* spectrum_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WarningReport final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetDatasource.WarningReport) */ {
+ public:
+  inline WarningReport() : WarningReport(nullptr) {}
+  ~WarningReport() override;
+  explicit PROTOBUF_CONSTEXPR WarningReport(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WarningReport(const WarningReport& from);
+  WarningReport(WarningReport&& from) noexcept
+    : WarningReport() {
+    *this = ::std::move(from);
+  }
+
+  inline WarningReport& operator=(const WarningReport& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WarningReport& operator=(WarningReport&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const WarningReport& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WarningReport* internal_default_instance() {
+    return reinterpret_cast<const WarningReport*>(
+               &_WarningReport_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    24;
+
+  friend void swap(WarningReport& a, WarningReport& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WarningReport* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WarningReport* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WarningReport* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WarningReport>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const WarningReport& from);
+  void MergeFrom(const WarningReport& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(WarningReport* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetDatasource.WarningReport";
+  }
+  protected:
+  explicit WarningReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWarningFieldNumber = 1,
+  };
+  // required string warning = 1;
+  bool has_warning() const;
+  private:
+  bool _internal_has_warning() const;
+  public:
+  void clear_warning();
+  const std::string& warning() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_warning(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_warning();
+  PROTOBUF_NODISCARD std::string* release_warning();
+  void set_allocated_warning(std::string* warning);
+  private:
+  const std::string& _internal_warning() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_warning(const std::string& value);
+  std::string* _internal_mutable_warning();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetDatasource.WarningReport)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr warning_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_datasource_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// SubChannels
+
+// repeated string channels = 1;
+inline int SubChannels::_internal_channels_size() const {
+  return _impl_.channels_.size();
+}
+inline int SubChannels::channels_size() const {
+  return _internal_channels_size();
+}
+inline void SubChannels::clear_channels() {
+  _impl_.channels_.Clear();
+}
+inline std::string* SubChannels::add_channels() {
+  std::string* _s = _internal_add_channels();
+  // @@protoc_insertion_point(field_add_mutable:KismetDatasource.SubChannels.channels)
+  return _s;
+}
+inline const std::string& SubChannels::_internal_channels(int index) const {
+  return _impl_.channels_.Get(index);
+}
+inline const std::string& SubChannels::channels(int index) const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubChannels.channels)
+  return _internal_channels(index);
+}
+inline std::string* SubChannels::mutable_channels(int index) {
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubChannels.channels)
+  return _impl_.channels_.Mutable(index);
+}
+inline void SubChannels::set_channels(int index, const std::string& value) {
+  _impl_.channels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChannels.channels)
+}
+inline void SubChannels::set_channels(int index, std::string&& value) {
+  _impl_.channels_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChannels.channels)
+}
+inline void SubChannels::set_channels(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.channels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:KismetDatasource.SubChannels.channels)
+}
+inline void SubChannels::set_channels(int index, const char* value, size_t size) {
+  _impl_.channels_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:KismetDatasource.SubChannels.channels)
+}
+inline std::string* SubChannels::_internal_add_channels() {
+  return _impl_.channels_.Add();
+}
+inline void SubChannels::add_channels(const std::string& value) {
+  _impl_.channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:KismetDatasource.SubChannels.channels)
+}
+inline void SubChannels::add_channels(std::string&& value) {
+  _impl_.channels_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:KismetDatasource.SubChannels.channels)
+}
+inline void SubChannels::add_channels(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:KismetDatasource.SubChannels.channels)
+}
+inline void SubChannels::add_channels(const char* value, size_t size) {
+  _impl_.channels_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:KismetDatasource.SubChannels.channels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SubChannels::channels() const {
+  // @@protoc_insertion_point(field_list:KismetDatasource.SubChannels.channels)
+  return _impl_.channels_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SubChannels::mutable_channels() {
+  // @@protoc_insertion_point(field_mutable_list:KismetDatasource.SubChannels.channels)
+  return &_impl_.channels_;
+}
+
+// -------------------------------------------------------------------
+
+// SubChanset
+
+// required string channel = 1;
+inline bool SubChanset::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubChanset::has_channel() const {
+  return _internal_has_channel();
+}
+inline void SubChanset::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubChanset::channel() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubChanset.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubChanset::set_channel(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChanset.channel)
+}
+inline std::string* SubChanset::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubChanset.channel)
+  return _s;
+}
+inline const std::string& SubChanset::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void SubChanset::_internal_set_channel(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubChanset::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubChanset::release_channel() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubChanset.channel)
+  if (!_internal_has_channel()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.channel_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubChanset::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubChanset.channel)
+}
+
+// -------------------------------------------------------------------
+
+// SubChanhop
+
+// repeated string channels = 1;
+inline int SubChanhop::_internal_channels_size() const {
+  return _impl_.channels_.size();
+}
+inline int SubChanhop::channels_size() const {
+  return _internal_channels_size();
+}
+inline void SubChanhop::clear_channels() {
+  _impl_.channels_.Clear();
+}
+inline std::string* SubChanhop::add_channels() {
+  std::string* _s = _internal_add_channels();
+  // @@protoc_insertion_point(field_add_mutable:KismetDatasource.SubChanhop.channels)
+  return _s;
+}
+inline const std::string& SubChanhop::_internal_channels(int index) const {
+  return _impl_.channels_.Get(index);
+}
+inline const std::string& SubChanhop::channels(int index) const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubChanhop.channels)
+  return _internal_channels(index);
+}
+inline std::string* SubChanhop::mutable_channels(int index) {
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubChanhop.channels)
+  return _impl_.channels_.Mutable(index);
+}
+inline void SubChanhop::set_channels(int index, const std::string& value) {
+  _impl_.channels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChanhop.channels)
+}
+inline void SubChanhop::set_channels(int index, std::string&& value) {
+  _impl_.channels_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChanhop.channels)
+}
+inline void SubChanhop::set_channels(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.channels_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:KismetDatasource.SubChanhop.channels)
+}
+inline void SubChanhop::set_channels(int index, const char* value, size_t size) {
+  _impl_.channels_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:KismetDatasource.SubChanhop.channels)
+}
+inline std::string* SubChanhop::_internal_add_channels() {
+  return _impl_.channels_.Add();
+}
+inline void SubChanhop::add_channels(const std::string& value) {
+  _impl_.channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:KismetDatasource.SubChanhop.channels)
+}
+inline void SubChanhop::add_channels(std::string&& value) {
+  _impl_.channels_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:KismetDatasource.SubChanhop.channels)
+}
+inline void SubChanhop::add_channels(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.channels_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:KismetDatasource.SubChanhop.channels)
+}
+inline void SubChanhop::add_channels(const char* value, size_t size) {
+  _impl_.channels_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:KismetDatasource.SubChanhop.channels)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+SubChanhop::channels() const {
+  // @@protoc_insertion_point(field_list:KismetDatasource.SubChanhop.channels)
+  return _impl_.channels_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+SubChanhop::mutable_channels() {
+  // @@protoc_insertion_point(field_mutable_list:KismetDatasource.SubChanhop.channels)
+  return &_impl_.channels_;
+}
+
+// optional double rate = 2;
+inline bool SubChanhop::_internal_has_rate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubChanhop::has_rate() const {
+  return _internal_has_rate();
+}
+inline void SubChanhop::clear_rate() {
+  _impl_.rate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double SubChanhop::_internal_rate() const {
+  return _impl_.rate_;
+}
+inline double SubChanhop::rate() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubChanhop.rate)
+  return _internal_rate();
+}
+inline void SubChanhop::_internal_set_rate(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.rate_ = value;
+}
+inline void SubChanhop::set_rate(double value) {
+  _internal_set_rate(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChanhop.rate)
+}
+
+// optional bool shuffle = 3;
+inline bool SubChanhop::_internal_has_shuffle() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubChanhop::has_shuffle() const {
+  return _internal_has_shuffle();
+}
+inline void SubChanhop::clear_shuffle() {
+  _impl_.shuffle_ = false;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline bool SubChanhop::_internal_shuffle() const {
+  return _impl_.shuffle_;
+}
+inline bool SubChanhop::shuffle() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubChanhop.shuffle)
+  return _internal_shuffle();
+}
+inline void SubChanhop::_internal_set_shuffle(bool value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.shuffle_ = value;
+}
+inline void SubChanhop::set_shuffle(bool value) {
+  _internal_set_shuffle(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChanhop.shuffle)
+}
+
+// optional uint32 shuffle_skip = 4;
+inline bool SubChanhop::_internal_has_shuffle_skip() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubChanhop::has_shuffle_skip() const {
+  return _internal_has_shuffle_skip();
+}
+inline void SubChanhop::clear_shuffle_skip() {
+  _impl_.shuffle_skip_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t SubChanhop::_internal_shuffle_skip() const {
+  return _impl_.shuffle_skip_;
+}
+inline uint32_t SubChanhop::shuffle_skip() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubChanhop.shuffle_skip)
+  return _internal_shuffle_skip();
+}
+inline void SubChanhop::_internal_set_shuffle_skip(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.shuffle_skip_ = value;
+}
+inline void SubChanhop::set_shuffle_skip(uint32_t value) {
+  _internal_set_shuffle_skip(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChanhop.shuffle_skip)
+}
+
+// optional uint32 offset = 5;
+inline bool SubChanhop::_internal_has_offset() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubChanhop::has_offset() const {
+  return _internal_has_offset();
+}
+inline void SubChanhop::clear_offset() {
+  _impl_.offset_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t SubChanhop::_internal_offset() const {
+  return _impl_.offset_;
+}
+inline uint32_t SubChanhop::offset() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubChanhop.offset)
+  return _internal_offset();
+}
+inline void SubChanhop::_internal_set_offset(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.offset_ = value;
+}
+inline void SubChanhop::set_offset(uint32_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubChanhop.offset)
+}
+
+// -------------------------------------------------------------------
+
+// SubGps
+
+// required double lat = 1;
+inline bool SubGps::_internal_has_lat() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubGps::has_lat() const {
+  return _internal_has_lat();
+}
+inline void SubGps::clear_lat() {
+  _impl_.lat_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SubGps::_internal_lat() const {
+  return _impl_.lat_;
+}
+inline double SubGps::lat() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.lat)
+  return _internal_lat();
+}
+inline void SubGps::_internal_set_lat(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.lat_ = value;
+}
+inline void SubGps::set_lat(double value) {
+  _internal_set_lat(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.lat)
+}
+
+// required double lon = 2;
+inline bool SubGps::_internal_has_lon() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubGps::has_lon() const {
+  return _internal_has_lon();
+}
+inline void SubGps::clear_lon() {
+  _impl_.lon_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SubGps::_internal_lon() const {
+  return _impl_.lon_;
+}
+inline double SubGps::lon() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.lon)
+  return _internal_lon();
+}
+inline void SubGps::_internal_set_lon(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.lon_ = value;
+}
+inline void SubGps::set_lon(double value) {
+  _internal_set_lon(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.lon)
+}
+
+// required double alt = 3;
+inline bool SubGps::_internal_has_alt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SubGps::has_alt() const {
+  return _internal_has_alt();
+}
+inline void SubGps::clear_alt() {
+  _impl_.alt_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SubGps::_internal_alt() const {
+  return _impl_.alt_;
+}
+inline double SubGps::alt() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.alt)
+  return _internal_alt();
+}
+inline void SubGps::_internal_set_alt(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.alt_ = value;
+}
+inline void SubGps::set_alt(double value) {
+  _internal_set_alt(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.alt)
+}
+
+// required double speed = 4;
+inline bool SubGps::_internal_has_speed() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SubGps::has_speed() const {
+  return _internal_has_speed();
+}
+inline void SubGps::clear_speed() {
+  _impl_.speed_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SubGps::_internal_speed() const {
+  return _impl_.speed_;
+}
+inline double SubGps::speed() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.speed)
+  return _internal_speed();
+}
+inline void SubGps::_internal_set_speed(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.speed_ = value;
+}
+inline void SubGps::set_speed(double value) {
+  _internal_set_speed(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.speed)
+}
+
+// required double heading = 5;
+inline bool SubGps::_internal_has_heading() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SubGps::has_heading() const {
+  return _internal_has_heading();
+}
+inline void SubGps::clear_heading() {
+  _impl_.heading_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SubGps::_internal_heading() const {
+  return _impl_.heading_;
+}
+inline double SubGps::heading() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.heading)
+  return _internal_heading();
+}
+inline void SubGps::_internal_set_heading(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.heading_ = value;
+}
+inline void SubGps::set_heading(double value) {
+  _internal_set_heading(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.heading)
+}
+
+// required double precision = 6;
+inline bool SubGps::_internal_has_precision() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  return value;
+}
+inline bool SubGps::has_precision() const {
+  return _internal_has_precision();
+}
+inline void SubGps::clear_precision() {
+  _impl_.precision_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline double SubGps::_internal_precision() const {
+  return _impl_.precision_;
+}
+inline double SubGps::precision() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.precision)
+  return _internal_precision();
+}
+inline void SubGps::_internal_set_precision(double value) {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  _impl_.precision_ = value;
+}
+inline void SubGps::set_precision(double value) {
+  _internal_set_precision(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.precision)
+}
+
+// required uint32 fix = 7;
+inline bool SubGps::_internal_has_fix() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000800u) != 0;
+  return value;
+}
+inline bool SubGps::has_fix() const {
+  return _internal_has_fix();
+}
+inline void SubGps::clear_fix() {
+  _impl_.fix_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000800u;
+}
+inline uint32_t SubGps::_internal_fix() const {
+  return _impl_.fix_;
+}
+inline uint32_t SubGps::fix() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.fix)
+  return _internal_fix();
+}
+inline void SubGps::_internal_set_fix(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000800u;
+  _impl_.fix_ = value;
+}
+inline void SubGps::set_fix(uint32_t value) {
+  _internal_set_fix(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.fix)
+}
+
+// required uint64 time_sec = 8;
+inline bool SubGps::_internal_has_time_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool SubGps::has_time_sec() const {
+  return _internal_has_time_sec();
+}
+inline void SubGps::clear_time_sec() {
+  _impl_.time_sec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline uint64_t SubGps::_internal_time_sec() const {
+  return _impl_.time_sec_;
+}
+inline uint64_t SubGps::time_sec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.time_sec)
+  return _internal_time_sec();
+}
+inline void SubGps::_internal_set_time_sec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.time_sec_ = value;
+}
+inline void SubGps::set_time_sec(uint64_t value) {
+  _internal_set_time_sec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.time_sec)
+}
+
+// required uint64 time_usec = 9;
+inline bool SubGps::_internal_has_time_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  return value;
+}
+inline bool SubGps::has_time_usec() const {
+  return _internal_has_time_usec();
+}
+inline void SubGps::clear_time_usec() {
+  _impl_.time_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline uint64_t SubGps::_internal_time_usec() const {
+  return _impl_.time_usec_;
+}
+inline uint64_t SubGps::time_usec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.time_usec)
+  return _internal_time_usec();
+}
+inline void SubGps::_internal_set_time_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  _impl_.time_usec_ = value;
+}
+inline void SubGps::set_time_usec(uint64_t value) {
+  _internal_set_time_usec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.time_usec)
+}
+
+// required string type = 10;
+inline bool SubGps::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubGps::has_type() const {
+  return _internal_has_type();
+}
+inline void SubGps::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubGps::type() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubGps::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.type)
+}
+inline std::string* SubGps::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubGps.type)
+  return _s;
+}
+inline const std::string& SubGps::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void SubGps::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubGps::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubGps::release_type() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubGps.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubGps::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubGps.type)
+}
+
+// required string name = 11;
+inline bool SubGps::_internal_has_name() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubGps::has_name() const {
+  return _internal_has_name();
+}
+inline void SubGps::clear_name() {
+  _impl_.name_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SubGps::name() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubGps::set_name(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.name)
+}
+inline std::string* SubGps::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubGps.name)
+  return _s;
+}
+inline const std::string& SubGps::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void SubGps::_internal_set_name(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubGps::_internal_mutable_name() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubGps::release_name() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubGps.name)
+  if (!_internal_has_name()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.name_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubGps::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubGps.name)
+}
+
+// optional double high_prec_time = 12;
+inline bool SubGps::_internal_has_high_prec_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool SubGps::has_high_prec_time() const {
+  return _internal_has_high_prec_time();
+}
+inline void SubGps::clear_high_prec_time() {
+  _impl_.high_prec_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline double SubGps::_internal_high_prec_time() const {
+  return _impl_.high_prec_time_;
+}
+inline double SubGps::high_prec_time() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubGps.high_prec_time)
+  return _internal_high_prec_time();
+}
+inline void SubGps::_internal_set_high_prec_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.high_prec_time_ = value;
+}
+inline void SubGps::set_high_prec_time(double value) {
+  _internal_set_high_prec_time(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubGps.high_prec_time)
+}
+
+// -------------------------------------------------------------------
+
+// SubInterface
+
+// required string interface = 1;
+inline bool SubInterface::_internal_has_interface() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubInterface::has_interface() const {
+  return _internal_has_interface();
+}
+inline void SubInterface::clear_interface() {
+  _impl_.interface_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubInterface::interface() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubInterface.interface)
+  return _internal_interface();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubInterface::set_interface(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.interface_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubInterface.interface)
+}
+inline std::string* SubInterface::mutable_interface() {
+  std::string* _s = _internal_mutable_interface();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubInterface.interface)
+  return _s;
+}
+inline const std::string& SubInterface::_internal_interface() const {
+  return _impl_.interface_.Get();
+}
+inline void SubInterface::_internal_set_interface(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.interface_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubInterface::_internal_mutable_interface() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.interface_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubInterface::release_interface() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubInterface.interface)
+  if (!_internal_has_interface()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.interface_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.interface_.IsDefault()) {
+    _impl_.interface_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubInterface::set_allocated_interface(std::string* interface) {
+  if (interface != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.interface_.SetAllocated(interface, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.interface_.IsDefault()) {
+    _impl_.interface_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubInterface.interface)
+}
+
+// required string flags = 2;
+inline bool SubInterface::_internal_has_flags() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubInterface::has_flags() const {
+  return _internal_has_flags();
+}
+inline void SubInterface::clear_flags() {
+  _impl_.flags_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SubInterface::flags() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubInterface.flags)
+  return _internal_flags();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubInterface::set_flags(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.flags_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubInterface.flags)
+}
+inline std::string* SubInterface::mutable_flags() {
+  std::string* _s = _internal_mutable_flags();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubInterface.flags)
+  return _s;
+}
+inline const std::string& SubInterface::_internal_flags() const {
+  return _impl_.flags_.Get();
+}
+inline void SubInterface::_internal_set_flags(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.flags_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubInterface::_internal_mutable_flags() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.flags_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubInterface::release_flags() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubInterface.flags)
+  if (!_internal_has_flags()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.flags_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.flags_.IsDefault()) {
+    _impl_.flags_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubInterface::set_allocated_flags(std::string* flags) {
+  if (flags != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.flags_.SetAllocated(flags, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.flags_.IsDefault()) {
+    _impl_.flags_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubInterface.flags)
+}
+
+// optional string hardware = 3;
+inline bool SubInterface::_internal_has_hardware() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubInterface::has_hardware() const {
+  return _internal_has_hardware();
+}
+inline void SubInterface::clear_hardware() {
+  _impl_.hardware_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& SubInterface::hardware() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubInterface.hardware)
+  return _internal_hardware();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubInterface::set_hardware(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.hardware_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubInterface.hardware)
+}
+inline std::string* SubInterface::mutable_hardware() {
+  std::string* _s = _internal_mutable_hardware();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubInterface.hardware)
+  return _s;
+}
+inline const std::string& SubInterface::_internal_hardware() const {
+  return _impl_.hardware_.Get();
+}
+inline void SubInterface::_internal_set_hardware(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.hardware_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubInterface::_internal_mutable_hardware() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.hardware_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubInterface::release_hardware() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubInterface.hardware)
+  if (!_internal_has_hardware()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.hardware_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hardware_.IsDefault()) {
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubInterface::set_allocated_hardware(std::string* hardware) {
+  if (hardware != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.hardware_.SetAllocated(hardware, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hardware_.IsDefault()) {
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubInterface.hardware)
+}
+
+// optional string capinterface = 4;
+inline bool SubInterface::_internal_has_capinterface() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubInterface::has_capinterface() const {
+  return _internal_has_capinterface();
+}
+inline void SubInterface::clear_capinterface() {
+  _impl_.capinterface_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& SubInterface::capinterface() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubInterface.capinterface)
+  return _internal_capinterface();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubInterface::set_capinterface(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.capinterface_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubInterface.capinterface)
+}
+inline std::string* SubInterface::mutable_capinterface() {
+  std::string* _s = _internal_mutable_capinterface();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubInterface.capinterface)
+  return _s;
+}
+inline const std::string& SubInterface::_internal_capinterface() const {
+  return _impl_.capinterface_.Get();
+}
+inline void SubInterface::_internal_set_capinterface(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.capinterface_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubInterface::_internal_mutable_capinterface() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.capinterface_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubInterface::release_capinterface() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubInterface.capinterface)
+  if (!_internal_has_capinterface()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.capinterface_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.capinterface_.IsDefault()) {
+    _impl_.capinterface_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubInterface::set_allocated_capinterface(std::string* capinterface) {
+  if (capinterface != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.capinterface_.SetAllocated(capinterface, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.capinterface_.IsDefault()) {
+    _impl_.capinterface_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubInterface.capinterface)
+}
+
+// -------------------------------------------------------------------
+
+// SubPacket
+
+// required uint64 time_sec = 1;
+inline bool SubPacket::_internal_has_time_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubPacket::has_time_sec() const {
+  return _internal_has_time_sec();
+}
+inline void SubPacket::clear_time_sec() {
+  _impl_.time_sec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SubPacket::_internal_time_sec() const {
+  return _impl_.time_sec_;
+}
+inline uint64_t SubPacket::time_sec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubPacket.time_sec)
+  return _internal_time_sec();
+}
+inline void SubPacket::_internal_set_time_sec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.time_sec_ = value;
+}
+inline void SubPacket::set_time_sec(uint64_t value) {
+  _internal_set_time_sec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubPacket.time_sec)
+}
+
+// required uint64 time_usec = 2;
+inline bool SubPacket::_internal_has_time_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubPacket::has_time_usec() const {
+  return _internal_has_time_usec();
+}
+inline void SubPacket::clear_time_usec() {
+  _impl_.time_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SubPacket::_internal_time_usec() const {
+  return _impl_.time_usec_;
+}
+inline uint64_t SubPacket::time_usec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubPacket.time_usec)
+  return _internal_time_usec();
+}
+inline void SubPacket::_internal_set_time_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.time_usec_ = value;
+}
+inline void SubPacket::set_time_usec(uint64_t value) {
+  _internal_set_time_usec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubPacket.time_usec)
+}
+
+// required uint32 dlt = 3;
+inline bool SubPacket::_internal_has_dlt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SubPacket::has_dlt() const {
+  return _internal_has_dlt();
+}
+inline void SubPacket::clear_dlt() {
+  _impl_.dlt_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint32_t SubPacket::_internal_dlt() const {
+  return _impl_.dlt_;
+}
+inline uint32_t SubPacket::dlt() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubPacket.dlt)
+  return _internal_dlt();
+}
+inline void SubPacket::_internal_set_dlt(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.dlt_ = value;
+}
+inline void SubPacket::set_dlt(uint32_t value) {
+  _internal_set_dlt(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubPacket.dlt)
+}
+
+// required uint64 size = 4;
+inline bool SubPacket::_internal_has_size() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubPacket::has_size() const {
+  return _internal_has_size();
+}
+inline void SubPacket::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SubPacket::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t SubPacket::size() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubPacket.size)
+  return _internal_size();
+}
+inline void SubPacket::_internal_set_size(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.size_ = value;
+}
+inline void SubPacket::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubPacket.size)
+}
+
+// required bytes data = 5;
+inline bool SubPacket::_internal_has_data() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubPacket::has_data() const {
+  return _internal_has_data();
+}
+inline void SubPacket::clear_data() {
+  _impl_.data_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubPacket::data() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubPacket.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubPacket::set_data(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubPacket.data)
+}
+inline std::string* SubPacket::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubPacket.data)
+  return _s;
+}
+inline const std::string& SubPacket::_internal_data() const {
+  return _impl_.data_.Get();
+}
+inline void SubPacket::_internal_set_data(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubPacket::_internal_mutable_data() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubPacket::release_data() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubPacket.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubPacket::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.data_.IsDefault()) {
+    _impl_.data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubPacket.data)
+}
+
+// -------------------------------------------------------------------
+
+// SubJson
+
+// required uint64 time_sec = 1;
+inline bool SubJson::_internal_has_time_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubJson::has_time_sec() const {
+  return _internal_has_time_sec();
+}
+inline void SubJson::clear_time_sec() {
+  _impl_.time_sec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SubJson::_internal_time_sec() const {
+  return _impl_.time_sec_;
+}
+inline uint64_t SubJson::time_sec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubJson.time_sec)
+  return _internal_time_sec();
+}
+inline void SubJson::_internal_set_time_sec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.time_sec_ = value;
+}
+inline void SubJson::set_time_sec(uint64_t value) {
+  _internal_set_time_sec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubJson.time_sec)
+}
+
+// required uint64 time_usec = 2;
+inline bool SubJson::_internal_has_time_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubJson::has_time_usec() const {
+  return _internal_has_time_usec();
+}
+inline void SubJson::clear_time_usec() {
+  _impl_.time_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SubJson::_internal_time_usec() const {
+  return _impl_.time_usec_;
+}
+inline uint64_t SubJson::time_usec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubJson.time_usec)
+  return _internal_time_usec();
+}
+inline void SubJson::_internal_set_time_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.time_usec_ = value;
+}
+inline void SubJson::set_time_usec(uint64_t value) {
+  _internal_set_time_usec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubJson.time_usec)
+}
+
+// required string type = 3;
+inline bool SubJson::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubJson::has_type() const {
+  return _internal_has_type();
+}
+inline void SubJson::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubJson::type() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubJson.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubJson::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubJson.type)
+}
+inline std::string* SubJson::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubJson.type)
+  return _s;
+}
+inline const std::string& SubJson::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void SubJson::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubJson::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubJson::release_type() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubJson.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubJson::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubJson.type)
+}
+
+// required string json = 4;
+inline bool SubJson::_internal_has_json() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubJson::has_json() const {
+  return _internal_has_json();
+}
+inline void SubJson::clear_json() {
+  _impl_.json_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SubJson::json() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubJson.json)
+  return _internal_json();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubJson::set_json(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.json_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubJson.json)
+}
+inline std::string* SubJson::mutable_json() {
+  std::string* _s = _internal_mutable_json();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubJson.json)
+  return _s;
+}
+inline const std::string& SubJson::_internal_json() const {
+  return _impl_.json_.Get();
+}
+inline void SubJson::_internal_set_json(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.json_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubJson::_internal_mutable_json() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.json_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubJson::release_json() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubJson.json)
+  if (!_internal_has_json()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.json_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.json_.IsDefault()) {
+    _impl_.json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubJson::set_allocated_json(std::string* json) {
+  if (json != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.json_.SetAllocated(json, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.json_.IsDefault()) {
+    _impl_.json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubJson.json)
+}
+
+// -------------------------------------------------------------------
+
+// SubBuffer
+
+// required uint64 time_sec = 1;
+inline bool SubBuffer::_internal_has_time_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubBuffer::has_time_sec() const {
+  return _internal_has_time_sec();
+}
+inline void SubBuffer::clear_time_sec() {
+  _impl_.time_sec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t SubBuffer::_internal_time_sec() const {
+  return _impl_.time_sec_;
+}
+inline uint64_t SubBuffer::time_sec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubBuffer.time_sec)
+  return _internal_time_sec();
+}
+inline void SubBuffer::_internal_set_time_sec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.time_sec_ = value;
+}
+inline void SubBuffer::set_time_sec(uint64_t value) {
+  _internal_set_time_sec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubBuffer.time_sec)
+}
+
+// required uint64 time_usec = 2;
+inline bool SubBuffer::_internal_has_time_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubBuffer::has_time_usec() const {
+  return _internal_has_time_usec();
+}
+inline void SubBuffer::clear_time_usec() {
+  _impl_.time_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t SubBuffer::_internal_time_usec() const {
+  return _impl_.time_usec_;
+}
+inline uint64_t SubBuffer::time_usec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubBuffer.time_usec)
+  return _internal_time_usec();
+}
+inline void SubBuffer::_internal_set_time_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.time_usec_ = value;
+}
+inline void SubBuffer::set_time_usec(uint64_t value) {
+  _internal_set_time_usec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubBuffer.time_usec)
+}
+
+// required string type = 3;
+inline bool SubBuffer::_internal_has_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubBuffer::has_type() const {
+  return _internal_has_type();
+}
+inline void SubBuffer::clear_type() {
+  _impl_.type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubBuffer::type() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubBuffer.type)
+  return _internal_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubBuffer::set_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubBuffer.type)
+}
+inline std::string* SubBuffer::mutable_type() {
+  std::string* _s = _internal_mutable_type();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubBuffer.type)
+  return _s;
+}
+inline const std::string& SubBuffer::_internal_type() const {
+  return _impl_.type_.Get();
+}
+inline void SubBuffer::_internal_set_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubBuffer::_internal_mutable_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubBuffer::release_type() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubBuffer.type)
+  if (!_internal_has_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubBuffer::set_allocated_type(std::string* type) {
+  if (type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.type_.SetAllocated(type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.type_.IsDefault()) {
+    _impl_.type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubBuffer.type)
+}
+
+// required bytes buffer = 4;
+inline bool SubBuffer::_internal_has_buffer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubBuffer::has_buffer() const {
+  return _internal_has_buffer();
+}
+inline void SubBuffer::clear_buffer() {
+  _impl_.buffer_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SubBuffer::buffer() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubBuffer.buffer)
+  return _internal_buffer();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubBuffer::set_buffer(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.buffer_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubBuffer.buffer)
+}
+inline std::string* SubBuffer::mutable_buffer() {
+  std::string* _s = _internal_mutable_buffer();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubBuffer.buffer)
+  return _s;
+}
+inline const std::string& SubBuffer::_internal_buffer() const {
+  return _impl_.buffer_.Get();
+}
+inline void SubBuffer::_internal_set_buffer(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.buffer_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubBuffer::_internal_mutable_buffer() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.buffer_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubBuffer::release_buffer() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubBuffer.buffer)
+  if (!_internal_has_buffer()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.buffer_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.buffer_.IsDefault()) {
+    _impl_.buffer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubBuffer::set_allocated_buffer(std::string* buffer) {
+  if (buffer != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.buffer_.SetAllocated(buffer, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.buffer_.IsDefault()) {
+    _impl_.buffer_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubBuffer.buffer)
+}
+
+// -------------------------------------------------------------------
+
+// SubSignal
+
+// optional double signal_dbm = 1;
+inline bool SubSignal::_internal_has_signal_dbm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubSignal::has_signal_dbm() const {
+  return _internal_has_signal_dbm();
+}
+inline void SubSignal::clear_signal_dbm() {
+  _impl_.signal_dbm_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SubSignal::_internal_signal_dbm() const {
+  return _impl_.signal_dbm_;
+}
+inline double SubSignal::signal_dbm() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSignal.signal_dbm)
+  return _internal_signal_dbm();
+}
+inline void SubSignal::_internal_set_signal_dbm(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.signal_dbm_ = value;
+}
+inline void SubSignal::set_signal_dbm(double value) {
+  _internal_set_signal_dbm(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSignal.signal_dbm)
+}
+
+// optional double noise_dbm = 2;
+inline bool SubSignal::_internal_has_noise_dbm() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubSignal::has_noise_dbm() const {
+  return _internal_has_noise_dbm();
+}
+inline void SubSignal::clear_noise_dbm() {
+  _impl_.noise_dbm_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SubSignal::_internal_noise_dbm() const {
+  return _impl_.noise_dbm_;
+}
+inline double SubSignal::noise_dbm() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSignal.noise_dbm)
+  return _internal_noise_dbm();
+}
+inline void SubSignal::_internal_set_noise_dbm(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.noise_dbm_ = value;
+}
+inline void SubSignal::set_noise_dbm(double value) {
+  _internal_set_noise_dbm(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSignal.noise_dbm)
+}
+
+// optional double signal_rssi = 3;
+inline bool SubSignal::_internal_has_signal_rssi() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubSignal::has_signal_rssi() const {
+  return _internal_has_signal_rssi();
+}
+inline void SubSignal::clear_signal_rssi() {
+  _impl_.signal_rssi_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SubSignal::_internal_signal_rssi() const {
+  return _impl_.signal_rssi_;
+}
+inline double SubSignal::signal_rssi() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSignal.signal_rssi)
+  return _internal_signal_rssi();
+}
+inline void SubSignal::_internal_set_signal_rssi(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.signal_rssi_ = value;
+}
+inline void SubSignal::set_signal_rssi(double value) {
+  _internal_set_signal_rssi(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSignal.signal_rssi)
+}
+
+// optional double noise_rssi = 4;
+inline bool SubSignal::_internal_has_noise_rssi() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SubSignal::has_noise_rssi() const {
+  return _internal_has_noise_rssi();
+}
+inline void SubSignal::clear_noise_rssi() {
+  _impl_.noise_rssi_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SubSignal::_internal_noise_rssi() const {
+  return _impl_.noise_rssi_;
+}
+inline double SubSignal::noise_rssi() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSignal.noise_rssi)
+  return _internal_noise_rssi();
+}
+inline void SubSignal::_internal_set_noise_rssi(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.noise_rssi_ = value;
+}
+inline void SubSignal::set_noise_rssi(double value) {
+  _internal_set_noise_rssi(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSignal.noise_rssi)
+}
+
+// optional double freq_khz = 5;
+inline bool SubSignal::_internal_has_freq_khz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SubSignal::has_freq_khz() const {
+  return _internal_has_freq_khz();
+}
+inline void SubSignal::clear_freq_khz() {
+  _impl_.freq_khz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline double SubSignal::_internal_freq_khz() const {
+  return _impl_.freq_khz_;
+}
+inline double SubSignal::freq_khz() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSignal.freq_khz)
+  return _internal_freq_khz();
+}
+inline void SubSignal::_internal_set_freq_khz(double value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.freq_khz_ = value;
+}
+inline void SubSignal::set_freq_khz(double value) {
+  _internal_set_freq_khz(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSignal.freq_khz)
+}
+
+// optional string channel = 6;
+inline bool SubSignal::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubSignal::has_channel() const {
+  return _internal_has_channel();
+}
+inline void SubSignal::clear_channel() {
+  _impl_.channel_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubSignal::channel() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSignal.channel)
+  return _internal_channel();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubSignal::set_channel(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.channel_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSignal.channel)
+}
+inline std::string* SubSignal::mutable_channel() {
+  std::string* _s = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.SubSignal.channel)
+  return _s;
+}
+inline const std::string& SubSignal::_internal_channel() const {
+  return _impl_.channel_.Get();
+}
+inline void SubSignal::_internal_set_channel(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.channel_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubSignal::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.channel_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubSignal::release_channel() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.SubSignal.channel)
+  if (!_internal_has_channel()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.channel_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubSignal::set_allocated_channel(std::string* channel) {
+  if (channel != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.channel_.SetAllocated(channel, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.channel_.IsDefault()) {
+    _impl_.channel_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.SubSignal.channel)
+}
+
+// optional double datarate = 7;
+inline bool SubSignal::_internal_has_datarate() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SubSignal::has_datarate() const {
+  return _internal_has_datarate();
+}
+inline void SubSignal::clear_datarate() {
+  _impl_.datarate_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline double SubSignal::_internal_datarate() const {
+  return _impl_.datarate_;
+}
+inline double SubSignal::datarate() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSignal.datarate)
+  return _internal_datarate();
+}
+inline void SubSignal::_internal_set_datarate(double value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.datarate_ = value;
+}
+inline void SubSignal::set_datarate(double value) {
+  _internal_set_datarate(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSignal.datarate)
+}
+
+// -------------------------------------------------------------------
+
+// SubSpecset
+
+// optional double start_mhz = 1;
+inline bool SubSpecset::_internal_has_start_mhz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubSpecset::has_start_mhz() const {
+  return _internal_has_start_mhz();
+}
+inline void SubSpecset::clear_start_mhz() {
+  _impl_.start_mhz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline double SubSpecset::_internal_start_mhz() const {
+  return _impl_.start_mhz_;
+}
+inline double SubSpecset::start_mhz() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpecset.start_mhz)
+  return _internal_start_mhz();
+}
+inline void SubSpecset::_internal_set_start_mhz(double value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.start_mhz_ = value;
+}
+inline void SubSpecset::set_start_mhz(double value) {
+  _internal_set_start_mhz(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpecset.start_mhz)
+}
+
+// optional double end_mhz = 2;
+inline bool SubSpecset::_internal_has_end_mhz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubSpecset::has_end_mhz() const {
+  return _internal_has_end_mhz();
+}
+inline void SubSpecset::clear_end_mhz() {
+  _impl_.end_mhz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline double SubSpecset::_internal_end_mhz() const {
+  return _impl_.end_mhz_;
+}
+inline double SubSpecset::end_mhz() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpecset.end_mhz)
+  return _internal_end_mhz();
+}
+inline void SubSpecset::_internal_set_end_mhz(double value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.end_mhz_ = value;
+}
+inline void SubSpecset::set_end_mhz(double value) {
+  _internal_set_end_mhz(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpecset.end_mhz)
+}
+
+// optional double samples_per_bucket = 3;
+inline bool SubSpecset::_internal_has_samples_per_bucket() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubSpecset::has_samples_per_bucket() const {
+  return _internal_has_samples_per_bucket();
+}
+inline void SubSpecset::clear_samples_per_bucket() {
+  _impl_.samples_per_bucket_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SubSpecset::_internal_samples_per_bucket() const {
+  return _impl_.samples_per_bucket_;
+}
+inline double SubSpecset::samples_per_bucket() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpecset.samples_per_bucket)
+  return _internal_samples_per_bucket();
+}
+inline void SubSpecset::_internal_set_samples_per_bucket(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.samples_per_bucket_ = value;
+}
+inline void SubSpecset::set_samples_per_bucket(double value) {
+  _internal_set_samples_per_bucket(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpecset.samples_per_bucket)
+}
+
+// optional double bucket_width_hz = 4;
+inline bool SubSpecset::_internal_has_bucket_width_hz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubSpecset::has_bucket_width_hz() const {
+  return _internal_has_bucket_width_hz();
+}
+inline void SubSpecset::clear_bucket_width_hz() {
+  _impl_.bucket_width_hz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SubSpecset::_internal_bucket_width_hz() const {
+  return _impl_.bucket_width_hz_;
+}
+inline double SubSpecset::bucket_width_hz() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpecset.bucket_width_hz)
+  return _internal_bucket_width_hz();
+}
+inline void SubSpecset::_internal_set_bucket_width_hz(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.bucket_width_hz_ = value;
+}
+inline void SubSpecset::set_bucket_width_hz(double value) {
+  _internal_set_bucket_width_hz(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpecset.bucket_width_hz)
+}
+
+// optional bool enable_amp = 5;
+inline bool SubSpecset::_internal_has_enable_amp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool SubSpecset::has_enable_amp() const {
+  return _internal_has_enable_amp();
+}
+inline void SubSpecset::clear_enable_amp() {
+  _impl_.enable_amp_ = false;
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline bool SubSpecset::_internal_enable_amp() const {
+  return _impl_.enable_amp_;
+}
+inline bool SubSpecset::enable_amp() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpecset.enable_amp)
+  return _internal_enable_amp();
+}
+inline void SubSpecset::_internal_set_enable_amp(bool value) {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  _impl_.enable_amp_ = value;
+}
+inline void SubSpecset::set_enable_amp(bool value) {
+  _internal_set_enable_amp(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpecset.enable_amp)
+}
+
+// optional uint64 if_amp = 6;
+inline bool SubSpecset::_internal_has_if_amp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SubSpecset::has_if_amp() const {
+  return _internal_has_if_amp();
+}
+inline void SubSpecset::clear_if_amp() {
+  _impl_.if_amp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline uint64_t SubSpecset::_internal_if_amp() const {
+  return _impl_.if_amp_;
+}
+inline uint64_t SubSpecset::if_amp() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpecset.if_amp)
+  return _internal_if_amp();
+}
+inline void SubSpecset::_internal_set_if_amp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.if_amp_ = value;
+}
+inline void SubSpecset::set_if_amp(uint64_t value) {
+  _internal_set_if_amp(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpecset.if_amp)
+}
+
+// optional uint64 baseband_amp = 7;
+inline bool SubSpecset::_internal_has_baseband_amp() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool SubSpecset::has_baseband_amp() const {
+  return _internal_has_baseband_amp();
+}
+inline void SubSpecset::clear_baseband_amp() {
+  _impl_.baseband_amp_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t SubSpecset::_internal_baseband_amp() const {
+  return _impl_.baseband_amp_;
+}
+inline uint64_t SubSpecset::baseband_amp() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpecset.baseband_amp)
+  return _internal_baseband_amp();
+}
+inline void SubSpecset::_internal_set_baseband_amp(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  _impl_.baseband_amp_ = value;
+}
+inline void SubSpecset::set_baseband_amp(uint64_t value) {
+  _internal_set_baseband_amp(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpecset.baseband_amp)
+}
+
+// -------------------------------------------------------------------
+
+// SubSpectrum
+
+// optional uint64 time_sec = 1;
+inline bool SubSpectrum::_internal_has_time_sec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubSpectrum::has_time_sec() const {
+  return _internal_has_time_sec();
+}
+inline void SubSpectrum::clear_time_sec() {
+  _impl_.time_sec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t SubSpectrum::_internal_time_sec() const {
+  return _impl_.time_sec_;
+}
+inline uint64_t SubSpectrum::time_sec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpectrum.time_sec)
+  return _internal_time_sec();
+}
+inline void SubSpectrum::_internal_set_time_sec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.time_sec_ = value;
+}
+inline void SubSpectrum::set_time_sec(uint64_t value) {
+  _internal_set_time_sec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpectrum.time_sec)
+}
+
+// optional uint64 time_usec = 2;
+inline bool SubSpectrum::_internal_has_time_usec() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubSpectrum::has_time_usec() const {
+  return _internal_has_time_usec();
+}
+inline void SubSpectrum::clear_time_usec() {
+  _impl_.time_usec_ = uint64_t{0u};
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t SubSpectrum::_internal_time_usec() const {
+  return _impl_.time_usec_;
+}
+inline uint64_t SubSpectrum::time_usec() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpectrum.time_usec)
+  return _internal_time_usec();
+}
+inline void SubSpectrum::_internal_set_time_usec(uint64_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.time_usec_ = value;
+}
+inline void SubSpectrum::set_time_usec(uint64_t value) {
+  _internal_set_time_usec(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpectrum.time_usec)
+}
+
+// optional double start_mhz = 3;
+inline bool SubSpectrum::_internal_has_start_mhz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool SubSpectrum::has_start_mhz() const {
+  return _internal_has_start_mhz();
+}
+inline void SubSpectrum::clear_start_mhz() {
+  _impl_.start_mhz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline double SubSpectrum::_internal_start_mhz() const {
+  return _impl_.start_mhz_;
+}
+inline double SubSpectrum::start_mhz() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpectrum.start_mhz)
+  return _internal_start_mhz();
+}
+inline void SubSpectrum::_internal_set_start_mhz(double value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.start_mhz_ = value;
+}
+inline void SubSpectrum::set_start_mhz(double value) {
+  _internal_set_start_mhz(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpectrum.start_mhz)
+}
+
+// optional double end_mhz = 4;
+inline bool SubSpectrum::_internal_has_end_mhz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool SubSpectrum::has_end_mhz() const {
+  return _internal_has_end_mhz();
+}
+inline void SubSpectrum::clear_end_mhz() {
+  _impl_.end_mhz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline double SubSpectrum::_internal_end_mhz() const {
+  return _impl_.end_mhz_;
+}
+inline double SubSpectrum::end_mhz() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpectrum.end_mhz)
+  return _internal_end_mhz();
+}
+inline void SubSpectrum::_internal_set_end_mhz(double value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.end_mhz_ = value;
+}
+inline void SubSpectrum::set_end_mhz(double value) {
+  _internal_set_end_mhz(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpectrum.end_mhz)
+}
+
+// optional double bucket_width_hz = 5;
+inline bool SubSpectrum::_internal_has_bucket_width_hz() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool SubSpectrum::has_bucket_width_hz() const {
+  return _internal_has_bucket_width_hz();
+}
+inline void SubSpectrum::clear_bucket_width_hz() {
+  _impl_.bucket_width_hz_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline double SubSpectrum::_internal_bucket_width_hz() const {
+  return _impl_.bucket_width_hz_;
+}
+inline double SubSpectrum::bucket_width_hz() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpectrum.bucket_width_hz)
+  return _internal_bucket_width_hz();
+}
+inline void SubSpectrum::_internal_set_bucket_width_hz(double value) {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  _impl_.bucket_width_hz_ = value;
+}
+inline void SubSpectrum::set_bucket_width_hz(double value) {
+  _internal_set_bucket_width_hz(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpectrum.bucket_width_hz)
+}
+
+// repeated int32 data = 6;
+inline int SubSpectrum::_internal_data_size() const {
+  return _impl_.data_.size();
+}
+inline int SubSpectrum::data_size() const {
+  return _internal_data_size();
+}
+inline void SubSpectrum::clear_data() {
+  _impl_.data_.Clear();
+}
+inline int32_t SubSpectrum::_internal_data(int index) const {
+  return _impl_.data_.Get(index);
+}
+inline int32_t SubSpectrum::data(int index) const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSpectrum.data)
+  return _internal_data(index);
+}
+inline void SubSpectrum::set_data(int index, int32_t value) {
+  _impl_.data_.Set(index, value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSpectrum.data)
+}
+inline void SubSpectrum::_internal_add_data(int32_t value) {
+  _impl_.data_.Add(value);
+}
+inline void SubSpectrum::add_data(int32_t value) {
+  _internal_add_data(value);
+  // @@protoc_insertion_point(field_add:KismetDatasource.SubSpectrum.data)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SubSpectrum::_internal_data() const {
+  return _impl_.data_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >&
+SubSpectrum::data() const {
+  // @@protoc_insertion_point(field_list:KismetDatasource.SubSpectrum.data)
+  return _internal_data();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SubSpectrum::_internal_mutable_data() {
+  return &_impl_.data_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< int32_t >*
+SubSpectrum::mutable_data() {
+  // @@protoc_insertion_point(field_mutable_list:KismetDatasource.SubSpectrum.data)
+  return _internal_mutable_data();
+}
+
+// -------------------------------------------------------------------
+
+// SubSuccess
+
+// required bool success = 1;
+inline bool SubSuccess::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubSuccess::has_success() const {
+  return _internal_has_success();
+}
+inline void SubSuccess::clear_success() {
+  _impl_.success_ = false;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline bool SubSuccess::_internal_success() const {
+  return _impl_.success_;
+}
+inline bool SubSuccess::success() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSuccess.success)
+  return _internal_success();
+}
+inline void SubSuccess::_internal_set_success(bool value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.success_ = value;
+}
+inline void SubSuccess::set_success(bool value) {
+  _internal_set_success(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSuccess.success)
+}
+
+// required uint32 seqno = 2;
+inline bool SubSuccess::_internal_has_seqno() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubSuccess::has_seqno() const {
+  return _internal_has_seqno();
+}
+inline void SubSuccess::clear_seqno() {
+  _impl_.seqno_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t SubSuccess::_internal_seqno() const {
+  return _impl_.seqno_;
+}
+inline uint32_t SubSuccess::seqno() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.SubSuccess.seqno)
+  return _internal_seqno();
+}
+inline void SubSuccess::_internal_set_seqno(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.seqno_ = value;
+}
+inline void SubSuccess::set_seqno(uint32_t value) {
+  _internal_set_seqno(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.SubSuccess.seqno)
+}
+
+// -------------------------------------------------------------------
+
+// CloseDatasource
+
+// -------------------------------------------------------------------
+
+// Configure
+
+// optional .KismetDatasource.SubChanset channel = 1;
+inline bool Configure::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channel_ != nullptr);
+  return value;
+}
+inline bool Configure::has_channel() const {
+  return _internal_has_channel();
+}
+inline void Configure::clear_channel() {
+  if (_impl_.channel_ != nullptr) _impl_.channel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::KismetDatasource::SubChanset& Configure::_internal_channel() const {
+  const ::KismetDatasource::SubChanset* p = _impl_.channel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChanset&>(
+      ::KismetDatasource::_SubChanset_default_instance_);
+}
+inline const ::KismetDatasource::SubChanset& Configure::channel() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.Configure.channel)
+  return _internal_channel();
+}
+inline void Configure::unsafe_arena_set_allocated_channel(
+    ::KismetDatasource::SubChanset* channel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channel_);
+  }
+  _impl_.channel_ = channel;
+  if (channel) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.Configure.channel)
+}
+inline ::KismetDatasource::SubChanset* Configure::release_channel() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* Configure::unsafe_arena_release_channel() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.Configure.channel)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* Configure::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.channel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChanset>(GetArenaForAllocation());
+    _impl_.channel_ = p;
+  }
+  return _impl_.channel_;
+}
+inline ::KismetDatasource::SubChanset* Configure::mutable_channel() {
+  ::KismetDatasource::SubChanset* _msg = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.Configure.channel)
+  return _msg;
+}
+inline void Configure::set_allocated_channel(::KismetDatasource::SubChanset* channel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channel_;
+  }
+  if (channel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channel);
+    if (message_arena != submessage_arena) {
+      channel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.channel_ = channel;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.Configure.channel)
+}
+
+// optional .KismetDatasource.SubChanhop hopping = 2;
+inline bool Configure::_internal_has_hopping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hopping_ != nullptr);
+  return value;
+}
+inline bool Configure::has_hopping() const {
+  return _internal_has_hopping();
+}
+inline void Configure::clear_hopping() {
+  if (_impl_.hopping_ != nullptr) _impl_.hopping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::KismetDatasource::SubChanhop& Configure::_internal_hopping() const {
+  const ::KismetDatasource::SubChanhop* p = _impl_.hopping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChanhop&>(
+      ::KismetDatasource::_SubChanhop_default_instance_);
+}
+inline const ::KismetDatasource::SubChanhop& Configure::hopping() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.Configure.hopping)
+  return _internal_hopping();
+}
+inline void Configure::unsafe_arena_set_allocated_hopping(
+    ::KismetDatasource::SubChanhop* hopping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hopping_);
+  }
+  _impl_.hopping_ = hopping;
+  if (hopping) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.Configure.hopping)
+}
+inline ::KismetDatasource::SubChanhop* Configure::release_hopping() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubChanhop* temp = _impl_.hopping_;
+  _impl_.hopping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChanhop* Configure::unsafe_arena_release_hopping() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.Configure.hopping)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubChanhop* temp = _impl_.hopping_;
+  _impl_.hopping_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChanhop* Configure::_internal_mutable_hopping() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.hopping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChanhop>(GetArenaForAllocation());
+    _impl_.hopping_ = p;
+  }
+  return _impl_.hopping_;
+}
+inline ::KismetDatasource::SubChanhop* Configure::mutable_hopping() {
+  ::KismetDatasource::SubChanhop* _msg = _internal_mutable_hopping();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.Configure.hopping)
+  return _msg;
+}
+inline void Configure::set_allocated_hopping(::KismetDatasource::SubChanhop* hopping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hopping_;
+  }
+  if (hopping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hopping);
+    if (message_arena != submessage_arena) {
+      hopping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hopping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.hopping_ = hopping;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.Configure.hopping)
+}
+
+// optional .KismetDatasource.SubSpecset spectrum = 3;
+inline bool Configure::_internal_has_spectrum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.spectrum_ != nullptr);
+  return value;
+}
+inline bool Configure::has_spectrum() const {
+  return _internal_has_spectrum();
+}
+inline void Configure::clear_spectrum() {
+  if (_impl_.spectrum_ != nullptr) _impl_.spectrum_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::KismetDatasource::SubSpecset& Configure::_internal_spectrum() const {
+  const ::KismetDatasource::SubSpecset* p = _impl_.spectrum_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSpecset&>(
+      ::KismetDatasource::_SubSpecset_default_instance_);
+}
+inline const ::KismetDatasource::SubSpecset& Configure::spectrum() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.Configure.spectrum)
+  return _internal_spectrum();
+}
+inline void Configure::unsafe_arena_set_allocated_spectrum(
+    ::KismetDatasource::SubSpecset* spectrum) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spectrum_);
+  }
+  _impl_.spectrum_ = spectrum;
+  if (spectrum) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.Configure.spectrum)
+}
+inline ::KismetDatasource::SubSpecset* Configure::release_spectrum() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetDatasource::SubSpecset* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSpecset* Configure::unsafe_arena_release_spectrum() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.Configure.spectrum)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetDatasource::SubSpecset* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSpecset* Configure::_internal_mutable_spectrum() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.spectrum_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSpecset>(GetArenaForAllocation());
+    _impl_.spectrum_ = p;
+  }
+  return _impl_.spectrum_;
+}
+inline ::KismetDatasource::SubSpecset* Configure::mutable_spectrum() {
+  ::KismetDatasource::SubSpecset* _msg = _internal_mutable_spectrum();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.Configure.spectrum)
+  return _msg;
+}
+inline void Configure::set_allocated_spectrum(::KismetDatasource::SubSpecset* spectrum) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.spectrum_;
+  }
+  if (spectrum) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(spectrum);
+    if (message_arena != submessage_arena) {
+      spectrum = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, spectrum, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.spectrum_ = spectrum;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.Configure.spectrum)
+}
+
+// -------------------------------------------------------------------
+
+// ConfigureReport
+
+// required .KismetDatasource.SubSuccess success = 1;
+inline bool ConfigureReport::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.success_ != nullptr);
+  return value;
+}
+inline bool ConfigureReport::has_success() const {
+  return _internal_has_success();
+}
+inline void ConfigureReport::clear_success() {
+  if (_impl_.success_ != nullptr) _impl_.success_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::KismetDatasource::SubSuccess& ConfigureReport::_internal_success() const {
+  const ::KismetDatasource::SubSuccess* p = _impl_.success_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSuccess&>(
+      ::KismetDatasource::_SubSuccess_default_instance_);
+}
+inline const ::KismetDatasource::SubSuccess& ConfigureReport::success() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ConfigureReport.success)
+  return _internal_success();
+}
+inline void ConfigureReport::unsafe_arena_set_allocated_success(
+    ::KismetDatasource::SubSuccess* success) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.success_);
+  }
+  _impl_.success_ = success;
+  if (success) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ConfigureReport.success)
+}
+inline ::KismetDatasource::SubSuccess* ConfigureReport::release_success() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* ConfigureReport::unsafe_arena_release_success() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ConfigureReport.success)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* ConfigureReport::_internal_mutable_success() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.success_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSuccess>(GetArenaForAllocation());
+    _impl_.success_ = p;
+  }
+  return _impl_.success_;
+}
+inline ::KismetDatasource::SubSuccess* ConfigureReport::mutable_success() {
+  ::KismetDatasource::SubSuccess* _msg = _internal_mutable_success();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ConfigureReport.success)
+  return _msg;
+}
+inline void ConfigureReport::set_allocated_success(::KismetDatasource::SubSuccess* success) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.success_;
+  }
+  if (success) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(success);
+    if (message_arena != submessage_arena) {
+      success = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, success, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.success_ = success;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ConfigureReport.success)
+}
+
+// optional .KismetDatasource.SubChanset channel = 2;
+inline bool ConfigureReport::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channel_ != nullptr);
+  return value;
+}
+inline bool ConfigureReport::has_channel() const {
+  return _internal_has_channel();
+}
+inline void ConfigureReport::clear_channel() {
+  if (_impl_.channel_ != nullptr) _impl_.channel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const ::KismetDatasource::SubChanset& ConfigureReport::_internal_channel() const {
+  const ::KismetDatasource::SubChanset* p = _impl_.channel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChanset&>(
+      ::KismetDatasource::_SubChanset_default_instance_);
+}
+inline const ::KismetDatasource::SubChanset& ConfigureReport::channel() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ConfigureReport.channel)
+  return _internal_channel();
+}
+inline void ConfigureReport::unsafe_arena_set_allocated_channel(
+    ::KismetDatasource::SubChanset* channel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channel_);
+  }
+  _impl_.channel_ = channel;
+  if (channel) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ConfigureReport.channel)
+}
+inline ::KismetDatasource::SubChanset* ConfigureReport::release_channel() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* ConfigureReport::unsafe_arena_release_channel() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ConfigureReport.channel)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* ConfigureReport::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.channel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChanset>(GetArenaForAllocation());
+    _impl_.channel_ = p;
+  }
+  return _impl_.channel_;
+}
+inline ::KismetDatasource::SubChanset* ConfigureReport::mutable_channel() {
+  ::KismetDatasource::SubChanset* _msg = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ConfigureReport.channel)
+  return _msg;
+}
+inline void ConfigureReport::set_allocated_channel(::KismetDatasource::SubChanset* channel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channel_;
+  }
+  if (channel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channel);
+    if (message_arena != submessage_arena) {
+      channel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.channel_ = channel;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ConfigureReport.channel)
+}
+
+// optional .KismetDatasource.SubChanhop hopping = 3;
+inline bool ConfigureReport::_internal_has_hopping() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hopping_ != nullptr);
+  return value;
+}
+inline bool ConfigureReport::has_hopping() const {
+  return _internal_has_hopping();
+}
+inline void ConfigureReport::clear_hopping() {
+  if (_impl_.hopping_ != nullptr) _impl_.hopping_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::KismetDatasource::SubChanhop& ConfigureReport::_internal_hopping() const {
+  const ::KismetDatasource::SubChanhop* p = _impl_.hopping_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChanhop&>(
+      ::KismetDatasource::_SubChanhop_default_instance_);
+}
+inline const ::KismetDatasource::SubChanhop& ConfigureReport::hopping() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ConfigureReport.hopping)
+  return _internal_hopping();
+}
+inline void ConfigureReport::unsafe_arena_set_allocated_hopping(
+    ::KismetDatasource::SubChanhop* hopping) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hopping_);
+  }
+  _impl_.hopping_ = hopping;
+  if (hopping) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ConfigureReport.hopping)
+}
+inline ::KismetDatasource::SubChanhop* ConfigureReport::release_hopping() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::KismetDatasource::SubChanhop* temp = _impl_.hopping_;
+  _impl_.hopping_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChanhop* ConfigureReport::unsafe_arena_release_hopping() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ConfigureReport.hopping)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::KismetDatasource::SubChanhop* temp = _impl_.hopping_;
+  _impl_.hopping_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChanhop* ConfigureReport::_internal_mutable_hopping() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.hopping_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChanhop>(GetArenaForAllocation());
+    _impl_.hopping_ = p;
+  }
+  return _impl_.hopping_;
+}
+inline ::KismetDatasource::SubChanhop* ConfigureReport::mutable_hopping() {
+  ::KismetDatasource::SubChanhop* _msg = _internal_mutable_hopping();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ConfigureReport.hopping)
+  return _msg;
+}
+inline void ConfigureReport::set_allocated_hopping(::KismetDatasource::SubChanhop* hopping) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hopping_;
+  }
+  if (hopping) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hopping);
+    if (message_arena != submessage_arena) {
+      hopping = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hopping, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.hopping_ = hopping;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ConfigureReport.hopping)
+}
+
+// optional .KismetExternal.MsgbusMessage message = 4;
+inline bool ConfigureReport::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool ConfigureReport::has_message() const {
+  return _internal_has_message();
+}
+inline const ::KismetExternal::MsgbusMessage& ConfigureReport::_internal_message() const {
+  const ::KismetExternal::MsgbusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetExternal::MsgbusMessage&>(
+      ::KismetExternal::_MsgbusMessage_default_instance_);
+}
+inline const ::KismetExternal::MsgbusMessage& ConfigureReport::message() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ConfigureReport.message)
+  return _internal_message();
+}
+inline void ConfigureReport::unsafe_arena_set_allocated_message(
+    ::KismetExternal::MsgbusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ConfigureReport.message)
+}
+inline ::KismetExternal::MsgbusMessage* ConfigureReport::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* ConfigureReport::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ConfigureReport.message)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* ConfigureReport::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetExternal::MsgbusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::KismetExternal::MsgbusMessage* ConfigureReport::mutable_message() {
+  ::KismetExternal::MsgbusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ConfigureReport.message)
+  return _msg;
+}
+inline void ConfigureReport::set_allocated_message(::KismetExternal::MsgbusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ConfigureReport.message)
+}
+
+// optional string warning = 5;
+inline bool ConfigureReport::_internal_has_warning() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ConfigureReport::has_warning() const {
+  return _internal_has_warning();
+}
+inline void ConfigureReport::clear_warning() {
+  _impl_.warning_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ConfigureReport::warning() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ConfigureReport.warning)
+  return _internal_warning();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ConfigureReport::set_warning(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.warning_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.ConfigureReport.warning)
+}
+inline std::string* ConfigureReport::mutable_warning() {
+  std::string* _s = _internal_mutable_warning();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ConfigureReport.warning)
+  return _s;
+}
+inline const std::string& ConfigureReport::_internal_warning() const {
+  return _impl_.warning_.Get();
+}
+inline void ConfigureReport::_internal_set_warning(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.warning_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ConfigureReport::_internal_mutable_warning() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.warning_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ConfigureReport::release_warning() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ConfigureReport.warning)
+  if (!_internal_has_warning()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.warning_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ConfigureReport::set_allocated_warning(std::string* warning) {
+  if (warning != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.warning_.SetAllocated(warning, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ConfigureReport.warning)
+}
+
+// -------------------------------------------------------------------
+
+// DataReport
+
+// optional .KismetDatasource.SubGps gps = 1;
+inline bool DataReport::_internal_has_gps() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.gps_ != nullptr);
+  return value;
+}
+inline bool DataReport::has_gps() const {
+  return _internal_has_gps();
+}
+inline void DataReport::clear_gps() {
+  if (_impl_.gps_ != nullptr) _impl_.gps_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::KismetDatasource::SubGps& DataReport::_internal_gps() const {
+  const ::KismetDatasource::SubGps* p = _impl_.gps_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubGps&>(
+      ::KismetDatasource::_SubGps_default_instance_);
+}
+inline const ::KismetDatasource::SubGps& DataReport::gps() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.gps)
+  return _internal_gps();
+}
+inline void DataReport::unsafe_arena_set_allocated_gps(
+    ::KismetDatasource::SubGps* gps) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.gps_);
+  }
+  _impl_.gps_ = gps;
+  if (gps) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.DataReport.gps)
+}
+inline ::KismetDatasource::SubGps* DataReport::release_gps() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubGps* temp = _impl_.gps_;
+  _impl_.gps_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubGps* DataReport::unsafe_arena_release_gps() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.gps)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubGps* temp = _impl_.gps_;
+  _impl_.gps_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubGps* DataReport::_internal_mutable_gps() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.gps_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubGps>(GetArenaForAllocation());
+    _impl_.gps_ = p;
+  }
+  return _impl_.gps_;
+}
+inline ::KismetDatasource::SubGps* DataReport::mutable_gps() {
+  ::KismetDatasource::SubGps* _msg = _internal_mutable_gps();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.gps)
+  return _msg;
+}
+inline void DataReport::set_allocated_gps(::KismetDatasource::SubGps* gps) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.gps_;
+  }
+  if (gps) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(gps);
+    if (message_arena != submessage_arena) {
+      gps = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gps, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.gps_ = gps;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.gps)
+}
+
+// optional .KismetExternal.MsgbusMessage message = 2;
+inline bool DataReport::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool DataReport::has_message() const {
+  return _internal_has_message();
+}
+inline const ::KismetExternal::MsgbusMessage& DataReport::_internal_message() const {
+  const ::KismetExternal::MsgbusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetExternal::MsgbusMessage&>(
+      ::KismetExternal::_MsgbusMessage_default_instance_);
+}
+inline const ::KismetExternal::MsgbusMessage& DataReport::message() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.message)
+  return _internal_message();
+}
+inline void DataReport::unsafe_arena_set_allocated_message(
+    ::KismetExternal::MsgbusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.DataReport.message)
+}
+inline ::KismetExternal::MsgbusMessage* DataReport::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* DataReport::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.message)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* DataReport::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetExternal::MsgbusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::KismetExternal::MsgbusMessage* DataReport::mutable_message() {
+  ::KismetExternal::MsgbusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.message)
+  return _msg;
+}
+inline void DataReport::set_allocated_message(::KismetExternal::MsgbusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.message)
+}
+
+// optional .KismetDatasource.SubPacket packet = 3;
+inline bool DataReport::_internal_has_packet() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.packet_ != nullptr);
+  return value;
+}
+inline bool DataReport::has_packet() const {
+  return _internal_has_packet();
+}
+inline void DataReport::clear_packet() {
+  if (_impl_.packet_ != nullptr) _impl_.packet_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::KismetDatasource::SubPacket& DataReport::_internal_packet() const {
+  const ::KismetDatasource::SubPacket* p = _impl_.packet_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubPacket&>(
+      ::KismetDatasource::_SubPacket_default_instance_);
+}
+inline const ::KismetDatasource::SubPacket& DataReport::packet() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.packet)
+  return _internal_packet();
+}
+inline void DataReport::unsafe_arena_set_allocated_packet(
+    ::KismetDatasource::SubPacket* packet) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.packet_);
+  }
+  _impl_.packet_ = packet;
+  if (packet) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.DataReport.packet)
+}
+inline ::KismetDatasource::SubPacket* DataReport::release_packet() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::KismetDatasource::SubPacket* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubPacket* DataReport::unsafe_arena_release_packet() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.packet)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::KismetDatasource::SubPacket* temp = _impl_.packet_;
+  _impl_.packet_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubPacket* DataReport::_internal_mutable_packet() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.packet_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubPacket>(GetArenaForAllocation());
+    _impl_.packet_ = p;
+  }
+  return _impl_.packet_;
+}
+inline ::KismetDatasource::SubPacket* DataReport::mutable_packet() {
+  ::KismetDatasource::SubPacket* _msg = _internal_mutable_packet();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.packet)
+  return _msg;
+}
+inline void DataReport::set_allocated_packet(::KismetDatasource::SubPacket* packet) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.packet_;
+  }
+  if (packet) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(packet);
+    if (message_arena != submessage_arena) {
+      packet = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, packet, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.packet_ = packet;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.packet)
+}
+
+// optional .KismetDatasource.SubSignal signal = 4;
+inline bool DataReport::_internal_has_signal() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.signal_ != nullptr);
+  return value;
+}
+inline bool DataReport::has_signal() const {
+  return _internal_has_signal();
+}
+inline void DataReport::clear_signal() {
+  if (_impl_.signal_ != nullptr) _impl_.signal_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::KismetDatasource::SubSignal& DataReport::_internal_signal() const {
+  const ::KismetDatasource::SubSignal* p = _impl_.signal_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSignal&>(
+      ::KismetDatasource::_SubSignal_default_instance_);
+}
+inline const ::KismetDatasource::SubSignal& DataReport::signal() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.signal)
+  return _internal_signal();
+}
+inline void DataReport::unsafe_arena_set_allocated_signal(
+    ::KismetDatasource::SubSignal* signal) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.signal_);
+  }
+  _impl_.signal_ = signal;
+  if (signal) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.DataReport.signal)
+}
+inline ::KismetDatasource::SubSignal* DataReport::release_signal() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetDatasource::SubSignal* temp = _impl_.signal_;
+  _impl_.signal_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSignal* DataReport::unsafe_arena_release_signal() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.signal)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetDatasource::SubSignal* temp = _impl_.signal_;
+  _impl_.signal_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSignal* DataReport::_internal_mutable_signal() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.signal_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSignal>(GetArenaForAllocation());
+    _impl_.signal_ = p;
+  }
+  return _impl_.signal_;
+}
+inline ::KismetDatasource::SubSignal* DataReport::mutable_signal() {
+  ::KismetDatasource::SubSignal* _msg = _internal_mutable_signal();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.signal)
+  return _msg;
+}
+inline void DataReport::set_allocated_signal(::KismetDatasource::SubSignal* signal) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.signal_;
+  }
+  if (signal) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(signal);
+    if (message_arena != submessage_arena) {
+      signal = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, signal, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.signal_ = signal;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.signal)
+}
+
+// optional .KismetDatasource.SubSpectrum spectrum = 5;
+inline bool DataReport::_internal_has_spectrum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.spectrum_ != nullptr);
+  return value;
+}
+inline bool DataReport::has_spectrum() const {
+  return _internal_has_spectrum();
+}
+inline void DataReport::clear_spectrum() {
+  if (_impl_.spectrum_ != nullptr) _impl_.spectrum_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::KismetDatasource::SubSpectrum& DataReport::_internal_spectrum() const {
+  const ::KismetDatasource::SubSpectrum* p = _impl_.spectrum_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSpectrum&>(
+      ::KismetDatasource::_SubSpectrum_default_instance_);
+}
+inline const ::KismetDatasource::SubSpectrum& DataReport::spectrum() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.spectrum)
+  return _internal_spectrum();
+}
+inline void DataReport::unsafe_arena_set_allocated_spectrum(
+    ::KismetDatasource::SubSpectrum* spectrum) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spectrum_);
+  }
+  _impl_.spectrum_ = spectrum;
+  if (spectrum) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.DataReport.spectrum)
+}
+inline ::KismetDatasource::SubSpectrum* DataReport::release_spectrum() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::KismetDatasource::SubSpectrum* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSpectrum* DataReport::unsafe_arena_release_spectrum() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.spectrum)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::KismetDatasource::SubSpectrum* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSpectrum* DataReport::_internal_mutable_spectrum() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.spectrum_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSpectrum>(GetArenaForAllocation());
+    _impl_.spectrum_ = p;
+  }
+  return _impl_.spectrum_;
+}
+inline ::KismetDatasource::SubSpectrum* DataReport::mutable_spectrum() {
+  ::KismetDatasource::SubSpectrum* _msg = _internal_mutable_spectrum();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.spectrum)
+  return _msg;
+}
+inline void DataReport::set_allocated_spectrum(::KismetDatasource::SubSpectrum* spectrum) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.spectrum_;
+  }
+  if (spectrum) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(spectrum);
+    if (message_arena != submessage_arena) {
+      spectrum = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, spectrum, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.spectrum_ = spectrum;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.spectrum)
+}
+
+// optional string warning = 6;
+inline bool DataReport::_internal_has_warning() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool DataReport::has_warning() const {
+  return _internal_has_warning();
+}
+inline void DataReport::clear_warning() {
+  _impl_.warning_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& DataReport::warning() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.warning)
+  return _internal_warning();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void DataReport::set_warning(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.warning_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.DataReport.warning)
+}
+inline std::string* DataReport::mutable_warning() {
+  std::string* _s = _internal_mutable_warning();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.warning)
+  return _s;
+}
+inline const std::string& DataReport::_internal_warning() const {
+  return _impl_.warning_.Get();
+}
+inline void DataReport::_internal_set_warning(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.warning_.Set(value, GetArenaForAllocation());
+}
+inline std::string* DataReport::_internal_mutable_warning() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.warning_.Mutable(GetArenaForAllocation());
+}
+inline std::string* DataReport::release_warning() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.warning)
+  if (!_internal_has_warning()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.warning_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void DataReport::set_allocated_warning(std::string* warning) {
+  if (warning != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.warning_.SetAllocated(warning, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.warning)
+}
+
+// optional .KismetDatasource.SubJson json = 7;
+inline bool DataReport::_internal_has_json() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.json_ != nullptr);
+  return value;
+}
+inline bool DataReport::has_json() const {
+  return _internal_has_json();
+}
+inline void DataReport::clear_json() {
+  if (_impl_.json_ != nullptr) _impl_.json_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::KismetDatasource::SubJson& DataReport::_internal_json() const {
+  const ::KismetDatasource::SubJson* p = _impl_.json_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubJson&>(
+      ::KismetDatasource::_SubJson_default_instance_);
+}
+inline const ::KismetDatasource::SubJson& DataReport::json() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.json)
+  return _internal_json();
+}
+inline void DataReport::unsafe_arena_set_allocated_json(
+    ::KismetDatasource::SubJson* json) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.json_);
+  }
+  _impl_.json_ = json;
+  if (json) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.DataReport.json)
+}
+inline ::KismetDatasource::SubJson* DataReport::release_json() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::KismetDatasource::SubJson* temp = _impl_.json_;
+  _impl_.json_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubJson* DataReport::unsafe_arena_release_json() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.json)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::KismetDatasource::SubJson* temp = _impl_.json_;
+  _impl_.json_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubJson* DataReport::_internal_mutable_json() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.json_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubJson>(GetArenaForAllocation());
+    _impl_.json_ = p;
+  }
+  return _impl_.json_;
+}
+inline ::KismetDatasource::SubJson* DataReport::mutable_json() {
+  ::KismetDatasource::SubJson* _msg = _internal_mutable_json();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.json)
+  return _msg;
+}
+inline void DataReport::set_allocated_json(::KismetDatasource::SubJson* json) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.json_;
+  }
+  if (json) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(json);
+    if (message_arena != submessage_arena) {
+      json = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, json, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.json_ = json;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.json)
+}
+
+// optional .KismetDatasource.SubBuffer buffer = 8;
+inline bool DataReport::_internal_has_buffer() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.buffer_ != nullptr);
+  return value;
+}
+inline bool DataReport::has_buffer() const {
+  return _internal_has_buffer();
+}
+inline void DataReport::clear_buffer() {
+  if (_impl_.buffer_ != nullptr) _impl_.buffer_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::KismetDatasource::SubBuffer& DataReport::_internal_buffer() const {
+  const ::KismetDatasource::SubBuffer* p = _impl_.buffer_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubBuffer&>(
+      ::KismetDatasource::_SubBuffer_default_instance_);
+}
+inline const ::KismetDatasource::SubBuffer& DataReport::buffer() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.buffer)
+  return _internal_buffer();
+}
+inline void DataReport::unsafe_arena_set_allocated_buffer(
+    ::KismetDatasource::SubBuffer* buffer) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.buffer_);
+  }
+  _impl_.buffer_ = buffer;
+  if (buffer) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.DataReport.buffer)
+}
+inline ::KismetDatasource::SubBuffer* DataReport::release_buffer() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::KismetDatasource::SubBuffer* temp = _impl_.buffer_;
+  _impl_.buffer_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubBuffer* DataReport::unsafe_arena_release_buffer() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.DataReport.buffer)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::KismetDatasource::SubBuffer* temp = _impl_.buffer_;
+  _impl_.buffer_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubBuffer* DataReport::_internal_mutable_buffer() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.buffer_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubBuffer>(GetArenaForAllocation());
+    _impl_.buffer_ = p;
+  }
+  return _impl_.buffer_;
+}
+inline ::KismetDatasource::SubBuffer* DataReport::mutable_buffer() {
+  ::KismetDatasource::SubBuffer* _msg = _internal_mutable_buffer();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.DataReport.buffer)
+  return _msg;
+}
+inline void DataReport::set_allocated_buffer(::KismetDatasource::SubBuffer* buffer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.buffer_;
+  }
+  if (buffer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(buffer);
+    if (message_arena != submessage_arena) {
+      buffer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, buffer, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.buffer_ = buffer;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.DataReport.buffer)
+}
+
+// optional double high_prec_time = 9;
+inline bool DataReport::_internal_has_high_prec_time() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  return value;
+}
+inline bool DataReport::has_high_prec_time() const {
+  return _internal_has_high_prec_time();
+}
+inline void DataReport::clear_high_prec_time() {
+  _impl_.high_prec_time_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000100u;
+}
+inline double DataReport::_internal_high_prec_time() const {
+  return _impl_.high_prec_time_;
+}
+inline double DataReport::high_prec_time() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.DataReport.high_prec_time)
+  return _internal_high_prec_time();
+}
+inline void DataReport::_internal_set_high_prec_time(double value) {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  _impl_.high_prec_time_ = value;
+}
+inline void DataReport::set_high_prec_time(double value) {
+  _internal_set_high_prec_time(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.DataReport.high_prec_time)
+}
+
+// -------------------------------------------------------------------
+
+// ErrorReport
+
+// required .KismetDatasource.SubSuccess success = 1;
+inline bool ErrorReport::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.success_ != nullptr);
+  return value;
+}
+inline bool ErrorReport::has_success() const {
+  return _internal_has_success();
+}
+inline void ErrorReport::clear_success() {
+  if (_impl_.success_ != nullptr) _impl_.success_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::KismetDatasource::SubSuccess& ErrorReport::_internal_success() const {
+  const ::KismetDatasource::SubSuccess* p = _impl_.success_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSuccess&>(
+      ::KismetDatasource::_SubSuccess_default_instance_);
+}
+inline const ::KismetDatasource::SubSuccess& ErrorReport::success() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ErrorReport.success)
+  return _internal_success();
+}
+inline void ErrorReport::unsafe_arena_set_allocated_success(
+    ::KismetDatasource::SubSuccess* success) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.success_);
+  }
+  _impl_.success_ = success;
+  if (success) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ErrorReport.success)
+}
+inline ::KismetDatasource::SubSuccess* ErrorReport::release_success() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* ErrorReport::unsafe_arena_release_success() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ErrorReport.success)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* ErrorReport::_internal_mutable_success() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.success_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSuccess>(GetArenaForAllocation());
+    _impl_.success_ = p;
+  }
+  return _impl_.success_;
+}
+inline ::KismetDatasource::SubSuccess* ErrorReport::mutable_success() {
+  ::KismetDatasource::SubSuccess* _msg = _internal_mutable_success();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ErrorReport.success)
+  return _msg;
+}
+inline void ErrorReport::set_allocated_success(::KismetDatasource::SubSuccess* success) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.success_;
+  }
+  if (success) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(success);
+    if (message_arena != submessage_arena) {
+      success = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, success, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.success_ = success;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ErrorReport.success)
+}
+
+// optional .KismetExternal.MsgbusMessage message = 2;
+inline bool ErrorReport::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool ErrorReport::has_message() const {
+  return _internal_has_message();
+}
+inline const ::KismetExternal::MsgbusMessage& ErrorReport::_internal_message() const {
+  const ::KismetExternal::MsgbusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetExternal::MsgbusMessage&>(
+      ::KismetExternal::_MsgbusMessage_default_instance_);
+}
+inline const ::KismetExternal::MsgbusMessage& ErrorReport::message() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ErrorReport.message)
+  return _internal_message();
+}
+inline void ErrorReport::unsafe_arena_set_allocated_message(
+    ::KismetExternal::MsgbusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ErrorReport.message)
+}
+inline ::KismetExternal::MsgbusMessage* ErrorReport::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* ErrorReport::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ErrorReport.message)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* ErrorReport::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetExternal::MsgbusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::KismetExternal::MsgbusMessage* ErrorReport::mutable_message() {
+  ::KismetExternal::MsgbusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ErrorReport.message)
+  return _msg;
+}
+inline void ErrorReport::set_allocated_message(::KismetExternal::MsgbusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ErrorReport.message)
+}
+
+// -------------------------------------------------------------------
+
+// ListInterfaces
+
+// -------------------------------------------------------------------
+
+// InterfacesReport
+
+// required .KismetDatasource.SubSuccess success = 1;
+inline bool InterfacesReport::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.success_ != nullptr);
+  return value;
+}
+inline bool InterfacesReport::has_success() const {
+  return _internal_has_success();
+}
+inline void InterfacesReport::clear_success() {
+  if (_impl_.success_ != nullptr) _impl_.success_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const ::KismetDatasource::SubSuccess& InterfacesReport::_internal_success() const {
+  const ::KismetDatasource::SubSuccess* p = _impl_.success_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSuccess&>(
+      ::KismetDatasource::_SubSuccess_default_instance_);
+}
+inline const ::KismetDatasource::SubSuccess& InterfacesReport::success() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.InterfacesReport.success)
+  return _internal_success();
+}
+inline void InterfacesReport::unsafe_arena_set_allocated_success(
+    ::KismetDatasource::SubSuccess* success) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.success_);
+  }
+  _impl_.success_ = success;
+  if (success) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.InterfacesReport.success)
+}
+inline ::KismetDatasource::SubSuccess* InterfacesReport::release_success() {
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* InterfacesReport::unsafe_arena_release_success() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.InterfacesReport.success)
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* InterfacesReport::_internal_mutable_success() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  if (_impl_.success_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSuccess>(GetArenaForAllocation());
+    _impl_.success_ = p;
+  }
+  return _impl_.success_;
+}
+inline ::KismetDatasource::SubSuccess* InterfacesReport::mutable_success() {
+  ::KismetDatasource::SubSuccess* _msg = _internal_mutable_success();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.InterfacesReport.success)
+  return _msg;
+}
+inline void InterfacesReport::set_allocated_success(::KismetDatasource::SubSuccess* success) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.success_;
+  }
+  if (success) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(success);
+    if (message_arena != submessage_arena) {
+      success = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, success, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.success_ = success;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.InterfacesReport.success)
+}
+
+// optional .KismetExternal.MsgbusMessage message = 2;
+inline bool InterfacesReport::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool InterfacesReport::has_message() const {
+  return _internal_has_message();
+}
+inline const ::KismetExternal::MsgbusMessage& InterfacesReport::_internal_message() const {
+  const ::KismetExternal::MsgbusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetExternal::MsgbusMessage&>(
+      ::KismetExternal::_MsgbusMessage_default_instance_);
+}
+inline const ::KismetExternal::MsgbusMessage& InterfacesReport::message() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.InterfacesReport.message)
+  return _internal_message();
+}
+inline void InterfacesReport::unsafe_arena_set_allocated_message(
+    ::KismetExternal::MsgbusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.InterfacesReport.message)
+}
+inline ::KismetExternal::MsgbusMessage* InterfacesReport::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* InterfacesReport::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.InterfacesReport.message)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* InterfacesReport::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetExternal::MsgbusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::KismetExternal::MsgbusMessage* InterfacesReport::mutable_message() {
+  ::KismetExternal::MsgbusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.InterfacesReport.message)
+  return _msg;
+}
+inline void InterfacesReport::set_allocated_message(::KismetExternal::MsgbusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.InterfacesReport.message)
+}
+
+// repeated .KismetDatasource.SubInterface interfaces = 3;
+inline int InterfacesReport::_internal_interfaces_size() const {
+  return _impl_.interfaces_.size();
+}
+inline int InterfacesReport::interfaces_size() const {
+  return _internal_interfaces_size();
+}
+inline void InterfacesReport::clear_interfaces() {
+  _impl_.interfaces_.Clear();
+}
+inline ::KismetDatasource::SubInterface* InterfacesReport::mutable_interfaces(int index) {
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.InterfacesReport.interfaces)
+  return _impl_.interfaces_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetDatasource::SubInterface >*
+InterfacesReport::mutable_interfaces() {
+  // @@protoc_insertion_point(field_mutable_list:KismetDatasource.InterfacesReport.interfaces)
+  return &_impl_.interfaces_;
+}
+inline const ::KismetDatasource::SubInterface& InterfacesReport::_internal_interfaces(int index) const {
+  return _impl_.interfaces_.Get(index);
+}
+inline const ::KismetDatasource::SubInterface& InterfacesReport::interfaces(int index) const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.InterfacesReport.interfaces)
+  return _internal_interfaces(index);
+}
+inline ::KismetDatasource::SubInterface* InterfacesReport::_internal_add_interfaces() {
+  return _impl_.interfaces_.Add();
+}
+inline ::KismetDatasource::SubInterface* InterfacesReport::add_interfaces() {
+  ::KismetDatasource::SubInterface* _add = _internal_add_interfaces();
+  // @@protoc_insertion_point(field_add:KismetDatasource.InterfacesReport.interfaces)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetDatasource::SubInterface >&
+InterfacesReport::interfaces() const {
+  // @@protoc_insertion_point(field_list:KismetDatasource.InterfacesReport.interfaces)
+  return _impl_.interfaces_;
+}
+
+// -------------------------------------------------------------------
+
+// NewSource
+
+// required string definition = 1;
+inline bool NewSource::_internal_has_definition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool NewSource::has_definition() const {
+  return _internal_has_definition();
+}
+inline void NewSource::clear_definition() {
+  _impl_.definition_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& NewSource::definition() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.NewSource.definition)
+  return _internal_definition();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewSource::set_definition(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.definition_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.NewSource.definition)
+}
+inline std::string* NewSource::mutable_definition() {
+  std::string* _s = _internal_mutable_definition();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.NewSource.definition)
+  return _s;
+}
+inline const std::string& NewSource::_internal_definition() const {
+  return _impl_.definition_.Get();
+}
+inline void NewSource::_internal_set_definition(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.definition_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NewSource::_internal_mutable_definition() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.definition_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NewSource::release_definition() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.NewSource.definition)
+  if (!_internal_has_definition()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.definition_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.definition_.IsDefault()) {
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void NewSource::set_allocated_definition(std::string* definition) {
+  if (definition != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.definition_.SetAllocated(definition, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.definition_.IsDefault()) {
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.NewSource.definition)
+}
+
+// required string sourcetype = 2;
+inline bool NewSource::_internal_has_sourcetype() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool NewSource::has_sourcetype() const {
+  return _internal_has_sourcetype();
+}
+inline void NewSource::clear_sourcetype() {
+  _impl_.sourcetype_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& NewSource::sourcetype() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.NewSource.sourcetype)
+  return _internal_sourcetype();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewSource::set_sourcetype(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.sourcetype_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.NewSource.sourcetype)
+}
+inline std::string* NewSource::mutable_sourcetype() {
+  std::string* _s = _internal_mutable_sourcetype();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.NewSource.sourcetype)
+  return _s;
+}
+inline const std::string& NewSource::_internal_sourcetype() const {
+  return _impl_.sourcetype_.Get();
+}
+inline void NewSource::_internal_set_sourcetype(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.sourcetype_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NewSource::_internal_mutable_sourcetype() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.sourcetype_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NewSource::release_sourcetype() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.NewSource.sourcetype)
+  if (!_internal_has_sourcetype()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.sourcetype_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sourcetype_.IsDefault()) {
+    _impl_.sourcetype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void NewSource::set_allocated_sourcetype(std::string* sourcetype) {
+  if (sourcetype != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.sourcetype_.SetAllocated(sourcetype, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sourcetype_.IsDefault()) {
+    _impl_.sourcetype_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.NewSource.sourcetype)
+}
+
+// required string uuid = 3;
+inline bool NewSource::_internal_has_uuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool NewSource::has_uuid() const {
+  return _internal_has_uuid();
+}
+inline void NewSource::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& NewSource::uuid() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.NewSource.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewSource::set_uuid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.NewSource.uuid)
+}
+inline std::string* NewSource::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.NewSource.uuid)
+  return _s;
+}
+inline const std::string& NewSource::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void NewSource::_internal_set_uuid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NewSource::_internal_mutable_uuid() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NewSource::release_uuid() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.NewSource.uuid)
+  if (!_internal_has_uuid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.uuid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void NewSource::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.NewSource.uuid)
+}
+
+// -------------------------------------------------------------------
+
+// OpenSource
+
+// required string definition = 1;
+inline bool OpenSource::_internal_has_definition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool OpenSource::has_definition() const {
+  return _internal_has_definition();
+}
+inline void OpenSource::clear_definition() {
+  _impl_.definition_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& OpenSource::definition() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSource.definition)
+  return _internal_definition();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpenSource::set_definition(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.definition_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.OpenSource.definition)
+}
+inline std::string* OpenSource::mutable_definition() {
+  std::string* _s = _internal_mutable_definition();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSource.definition)
+  return _s;
+}
+inline const std::string& OpenSource::_internal_definition() const {
+  return _impl_.definition_.Get();
+}
+inline void OpenSource::_internal_set_definition(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.definition_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpenSource::_internal_mutable_definition() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.definition_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpenSource::release_definition() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSource.definition)
+  if (!_internal_has_definition()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.definition_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.definition_.IsDefault()) {
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void OpenSource::set_allocated_definition(std::string* definition) {
+  if (definition != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.definition_.SetAllocated(definition, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.definition_.IsDefault()) {
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSource.definition)
+}
+
+// -------------------------------------------------------------------
+
+// OpenSourceReport
+
+// required .KismetDatasource.SubSuccess success = 1;
+inline bool OpenSourceReport::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.success_ != nullptr);
+  return value;
+}
+inline bool OpenSourceReport::has_success() const {
+  return _internal_has_success();
+}
+inline void OpenSourceReport::clear_success() {
+  if (_impl_.success_ != nullptr) _impl_.success_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::KismetDatasource::SubSuccess& OpenSourceReport::_internal_success() const {
+  const ::KismetDatasource::SubSuccess* p = _impl_.success_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSuccess&>(
+      ::KismetDatasource::_SubSuccess_default_instance_);
+}
+inline const ::KismetDatasource::SubSuccess& OpenSourceReport::success() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.success)
+  return _internal_success();
+}
+inline void OpenSourceReport::unsafe_arena_set_allocated_success(
+    ::KismetDatasource::SubSuccess* success) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.success_);
+  }
+  _impl_.success_ = success;
+  if (success) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.OpenSourceReport.success)
+}
+inline ::KismetDatasource::SubSuccess* OpenSourceReport::release_success() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* OpenSourceReport::unsafe_arena_release_success() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.success)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* OpenSourceReport::_internal_mutable_success() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.success_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSuccess>(GetArenaForAllocation());
+    _impl_.success_ = p;
+  }
+  return _impl_.success_;
+}
+inline ::KismetDatasource::SubSuccess* OpenSourceReport::mutable_success() {
+  ::KismetDatasource::SubSuccess* _msg = _internal_mutable_success();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.success)
+  return _msg;
+}
+inline void OpenSourceReport::set_allocated_success(::KismetDatasource::SubSuccess* success) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.success_;
+  }
+  if (success) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(success);
+    if (message_arena != submessage_arena) {
+      success = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, success, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.success_ = success;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.success)
+}
+
+// optional uint32 dlt = 2;
+inline bool OpenSourceReport::_internal_has_dlt() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000400u) != 0;
+  return value;
+}
+inline bool OpenSourceReport::has_dlt() const {
+  return _internal_has_dlt();
+}
+inline void OpenSourceReport::clear_dlt() {
+  _impl_.dlt_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000400u;
+}
+inline uint32_t OpenSourceReport::_internal_dlt() const {
+  return _impl_.dlt_;
+}
+inline uint32_t OpenSourceReport::dlt() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.dlt)
+  return _internal_dlt();
+}
+inline void OpenSourceReport::_internal_set_dlt(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000400u;
+  _impl_.dlt_ = value;
+}
+inline void OpenSourceReport::set_dlt(uint32_t value) {
+  _internal_set_dlt(value);
+  // @@protoc_insertion_point(field_set:KismetDatasource.OpenSourceReport.dlt)
+}
+
+// optional string capture_interface = 3;
+inline bool OpenSourceReport::_internal_has_capture_interface() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool OpenSourceReport::has_capture_interface() const {
+  return _internal_has_capture_interface();
+}
+inline void OpenSourceReport::clear_capture_interface() {
+  _impl_.capture_interface_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& OpenSourceReport::capture_interface() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.capture_interface)
+  return _internal_capture_interface();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpenSourceReport::set_capture_interface(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.capture_interface_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.OpenSourceReport.capture_interface)
+}
+inline std::string* OpenSourceReport::mutable_capture_interface() {
+  std::string* _s = _internal_mutable_capture_interface();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.capture_interface)
+  return _s;
+}
+inline const std::string& OpenSourceReport::_internal_capture_interface() const {
+  return _impl_.capture_interface_.Get();
+}
+inline void OpenSourceReport::_internal_set_capture_interface(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.capture_interface_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::_internal_mutable_capture_interface() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.capture_interface_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::release_capture_interface() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.capture_interface)
+  if (!_internal_has_capture_interface()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.capture_interface_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.capture_interface_.IsDefault()) {
+    _impl_.capture_interface_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void OpenSourceReport::set_allocated_capture_interface(std::string* capture_interface) {
+  if (capture_interface != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.capture_interface_.SetAllocated(capture_interface, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.capture_interface_.IsDefault()) {
+    _impl_.capture_interface_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.capture_interface)
+}
+
+// optional .KismetDatasource.SubChannels channels = 4;
+inline bool OpenSourceReport::_internal_has_channels() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channels_ != nullptr);
+  return value;
+}
+inline bool OpenSourceReport::has_channels() const {
+  return _internal_has_channels();
+}
+inline void OpenSourceReport::clear_channels() {
+  if (_impl_.channels_ != nullptr) _impl_.channels_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::KismetDatasource::SubChannels& OpenSourceReport::_internal_channels() const {
+  const ::KismetDatasource::SubChannels* p = _impl_.channels_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChannels&>(
+      ::KismetDatasource::_SubChannels_default_instance_);
+}
+inline const ::KismetDatasource::SubChannels& OpenSourceReport::channels() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.channels)
+  return _internal_channels();
+}
+inline void OpenSourceReport::unsafe_arena_set_allocated_channels(
+    ::KismetDatasource::SubChannels* channels) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channels_);
+  }
+  _impl_.channels_ = channels;
+  if (channels) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.OpenSourceReport.channels)
+}
+inline ::KismetDatasource::SubChannels* OpenSourceReport::release_channels() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::KismetDatasource::SubChannels* temp = _impl_.channels_;
+  _impl_.channels_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChannels* OpenSourceReport::unsafe_arena_release_channels() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.channels)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::KismetDatasource::SubChannels* temp = _impl_.channels_;
+  _impl_.channels_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChannels* OpenSourceReport::_internal_mutable_channels() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.channels_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChannels>(GetArenaForAllocation());
+    _impl_.channels_ = p;
+  }
+  return _impl_.channels_;
+}
+inline ::KismetDatasource::SubChannels* OpenSourceReport::mutable_channels() {
+  ::KismetDatasource::SubChannels* _msg = _internal_mutable_channels();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.channels)
+  return _msg;
+}
+inline void OpenSourceReport::set_allocated_channels(::KismetDatasource::SubChannels* channels) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channels_;
+  }
+  if (channels) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channels);
+    if (message_arena != submessage_arena) {
+      channels = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channels, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.channels_ = channels;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.channels)
+}
+
+// optional .KismetDatasource.SubChanset channel = 5;
+inline bool OpenSourceReport::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channel_ != nullptr);
+  return value;
+}
+inline bool OpenSourceReport::has_channel() const {
+  return _internal_has_channel();
+}
+inline void OpenSourceReport::clear_channel() {
+  if (_impl_.channel_ != nullptr) _impl_.channel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000040u;
+}
+inline const ::KismetDatasource::SubChanset& OpenSourceReport::_internal_channel() const {
+  const ::KismetDatasource::SubChanset* p = _impl_.channel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChanset&>(
+      ::KismetDatasource::_SubChanset_default_instance_);
+}
+inline const ::KismetDatasource::SubChanset& OpenSourceReport::channel() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.channel)
+  return _internal_channel();
+}
+inline void OpenSourceReport::unsafe_arena_set_allocated_channel(
+    ::KismetDatasource::SubChanset* channel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channel_);
+  }
+  _impl_.channel_ = channel;
+  if (channel) {
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.OpenSourceReport.channel)
+}
+inline ::KismetDatasource::SubChanset* OpenSourceReport::release_channel() {
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* OpenSourceReport::unsafe_arena_release_channel() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.channel)
+  _impl_._has_bits_[0] &= ~0x00000040u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* OpenSourceReport::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000040u;
+  if (_impl_.channel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChanset>(GetArenaForAllocation());
+    _impl_.channel_ = p;
+  }
+  return _impl_.channel_;
+}
+inline ::KismetDatasource::SubChanset* OpenSourceReport::mutable_channel() {
+  ::KismetDatasource::SubChanset* _msg = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.channel)
+  return _msg;
+}
+inline void OpenSourceReport::set_allocated_channel(::KismetDatasource::SubChanset* channel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channel_;
+  }
+  if (channel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channel);
+    if (message_arena != submessage_arena) {
+      channel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000040u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000040u;
+  }
+  _impl_.channel_ = channel;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.channel)
+}
+
+// optional .KismetDatasource.SubChanhop hop_config = 6;
+inline bool OpenSourceReport::_internal_has_hop_config() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000080u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.hop_config_ != nullptr);
+  return value;
+}
+inline bool OpenSourceReport::has_hop_config() const {
+  return _internal_has_hop_config();
+}
+inline void OpenSourceReport::clear_hop_config() {
+  if (_impl_.hop_config_ != nullptr) _impl_.hop_config_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000080u;
+}
+inline const ::KismetDatasource::SubChanhop& OpenSourceReport::_internal_hop_config() const {
+  const ::KismetDatasource::SubChanhop* p = _impl_.hop_config_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChanhop&>(
+      ::KismetDatasource::_SubChanhop_default_instance_);
+}
+inline const ::KismetDatasource::SubChanhop& OpenSourceReport::hop_config() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.hop_config)
+  return _internal_hop_config();
+}
+inline void OpenSourceReport::unsafe_arena_set_allocated_hop_config(
+    ::KismetDatasource::SubChanhop* hop_config) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hop_config_);
+  }
+  _impl_.hop_config_ = hop_config;
+  if (hop_config) {
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.OpenSourceReport.hop_config)
+}
+inline ::KismetDatasource::SubChanhop* OpenSourceReport::release_hop_config() {
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::KismetDatasource::SubChanhop* temp = _impl_.hop_config_;
+  _impl_.hop_config_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChanhop* OpenSourceReport::unsafe_arena_release_hop_config() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.hop_config)
+  _impl_._has_bits_[0] &= ~0x00000080u;
+  ::KismetDatasource::SubChanhop* temp = _impl_.hop_config_;
+  _impl_.hop_config_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChanhop* OpenSourceReport::_internal_mutable_hop_config() {
+  _impl_._has_bits_[0] |= 0x00000080u;
+  if (_impl_.hop_config_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChanhop>(GetArenaForAllocation());
+    _impl_.hop_config_ = p;
+  }
+  return _impl_.hop_config_;
+}
+inline ::KismetDatasource::SubChanhop* OpenSourceReport::mutable_hop_config() {
+  ::KismetDatasource::SubChanhop* _msg = _internal_mutable_hop_config();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.hop_config)
+  return _msg;
+}
+inline void OpenSourceReport::set_allocated_hop_config(::KismetDatasource::SubChanhop* hop_config) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.hop_config_;
+  }
+  if (hop_config) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(hop_config);
+    if (message_arena != submessage_arena) {
+      hop_config = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hop_config, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000080u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000080u;
+  }
+  _impl_.hop_config_ = hop_config;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.hop_config)
+}
+
+// optional string hardware = 7;
+inline bool OpenSourceReport::_internal_has_hardware() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool OpenSourceReport::has_hardware() const {
+  return _internal_has_hardware();
+}
+inline void OpenSourceReport::clear_hardware() {
+  _impl_.hardware_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& OpenSourceReport::hardware() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.hardware)
+  return _internal_hardware();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpenSourceReport::set_hardware(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.hardware_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.OpenSourceReport.hardware)
+}
+inline std::string* OpenSourceReport::mutable_hardware() {
+  std::string* _s = _internal_mutable_hardware();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.hardware)
+  return _s;
+}
+inline const std::string& OpenSourceReport::_internal_hardware() const {
+  return _impl_.hardware_.Get();
+}
+inline void OpenSourceReport::_internal_set_hardware(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.hardware_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::_internal_mutable_hardware() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.hardware_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::release_hardware() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.hardware)
+  if (!_internal_has_hardware()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.hardware_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hardware_.IsDefault()) {
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void OpenSourceReport::set_allocated_hardware(std::string* hardware) {
+  if (hardware != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.hardware_.SetAllocated(hardware, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hardware_.IsDefault()) {
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.hardware)
+}
+
+// optional .KismetExternal.MsgbusMessage message = 8;
+inline bool OpenSourceReport::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000100u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool OpenSourceReport::has_message() const {
+  return _internal_has_message();
+}
+inline const ::KismetExternal::MsgbusMessage& OpenSourceReport::_internal_message() const {
+  const ::KismetExternal::MsgbusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetExternal::MsgbusMessage&>(
+      ::KismetExternal::_MsgbusMessage_default_instance_);
+}
+inline const ::KismetExternal::MsgbusMessage& OpenSourceReport::message() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.message)
+  return _internal_message();
+}
+inline void OpenSourceReport::unsafe_arena_set_allocated_message(
+    ::KismetExternal::MsgbusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.OpenSourceReport.message)
+}
+inline ::KismetExternal::MsgbusMessage* OpenSourceReport::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* OpenSourceReport::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.message)
+  _impl_._has_bits_[0] &= ~0x00000100u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* OpenSourceReport::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000100u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetExternal::MsgbusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::KismetExternal::MsgbusMessage* OpenSourceReport::mutable_message() {
+  ::KismetExternal::MsgbusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.message)
+  return _msg;
+}
+inline void OpenSourceReport::set_allocated_message(::KismetExternal::MsgbusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000100u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000100u;
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.message)
+}
+
+// optional .KismetDatasource.SubSpecset spectrum = 9;
+inline bool OpenSourceReport::_internal_has_spectrum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000200u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.spectrum_ != nullptr);
+  return value;
+}
+inline bool OpenSourceReport::has_spectrum() const {
+  return _internal_has_spectrum();
+}
+inline void OpenSourceReport::clear_spectrum() {
+  if (_impl_.spectrum_ != nullptr) _impl_.spectrum_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000200u;
+}
+inline const ::KismetDatasource::SubSpecset& OpenSourceReport::_internal_spectrum() const {
+  const ::KismetDatasource::SubSpecset* p = _impl_.spectrum_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSpecset&>(
+      ::KismetDatasource::_SubSpecset_default_instance_);
+}
+inline const ::KismetDatasource::SubSpecset& OpenSourceReport::spectrum() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.spectrum)
+  return _internal_spectrum();
+}
+inline void OpenSourceReport::unsafe_arena_set_allocated_spectrum(
+    ::KismetDatasource::SubSpecset* spectrum) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spectrum_);
+  }
+  _impl_.spectrum_ = spectrum;
+  if (spectrum) {
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.OpenSourceReport.spectrum)
+}
+inline ::KismetDatasource::SubSpecset* OpenSourceReport::release_spectrum() {
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::KismetDatasource::SubSpecset* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSpecset* OpenSourceReport::unsafe_arena_release_spectrum() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.spectrum)
+  _impl_._has_bits_[0] &= ~0x00000200u;
+  ::KismetDatasource::SubSpecset* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSpecset* OpenSourceReport::_internal_mutable_spectrum() {
+  _impl_._has_bits_[0] |= 0x00000200u;
+  if (_impl_.spectrum_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSpecset>(GetArenaForAllocation());
+    _impl_.spectrum_ = p;
+  }
+  return _impl_.spectrum_;
+}
+inline ::KismetDatasource::SubSpecset* OpenSourceReport::mutable_spectrum() {
+  ::KismetDatasource::SubSpecset* _msg = _internal_mutable_spectrum();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.spectrum)
+  return _msg;
+}
+inline void OpenSourceReport::set_allocated_spectrum(::KismetDatasource::SubSpecset* spectrum) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.spectrum_;
+  }
+  if (spectrum) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(spectrum);
+    if (message_arena != submessage_arena) {
+      spectrum = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, spectrum, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000200u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000200u;
+  }
+  _impl_.spectrum_ = spectrum;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.spectrum)
+}
+
+// optional string uuid = 10;
+inline bool OpenSourceReport::_internal_has_uuid() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool OpenSourceReport::has_uuid() const {
+  return _internal_has_uuid();
+}
+inline void OpenSourceReport::clear_uuid() {
+  _impl_.uuid_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline const std::string& OpenSourceReport::uuid() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.uuid)
+  return _internal_uuid();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpenSourceReport::set_uuid(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000004u;
+ _impl_.uuid_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.OpenSourceReport.uuid)
+}
+inline std::string* OpenSourceReport::mutable_uuid() {
+  std::string* _s = _internal_mutable_uuid();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.uuid)
+  return _s;
+}
+inline const std::string& OpenSourceReport::_internal_uuid() const {
+  return _impl_.uuid_.Get();
+}
+inline void OpenSourceReport::_internal_set_uuid(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.uuid_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::_internal_mutable_uuid() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  return _impl_.uuid_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::release_uuid() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.uuid)
+  if (!_internal_has_uuid()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  auto* p = _impl_.uuid_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void OpenSourceReport::set_allocated_uuid(std::string* uuid) {
+  if (uuid != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.uuid_.SetAllocated(uuid, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uuid_.IsDefault()) {
+    _impl_.uuid_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.uuid)
+}
+
+// optional string warning = 11;
+inline bool OpenSourceReport::_internal_has_warning() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool OpenSourceReport::has_warning() const {
+  return _internal_has_warning();
+}
+inline void OpenSourceReport::clear_warning() {
+  _impl_.warning_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const std::string& OpenSourceReport::warning() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.OpenSourceReport.warning)
+  return _internal_warning();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OpenSourceReport::set_warning(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000008u;
+ _impl_.warning_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.OpenSourceReport.warning)
+}
+inline std::string* OpenSourceReport::mutable_warning() {
+  std::string* _s = _internal_mutable_warning();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.OpenSourceReport.warning)
+  return _s;
+}
+inline const std::string& OpenSourceReport::_internal_warning() const {
+  return _impl_.warning_.Get();
+}
+inline void OpenSourceReport::_internal_set_warning(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.warning_.Set(value, GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::_internal_mutable_warning() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  return _impl_.warning_.Mutable(GetArenaForAllocation());
+}
+inline std::string* OpenSourceReport::release_warning() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.OpenSourceReport.warning)
+  if (!_internal_has_warning()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  auto* p = _impl_.warning_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void OpenSourceReport::set_allocated_warning(std::string* warning) {
+  if (warning != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.warning_.SetAllocated(warning, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.OpenSourceReport.warning)
+}
+
+// -------------------------------------------------------------------
+
+// ProbeSource
+
+// required string definition = 1;
+inline bool ProbeSource::_internal_has_definition() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ProbeSource::has_definition() const {
+  return _internal_has_definition();
+}
+inline void ProbeSource::clear_definition() {
+  _impl_.definition_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ProbeSource::definition() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ProbeSource.definition)
+  return _internal_definition();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProbeSource::set_definition(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.definition_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.ProbeSource.definition)
+}
+inline std::string* ProbeSource::mutable_definition() {
+  std::string* _s = _internal_mutable_definition();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ProbeSource.definition)
+  return _s;
+}
+inline const std::string& ProbeSource::_internal_definition() const {
+  return _impl_.definition_.Get();
+}
+inline void ProbeSource::_internal_set_definition(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.definition_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProbeSource::_internal_mutable_definition() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.definition_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProbeSource::release_definition() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ProbeSource.definition)
+  if (!_internal_has_definition()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.definition_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.definition_.IsDefault()) {
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ProbeSource::set_allocated_definition(std::string* definition) {
+  if (definition != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.definition_.SetAllocated(definition, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.definition_.IsDefault()) {
+    _impl_.definition_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ProbeSource.definition)
+}
+
+// -------------------------------------------------------------------
+
+// ProbeSourceReport
+
+// required .KismetDatasource.SubSuccess success = 1;
+inline bool ProbeSourceReport::_internal_has_success() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.success_ != nullptr);
+  return value;
+}
+inline bool ProbeSourceReport::has_success() const {
+  return _internal_has_success();
+}
+inline void ProbeSourceReport::clear_success() {
+  if (_impl_.success_ != nullptr) _impl_.success_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const ::KismetDatasource::SubSuccess& ProbeSourceReport::_internal_success() const {
+  const ::KismetDatasource::SubSuccess* p = _impl_.success_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSuccess&>(
+      ::KismetDatasource::_SubSuccess_default_instance_);
+}
+inline const ::KismetDatasource::SubSuccess& ProbeSourceReport::success() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ProbeSourceReport.success)
+  return _internal_success();
+}
+inline void ProbeSourceReport::unsafe_arena_set_allocated_success(
+    ::KismetDatasource::SubSuccess* success) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.success_);
+  }
+  _impl_.success_ = success;
+  if (success) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ProbeSourceReport.success)
+}
+inline ::KismetDatasource::SubSuccess* ProbeSourceReport::release_success() {
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* ProbeSourceReport::unsafe_arena_release_success() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ProbeSourceReport.success)
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  ::KismetDatasource::SubSuccess* temp = _impl_.success_;
+  _impl_.success_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSuccess* ProbeSourceReport::_internal_mutable_success() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  if (_impl_.success_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSuccess>(GetArenaForAllocation());
+    _impl_.success_ = p;
+  }
+  return _impl_.success_;
+}
+inline ::KismetDatasource::SubSuccess* ProbeSourceReport::mutable_success() {
+  ::KismetDatasource::SubSuccess* _msg = _internal_mutable_success();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ProbeSourceReport.success)
+  return _msg;
+}
+inline void ProbeSourceReport::set_allocated_success(::KismetDatasource::SubSuccess* success) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.success_;
+  }
+  if (success) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(success);
+    if (message_arena != submessage_arena) {
+      success = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, success, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.success_ = success;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ProbeSourceReport.success)
+}
+
+// optional .KismetExternal.MsgbusMessage message = 2;
+inline bool ProbeSourceReport::_internal_has_message() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.message_ != nullptr);
+  return value;
+}
+inline bool ProbeSourceReport::has_message() const {
+  return _internal_has_message();
+}
+inline const ::KismetExternal::MsgbusMessage& ProbeSourceReport::_internal_message() const {
+  const ::KismetExternal::MsgbusMessage* p = _impl_.message_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetExternal::MsgbusMessage&>(
+      ::KismetExternal::_MsgbusMessage_default_instance_);
+}
+inline const ::KismetExternal::MsgbusMessage& ProbeSourceReport::message() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ProbeSourceReport.message)
+  return _internal_message();
+}
+inline void ProbeSourceReport::unsafe_arena_set_allocated_message(
+    ::KismetExternal::MsgbusMessage* message) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  _impl_.message_ = message;
+  if (message) {
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ProbeSourceReport.message)
+}
+inline ::KismetExternal::MsgbusMessage* ProbeSourceReport::release_message() {
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* ProbeSourceReport::unsafe_arena_release_message() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ProbeSourceReport.message)
+  _impl_._has_bits_[0] &= ~0x00000004u;
+  ::KismetExternal::MsgbusMessage* temp = _impl_.message_;
+  _impl_.message_ = nullptr;
+  return temp;
+}
+inline ::KismetExternal::MsgbusMessage* ProbeSourceReport::_internal_mutable_message() {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  if (_impl_.message_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetExternal::MsgbusMessage>(GetArenaForAllocation());
+    _impl_.message_ = p;
+  }
+  return _impl_.message_;
+}
+inline ::KismetExternal::MsgbusMessage* ProbeSourceReport::mutable_message() {
+  ::KismetExternal::MsgbusMessage* _msg = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ProbeSourceReport.message)
+  return _msg;
+}
+inline void ProbeSourceReport::set_allocated_message(::KismetExternal::MsgbusMessage* message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.message_);
+  }
+  if (message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(message));
+    if (message_arena != submessage_arena) {
+      message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000004u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000004u;
+  }
+  _impl_.message_ = message;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ProbeSourceReport.message)
+}
+
+// optional .KismetDatasource.SubChannels channels = 3;
+inline bool ProbeSourceReport::_internal_has_channels() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channels_ != nullptr);
+  return value;
+}
+inline bool ProbeSourceReport::has_channels() const {
+  return _internal_has_channels();
+}
+inline void ProbeSourceReport::clear_channels() {
+  if (_impl_.channels_ != nullptr) _impl_.channels_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline const ::KismetDatasource::SubChannels& ProbeSourceReport::_internal_channels() const {
+  const ::KismetDatasource::SubChannels* p = _impl_.channels_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChannels&>(
+      ::KismetDatasource::_SubChannels_default_instance_);
+}
+inline const ::KismetDatasource::SubChannels& ProbeSourceReport::channels() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ProbeSourceReport.channels)
+  return _internal_channels();
+}
+inline void ProbeSourceReport::unsafe_arena_set_allocated_channels(
+    ::KismetDatasource::SubChannels* channels) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channels_);
+  }
+  _impl_.channels_ = channels;
+  if (channels) {
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ProbeSourceReport.channels)
+}
+inline ::KismetDatasource::SubChannels* ProbeSourceReport::release_channels() {
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::KismetDatasource::SubChannels* temp = _impl_.channels_;
+  _impl_.channels_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChannels* ProbeSourceReport::unsafe_arena_release_channels() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ProbeSourceReport.channels)
+  _impl_._has_bits_[0] &= ~0x00000008u;
+  ::KismetDatasource::SubChannels* temp = _impl_.channels_;
+  _impl_.channels_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChannels* ProbeSourceReport::_internal_mutable_channels() {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  if (_impl_.channels_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChannels>(GetArenaForAllocation());
+    _impl_.channels_ = p;
+  }
+  return _impl_.channels_;
+}
+inline ::KismetDatasource::SubChannels* ProbeSourceReport::mutable_channels() {
+  ::KismetDatasource::SubChannels* _msg = _internal_mutable_channels();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ProbeSourceReport.channels)
+  return _msg;
+}
+inline void ProbeSourceReport::set_allocated_channels(::KismetDatasource::SubChannels* channels) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channels_;
+  }
+  if (channels) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channels);
+    if (message_arena != submessage_arena) {
+      channels = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channels, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000008u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000008u;
+  }
+  _impl_.channels_ = channels;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ProbeSourceReport.channels)
+}
+
+// optional .KismetDatasource.SubChanset channel = 4;
+inline bool ProbeSourceReport::_internal_has_channel() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000010u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.channel_ != nullptr);
+  return value;
+}
+inline bool ProbeSourceReport::has_channel() const {
+  return _internal_has_channel();
+}
+inline void ProbeSourceReport::clear_channel() {
+  if (_impl_.channel_ != nullptr) _impl_.channel_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000010u;
+}
+inline const ::KismetDatasource::SubChanset& ProbeSourceReport::_internal_channel() const {
+  const ::KismetDatasource::SubChanset* p = _impl_.channel_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubChanset&>(
+      ::KismetDatasource::_SubChanset_default_instance_);
+}
+inline const ::KismetDatasource::SubChanset& ProbeSourceReport::channel() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ProbeSourceReport.channel)
+  return _internal_channel();
+}
+inline void ProbeSourceReport::unsafe_arena_set_allocated_channel(
+    ::KismetDatasource::SubChanset* channel) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.channel_);
+  }
+  _impl_.channel_ = channel;
+  if (channel) {
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ProbeSourceReport.channel)
+}
+inline ::KismetDatasource::SubChanset* ProbeSourceReport::release_channel() {
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* ProbeSourceReport::unsafe_arena_release_channel() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ProbeSourceReport.channel)
+  _impl_._has_bits_[0] &= ~0x00000010u;
+  ::KismetDatasource::SubChanset* temp = _impl_.channel_;
+  _impl_.channel_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubChanset* ProbeSourceReport::_internal_mutable_channel() {
+  _impl_._has_bits_[0] |= 0x00000010u;
+  if (_impl_.channel_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubChanset>(GetArenaForAllocation());
+    _impl_.channel_ = p;
+  }
+  return _impl_.channel_;
+}
+inline ::KismetDatasource::SubChanset* ProbeSourceReport::mutable_channel() {
+  ::KismetDatasource::SubChanset* _msg = _internal_mutable_channel();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ProbeSourceReport.channel)
+  return _msg;
+}
+inline void ProbeSourceReport::set_allocated_channel(::KismetDatasource::SubChanset* channel) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.channel_;
+  }
+  if (channel) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(channel);
+    if (message_arena != submessage_arena) {
+      channel = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, channel, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000010u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000010u;
+  }
+  _impl_.channel_ = channel;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ProbeSourceReport.channel)
+}
+
+// optional .KismetDatasource.SubSpecset spectrum = 5;
+inline bool ProbeSourceReport::_internal_has_spectrum() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000020u) != 0;
+  PROTOBUF_ASSUME(!value || _impl_.spectrum_ != nullptr);
+  return value;
+}
+inline bool ProbeSourceReport::has_spectrum() const {
+  return _internal_has_spectrum();
+}
+inline void ProbeSourceReport::clear_spectrum() {
+  if (_impl_.spectrum_ != nullptr) _impl_.spectrum_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000020u;
+}
+inline const ::KismetDatasource::SubSpecset& ProbeSourceReport::_internal_spectrum() const {
+  const ::KismetDatasource::SubSpecset* p = _impl_.spectrum_;
+  return p != nullptr ? *p : reinterpret_cast<const ::KismetDatasource::SubSpecset&>(
+      ::KismetDatasource::_SubSpecset_default_instance_);
+}
+inline const ::KismetDatasource::SubSpecset& ProbeSourceReport::spectrum() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ProbeSourceReport.spectrum)
+  return _internal_spectrum();
+}
+inline void ProbeSourceReport::unsafe_arena_set_allocated_spectrum(
+    ::KismetDatasource::SubSpecset* spectrum) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.spectrum_);
+  }
+  _impl_.spectrum_ = spectrum;
+  if (spectrum) {
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:KismetDatasource.ProbeSourceReport.spectrum)
+}
+inline ::KismetDatasource::SubSpecset* ProbeSourceReport::release_spectrum() {
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::KismetDatasource::SubSpecset* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::KismetDatasource::SubSpecset* ProbeSourceReport::unsafe_arena_release_spectrum() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ProbeSourceReport.spectrum)
+  _impl_._has_bits_[0] &= ~0x00000020u;
+  ::KismetDatasource::SubSpecset* temp = _impl_.spectrum_;
+  _impl_.spectrum_ = nullptr;
+  return temp;
+}
+inline ::KismetDatasource::SubSpecset* ProbeSourceReport::_internal_mutable_spectrum() {
+  _impl_._has_bits_[0] |= 0x00000020u;
+  if (_impl_.spectrum_ == nullptr) {
+    auto* p = CreateMaybeMessage<::KismetDatasource::SubSpecset>(GetArenaForAllocation());
+    _impl_.spectrum_ = p;
+  }
+  return _impl_.spectrum_;
+}
+inline ::KismetDatasource::SubSpecset* ProbeSourceReport::mutable_spectrum() {
+  ::KismetDatasource::SubSpecset* _msg = _internal_mutable_spectrum();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ProbeSourceReport.spectrum)
+  return _msg;
+}
+inline void ProbeSourceReport::set_allocated_spectrum(::KismetDatasource::SubSpecset* spectrum) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.spectrum_;
+  }
+  if (spectrum) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(spectrum);
+    if (message_arena != submessage_arena) {
+      spectrum = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, spectrum, submessage_arena);
+    }
+    _impl_._has_bits_[0] |= 0x00000020u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000020u;
+  }
+  _impl_.spectrum_ = spectrum;
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ProbeSourceReport.spectrum)
+}
+
+// optional string hardware = 6;
+inline bool ProbeSourceReport::_internal_has_hardware() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ProbeSourceReport::has_hardware() const {
+  return _internal_has_hardware();
+}
+inline void ProbeSourceReport::clear_hardware() {
+  _impl_.hardware_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& ProbeSourceReport::hardware() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.ProbeSourceReport.hardware)
+  return _internal_hardware();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ProbeSourceReport::set_hardware(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.hardware_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.ProbeSourceReport.hardware)
+}
+inline std::string* ProbeSourceReport::mutable_hardware() {
+  std::string* _s = _internal_mutable_hardware();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.ProbeSourceReport.hardware)
+  return _s;
+}
+inline const std::string& ProbeSourceReport::_internal_hardware() const {
+  return _impl_.hardware_.Get();
+}
+inline void ProbeSourceReport::_internal_set_hardware(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.hardware_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ProbeSourceReport::_internal_mutable_hardware() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.hardware_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ProbeSourceReport::release_hardware() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.ProbeSourceReport.hardware)
+  if (!_internal_has_hardware()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.hardware_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hardware_.IsDefault()) {
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void ProbeSourceReport::set_allocated_hardware(std::string* hardware) {
+  if (hardware != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.hardware_.SetAllocated(hardware, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.hardware_.IsDefault()) {
+    _impl_.hardware_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.ProbeSourceReport.hardware)
+}
+
+// -------------------------------------------------------------------
+
+// WarningReport
+
+// required string warning = 1;
+inline bool WarningReport::_internal_has_warning() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WarningReport::has_warning() const {
+  return _internal_has_warning();
+}
+inline void WarningReport::clear_warning() {
+  _impl_.warning_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& WarningReport::warning() const {
+  // @@protoc_insertion_point(field_get:KismetDatasource.WarningReport.warning)
+  return _internal_warning();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WarningReport::set_warning(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.warning_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetDatasource.WarningReport.warning)
+}
+inline std::string* WarningReport::mutable_warning() {
+  std::string* _s = _internal_mutable_warning();
+  // @@protoc_insertion_point(field_mutable:KismetDatasource.WarningReport.warning)
+  return _s;
+}
+inline const std::string& WarningReport::_internal_warning() const {
+  return _impl_.warning_.Get();
+}
+inline void WarningReport::_internal_set_warning(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.warning_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WarningReport::_internal_mutable_warning() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.warning_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WarningReport::release_warning() {
+  // @@protoc_insertion_point(field_release:KismetDatasource.WarningReport.warning)
+  if (!_internal_has_warning()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.warning_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void WarningReport::set_allocated_warning(std::string* warning) {
+  if (warning != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.warning_.SetAllocated(warning, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.warning_.IsDefault()) {
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetDatasource.WarningReport.warning)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace KismetDatasource
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_datasource_2eproto
@@ -0,0 +1,781 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: eventbus.proto
+
+#include "eventbus.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace KismetEventBus {
+PROTOBUF_CONSTEXPR EventbusEvent::EventbusEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.event_json_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct EventbusEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EventbusEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EventbusEventDefaultTypeInternal() {}
+  union {
+    EventbusEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventbusEventDefaultTypeInternal _EventbusEvent_default_instance_;
+PROTOBUF_CONSTEXPR EventbusRegisterListener::EventbusRegisterListener(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.event_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EventbusRegisterListenerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EventbusRegisterListenerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EventbusRegisterListenerDefaultTypeInternal() {}
+  union {
+    EventbusRegisterListener _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventbusRegisterListenerDefaultTypeInternal _EventbusRegisterListener_default_instance_;
+PROTOBUF_CONSTEXPR EventbusPublishEvent::EventbusPublishEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.event_type_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.event_content_json_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}} {}
+struct EventbusPublishEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EventbusPublishEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EventbusPublishEventDefaultTypeInternal() {}
+  union {
+    EventbusPublishEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventbusPublishEventDefaultTypeInternal _EventbusPublishEvent_default_instance_;
+}  // namespace KismetEventBus
+namespace KismetEventBus {
+
+// ===================================================================
+
+class EventbusEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EventbusEvent>()._impl_._has_bits_);
+  static void set_has_event_json(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+  }
+};
+
+EventbusEvent::EventbusEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetEventBus.EventbusEvent)
+}
+EventbusEvent::EventbusEvent(const EventbusEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  EventbusEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_json_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.event_json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_event_json()) {
+    _this->_impl_.event_json_.Set(from._internal_event_json(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetEventBus.EventbusEvent)
+}
+
+inline void EventbusEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_json_){}
+  };
+  _impl_.event_json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+EventbusEvent::~EventbusEvent() {
+  // @@protoc_insertion_point(destructor:KismetEventBus.EventbusEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EventbusEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.event_json_.Destroy();
+}
+
+void EventbusEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EventbusEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetEventBus.EventbusEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.event_json_.ClearNonDefaultToEmpty();
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* EventbusEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string event_json = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_event_json();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EventbusEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetEventBus.EventbusEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string event_json = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_event_json(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetEventBus.EventbusEvent)
+  return target;
+}
+
+size_t EventbusEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetEventBus.EventbusEvent)
+  size_t total_size = 0;
+
+  // required string event_json = 1;
+  if (_internal_has_event_json()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event_json());
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void EventbusEvent::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const EventbusEvent*>(
+      &from));
+}
+
+void EventbusEvent::MergeFrom(const EventbusEvent& from) {
+  EventbusEvent* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetEventBus.EventbusEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_event_json()) {
+    _this->_internal_set_event_json(from._internal_event_json());
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void EventbusEvent::CopyFrom(const EventbusEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetEventBus.EventbusEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EventbusEvent::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EventbusEvent::InternalSwap(EventbusEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.event_json_, lhs_arena,
+      &other->_impl_.event_json_, rhs_arena
+  );
+}
+
+std::string EventbusEvent::GetTypeName() const {
+  return "KismetEventBus.EventbusEvent";
+}
+
+
+// ===================================================================
+
+class EventbusRegisterListener::_Internal {
+ public:
+};
+
+EventbusRegisterListener::EventbusRegisterListener(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetEventBus.EventbusRegisterListener)
+}
+EventbusRegisterListener::EventbusRegisterListener(const EventbusRegisterListener& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  EventbusRegisterListener* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.event_){from._impl_.event_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:KismetEventBus.EventbusRegisterListener)
+}
+
+inline void EventbusRegisterListener::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.event_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+EventbusRegisterListener::~EventbusRegisterListener() {
+  // @@protoc_insertion_point(destructor:KismetEventBus.EventbusRegisterListener)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EventbusRegisterListener::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.event_.~RepeatedPtrField();
+}
+
+void EventbusRegisterListener::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EventbusRegisterListener::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetEventBus.EventbusRegisterListener)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.event_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* EventbusRegisterListener::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string event = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_event();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EventbusRegisterListener::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetEventBus.EventbusRegisterListener)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string event = 1;
+  for (int i = 0, n = this->_internal_event_size(); i < n; i++) {
+    const auto& s = this->_internal_event(i);
+    target = stream->WriteString(1, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetEventBus.EventbusRegisterListener)
+  return target;
+}
+
+size_t EventbusRegisterListener::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetEventBus.EventbusRegisterListener)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string event = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.event_.size());
+  for (int i = 0, n = _impl_.event_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.event_.Get(i));
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void EventbusRegisterListener::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const EventbusRegisterListener*>(
+      &from));
+}
+
+void EventbusRegisterListener::MergeFrom(const EventbusRegisterListener& from) {
+  EventbusRegisterListener* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetEventBus.EventbusRegisterListener)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.event_.MergeFrom(from._impl_.event_);
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void EventbusRegisterListener::CopyFrom(const EventbusRegisterListener& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetEventBus.EventbusRegisterListener)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EventbusRegisterListener::IsInitialized() const {
+  return true;
+}
+
+void EventbusRegisterListener::InternalSwap(EventbusRegisterListener* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.event_.InternalSwap(&other->_impl_.event_);
+}
+
+std::string EventbusRegisterListener::GetTypeName() const {
+  return "KismetEventBus.EventbusRegisterListener";
+}
+
+
+// ===================================================================
+
+class EventbusPublishEvent::_Internal {
+ public:
+  using HasBits = decltype(std::declval<EventbusPublishEvent>()._impl_._has_bits_);
+  static void set_has_event_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_event_content_json(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+EventbusPublishEvent::EventbusPublishEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetEventBus.EventbusPublishEvent)
+}
+EventbusPublishEvent::EventbusPublishEvent(const EventbusPublishEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  EventbusPublishEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_type_){}
+    , decltype(_impl_.event_content_json_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.event_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_event_type()) {
+    _this->_impl_.event_type_.Set(from._internal_event_type(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.event_content_json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_content_json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_event_content_json()) {
+    _this->_impl_.event_content_json_.Set(from._internal_event_content_json(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetEventBus.EventbusPublishEvent)
+}
+
+inline void EventbusPublishEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.event_type_){}
+    , decltype(_impl_.event_content_json_){}
+  };
+  _impl_.event_type_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_type_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.event_content_json_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.event_content_json_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+EventbusPublishEvent::~EventbusPublishEvent() {
+  // @@protoc_insertion_point(destructor:KismetEventBus.EventbusPublishEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void EventbusPublishEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.event_type_.Destroy();
+  _impl_.event_content_json_.Destroy();
+}
+
+void EventbusPublishEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void EventbusPublishEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetEventBus.EventbusPublishEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.event_type_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.event_content_json_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* EventbusPublishEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string event_type = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_event_type();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string event_content_json = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_event_content_json();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* EventbusPublishEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetEventBus.EventbusPublishEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required string event_type = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_event_type(), target);
+  }
+
+  // required string event_content_json = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_event_content_json(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetEventBus.EventbusPublishEvent)
+  return target;
+}
+
+size_t EventbusPublishEvent::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetEventBus.EventbusPublishEvent)
+  size_t total_size = 0;
+
+  if (_internal_has_event_type()) {
+    // required string event_type = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event_type());
+  }
+
+  if (_internal_has_event_content_json()) {
+    // required string event_content_json = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event_content_json());
+  }
+
+  return total_size;
+}
+size_t EventbusPublishEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetEventBus.EventbusPublishEvent)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string event_type = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event_type());
+
+    // required string event_content_json = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_event_content_json());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void EventbusPublishEvent::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const EventbusPublishEvent*>(
+      &from));
+}
+
+void EventbusPublishEvent::MergeFrom(const EventbusPublishEvent& from) {
+  EventbusPublishEvent* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetEventBus.EventbusPublishEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_event_type(from._internal_event_type());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_event_content_json(from._internal_event_content_json());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void EventbusPublishEvent::CopyFrom(const EventbusPublishEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetEventBus.EventbusPublishEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool EventbusPublishEvent::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void EventbusPublishEvent::InternalSwap(EventbusPublishEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.event_type_, lhs_arena,
+      &other->_impl_.event_type_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.event_content_json_, lhs_arena,
+      &other->_impl_.event_content_json_, rhs_arena
+  );
+}
+
+std::string EventbusPublishEvent::GetTypeName() const {
+  return "KismetEventBus.EventbusPublishEvent";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace KismetEventBus
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::KismetEventBus::EventbusEvent*
+Arena::CreateMaybeMessage< ::KismetEventBus::EventbusEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetEventBus::EventbusEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetEventBus::EventbusRegisterListener*
+Arena::CreateMaybeMessage< ::KismetEventBus::EventbusRegisterListener >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetEventBus::EventbusRegisterListener >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetEventBus::EventbusPublishEvent*
+Arena::CreateMaybeMessage< ::KismetEventBus::EventbusPublishEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetEventBus::EventbusPublishEvent >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,844 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: eventbus.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_eventbus_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_eventbus_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_eventbus_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_eventbus_2eproto {
+  static const uint32_t offsets[];
+};
+namespace KismetEventBus {
+class EventbusEvent;
+struct EventbusEventDefaultTypeInternal;
+extern EventbusEventDefaultTypeInternal _EventbusEvent_default_instance_;
+class EventbusPublishEvent;
+struct EventbusPublishEventDefaultTypeInternal;
+extern EventbusPublishEventDefaultTypeInternal _EventbusPublishEvent_default_instance_;
+class EventbusRegisterListener;
+struct EventbusRegisterListenerDefaultTypeInternal;
+extern EventbusRegisterListenerDefaultTypeInternal _EventbusRegisterListener_default_instance_;
+}  // namespace KismetEventBus
+PROTOBUF_NAMESPACE_OPEN
+template<> ::KismetEventBus::EventbusEvent* Arena::CreateMaybeMessage<::KismetEventBus::EventbusEvent>(Arena*);
+template<> ::KismetEventBus::EventbusPublishEvent* Arena::CreateMaybeMessage<::KismetEventBus::EventbusPublishEvent>(Arena*);
+template<> ::KismetEventBus::EventbusRegisterListener* Arena::CreateMaybeMessage<::KismetEventBus::EventbusRegisterListener>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace KismetEventBus {
+
+// ===================================================================
+
+class EventbusEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetEventBus.EventbusEvent) */ {
+ public:
+  inline EventbusEvent() : EventbusEvent(nullptr) {}
+  ~EventbusEvent() override;
+  explicit PROTOBUF_CONSTEXPR EventbusEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EventbusEvent(const EventbusEvent& from);
+  EventbusEvent(EventbusEvent&& from) noexcept
+    : EventbusEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline EventbusEvent& operator=(const EventbusEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EventbusEvent& operator=(EventbusEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const EventbusEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EventbusEvent* internal_default_instance() {
+    return reinterpret_cast<const EventbusEvent*>(
+               &_EventbusEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(EventbusEvent& a, EventbusEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EventbusEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EventbusEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EventbusEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EventbusEvent>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const EventbusEvent& from);
+  void MergeFrom(const EventbusEvent& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(EventbusEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetEventBus.EventbusEvent";
+  }
+  protected:
+  explicit EventbusEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventJsonFieldNumber = 1,
+  };
+  // required string event_json = 1;
+  bool has_event_json() const;
+  private:
+  bool _internal_has_event_json() const;
+  public:
+  void clear_event_json();
+  const std::string& event_json() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_json(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_event_json();
+  PROTOBUF_NODISCARD std::string* release_event_json();
+  void set_allocated_event_json(std::string* event_json);
+  private:
+  const std::string& _internal_event_json() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_json(const std::string& value);
+  std::string* _internal_mutable_event_json();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetEventBus.EventbusEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_json_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_eventbus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EventbusRegisterListener final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetEventBus.EventbusRegisterListener) */ {
+ public:
+  inline EventbusRegisterListener() : EventbusRegisterListener(nullptr) {}
+  ~EventbusRegisterListener() override;
+  explicit PROTOBUF_CONSTEXPR EventbusRegisterListener(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EventbusRegisterListener(const EventbusRegisterListener& from);
+  EventbusRegisterListener(EventbusRegisterListener&& from) noexcept
+    : EventbusRegisterListener() {
+    *this = ::std::move(from);
+  }
+
+  inline EventbusRegisterListener& operator=(const EventbusRegisterListener& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EventbusRegisterListener& operator=(EventbusRegisterListener&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const EventbusRegisterListener& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EventbusRegisterListener* internal_default_instance() {
+    return reinterpret_cast<const EventbusRegisterListener*>(
+               &_EventbusRegisterListener_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(EventbusRegisterListener& a, EventbusRegisterListener& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EventbusRegisterListener* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EventbusRegisterListener* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EventbusRegisterListener* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EventbusRegisterListener>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const EventbusRegisterListener& from);
+  void MergeFrom(const EventbusRegisterListener& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(EventbusRegisterListener* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetEventBus.EventbusRegisterListener";
+  }
+  protected:
+  explicit EventbusRegisterListener(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventFieldNumber = 1,
+  };
+  // repeated string event = 1;
+  int event_size() const;
+  private:
+  int _internal_event_size() const;
+  public:
+  void clear_event();
+  const std::string& event(int index) const;
+  std::string* mutable_event(int index);
+  void set_event(int index, const std::string& value);
+  void set_event(int index, std::string&& value);
+  void set_event(int index, const char* value);
+  void set_event(int index, const char* value, size_t size);
+  std::string* add_event();
+  void add_event(const std::string& value);
+  void add_event(std::string&& value);
+  void add_event(const char* value);
+  void add_event(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& event() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_event();
+  private:
+  const std::string& _internal_event(int index) const;
+  std::string* _internal_add_event();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetEventBus.EventbusRegisterListener)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> event_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_eventbus_2eproto;
+};
+// -------------------------------------------------------------------
+
+class EventbusPublishEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetEventBus.EventbusPublishEvent) */ {
+ public:
+  inline EventbusPublishEvent() : EventbusPublishEvent(nullptr) {}
+  ~EventbusPublishEvent() override;
+  explicit PROTOBUF_CONSTEXPR EventbusPublishEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  EventbusPublishEvent(const EventbusPublishEvent& from);
+  EventbusPublishEvent(EventbusPublishEvent&& from) noexcept
+    : EventbusPublishEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline EventbusPublishEvent& operator=(const EventbusPublishEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline EventbusPublishEvent& operator=(EventbusPublishEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const EventbusPublishEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const EventbusPublishEvent* internal_default_instance() {
+    return reinterpret_cast<const EventbusPublishEvent*>(
+               &_EventbusPublishEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(EventbusPublishEvent& a, EventbusPublishEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(EventbusPublishEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(EventbusPublishEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  EventbusPublishEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<EventbusPublishEvent>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const EventbusPublishEvent& from);
+  void MergeFrom(const EventbusPublishEvent& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(EventbusPublishEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetEventBus.EventbusPublishEvent";
+  }
+  protected:
+  explicit EventbusPublishEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEventTypeFieldNumber = 1,
+    kEventContentJsonFieldNumber = 2,
+  };
+  // required string event_type = 1;
+  bool has_event_type() const;
+  private:
+  bool _internal_has_event_type() const;
+  public:
+  void clear_event_type();
+  const std::string& event_type() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_type(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_event_type();
+  PROTOBUF_NODISCARD std::string* release_event_type();
+  void set_allocated_event_type(std::string* event_type);
+  private:
+  const std::string& _internal_event_type() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_type(const std::string& value);
+  std::string* _internal_mutable_event_type();
+  public:
+
+  // required string event_content_json = 2;
+  bool has_event_content_json() const;
+  private:
+  bool _internal_has_event_content_json() const;
+  public:
+  void clear_event_content_json();
+  const std::string& event_content_json() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_event_content_json(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_event_content_json();
+  PROTOBUF_NODISCARD std::string* release_event_content_json();
+  void set_allocated_event_content_json(std::string* event_content_json);
+  private:
+  const std::string& _internal_event_content_json() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_event_content_json(const std::string& value);
+  std::string* _internal_mutable_event_content_json();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetEventBus.EventbusPublishEvent)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_type_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr event_content_json_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_eventbus_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// EventbusEvent
+
+// required string event_json = 1;
+inline bool EventbusEvent::_internal_has_event_json() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EventbusEvent::has_event_json() const {
+  return _internal_has_event_json();
+}
+inline void EventbusEvent::clear_event_json() {
+  _impl_.event_json_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EventbusEvent::event_json() const {
+  // @@protoc_insertion_point(field_get:KismetEventBus.EventbusEvent.event_json)
+  return _internal_event_json();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventbusEvent::set_event_json(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_json_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetEventBus.EventbusEvent.event_json)
+}
+inline std::string* EventbusEvent::mutable_event_json() {
+  std::string* _s = _internal_mutable_event_json();
+  // @@protoc_insertion_point(field_mutable:KismetEventBus.EventbusEvent.event_json)
+  return _s;
+}
+inline const std::string& EventbusEvent::_internal_event_json() const {
+  return _impl_.event_json_.Get();
+}
+inline void EventbusEvent::_internal_set_event_json(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_json_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EventbusEvent::_internal_mutable_event_json() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_json_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EventbusEvent::release_event_json() {
+  // @@protoc_insertion_point(field_release:KismetEventBus.EventbusEvent.event_json)
+  if (!_internal_has_event_json()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_json_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_json_.IsDefault()) {
+    _impl_.event_json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EventbusEvent::set_allocated_event_json(std::string* event_json) {
+  if (event_json != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_json_.SetAllocated(event_json, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_json_.IsDefault()) {
+    _impl_.event_json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetEventBus.EventbusEvent.event_json)
+}
+
+// -------------------------------------------------------------------
+
+// EventbusRegisterListener
+
+// repeated string event = 1;
+inline int EventbusRegisterListener::_internal_event_size() const {
+  return _impl_.event_.size();
+}
+inline int EventbusRegisterListener::event_size() const {
+  return _internal_event_size();
+}
+inline void EventbusRegisterListener::clear_event() {
+  _impl_.event_.Clear();
+}
+inline std::string* EventbusRegisterListener::add_event() {
+  std::string* _s = _internal_add_event();
+  // @@protoc_insertion_point(field_add_mutable:KismetEventBus.EventbusRegisterListener.event)
+  return _s;
+}
+inline const std::string& EventbusRegisterListener::_internal_event(int index) const {
+  return _impl_.event_.Get(index);
+}
+inline const std::string& EventbusRegisterListener::event(int index) const {
+  // @@protoc_insertion_point(field_get:KismetEventBus.EventbusRegisterListener.event)
+  return _internal_event(index);
+}
+inline std::string* EventbusRegisterListener::mutable_event(int index) {
+  // @@protoc_insertion_point(field_mutable:KismetEventBus.EventbusRegisterListener.event)
+  return _impl_.event_.Mutable(index);
+}
+inline void EventbusRegisterListener::set_event(int index, const std::string& value) {
+  _impl_.event_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:KismetEventBus.EventbusRegisterListener.event)
+}
+inline void EventbusRegisterListener::set_event(int index, std::string&& value) {
+  _impl_.event_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:KismetEventBus.EventbusRegisterListener.event)
+}
+inline void EventbusRegisterListener::set_event(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.event_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:KismetEventBus.EventbusRegisterListener.event)
+}
+inline void EventbusRegisterListener::set_event(int index, const char* value, size_t size) {
+  _impl_.event_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:KismetEventBus.EventbusRegisterListener.event)
+}
+inline std::string* EventbusRegisterListener::_internal_add_event() {
+  return _impl_.event_.Add();
+}
+inline void EventbusRegisterListener::add_event(const std::string& value) {
+  _impl_.event_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:KismetEventBus.EventbusRegisterListener.event)
+}
+inline void EventbusRegisterListener::add_event(std::string&& value) {
+  _impl_.event_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:KismetEventBus.EventbusRegisterListener.event)
+}
+inline void EventbusRegisterListener::add_event(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.event_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:KismetEventBus.EventbusRegisterListener.event)
+}
+inline void EventbusRegisterListener::add_event(const char* value, size_t size) {
+  _impl_.event_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:KismetEventBus.EventbusRegisterListener.event)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+EventbusRegisterListener::event() const {
+  // @@protoc_insertion_point(field_list:KismetEventBus.EventbusRegisterListener.event)
+  return _impl_.event_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+EventbusRegisterListener::mutable_event() {
+  // @@protoc_insertion_point(field_mutable_list:KismetEventBus.EventbusRegisterListener.event)
+  return &_impl_.event_;
+}
+
+// -------------------------------------------------------------------
+
+// EventbusPublishEvent
+
+// required string event_type = 1;
+inline bool EventbusPublishEvent::_internal_has_event_type() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EventbusPublishEvent::has_event_type() const {
+  return _internal_has_event_type();
+}
+inline void EventbusPublishEvent::clear_event_type() {
+  _impl_.event_type_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EventbusPublishEvent::event_type() const {
+  // @@protoc_insertion_point(field_get:KismetEventBus.EventbusPublishEvent.event_type)
+  return _internal_event_type();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventbusPublishEvent::set_event_type(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.event_type_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetEventBus.EventbusPublishEvent.event_type)
+}
+inline std::string* EventbusPublishEvent::mutable_event_type() {
+  std::string* _s = _internal_mutable_event_type();
+  // @@protoc_insertion_point(field_mutable:KismetEventBus.EventbusPublishEvent.event_type)
+  return _s;
+}
+inline const std::string& EventbusPublishEvent::_internal_event_type() const {
+  return _impl_.event_type_.Get();
+}
+inline void EventbusPublishEvent::_internal_set_event_type(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.event_type_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EventbusPublishEvent::_internal_mutable_event_type() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.event_type_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EventbusPublishEvent::release_event_type() {
+  // @@protoc_insertion_point(field_release:KismetEventBus.EventbusPublishEvent.event_type)
+  if (!_internal_has_event_type()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.event_type_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_type_.IsDefault()) {
+    _impl_.event_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EventbusPublishEvent::set_allocated_event_type(std::string* event_type) {
+  if (event_type != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.event_type_.SetAllocated(event_type, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_type_.IsDefault()) {
+    _impl_.event_type_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetEventBus.EventbusPublishEvent.event_type)
+}
+
+// required string event_content_json = 2;
+inline bool EventbusPublishEvent::_internal_has_event_content_json() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EventbusPublishEvent::has_event_content_json() const {
+  return _internal_has_event_content_json();
+}
+inline void EventbusPublishEvent::clear_event_content_json() {
+  _impl_.event_content_json_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& EventbusPublishEvent::event_content_json() const {
+  // @@protoc_insertion_point(field_get:KismetEventBus.EventbusPublishEvent.event_content_json)
+  return _internal_event_content_json();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventbusPublishEvent::set_event_content_json(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.event_content_json_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetEventBus.EventbusPublishEvent.event_content_json)
+}
+inline std::string* EventbusPublishEvent::mutable_event_content_json() {
+  std::string* _s = _internal_mutable_event_content_json();
+  // @@protoc_insertion_point(field_mutable:KismetEventBus.EventbusPublishEvent.event_content_json)
+  return _s;
+}
+inline const std::string& EventbusPublishEvent::_internal_event_content_json() const {
+  return _impl_.event_content_json_.Get();
+}
+inline void EventbusPublishEvent::_internal_set_event_content_json(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.event_content_json_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EventbusPublishEvent::_internal_mutable_event_content_json() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.event_content_json_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EventbusPublishEvent::release_event_content_json() {
+  // @@protoc_insertion_point(field_release:KismetEventBus.EventbusPublishEvent.event_content_json)
+  if (!_internal_has_event_content_json()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.event_content_json_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_content_json_.IsDefault()) {
+    _impl_.event_content_json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EventbusPublishEvent::set_allocated_event_content_json(std::string* event_content_json) {
+  if (event_content_json != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.event_content_json_.SetAllocated(event_content_json, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.event_content_json_.IsDefault()) {
+    _impl_.event_content_json_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetEventBus.EventbusPublishEvent.event_content_json)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace KismetEventBus
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_eventbus_2eproto
@@ -0,0 +1,2429 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: http.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_http_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_http_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_http_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_http_2eproto {
+  static const uint32_t offsets[];
+};
+namespace KismetExternalHttp {
+class HttpAuthToken;
+struct HttpAuthTokenDefaultTypeInternal;
+extern HttpAuthTokenDefaultTypeInternal _HttpAuthToken_default_instance_;
+class HttpAuthTokenRequest;
+struct HttpAuthTokenRequestDefaultTypeInternal;
+extern HttpAuthTokenRequestDefaultTypeInternal _HttpAuthTokenRequest_default_instance_;
+class HttpRegisterUri;
+struct HttpRegisterUriDefaultTypeInternal;
+extern HttpRegisterUriDefaultTypeInternal _HttpRegisterUri_default_instance_;
+class HttpRequest;
+struct HttpRequestDefaultTypeInternal;
+extern HttpRequestDefaultTypeInternal _HttpRequest_default_instance_;
+class HttpRequestCancel;
+struct HttpRequestCancelDefaultTypeInternal;
+extern HttpRequestCancelDefaultTypeInternal _HttpRequestCancel_default_instance_;
+class HttpResponse;
+struct HttpResponseDefaultTypeInternal;
+extern HttpResponseDefaultTypeInternal _HttpResponse_default_instance_;
+class SubHttpHeader;
+struct SubHttpHeaderDefaultTypeInternal;
+extern SubHttpHeaderDefaultTypeInternal _SubHttpHeader_default_instance_;
+class SubHttpVariableData;
+struct SubHttpVariableDataDefaultTypeInternal;
+extern SubHttpVariableDataDefaultTypeInternal _SubHttpVariableData_default_instance_;
+}  // namespace KismetExternalHttp
+PROTOBUF_NAMESPACE_OPEN
+template<> ::KismetExternalHttp::HttpAuthToken* Arena::CreateMaybeMessage<::KismetExternalHttp::HttpAuthToken>(Arena*);
+template<> ::KismetExternalHttp::HttpAuthTokenRequest* Arena::CreateMaybeMessage<::KismetExternalHttp::HttpAuthTokenRequest>(Arena*);
+template<> ::KismetExternalHttp::HttpRegisterUri* Arena::CreateMaybeMessage<::KismetExternalHttp::HttpRegisterUri>(Arena*);
+template<> ::KismetExternalHttp::HttpRequest* Arena::CreateMaybeMessage<::KismetExternalHttp::HttpRequest>(Arena*);
+template<> ::KismetExternalHttp::HttpRequestCancel* Arena::CreateMaybeMessage<::KismetExternalHttp::HttpRequestCancel>(Arena*);
+template<> ::KismetExternalHttp::HttpResponse* Arena::CreateMaybeMessage<::KismetExternalHttp::HttpResponse>(Arena*);
+template<> ::KismetExternalHttp::SubHttpHeader* Arena::CreateMaybeMessage<::KismetExternalHttp::SubHttpHeader>(Arena*);
+template<> ::KismetExternalHttp::SubHttpVariableData* Arena::CreateMaybeMessage<::KismetExternalHttp::SubHttpVariableData>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace KismetExternalHttp {
+
+// ===================================================================
+
+class HttpAuthTokenRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.HttpAuthTokenRequest) */ {
+ public:
+  inline HttpAuthTokenRequest() : HttpAuthTokenRequest(nullptr) {}
+  ~HttpAuthTokenRequest() override;
+  explicit PROTOBUF_CONSTEXPR HttpAuthTokenRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HttpAuthTokenRequest(const HttpAuthTokenRequest& from);
+  HttpAuthTokenRequest(HttpAuthTokenRequest&& from) noexcept
+    : HttpAuthTokenRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline HttpAuthTokenRequest& operator=(const HttpAuthTokenRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HttpAuthTokenRequest& operator=(HttpAuthTokenRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HttpAuthTokenRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpAuthTokenRequest* internal_default_instance() {
+    return reinterpret_cast<const HttpAuthTokenRequest*>(
+               &_HttpAuthTokenRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(HttpAuthTokenRequest& a, HttpAuthTokenRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpAuthTokenRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpAuthTokenRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HttpAuthTokenRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpAuthTokenRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HttpAuthTokenRequest& from);
+  void MergeFrom(const HttpAuthTokenRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HttpAuthTokenRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.HttpAuthTokenRequest";
+  }
+  protected:
+  explicit HttpAuthTokenRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.HttpAuthTokenRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HttpAuthToken final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.HttpAuthToken) */ {
+ public:
+  inline HttpAuthToken() : HttpAuthToken(nullptr) {}
+  ~HttpAuthToken() override;
+  explicit PROTOBUF_CONSTEXPR HttpAuthToken(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HttpAuthToken(const HttpAuthToken& from);
+  HttpAuthToken(HttpAuthToken&& from) noexcept
+    : HttpAuthToken() {
+    *this = ::std::move(from);
+  }
+
+  inline HttpAuthToken& operator=(const HttpAuthToken& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HttpAuthToken& operator=(HttpAuthToken&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HttpAuthToken& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpAuthToken* internal_default_instance() {
+    return reinterpret_cast<const HttpAuthToken*>(
+               &_HttpAuthToken_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(HttpAuthToken& a, HttpAuthToken& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpAuthToken* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpAuthToken* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HttpAuthToken* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpAuthToken>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HttpAuthToken& from);
+  void MergeFrom(const HttpAuthToken& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HttpAuthToken* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.HttpAuthToken";
+  }
+  protected:
+  explicit HttpAuthToken(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTokenFieldNumber = 1,
+  };
+  // required string token = 1;
+  bool has_token() const;
+  private:
+  bool _internal_has_token() const;
+  public:
+  void clear_token();
+  const std::string& token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.HttpAuthToken)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HttpRegisterUri final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.HttpRegisterUri) */ {
+ public:
+  inline HttpRegisterUri() : HttpRegisterUri(nullptr) {}
+  ~HttpRegisterUri() override;
+  explicit PROTOBUF_CONSTEXPR HttpRegisterUri(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HttpRegisterUri(const HttpRegisterUri& from);
+  HttpRegisterUri(HttpRegisterUri&& from) noexcept
+    : HttpRegisterUri() {
+    *this = ::std::move(from);
+  }
+
+  inline HttpRegisterUri& operator=(const HttpRegisterUri& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HttpRegisterUri& operator=(HttpRegisterUri&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HttpRegisterUri& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpRegisterUri* internal_default_instance() {
+    return reinterpret_cast<const HttpRegisterUri*>(
+               &_HttpRegisterUri_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(HttpRegisterUri& a, HttpRegisterUri& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpRegisterUri* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpRegisterUri* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HttpRegisterUri* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpRegisterUri>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HttpRegisterUri& from);
+  void MergeFrom(const HttpRegisterUri& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HttpRegisterUri* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.HttpRegisterUri";
+  }
+  protected:
+  explicit HttpRegisterUri(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUriFieldNumber = 1,
+    kMethodFieldNumber = 2,
+    kObsoleteAuthRequiredFieldNumber = 3,
+  };
+  // required string uri = 1;
+  bool has_uri() const;
+  private:
+  bool _internal_has_uri() const;
+  public:
+  void clear_uri();
+  const std::string& uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri();
+  PROTOBUF_NODISCARD std::string* release_uri();
+  void set_allocated_uri(std::string* uri);
+  private:
+  const std::string& _internal_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri(const std::string& value);
+  std::string* _internal_mutable_uri();
+  public:
+
+  // required string method = 2;
+  bool has_method() const;
+  private:
+  bool _internal_has_method() const;
+  public:
+  void clear_method();
+  const std::string& method() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method();
+  PROTOBUF_NODISCARD std::string* release_method();
+  void set_allocated_method(std::string* method);
+  private:
+  const std::string& _internal_method() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method(const std::string& value);
+  std::string* _internal_mutable_method();
+  public:
+
+  // optional bool obsolete_auth_required = 3;
+  bool has_obsolete_auth_required() const;
+  private:
+  bool _internal_has_obsolete_auth_required() const;
+  public:
+  void clear_obsolete_auth_required();
+  bool obsolete_auth_required() const;
+  void set_obsolete_auth_required(bool value);
+  private:
+  bool _internal_obsolete_auth_required() const;
+  void _internal_set_obsolete_auth_required(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.HttpRegisterUri)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_;
+    bool obsolete_auth_required_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubHttpVariableData final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.SubHttpVariableData) */ {
+ public:
+  inline SubHttpVariableData() : SubHttpVariableData(nullptr) {}
+  ~SubHttpVariableData() override;
+  explicit PROTOBUF_CONSTEXPR SubHttpVariableData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubHttpVariableData(const SubHttpVariableData& from);
+  SubHttpVariableData(SubHttpVariableData&& from) noexcept
+    : SubHttpVariableData() {
+    *this = ::std::move(from);
+  }
+
+  inline SubHttpVariableData& operator=(const SubHttpVariableData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubHttpVariableData& operator=(SubHttpVariableData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubHttpVariableData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubHttpVariableData* internal_default_instance() {
+    return reinterpret_cast<const SubHttpVariableData*>(
+               &_SubHttpVariableData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(SubHttpVariableData& a, SubHttpVariableData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubHttpVariableData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubHttpVariableData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubHttpVariableData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubHttpVariableData>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubHttpVariableData& from);
+  void MergeFrom(const SubHttpVariableData& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubHttpVariableData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.SubHttpVariableData";
+  }
+  protected:
+  explicit SubHttpVariableData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFieldFieldNumber = 1,
+    kContentFieldNumber = 2,
+  };
+  // required string field = 1;
+  bool has_field() const;
+  private:
+  bool _internal_has_field() const;
+  public:
+  void clear_field();
+  const std::string& field() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_field(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_field();
+  PROTOBUF_NODISCARD std::string* release_field();
+  void set_allocated_field(std::string* field);
+  private:
+  const std::string& _internal_field() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_field(const std::string& value);
+  std::string* _internal_mutable_field();
+  public:
+
+  // required string content = 2;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.SubHttpVariableData)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr field_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HttpRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.HttpRequest) */ {
+ public:
+  inline HttpRequest() : HttpRequest(nullptr) {}
+  ~HttpRequest() override;
+  explicit PROTOBUF_CONSTEXPR HttpRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HttpRequest(const HttpRequest& from);
+  HttpRequest(HttpRequest&& from) noexcept
+    : HttpRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline HttpRequest& operator=(const HttpRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HttpRequest& operator=(HttpRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HttpRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpRequest* internal_default_instance() {
+    return reinterpret_cast<const HttpRequest*>(
+               &_HttpRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(HttpRequest& a, HttpRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HttpRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpRequest>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HttpRequest& from);
+  void MergeFrom(const HttpRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HttpRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.HttpRequest";
+  }
+  protected:
+  explicit HttpRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVariableDataFieldNumber = 4,
+    kUriFieldNumber = 2,
+    kMethodFieldNumber = 3,
+    kReqIdFieldNumber = 1,
+  };
+  // repeated .KismetExternalHttp.SubHttpVariableData variable_data = 4;
+  int variable_data_size() const;
+  private:
+  int _internal_variable_data_size() const;
+  public:
+  void clear_variable_data();
+  ::KismetExternalHttp::SubHttpVariableData* mutable_variable_data(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpVariableData >*
+      mutable_variable_data();
+  private:
+  const ::KismetExternalHttp::SubHttpVariableData& _internal_variable_data(int index) const;
+  ::KismetExternalHttp::SubHttpVariableData* _internal_add_variable_data();
+  public:
+  const ::KismetExternalHttp::SubHttpVariableData& variable_data(int index) const;
+  ::KismetExternalHttp::SubHttpVariableData* add_variable_data();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpVariableData >&
+      variable_data() const;
+
+  // required string uri = 2;
+  bool has_uri() const;
+  private:
+  bool _internal_has_uri() const;
+  public:
+  void clear_uri();
+  const std::string& uri() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_uri(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_uri();
+  PROTOBUF_NODISCARD std::string* release_uri();
+  void set_allocated_uri(std::string* uri);
+  private:
+  const std::string& _internal_uri() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_uri(const std::string& value);
+  std::string* _internal_mutable_uri();
+  public:
+
+  // required string method = 3;
+  bool has_method() const;
+  private:
+  bool _internal_has_method() const;
+  public:
+  void clear_method();
+  const std::string& method() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_method(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_method();
+  PROTOBUF_NODISCARD std::string* release_method();
+  void set_allocated_method(std::string* method);
+  private:
+  const std::string& _internal_method() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_method(const std::string& value);
+  std::string* _internal_mutable_method();
+  public:
+
+  // required uint32 req_id = 1;
+  bool has_req_id() const;
+  private:
+  bool _internal_has_req_id() const;
+  public:
+  void clear_req_id();
+  uint32_t req_id() const;
+  void set_req_id(uint32_t value);
+  private:
+  uint32_t _internal_req_id() const;
+  void _internal_set_req_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.HttpRequest)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpVariableData > variable_data_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr uri_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr method_;
+    uint32_t req_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HttpRequestCancel final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.HttpRequestCancel) */ {
+ public:
+  inline HttpRequestCancel() : HttpRequestCancel(nullptr) {}
+  ~HttpRequestCancel() override;
+  explicit PROTOBUF_CONSTEXPR HttpRequestCancel(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HttpRequestCancel(const HttpRequestCancel& from);
+  HttpRequestCancel(HttpRequestCancel&& from) noexcept
+    : HttpRequestCancel() {
+    *this = ::std::move(from);
+  }
+
+  inline HttpRequestCancel& operator=(const HttpRequestCancel& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HttpRequestCancel& operator=(HttpRequestCancel&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HttpRequestCancel& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpRequestCancel* internal_default_instance() {
+    return reinterpret_cast<const HttpRequestCancel*>(
+               &_HttpRequestCancel_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(HttpRequestCancel& a, HttpRequestCancel& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpRequestCancel* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpRequestCancel* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HttpRequestCancel* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpRequestCancel>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HttpRequestCancel& from);
+  void MergeFrom(const HttpRequestCancel& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HttpRequestCancel* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.HttpRequestCancel";
+  }
+  protected:
+  explicit HttpRequestCancel(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReqIdFieldNumber = 1,
+  };
+  // required uint32 req_id = 1;
+  bool has_req_id() const;
+  private:
+  bool _internal_has_req_id() const;
+  public:
+  void clear_req_id();
+  uint32_t req_id() const;
+  void set_req_id(uint32_t value);
+  private:
+  uint32_t _internal_req_id() const;
+  void _internal_set_req_id(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.HttpRequestCancel)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t req_id_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SubHttpHeader final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.SubHttpHeader) */ {
+ public:
+  inline SubHttpHeader() : SubHttpHeader(nullptr) {}
+  ~SubHttpHeader() override;
+  explicit PROTOBUF_CONSTEXPR SubHttpHeader(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SubHttpHeader(const SubHttpHeader& from);
+  SubHttpHeader(SubHttpHeader&& from) noexcept
+    : SubHttpHeader() {
+    *this = ::std::move(from);
+  }
+
+  inline SubHttpHeader& operator=(const SubHttpHeader& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SubHttpHeader& operator=(SubHttpHeader&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const SubHttpHeader& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SubHttpHeader* internal_default_instance() {
+    return reinterpret_cast<const SubHttpHeader*>(
+               &_SubHttpHeader_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SubHttpHeader& a, SubHttpHeader& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SubHttpHeader* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SubHttpHeader* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SubHttpHeader* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SubHttpHeader>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const SubHttpHeader& from);
+  void MergeFrom(const SubHttpHeader& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(SubHttpHeader* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.SubHttpHeader";
+  }
+  protected:
+  explicit SubHttpHeader(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderFieldNumber = 1,
+    kContentFieldNumber = 2,
+  };
+  // required string header = 1;
+  bool has_header() const;
+  private:
+  bool _internal_has_header() const;
+  public:
+  void clear_header();
+  const std::string& header() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_header(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_header();
+  PROTOBUF_NODISCARD std::string* release_header();
+  void set_allocated_header(std::string* header);
+  private:
+  const std::string& _internal_header() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_header(const std::string& value);
+  std::string* _internal_mutable_header();
+  public:
+
+  // required string content = 2;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.SubHttpHeader)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr header_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// -------------------------------------------------------------------
+
+class HttpResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:KismetExternalHttp.HttpResponse) */ {
+ public:
+  inline HttpResponse() : HttpResponse(nullptr) {}
+  ~HttpResponse() override;
+  explicit PROTOBUF_CONSTEXPR HttpResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  HttpResponse(const HttpResponse& from);
+  HttpResponse(HttpResponse&& from) noexcept
+    : HttpResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline HttpResponse& operator=(const HttpResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline HttpResponse& operator=(HttpResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const HttpResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const HttpResponse* internal_default_instance() {
+    return reinterpret_cast<const HttpResponse*>(
+               &_HttpResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(HttpResponse& a, HttpResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(HttpResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(HttpResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  HttpResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<HttpResponse>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const HttpResponse& from);
+  void MergeFrom(const HttpResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(HttpResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "KismetExternalHttp.HttpResponse";
+  }
+  protected:
+  explicit HttpResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kHeaderContentFieldNumber = 2,
+    kContentFieldNumber = 3,
+    kReqIdFieldNumber = 1,
+    kResultcodeFieldNumber = 4,
+    kCloseResponseFieldNumber = 5,
+  };
+  // repeated .KismetExternalHttp.SubHttpHeader header_content = 2;
+  int header_content_size() const;
+  private:
+  int _internal_header_content_size() const;
+  public:
+  void clear_header_content();
+  ::KismetExternalHttp::SubHttpHeader* mutable_header_content(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpHeader >*
+      mutable_header_content();
+  private:
+  const ::KismetExternalHttp::SubHttpHeader& _internal_header_content(int index) const;
+  ::KismetExternalHttp::SubHttpHeader* _internal_add_header_content();
+  public:
+  const ::KismetExternalHttp::SubHttpHeader& header_content(int index) const;
+  ::KismetExternalHttp::SubHttpHeader* add_header_content();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpHeader >&
+      header_content() const;
+
+  // optional bytes content = 3;
+  bool has_content() const;
+  private:
+  bool _internal_has_content() const;
+  public:
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // required uint32 req_id = 1;
+  bool has_req_id() const;
+  private:
+  bool _internal_has_req_id() const;
+  public:
+  void clear_req_id();
+  uint32_t req_id() const;
+  void set_req_id(uint32_t value);
+  private:
+  uint32_t _internal_req_id() const;
+  void _internal_set_req_id(uint32_t value);
+  public:
+
+  // optional uint32 resultcode = 4;
+  bool has_resultcode() const;
+  private:
+  bool _internal_has_resultcode() const;
+  public:
+  void clear_resultcode();
+  uint32_t resultcode() const;
+  void set_resultcode(uint32_t value);
+  private:
+  uint32_t _internal_resultcode() const;
+  void _internal_set_resultcode(uint32_t value);
+  public:
+
+  // optional bool close_response = 5;
+  bool has_close_response() const;
+  private:
+  bool _internal_has_close_response() const;
+  public:
+  void clear_close_response();
+  bool close_response() const;
+  void set_close_response(bool value);
+  private:
+  bool _internal_close_response() const;
+  void _internal_set_close_response(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:KismetExternalHttp.HttpResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpHeader > header_content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    uint32_t req_id_;
+    uint32_t resultcode_;
+    bool close_response_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_http_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// HttpAuthTokenRequest
+
+// -------------------------------------------------------------------
+
+// HttpAuthToken
+
+// required string token = 1;
+inline bool HttpAuthToken::_internal_has_token() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HttpAuthToken::has_token() const {
+  return _internal_has_token();
+}
+inline void HttpAuthToken::clear_token() {
+  _impl_.token_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HttpAuthToken::token() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpAuthToken.token)
+  return _internal_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpAuthToken::set_token(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.token_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpAuthToken.token)
+}
+inline std::string* HttpAuthToken::mutable_token() {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpAuthToken.token)
+  return _s;
+}
+inline const std::string& HttpAuthToken::_internal_token() const {
+  return _impl_.token_.Get();
+}
+inline void HttpAuthToken::_internal_set_token(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HttpAuthToken::_internal_mutable_token() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HttpAuthToken::release_token() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.HttpAuthToken.token)
+  if (!_internal_has_token()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.token_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HttpAuthToken::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.token_.SetAllocated(token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.HttpAuthToken.token)
+}
+
+// -------------------------------------------------------------------
+
+// HttpRegisterUri
+
+// required string uri = 1;
+inline bool HttpRegisterUri::_internal_has_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HttpRegisterUri::has_uri() const {
+  return _internal_has_uri();
+}
+inline void HttpRegisterUri::clear_uri() {
+  _impl_.uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HttpRegisterUri::uri() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRegisterUri.uri)
+  return _internal_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpRegisterUri::set_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpRegisterUri.uri)
+}
+inline std::string* HttpRegisterUri::mutable_uri() {
+  std::string* _s = _internal_mutable_uri();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpRegisterUri.uri)
+  return _s;
+}
+inline const std::string& HttpRegisterUri::_internal_uri() const {
+  return _impl_.uri_.Get();
+}
+inline void HttpRegisterUri::_internal_set_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HttpRegisterUri::_internal_mutable_uri() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HttpRegisterUri::release_uri() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.HttpRegisterUri.uri)
+  if (!_internal_has_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HttpRegisterUri::set_allocated_uri(std::string* uri) {
+  if (uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.uri_.SetAllocated(uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.HttpRegisterUri.uri)
+}
+
+// required string method = 2;
+inline bool HttpRegisterUri::_internal_has_method() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HttpRegisterUri::has_method() const {
+  return _internal_has_method();
+}
+inline void HttpRegisterUri::clear_method() {
+  _impl_.method_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& HttpRegisterUri::method() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRegisterUri.method)
+  return _internal_method();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpRegisterUri::set_method(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.method_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpRegisterUri.method)
+}
+inline std::string* HttpRegisterUri::mutable_method() {
+  std::string* _s = _internal_mutable_method();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpRegisterUri.method)
+  return _s;
+}
+inline const std::string& HttpRegisterUri::_internal_method() const {
+  return _impl_.method_.Get();
+}
+inline void HttpRegisterUri::_internal_set_method(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.method_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HttpRegisterUri::_internal_mutable_method() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.method_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HttpRegisterUri::release_method() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.HttpRegisterUri.method)
+  if (!_internal_has_method()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.method_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_.IsDefault()) {
+    _impl_.method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HttpRegisterUri::set_allocated_method(std::string* method) {
+  if (method != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.method_.SetAllocated(method, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_.IsDefault()) {
+    _impl_.method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.HttpRegisterUri.method)
+}
+
+// optional bool obsolete_auth_required = 3;
+inline bool HttpRegisterUri::_internal_has_obsolete_auth_required() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool HttpRegisterUri::has_obsolete_auth_required() const {
+  return _internal_has_obsolete_auth_required();
+}
+inline void HttpRegisterUri::clear_obsolete_auth_required() {
+  _impl_.obsolete_auth_required_ = false;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline bool HttpRegisterUri::_internal_obsolete_auth_required() const {
+  return _impl_.obsolete_auth_required_;
+}
+inline bool HttpRegisterUri::obsolete_auth_required() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRegisterUri.obsolete_auth_required)
+  return _internal_obsolete_auth_required();
+}
+inline void HttpRegisterUri::_internal_set_obsolete_auth_required(bool value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.obsolete_auth_required_ = value;
+}
+inline void HttpRegisterUri::set_obsolete_auth_required(bool value) {
+  _internal_set_obsolete_auth_required(value);
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpRegisterUri.obsolete_auth_required)
+}
+
+// -------------------------------------------------------------------
+
+// SubHttpVariableData
+
+// required string field = 1;
+inline bool SubHttpVariableData::_internal_has_field() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubHttpVariableData::has_field() const {
+  return _internal_has_field();
+}
+inline void SubHttpVariableData::clear_field() {
+  _impl_.field_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubHttpVariableData::field() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.SubHttpVariableData.field)
+  return _internal_field();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubHttpVariableData::set_field(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.field_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.SubHttpVariableData.field)
+}
+inline std::string* SubHttpVariableData::mutable_field() {
+  std::string* _s = _internal_mutable_field();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.SubHttpVariableData.field)
+  return _s;
+}
+inline const std::string& SubHttpVariableData::_internal_field() const {
+  return _impl_.field_.Get();
+}
+inline void SubHttpVariableData::_internal_set_field(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.field_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubHttpVariableData::_internal_mutable_field() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.field_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubHttpVariableData::release_field() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.SubHttpVariableData.field)
+  if (!_internal_has_field()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.field_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.field_.IsDefault()) {
+    _impl_.field_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubHttpVariableData::set_allocated_field(std::string* field) {
+  if (field != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.field_.SetAllocated(field, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.field_.IsDefault()) {
+    _impl_.field_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.SubHttpVariableData.field)
+}
+
+// required string content = 2;
+inline bool SubHttpVariableData::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubHttpVariableData::has_content() const {
+  return _internal_has_content();
+}
+inline void SubHttpVariableData::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SubHttpVariableData::content() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.SubHttpVariableData.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubHttpVariableData::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.SubHttpVariableData.content)
+}
+inline std::string* SubHttpVariableData::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.SubHttpVariableData.content)
+  return _s;
+}
+inline const std::string& SubHttpVariableData::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void SubHttpVariableData::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubHttpVariableData::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubHttpVariableData::release_content() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.SubHttpVariableData.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubHttpVariableData::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.SubHttpVariableData.content)
+}
+
+// -------------------------------------------------------------------
+
+// HttpRequest
+
+// required uint32 req_id = 1;
+inline bool HttpRequest::_internal_has_req_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool HttpRequest::has_req_id() const {
+  return _internal_has_req_id();
+}
+inline void HttpRequest::clear_req_id() {
+  _impl_.req_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t HttpRequest::_internal_req_id() const {
+  return _impl_.req_id_;
+}
+inline uint32_t HttpRequest::req_id() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRequest.req_id)
+  return _internal_req_id();
+}
+inline void HttpRequest::_internal_set_req_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.req_id_ = value;
+}
+inline void HttpRequest::set_req_id(uint32_t value) {
+  _internal_set_req_id(value);
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpRequest.req_id)
+}
+
+// required string uri = 2;
+inline bool HttpRequest::_internal_has_uri() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HttpRequest::has_uri() const {
+  return _internal_has_uri();
+}
+inline void HttpRequest::clear_uri() {
+  _impl_.uri_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HttpRequest::uri() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRequest.uri)
+  return _internal_uri();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpRequest::set_uri(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.uri_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpRequest.uri)
+}
+inline std::string* HttpRequest::mutable_uri() {
+  std::string* _s = _internal_mutable_uri();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpRequest.uri)
+  return _s;
+}
+inline const std::string& HttpRequest::_internal_uri() const {
+  return _impl_.uri_.Get();
+}
+inline void HttpRequest::_internal_set_uri(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.uri_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HttpRequest::_internal_mutable_uri() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.uri_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HttpRequest::release_uri() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.HttpRequest.uri)
+  if (!_internal_has_uri()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.uri_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HttpRequest::set_allocated_uri(std::string* uri) {
+  if (uri != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.uri_.SetAllocated(uri, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.uri_.IsDefault()) {
+    _impl_.uri_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.HttpRequest.uri)
+}
+
+// required string method = 3;
+inline bool HttpRequest::_internal_has_method() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HttpRequest::has_method() const {
+  return _internal_has_method();
+}
+inline void HttpRequest::clear_method() {
+  _impl_.method_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& HttpRequest::method() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRequest.method)
+  return _internal_method();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpRequest::set_method(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.method_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpRequest.method)
+}
+inline std::string* HttpRequest::mutable_method() {
+  std::string* _s = _internal_mutable_method();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpRequest.method)
+  return _s;
+}
+inline const std::string& HttpRequest::_internal_method() const {
+  return _impl_.method_.Get();
+}
+inline void HttpRequest::_internal_set_method(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.method_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HttpRequest::_internal_mutable_method() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.method_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HttpRequest::release_method() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.HttpRequest.method)
+  if (!_internal_has_method()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.method_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_.IsDefault()) {
+    _impl_.method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HttpRequest::set_allocated_method(std::string* method) {
+  if (method != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.method_.SetAllocated(method, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.method_.IsDefault()) {
+    _impl_.method_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.HttpRequest.method)
+}
+
+// repeated .KismetExternalHttp.SubHttpVariableData variable_data = 4;
+inline int HttpRequest::_internal_variable_data_size() const {
+  return _impl_.variable_data_.size();
+}
+inline int HttpRequest::variable_data_size() const {
+  return _internal_variable_data_size();
+}
+inline void HttpRequest::clear_variable_data() {
+  _impl_.variable_data_.Clear();
+}
+inline ::KismetExternalHttp::SubHttpVariableData* HttpRequest::mutable_variable_data(int index) {
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpRequest.variable_data)
+  return _impl_.variable_data_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpVariableData >*
+HttpRequest::mutable_variable_data() {
+  // @@protoc_insertion_point(field_mutable_list:KismetExternalHttp.HttpRequest.variable_data)
+  return &_impl_.variable_data_;
+}
+inline const ::KismetExternalHttp::SubHttpVariableData& HttpRequest::_internal_variable_data(int index) const {
+  return _impl_.variable_data_.Get(index);
+}
+inline const ::KismetExternalHttp::SubHttpVariableData& HttpRequest::variable_data(int index) const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRequest.variable_data)
+  return _internal_variable_data(index);
+}
+inline ::KismetExternalHttp::SubHttpVariableData* HttpRequest::_internal_add_variable_data() {
+  return _impl_.variable_data_.Add();
+}
+inline ::KismetExternalHttp::SubHttpVariableData* HttpRequest::add_variable_data() {
+  ::KismetExternalHttp::SubHttpVariableData* _add = _internal_add_variable_data();
+  // @@protoc_insertion_point(field_add:KismetExternalHttp.HttpRequest.variable_data)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpVariableData >&
+HttpRequest::variable_data() const {
+  // @@protoc_insertion_point(field_list:KismetExternalHttp.HttpRequest.variable_data)
+  return _impl_.variable_data_;
+}
+
+// -------------------------------------------------------------------
+
+// HttpRequestCancel
+
+// required uint32 req_id = 1;
+inline bool HttpRequestCancel::_internal_has_req_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HttpRequestCancel::has_req_id() const {
+  return _internal_has_req_id();
+}
+inline void HttpRequestCancel::clear_req_id() {
+  _impl_.req_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t HttpRequestCancel::_internal_req_id() const {
+  return _impl_.req_id_;
+}
+inline uint32_t HttpRequestCancel::req_id() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpRequestCancel.req_id)
+  return _internal_req_id();
+}
+inline void HttpRequestCancel::_internal_set_req_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.req_id_ = value;
+}
+inline void HttpRequestCancel::set_req_id(uint32_t value) {
+  _internal_set_req_id(value);
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpRequestCancel.req_id)
+}
+
+// -------------------------------------------------------------------
+
+// SubHttpHeader
+
+// required string header = 1;
+inline bool SubHttpHeader::_internal_has_header() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool SubHttpHeader::has_header() const {
+  return _internal_has_header();
+}
+inline void SubHttpHeader::clear_header() {
+  _impl_.header_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& SubHttpHeader::header() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.SubHttpHeader.header)
+  return _internal_header();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubHttpHeader::set_header(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.header_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.SubHttpHeader.header)
+}
+inline std::string* SubHttpHeader::mutable_header() {
+  std::string* _s = _internal_mutable_header();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.SubHttpHeader.header)
+  return _s;
+}
+inline const std::string& SubHttpHeader::_internal_header() const {
+  return _impl_.header_.Get();
+}
+inline void SubHttpHeader::_internal_set_header(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.header_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubHttpHeader::_internal_mutable_header() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.header_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubHttpHeader::release_header() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.SubHttpHeader.header)
+  if (!_internal_has_header()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.header_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.header_.IsDefault()) {
+    _impl_.header_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubHttpHeader::set_allocated_header(std::string* header) {
+  if (header != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.header_.SetAllocated(header, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.header_.IsDefault()) {
+    _impl_.header_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.SubHttpHeader.header)
+}
+
+// required string content = 2;
+inline bool SubHttpHeader::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool SubHttpHeader::has_content() const {
+  return _internal_has_content();
+}
+inline void SubHttpHeader::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& SubHttpHeader::content() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.SubHttpHeader.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SubHttpHeader::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.SubHttpHeader.content)
+}
+inline std::string* SubHttpHeader::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.SubHttpHeader.content)
+  return _s;
+}
+inline const std::string& SubHttpHeader::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void SubHttpHeader::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SubHttpHeader::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SubHttpHeader::release_content() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.SubHttpHeader.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void SubHttpHeader::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000002u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.SubHttpHeader.content)
+}
+
+// -------------------------------------------------------------------
+
+// HttpResponse
+
+// required uint32 req_id = 1;
+inline bool HttpResponse::_internal_has_req_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool HttpResponse::has_req_id() const {
+  return _internal_has_req_id();
+}
+inline void HttpResponse::clear_req_id() {
+  _impl_.req_id_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t HttpResponse::_internal_req_id() const {
+  return _impl_.req_id_;
+}
+inline uint32_t HttpResponse::req_id() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpResponse.req_id)
+  return _internal_req_id();
+}
+inline void HttpResponse::_internal_set_req_id(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.req_id_ = value;
+}
+inline void HttpResponse::set_req_id(uint32_t value) {
+  _internal_set_req_id(value);
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpResponse.req_id)
+}
+
+// repeated .KismetExternalHttp.SubHttpHeader header_content = 2;
+inline int HttpResponse::_internal_header_content_size() const {
+  return _impl_.header_content_.size();
+}
+inline int HttpResponse::header_content_size() const {
+  return _internal_header_content_size();
+}
+inline void HttpResponse::clear_header_content() {
+  _impl_.header_content_.Clear();
+}
+inline ::KismetExternalHttp::SubHttpHeader* HttpResponse::mutable_header_content(int index) {
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpResponse.header_content)
+  return _impl_.header_content_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpHeader >*
+HttpResponse::mutable_header_content() {
+  // @@protoc_insertion_point(field_mutable_list:KismetExternalHttp.HttpResponse.header_content)
+  return &_impl_.header_content_;
+}
+inline const ::KismetExternalHttp::SubHttpHeader& HttpResponse::_internal_header_content(int index) const {
+  return _impl_.header_content_.Get(index);
+}
+inline const ::KismetExternalHttp::SubHttpHeader& HttpResponse::header_content(int index) const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpResponse.header_content)
+  return _internal_header_content(index);
+}
+inline ::KismetExternalHttp::SubHttpHeader* HttpResponse::_internal_add_header_content() {
+  return _impl_.header_content_.Add();
+}
+inline ::KismetExternalHttp::SubHttpHeader* HttpResponse::add_header_content() {
+  ::KismetExternalHttp::SubHttpHeader* _add = _internal_add_header_content();
+  // @@protoc_insertion_point(field_add:KismetExternalHttp.HttpResponse.header_content)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::KismetExternalHttp::SubHttpHeader >&
+HttpResponse::header_content() const {
+  // @@protoc_insertion_point(field_list:KismetExternalHttp.HttpResponse.header_content)
+  return _impl_.header_content_;
+}
+
+// optional bytes content = 3;
+inline bool HttpResponse::_internal_has_content() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool HttpResponse::has_content() const {
+  return _internal_has_content();
+}
+inline void HttpResponse::clear_content() {
+  _impl_.content_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& HttpResponse::content() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpResponse.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void HttpResponse::set_content(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.content_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpResponse.content)
+}
+inline std::string* HttpResponse::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:KismetExternalHttp.HttpResponse.content)
+  return _s;
+}
+inline const std::string& HttpResponse::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void HttpResponse::_internal_set_content(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* HttpResponse::_internal_mutable_content() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* HttpResponse::release_content() {
+  // @@protoc_insertion_point(field_release:KismetExternalHttp.HttpResponse.content)
+  if (!_internal_has_content()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.content_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void HttpResponse::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:KismetExternalHttp.HttpResponse.content)
+}
+
+// optional uint32 resultcode = 4;
+inline bool HttpResponse::_internal_has_resultcode() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool HttpResponse::has_resultcode() const {
+  return _internal_has_resultcode();
+}
+inline void HttpResponse::clear_resultcode() {
+  _impl_.resultcode_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t HttpResponse::_internal_resultcode() const {
+  return _impl_.resultcode_;
+}
+inline uint32_t HttpResponse::resultcode() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpResponse.resultcode)
+  return _internal_resultcode();
+}
+inline void HttpResponse::_internal_set_resultcode(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.resultcode_ = value;
+}
+inline void HttpResponse::set_resultcode(uint32_t value) {
+  _internal_set_resultcode(value);
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpResponse.resultcode)
+}
+
+// optional bool close_response = 5;
+inline bool HttpResponse::_internal_has_close_response() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool HttpResponse::has_close_response() const {
+  return _internal_has_close_response();
+}
+inline void HttpResponse::clear_close_response() {
+  _impl_.close_response_ = false;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline bool HttpResponse::_internal_close_response() const {
+  return _impl_.close_response_;
+}
+inline bool HttpResponse::close_response() const {
+  // @@protoc_insertion_point(field_get:KismetExternalHttp.HttpResponse.close_response)
+  return _internal_close_response();
+}
+inline void HttpResponse::_internal_set_close_response(bool value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.close_response_ = value;
+}
+inline void HttpResponse::set_close_response(bool value) {
+  _internal_set_close_response(value);
+  // @@protoc_insertion_point(field_set:KismetExternalHttp.HttpResponse.close_response)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace KismetExternalHttp
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_http_2eproto
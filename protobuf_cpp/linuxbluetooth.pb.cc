@@ -0,0 +1,970 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: linuxbluetooth.proto
+
+#include "linuxbluetooth.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace KismetLinuxBluetooth {
+PROTOBUF_CONSTEXPR SubLinuxBluetoothDevice::SubLinuxBluetoothDevice(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.uuid_list_)*/{}
+  , /*decltype(_impl_.address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.time_sec_)*/uint64_t{0u}
+  , /*decltype(_impl_.time_usec_)*/uint64_t{0u}
+  , /*decltype(_impl_.txpower_)*/0
+  , /*decltype(_impl_.type_)*/0} {}
+struct SubLinuxBluetoothDeviceDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SubLinuxBluetoothDeviceDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SubLinuxBluetoothDeviceDefaultTypeInternal() {}
+  union {
+    SubLinuxBluetoothDevice _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SubLinuxBluetoothDeviceDefaultTypeInternal _SubLinuxBluetoothDevice_default_instance_;
+PROTOBUF_CONSTEXPR LinuxBluetoothDataReport::LinuxBluetoothDataReport(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.warning_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.gps_)*/nullptr
+  , /*decltype(_impl_.message_)*/nullptr
+  , /*decltype(_impl_.signal_)*/nullptr
+  , /*decltype(_impl_.btdevice_)*/nullptr} {}
+struct LinuxBluetoothDataReportDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LinuxBluetoothDataReportDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LinuxBluetoothDataReportDefaultTypeInternal() {}
+  union {
+    LinuxBluetoothDataReport _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LinuxBluetoothDataReportDefaultTypeInternal _LinuxBluetoothDataReport_default_instance_;
+}  // namespace KismetLinuxBluetooth
+namespace KismetLinuxBluetooth {
+
+// ===================================================================
+
+class SubLinuxBluetoothDevice::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SubLinuxBluetoothDevice>()._impl_._has_bits_);
+  static void set_has_time_sec(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_time_usec(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_address(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_txpower(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000003f) ^ 0x0000003f) != 0;
+  }
+};
+
+SubLinuxBluetoothDevice::SubLinuxBluetoothDevice(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+}
+SubLinuxBluetoothDevice::SubLinuxBluetoothDevice(const SubLinuxBluetoothDevice& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  SubLinuxBluetoothDevice* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uuid_list_){from._impl_.uuid_list_}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.time_sec_){}
+    , decltype(_impl_.time_usec_){}
+    , decltype(_impl_.txpower_){}
+    , decltype(_impl_.type_){}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_address()) {
+    _this->_impl_.address_.Set(from._internal_address(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.time_sec_, &from._impl_.time_sec_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+}
+
+inline void SubLinuxBluetoothDevice::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.uuid_list_){arena}
+    , decltype(_impl_.address_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.time_sec_){uint64_t{0u}}
+    , decltype(_impl_.time_usec_){uint64_t{0u}}
+    , decltype(_impl_.txpower_){0}
+    , decltype(_impl_.type_){0}
+  };
+  _impl_.address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SubLinuxBluetoothDevice::~SubLinuxBluetoothDevice() {
+  // @@protoc_insertion_point(destructor:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SubLinuxBluetoothDevice::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.uuid_list_.~RepeatedPtrField();
+  _impl_.address_.Destroy();
+  _impl_.name_.Destroy();
+}
+
+void SubLinuxBluetoothDevice::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SubLinuxBluetoothDevice::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.uuid_list_.Clear();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.address_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.name_.ClearNonDefaultToEmpty();
+    }
+  }
+  if (cached_has_bits & 0x0000003cu) {
+    ::memset(&_impl_.time_sec_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.type_) -
+        reinterpret_cast<char*>(&_impl_.time_sec_)) + sizeof(_impl_.type_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* SubLinuxBluetoothDevice::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 time_sec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_time_sec(&has_bits);
+          _impl_.time_sec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 time_usec = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_time_usec(&has_bits);
+          _impl_.time_usec_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string address = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 txpower = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_txpower(&has_bits);
+          _impl_.txpower_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required int32 type = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_type(&has_bits);
+          _impl_.type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string uuid_list = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_uuid_list();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<58>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SubLinuxBluetoothDevice::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // required uint64 time_sec = 1;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_time_sec(), target);
+  }
+
+  // required uint64 time_usec = 2;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_time_usec(), target);
+  }
+
+  // required string address = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_address(), target);
+  }
+
+  // required string name = 4;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_name(), target);
+  }
+
+  // required int32 txpower = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(5, this->_internal_txpower(), target);
+  }
+
+  // required int32 type = 6;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(6, this->_internal_type(), target);
+  }
+
+  // repeated string uuid_list = 7;
+  for (int i = 0, n = this->_internal_uuid_list_size(); i < n; i++) {
+    const auto& s = this->_internal_uuid_list(i);
+    target = stream->WriteString(7, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  return target;
+}
+
+size_t SubLinuxBluetoothDevice::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  size_t total_size = 0;
+
+  if (_internal_has_address()) {
+    // required string address = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_address());
+  }
+
+  if (_internal_has_name()) {
+    // required string name = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (_internal_has_time_sec()) {
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+  }
+
+  if (_internal_has_time_usec()) {
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+  }
+
+  if (_internal_has_txpower()) {
+    // required int32 txpower = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_txpower());
+  }
+
+  if (_internal_has_type()) {
+    // required int32 type = 6;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+  }
+
+  return total_size;
+}
+size_t SubLinuxBluetoothDevice::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  size_t total_size = 0;
+
+  if (((_impl_._has_bits_[0] & 0x0000003f) ^ 0x0000003f) == 0) {  // All required fields are present.
+    // required string address = 3;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_address());
+
+    // required string name = 4;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required uint64 time_sec = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_sec());
+
+    // required uint64 time_usec = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_usec());
+
+    // required int32 txpower = 5;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_txpower());
+
+    // required int32 type = 6;
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_type());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string uuid_list = 7;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.uuid_list_.size());
+  for (int i = 0, n = _impl_.uuid_list_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.uuid_list_.Get(i));
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SubLinuxBluetoothDevice::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const SubLinuxBluetoothDevice*>(
+      &from));
+}
+
+void SubLinuxBluetoothDevice::MergeFrom(const SubLinuxBluetoothDevice& from) {
+  SubLinuxBluetoothDevice* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.uuid_list_.MergeFrom(from._impl_.uuid_list_);
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000003fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_address(from._internal_address());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.time_sec_ = from._impl_.time_sec_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.time_usec_ = from._impl_.time_usec_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_impl_.txpower_ = from._impl_.txpower_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _this->_impl_.type_ = from._impl_.type_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void SubLinuxBluetoothDevice::CopyFrom(const SubLinuxBluetoothDevice& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetLinuxBluetooth.SubLinuxBluetoothDevice)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SubLinuxBluetoothDevice::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  return true;
+}
+
+void SubLinuxBluetoothDevice::InternalSwap(SubLinuxBluetoothDevice* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.uuid_list_.InternalSwap(&other->_impl_.uuid_list_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.address_, lhs_arena,
+      &other->_impl_.address_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SubLinuxBluetoothDevice, _impl_.type_)
+      + sizeof(SubLinuxBluetoothDevice::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(SubLinuxBluetoothDevice, _impl_.time_sec_)>(
+          reinterpret_cast<char*>(&_impl_.time_sec_),
+          reinterpret_cast<char*>(&other->_impl_.time_sec_));
+}
+
+std::string SubLinuxBluetoothDevice::GetTypeName() const {
+  return "KismetLinuxBluetooth.SubLinuxBluetoothDevice";
+}
+
+
+// ===================================================================
+
+class LinuxBluetoothDataReport::_Internal {
+ public:
+  using HasBits = decltype(std::declval<LinuxBluetoothDataReport>()._impl_._has_bits_);
+  static const ::KismetDatasource::SubGps& gps(const LinuxBluetoothDataReport* msg);
+  static void set_has_gps(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static const ::KismetExternal::MsgbusMessage& message(const LinuxBluetoothDataReport* msg);
+  static void set_has_message(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_warning(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static const ::KismetDatasource::SubSignal& signal(const LinuxBluetoothDataReport* msg);
+  static void set_has_signal(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::KismetLinuxBluetooth::SubLinuxBluetoothDevice& btdevice(const LinuxBluetoothDataReport* msg);
+  static void set_has_btdevice(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000010) ^ 0x00000010) != 0;
+  }
+};
+
+const ::KismetDatasource::SubGps&
+LinuxBluetoothDataReport::_Internal::gps(const LinuxBluetoothDataReport* msg) {
+  return *msg->_impl_.gps_;
+}
+const ::KismetExternal::MsgbusMessage&
+LinuxBluetoothDataReport::_Internal::message(const LinuxBluetoothDataReport* msg) {
+  return *msg->_impl_.message_;
+}
+const ::KismetDatasource::SubSignal&
+LinuxBluetoothDataReport::_Internal::signal(const LinuxBluetoothDataReport* msg) {
+  return *msg->_impl_.signal_;
+}
+const ::KismetLinuxBluetooth::SubLinuxBluetoothDevice&
+LinuxBluetoothDataReport::_Internal::btdevice(const LinuxBluetoothDataReport* msg) {
+  return *msg->_impl_.btdevice_;
+}
+void LinuxBluetoothDataReport::clear_gps() {
+  if (_impl_.gps_ != nullptr) _impl_.gps_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+void LinuxBluetoothDataReport::clear_message() {
+  if (_impl_.message_ != nullptr) _impl_.message_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+void LinuxBluetoothDataReport::clear_signal() {
+  if (_impl_.signal_ != nullptr) _impl_.signal_->Clear();
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+LinuxBluetoothDataReport::LinuxBluetoothDataReport(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+}
+LinuxBluetoothDataReport::LinuxBluetoothDataReport(const LinuxBluetoothDataReport& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  LinuxBluetoothDataReport* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.gps_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.signal_){nullptr}
+    , decltype(_impl_.btdevice_){nullptr}};
+
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_warning()) {
+    _this->_impl_.warning_.Set(from._internal_warning(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_gps()) {
+    _this->_impl_.gps_ = new ::KismetDatasource::SubGps(*from._impl_.gps_);
+  }
+  if (from._internal_has_message()) {
+    _this->_impl_.message_ = new ::KismetExternal::MsgbusMessage(*from._impl_.message_);
+  }
+  if (from._internal_has_signal()) {
+    _this->_impl_.signal_ = new ::KismetDatasource::SubSignal(*from._impl_.signal_);
+  }
+  if (from._internal_has_btdevice()) {
+    _this->_impl_.btdevice_ = new ::KismetLinuxBluetooth::SubLinuxBluetoothDevice(*from._impl_.btdevice_);
+  }
+  // @@protoc_insertion_point(copy_constructor:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+}
+
+inline void LinuxBluetoothDataReport::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.warning_){}
+    , decltype(_impl_.gps_){nullptr}
+    , decltype(_impl_.message_){nullptr}
+    , decltype(_impl_.signal_){nullptr}
+    , decltype(_impl_.btdevice_){nullptr}
+  };
+  _impl_.warning_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.warning_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+LinuxBluetoothDataReport::~LinuxBluetoothDataReport() {
+  // @@protoc_insertion_point(destructor:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LinuxBluetoothDataReport::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.warning_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.gps_;
+  if (this != internal_default_instance()) delete _impl_.message_;
+  if (this != internal_default_instance()) delete _impl_.signal_;
+  if (this != internal_default_instance()) delete _impl_.btdevice_;
+}
+
+void LinuxBluetoothDataReport::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LinuxBluetoothDataReport::Clear() {
+// @@protoc_insertion_point(message_clear_start:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.warning_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(_impl_.gps_ != nullptr);
+      _impl_.gps_->Clear();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      GOOGLE_DCHECK(_impl_.message_ != nullptr);
+      _impl_.message_->Clear();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      GOOGLE_DCHECK(_impl_.signal_ != nullptr);
+      _impl_.signal_->Clear();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      GOOGLE_DCHECK(_impl_.btdevice_ != nullptr);
+      _impl_.btdevice_->Clear();
+    }
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* LinuxBluetoothDataReport::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional .KismetDatasource.SubGps gps = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_gps(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetExternal.MsgbusMessage message = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string warning = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_warning();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .KismetDatasource.SubSignal signal = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_signal(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .KismetLinuxBluetooth.SubLinuxBluetoothDevice btdevice = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_btdevice(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LinuxBluetoothDataReport::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  // optional .KismetDatasource.SubGps gps = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gps(this),
+        _Internal::gps(this).GetCachedSize(), target, stream);
+  }
+
+  // optional .KismetExternal.MsgbusMessage message = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::message(this),
+        _Internal::message(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string warning = 3;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_warning(), target);
+  }
+
+  // optional .KismetDatasource.SubSignal signal = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::signal(this),
+        _Internal::signal(this).GetCachedSize(), target, stream);
+  }
+
+  // required .KismetLinuxBluetooth.SubLinuxBluetoothDevice btdevice = 5;
+  if (cached_has_bits & 0x00000010u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::btdevice(this),
+        _Internal::btdevice(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+  return target;
+}
+
+size_t LinuxBluetoothDataReport::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+  size_t total_size = 0;
+
+  // required .KismetLinuxBluetooth.SubLinuxBluetoothDevice btdevice = 5;
+  if (_internal_has_btdevice()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.btdevice_);
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    // optional string warning = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_warning());
+    }
+
+    // optional .KismetDatasource.SubGps gps = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.gps_);
+    }
+
+    // optional .KismetExternal.MsgbusMessage message = 2;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.message_);
+    }
+
+    // optional .KismetDatasource.SubSignal signal = 4;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.signal_);
+    }
+
+  }
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void LinuxBluetoothDataReport::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const LinuxBluetoothDataReport*>(
+      &from));
+}
+
+void LinuxBluetoothDataReport::MergeFrom(const LinuxBluetoothDataReport& from) {
+  LinuxBluetoothDataReport* const _this = this;
+  // @@protoc_insertion_point(class_specific_merge_from_start:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x0000001fu) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_warning(from._internal_warning());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_mutable_gps()->::KismetDatasource::SubGps::MergeFrom(
+          from._internal_gps());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_internal_mutable_message()->::KismetExternal::MsgbusMessage::MergeFrom(
+          from._internal_message());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_internal_mutable_signal()->::KismetDatasource::SubSignal::MergeFrom(
+          from._internal_signal());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _this->_internal_mutable_btdevice()->::KismetLinuxBluetooth::SubLinuxBluetoothDevice::MergeFrom(
+          from._internal_btdevice());
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void LinuxBluetoothDataReport::CopyFrom(const LinuxBluetoothDataReport& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:KismetLinuxBluetooth.LinuxBluetoothDataReport)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LinuxBluetoothDataReport::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_impl_._has_bits_)) return false;
+  if (_internal_has_gps()) {
+    if (!_impl_.gps_->IsInitialized()) return false;
+  }
+  if (_internal_has_message()) {
+    if (!_impl_.message_->IsInitialized()) return false;
+  }
+  if (_internal_has_btdevice()) {
+    if (!_impl_.btdevice_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void LinuxBluetoothDataReport::InternalSwap(LinuxBluetoothDataReport* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.warning_, lhs_arena,
+      &other->_impl_.warning_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(LinuxBluetoothDataReport, _impl_.btdevice_)
+      + sizeof(LinuxBluetoothDataReport::_impl_.btdevice_)
+      - PROTOBUF_FIELD_OFFSET(LinuxBluetoothDataReport, _impl_.gps_)>(
+          reinterpret_cast<char*>(&_impl_.gps_),
+          reinterpret_cast<char*>(&other->_impl_.gps_));
+}
+
+std::string LinuxBluetoothDataReport::GetTypeName() const {
+  return "KismetLinuxBluetooth.LinuxBluetoothDataReport";
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace KismetLinuxBluetooth
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::KismetLinuxBluetooth::SubLinuxBluetoothDevice*
+Arena::CreateMaybeMessage< ::KismetLinuxBluetooth::SubLinuxBluetoothDevice >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetLinuxBluetooth::SubLinuxBluetoothDevice >(arena);
+}
+template<> PROTOBUF_NOINLINE ::KismetLinuxBluetooth::LinuxBluetoothDataReport*
+Arena::CreateMaybeMessage< ::KismetLinuxBluetooth::LinuxBluetoothDataReport >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::KismetLinuxBluetooth::LinuxBluetoothDataReport >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
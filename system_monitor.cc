@@ -138,6 +138,91 @@ Systemmonitor::Systemmonitor() :
             }, monitor_mutex);
     httpd->register_route("/system/timestamp", {"GET", "POST"}, httpd->RO_ROLE, {}, timestamp_endp);
 
+    httpd->register_route("/system/memory", {"GET", "POST"}, httpd->RO_ROLE, {},
+            std::make_shared<kis_net_web_tracked_endpoint>(
+                [](std::shared_ptr<kis_net_beast_httpd_connection>) -> std::shared_ptr<tracker_element> {
+                    auto ret = std::make_shared<tracker_element_string_map>();
+
+                    auto elements = std::make_shared<tracker_element_vector>();
+                    ret->insert(std::make_pair("kismet.system.memory.elements", elements));
+
+                    for (unsigned int t = 0; t < tracker_element_accounting::num_types; t++) {
+                        auto tt = static_cast<tracker_type>(t);
+                        auto count = tracker_element_accounting::get_count(tt);
+
+                        if (count == 0)
+                            continue;
+
+                        auto emap = std::make_shared<tracker_element_string_map>();
+                        emap->insert(std::make_pair("kismet.system.memory.type",
+                                    std::make_shared<tracker_element_string>(0, 
+                                        tracker_element::type_to_string(tt))));
+                        emap->insert(std::make_pair("kismet.system.memory.count",
+                                    std::make_shared<tracker_element_int64>(0, count)));
+                        emap->insert(std::make_pair("kismet.system.memory.bytes",
+                                    std::make_shared<tracker_element_int64>(0, 
+                                        tracker_element_accounting::get_bytes(tt))));
+                        elements->push_back(emap);
+                    }
+
+                    auto components = std::make_shared<tracker_element_vector>();
+                    ret->insert(std::make_pair("kismet.system.memory.components", components));
+
+                    tracker_component::for_each_schema([&components](const std::string& name,
+                                int64_t count, size_t fields) {
+                        if (count == 0)
+                            return;
+
+                        auto cmap = std::make_shared<tracker_element_string_map>();
+                        cmap->insert(std::make_pair("kismet.system.memory.type",
+                                    std::make_shared<tracker_element_string>(0, name)));
+                        cmap->insert(std::make_pair("kismet.system.memory.count",
+                                    std::make_shared<tracker_element_int64>(0, count)));
+                        cmap->insert(std::make_pair("kismet.system.memory.fields",
+                                    std::make_shared<tracker_element_uint64>(0, fields)));
+                        components->push_back(cmap);
+                    });
+
+                    ret->insert(std::make_pair("kismet.system.memory.num_fields",
+                                std::make_shared<tracker_element_int64>(0, 
+                                    tracker_element_accounting::get_total_count())));
+                    ret->insert(std::make_pair("kismet.system.memory.num_components",
+                                std::make_shared<tracker_element_int64>(0, 
+                                    tracker_component::get_total_count())));
+
+                    return ret;
+                }));
+
+#ifdef KIS_MUTEX_STATS
+    httpd->register_route("/system/mutex_stats", {"GET", "POST"}, httpd->RO_ROLE, {},
+            std::make_shared<kis_net_web_tracked_endpoint>(
+                [](std::shared_ptr<kis_net_beast_httpd_connection>) -> std::shared_ptr<tracker_element> {
+                    auto ret = std::make_shared<tracker_element_vector>();
+
+                    // Debug-only endpoint, so don't bother registering tracked fields
+                    kis_mutex_stats::for_each([&ret](const kis_mutex_op_stats& s) {
+                        auto smap = std::make_shared<tracker_element_string_map>();
+                        smap->insert(std::make_pair("kismet.mutex.op",
+                                    std::make_shared<tracker_element_string>(0, s.op)));
+                        smap->insert(std::make_pair("kismet.mutex.name",
+                                    std::make_shared<tracker_element_string>(0, s.mutex_name)));
+                        smap->insert(std::make_pair("kismet.mutex.count",
+                                    std::make_shared<tracker_element_uint64>(0, s.count.load())));
+                        smap->insert(std::make_pair("kismet.mutex.contended",
+                                    std::make_shared<tracker_element_uint64>(0, s.contended.load())));
+                        smap->insert(std::make_pair("kismet.mutex.wait_ns",
+                                    std::make_shared<tracker_element_uint64>(0, s.wait_ns.load())));
+                        smap->insert(std::make_pair("kismet.mutex.hold_ns",
+                                    std::make_shared<tracker_element_uint64>(0, s.hold_ns.load())));
+                        smap->insert(std::make_pair("kismet.mutex.max_hold_ns",
+                                    std::make_shared<tracker_element_uint64>(0, s.max_hold_ns.load())));
+                        ret->push_back(smap);
+                    });
+
+                    return ret;
+                }));
+#endif
+
     if (Globalreg::globalreg->kismet_config->fetch_opt_bool("kis_log_system_status", true)) {
         auto snap_time_s = 
             Globalreg::globalreg->kismet_config->fetch_opt_as<unsigned int>("kis_log_system_status_rate", 30);
@@ -283,6 +368,12 @@ void tracked_system_status::register_fields() {
     register_field("kismet.system.num_fields", "number of allocated tracked element fields", &num_fields);
     register_field("kismet.system.num_components", "number of allocated tracked element components", &num_components);
     register_field("kismet.system.num_http_connections", "number of concurrent http connections", &num_http_connections);
+    register_field("kismet.system.http.active_requests", "number of http requests being handled", &http_active_requests);
+    register_field("kismet.system.http.queued_requests", "number of http requests waiting for a worker", &http_queued_requests);
+    register_field("kismet.system.http.idle_connections", "number of idle http connections awaiting a request", &http_idle_connections);
+    register_field("kismet.system.http.workers", "number of http worker threads", &http_workers);
+    register_field("kismet.system.http.streaming_requests", "number of websockets and streams running outside the http workers", &http_streaming_requests);
+    register_field("kismet.system.http.rejected_requests", "number of http requests refused because the server was busy", &http_rejected_requests);
 }
 
 int Systemmonitor::timetracker_event(int eventid) {
@@ -437,8 +528,18 @@ void tracked_system_status::pre_serialize() {
     set_timestamp_sec(now.tv_sec);
     set_timestamp_usec(now.tv_usec);
 
-    set_num_fields(Globalreg::n_tracked_fields);
-    set_num_components(Globalreg::n_tracked_components);
+    set_num_fields(tracker_element_accounting::get_total_count());
+    set_num_components(tracker_component::get_total_count());
     set_num_http_connections(Globalreg::n_tracked_http_connections);
+
+    auto httpd = Globalreg::fetch_global_as<kis_net_beast_httpd>();
+    if (httpd != nullptr) {
+        set_http_active_requests(httpd->fetch_active_requests());
+        set_http_queued_requests(httpd->fetch_queued_requests());
+        set_http_idle_connections(httpd->fetch_idle_connections());
+        set_http_workers(httpd->fetch_request_workers());
+        set_http_streaming_requests(httpd->fetch_streaming_requests());
+        set_http_rejected_requests(httpd->fetch_rejected_requests());
+    }
 } 
 
@@ -93,6 +93,12 @@ public:
     __Proxy(num_fields, uint64_t, uint64_t, uint64_t, num_fields);
     __Proxy(num_components, uint64_t, uint64_t, uint64_t, num_components);
     __Proxy(num_http_connections, uint64_t, uint64_t, uint64_t, num_http_connections);
+    __Proxy(http_active_requests, uint64_t, uint64_t, uint64_t, http_active_requests);
+    __Proxy(http_queued_requests, uint64_t, uint64_t, uint64_t, http_queued_requests);
+    __Proxy(http_idle_connections, uint64_t, uint64_t, uint64_t, http_idle_connections);
+    __Proxy(http_workers, uint64_t, uint64_t, uint64_t, http_workers);
+    __Proxy(http_streaming_requests, uint64_t, uint64_t, uint64_t, http_streaming_requests);
+    __Proxy(http_rejected_requests, uint64_t, uint64_t, uint64_t, http_rejected_requests);
 
     virtual void pre_serialize() override;
 
@@ -129,6 +135,12 @@ protected:
     std::shared_ptr<tracker_element_uint64> num_fields;
     std::shared_ptr<tracker_element_uint64> num_components;
     std::shared_ptr<tracker_element_uint64> num_http_connections;
+    std::shared_ptr<tracker_element_uint64> http_active_requests;
+    std::shared_ptr<tracker_element_uint64> http_queued_requests;
+    std::shared_ptr<tracker_element_uint64> http_idle_connections;
+    std::shared_ptr<tracker_element_uint64> http_workers;
+    std::shared_ptr<tracker_element_uint64> http_streaming_requests;
+    std::shared_ptr<tracker_element_uint64> http_rejected_requests;
 };
 
 class Systemmonitor : public lifetime_global, public time_tracker_event {
@@ -18,6 +18,8 @@
 
 #include "config.h"
 
+#include <cxxabi.h>
+
 #include "trackedcomponent.h"
 
 std::string tracker_component::get_name() {
@@ -28,36 +30,200 @@ std::string tracker_component::get_name(int in_id) {
     return Globalreg::globalreg->entrytracker->get_field_name(in_id);
 }
 
-int tracker_component::register_field(const std::string& in_name, 
-        std::unique_ptr<tracker_element> in_builder,
-        const std::string& in_desc, shared_tracker_element *in_dest) {
+const tracker_component::field_schema *tracker_component::fetch_field_schema(const std::type_info& in_type) {
+    // Most components are built in runs of the same type, so remember the last one
+    // this thread looked up before taking the schema lock
+    thread_local const std::type_info *cached_type = nullptr;
+    thread_local const field_schema *cached_schema = nullptr;
 
-    int id = 
-        Globalreg::globalreg->entrytracker->register_field(in_name, std::move(in_builder), in_desc);
+    if (cached_type != nullptr && *cached_type == in_type)
+        return cached_schema;
+
+    kis_lock_guard<kis_shared_mutex> lk(schema_mutex, kismet::shared_lock, "fetch_field_schema");
+
+    auto k = schema_map.find(std::type_index(in_type));
+
+    if (k == schema_map.end())
+        return nullptr;
+
+    cached_type = k->second->type;
+    cached_schema = k->second.get();
+
+    return cached_schema;
+}
+
+void tracker_component::publish_field_schema(std::unique_ptr<field_schema> in_schema) {
+    int status;
+    auto demangled = abi::__cxa_demangle(in_schema->type->name(), nullptr, nullptr, &status);
+
+    if (demangled != nullptr) {
+        in_schema->type_name = demangled;
+        free(demangled);
+    } else {
+        in_schema->type_name = in_schema->type->name();
+    }
+
+    kis_lock_guard<kis_shared_mutex> lk(schema_mutex, "publish_field_schema");
+
+    if (schema_map.find(std::type_index(*in_schema->type)) != schema_map.end())
+        return;
+
+    if (schema_map.size() + 1 < max_accounted_schemas)
+        in_schema->index = schema_map.size() + 1;
+    else
+        in_schema->index = 0;
+
+    // The first instance to finish wins; a schema is never replaced once another 
+    // instance could be replaying it
+    schema_map.emplace(std::type_index(*in_schema->type), std::move(in_schema));
+}
+
+int64_t tracker_component::get_component_count(unsigned int slot) {
+    int64_t r = 0;
 
-    if (in_dest != NULL) {
-        if (registered_fields == nullptr)
-            registered_fields = new std::vector<std::unique_ptr<registered_field>>();
+    for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+        r += component_shards[i].count[slot].load(std::memory_order_relaxed);
 
-        auto rf = std::unique_ptr<registered_field>(new registered_field(id, in_dest));
-        registered_fields->push_back(std::move(rf));
+    return r;
+}
+
+void tracker_component::for_each_schema(const std::function<void (const std::string&, int64_t, size_t)>& fn) {
+    kis_lock_guard<kis_shared_mutex> lk(schema_mutex, kismet::shared_lock, "for_each_schema");
+
+    for (const auto& s : schema_map) {
+        if (s.second->index == 0)
+            continue;
+
+        fn(s.second->type_name, get_component_count(s.second->index), s.second->fields.size());
+    }
+}
+
+int tracker_component::replay_field(std::string_view in_name, shared_tracker_element *in_dest,
+        bool in_dynamic) {
+
+    // Start of a registration pass; look for a schema for this type
+    if (reg_schema == nullptr && registered_fields == nullptr) {
+        reg_schema = fetch_field_schema(typeid(*this));
+        reg_schema_pos = 0;
     }
 
+    if (reg_schema == nullptr)
+        return -1;
+
+    auto offset = in_dest == nullptr ? -1 : 
+        reinterpret_cast<char *>(in_dest) - reinterpret_cast<char *>(this);
+
+    if (reg_schema_pos < reg_schema->fields.size()) {
+        const auto& f = reg_schema->fields[reg_schema_pos];
+
+        if (f.offset == offset && f.dynamic == in_dynamic && f.name == in_name) {
+            reg_schema_pos++;
+            return f.id;
+        }
+    }
+
+    // This instance registers a different set of fields than the type schema; convert 
+    // what we've matched so far into normal registration records and register the rest
+    // via the entrytracker
+    registered_fields = new std::vector<std::unique_ptr<registered_field>>();
+
+    for (unsigned int i = 0; i < reg_schema_pos; i++) {
+        const auto& f = reg_schema->fields[i];
+        auto assign = f.offset < 0 ? nullptr : 
+            reinterpret_cast<shared_tracker_element *>(reinterpret_cast<char *>(this) + f.offset);
+        registered_fields->push_back(std::make_unique<registered_field>(f.name, f.id, 
+                    assign, f.dynamic));
+    }
+
+    reg_schema = nullptr;
+    reg_schema_pos = 0;
+
+    return -1;
+}
+
+void tracker_component::record_field(std::string_view in_name, int in_id, 
+        shared_tracker_element *in_dest, bool in_dynamic) {
+    if (registered_fields == nullptr)
+        registered_fields = new std::vector<std::unique_ptr<registered_field>>();
+
+    registered_fields->push_back(std::make_unique<registered_field>(in_name, in_id, 
+                in_dest, in_dynamic));
+}
+
+int tracker_component::register_field(std::string_view in_name, 
+        std::unique_ptr<tracker_element> in_builder,
+        std::string_view in_desc, shared_tracker_element *in_dest) {
+
+    auto id = replay_field(in_name, in_dest, false);
+
+    if (id >= 0)
+        return id;
+
+    return register_field_direct(in_name, std::move(in_builder), in_desc, in_dest);
+}
+
+int tracker_component::register_field_direct(std::string_view in_name, 
+        std::unique_ptr<tracker_element> in_builder,
+        std::string_view in_desc, shared_tracker_element *in_dest) {
+
+    int id = 
+        Globalreg::globalreg->entrytracker->register_field(std::string(in_name), 
+                std::move(in_builder), std::string(in_desc));
+
+    record_field(in_name, id, in_dest, false);
+
     return id;
 }
 
+void tracker_component::account_as(const field_schema *schema) {
+    if (schema == acct_schema)
+        return;
+
+    account_schema(acct_schema, -1);
+    account_schema(schema, 1);
+    acct_schema = schema;
+}
+
 void tracker_component::reserve_fields(std::shared_ptr<tracker_element_map> e) {
+    if (reg_schema != nullptr) {
+        // Size the field table once, instead of growing it field by field
+        map.reserve(map.size() + reg_schema_pos);
+
+        for (unsigned int i = 0; i < reg_schema_pos; i++) {
+            const auto& f = reg_schema->fields[i];
+
+            if (f.offset < 0)
+                continue;
+
+            auto assign = 
+                reinterpret_cast<shared_tracker_element *>(reinterpret_cast<char *>(this) + f.offset);
+
+            if (f.dynamic) {
+                *assign = nullptr;
+                insert(f.id, std::shared_ptr<tracker_element>());
+            } else {
+                *assign = import_or_new(e, f.id, f.builder);
+            }
+        }
+
+        account_as(reg_schema);
+
+        reg_schema = nullptr;
+        reg_schema_pos = 0;
+
+        return;
+    }
+
     if (registered_fields == nullptr)
         return;
 
     for (auto& rf : *registered_fields) {
         if (rf->assign != nullptr) {
-            // We use negative IDs to indicate dynamic to eke out 4 more bytes
-            if (rf->id < 0) {
+            if (rf->dynamic) {
                 // If the variable is dynamic set the assignment container to null so that
                 // proxydynamictrackable can fill it in;
                 *(rf->assign) = nullptr;
-                insert(abs(rf->id), std::shared_ptr<tracker_element>());
+                insert(rf->id, std::shared_ptr<tracker_element>());
             } else {
                 // otherwise generate a variable for the destination
                 *(rf->assign) = import_or_new(e, rf->id);
@@ -65,12 +231,35 @@ void tracker_component::reserve_fields(std::shared_ptr<tracker_element_map> e) {
         }
     }
 
+    // Publish what this instance registered as the schema for its type, if there isn't
+    // one already, so that later instances can skip the entrytracker
+    if (fetch_field_schema(typeid(*this)) == nullptr) {
+        auto schema = std::make_unique<field_schema>();
+        schema->type = &typeid(*this);
+
+        for (auto& rf : *registered_fields) {
+            auto offset = rf->assign == nullptr ? -1 :
+                reinterpret_cast<char *>(rf->assign) - reinterpret_cast<char *>(this);
+            schema->fields.push_back(field_schema_entry{rf->name, rf->id, offset, rf->dynamic,
+                    Globalreg::globalreg->entrytracker->get_builder(rf->id)});
+        }
+
+        publish_field_schema(std::move(schema));
+    }
+
+    account_as(fetch_field_schema(typeid(*this)));
+
     // Remove all the registration records we've allocated
     delete registered_fields;
     registered_fields = nullptr;
 }
 
 shared_tracker_element tracker_component::import_or_new(std::shared_ptr<tracker_element_map> e, int i) {
+    return import_or_new(e, i, nullptr);
+}
+
+shared_tracker_element tracker_component::import_or_new(std::shared_ptr<tracker_element_map> e, int i,
+        tracker_element *builder) {
     shared_tracker_element r;
 
     // Find the value of any known fields in the importer element; only try
@@ -96,7 +285,10 @@ shared_tracker_element tracker_component::import_or_new(std::shared_ptr<tracker_
         return existing->second;
 
     // Build it
-    r = Globalreg::globalreg->entrytracker->get_shared_instance(i);
+    if (builder != nullptr)
+        r = builder->clone_shared();
+    else
+        r = Globalreg::globalreg->entrytracker->get_shared_instance(i);
 
     // Add it to our tracked map object
     insert(r);
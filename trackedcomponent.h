@@ -25,7 +25,11 @@
 #include <stdint.h>
 
 #include <string>
+#include <string_view>
 #include <stdexcept>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 
 #include <vector>
 #include <map>
@@ -55,6 +59,12 @@
 // use of the component.  By passing an existing trackermap object, a parsed tree
 // can be annealed into the c++ representation without copying/re-parsing the data.
 //
+// Every field is a standalone tracker_element held by shared_ptr, both in the map and
+// in the cached class variable; scalar fields are built in the same allocation as their
+// reference count, but there is no packed inline storage.  Fields which are only set
+// for some records should use the dynamic proxies, which don't build the element
+// until it is first set.
+//
 // Subclasses MUST override the signature, typically with a checksum of the class
 // name, so that the entry tracker can differentiate multiple tracker_map classes
 class tracker_component : public tracker_element_map {
@@ -696,63 +706,103 @@ class tracker_component : public tracker_element_map {
     f = b->f
 
     class registered_field {
-        // We use negative IDs to indicate dynamic assignment, since this exists for every field
-        // in every tracked element we actually do benefit from squeezing the boolean out
         public:
-            registered_field(int id, shared_tracker_element *assign) { 
-                this->assign = assign;
-
-                if (assign == nullptr) {
-                    this->id = id * -1; 
-                } else {
-                    this->id = id;
+            registered_field(std::string_view name, int id, shared_tracker_element *assign, 
+                    bool dynamic) :
+                name{name},
+                id{id},
+                assign{assign},
+                dynamic{dynamic} {
+                    if (assign == nullptr && dynamic)
+                        throw std::runtime_error("attempted to assign a dynamic field to "
+                                "a null destination");
                 }
-            }
-
-            registered_field(int id, shared_tracker_element *assign, bool dynamic) {
-                if (assign == nullptr && dynamic)
-                    throw std::runtime_error("attempted to assign a dynamic field to "
-                            "a null destination");
-
-                if (dynamic)
-                    this->id = id * -1;
-                else
-                    this->id = id;
-                this->assign = assign;
-            }
 
+            std::string name;
             int id;
             shared_tracker_element *assign;
+            bool dynamic;
+    };
+
+    // Per-type field schema.  The first instance of each component type to register 
+    // its fields records the sequence it registered; every later instance of that type
+    // replays it, so register_field only has to confirm that the name and destination
+    // match and hand back the cached id, without the entrytracker lookup and without
+    // building a per-instance list of registered fields.  Instances which register a
+    // different sequence fall back to registering through the entrytracker.
+    struct field_schema_entry {
+        std::string name;
+        int id;
+        // Offset of the destination from the component, or -1 if not assigned
+        ptrdiff_t offset;
+        bool dynamic;
+        // Entrytracker builder, cloned directly when the field is reserved
+        tracker_element *builder;
+    };
+
+    struct field_schema {
+        const std::type_info *type;
+        // Readable type name and accounting slot, see account_schema
+        std::string type_name;
+        unsigned int index;
+        std::vector<field_schema_entry> fields;
+    };
+
+    static const field_schema *fetch_field_schema(const std::type_info& in_type);
+    static void publish_field_schema(std::unique_ptr<field_schema> in_schema);
+
+    static inline kis_shared_mutex schema_mutex;
+    static inline std::unordered_map<std::type_index, std::unique_ptr<field_schema>> schema_map;
+
+    // Live components, counted per thread shard like the element accounting.  Slot 0
+    // counts every component; each published schema is given its own slot, and types
+    // past the end of the table are only counted in the total.
+    static constexpr unsigned int max_accounted_schemas = 256;
+
+    struct alignas(64) component_shard {
+        std::atomic<int64_t> count[max_accounted_schemas];
     };
 
+    static inline component_shard component_shards[KIS_COUNTER_SHARDS];
+
+    static void account_component(unsigned int slot, int64_t n) {
+        component_shards[kismet::counter_shard()].count[slot].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    static void account_schema(const field_schema *schema, int64_t n) {
+        if (schema != nullptr && schema->index != 0)
+            account_component(schema->index, n);
+    }
+
+    static int64_t get_component_count(unsigned int slot);
+
+    // Move this instance's accounting to a schema
+    void account_as(const field_schema *schema);
 
 public:
     tracker_component() :
-        tracker_element_map(0),
-        registered_fields{nullptr} {
-            Globalreg::n_tracked_components++;
+        tracker_element_map(0) {
+            account_component(0, 1);
         }
 
     tracker_component(int in_id) :
-        tracker_element_map(in_id),
-        registered_fields{nullptr} {
-            Globalreg::n_tracked_components++;
+        tracker_element_map(in_id) {
+            account_component(0, 1);
         }
 
     tracker_component(int in_id, std::shared_ptr<tracker_element_map> e __attribute__((unused))) :
-        tracker_element_map(in_id),
-        registered_fields{nullptr} {
-            Globalreg::n_tracked_components++;
+        tracker_element_map(in_id) {
+            account_component(0, 1);
         }
 
     tracker_component(const tracker_component *p) :
-        tracker_element_map(p),
-        registered_fields{nullptr} {
-            Globalreg::n_tracked_components++;
+        tracker_element_map(p) {
+            account_component(0, 1);
         }
 
 	virtual ~tracker_component() {
-        Globalreg::n_tracked_components--;
+        account_component(0, -1);
+        account_schema(acct_schema, -1);
 
         if (registered_fields != nullptr)
             delete registered_fields;
@@ -768,6 +818,15 @@ public:
     tracker_component(tracker_component&) = delete;
     tracker_component& operator=(tracker_component&) = delete;
 
+    // Live components of all types
+    static int64_t get_total_count() {
+        return get_component_count(0);
+    }
+
+    // Call a function for each component type which has registered fields, with the
+    // readable type name, the number of live instances, and the fields per instance
+    static void for_each_schema(const std::function<void (const std::string&, int64_t, size_t)>& fn);
+
     // Return the name via the entrytracker
     virtual std::string get_name();
 
@@ -784,18 +843,24 @@ protected:
     //
     // If in_dest is a nullptr, it will not be instantiated; this is useful for registering
     // sub-components of maps which may not be directly instantiated as top-level fields
-    int register_field(const std::string& in_name, std::unique_ptr<tracker_element> in_builder,
-            const std::string& in_desc, shared_tracker_element *in_dest = nullptr);
+    int register_field(std::string_view in_name, std::unique_ptr<tracker_element> in_builder,
+            std::string_view in_desc, shared_tracker_element *in_dest = nullptr);
 
     // Register a field, automatically deriving its type from the provided destination
     // field.  The destination field must be specified.
     template<typename T>
-    int register_field(const std::string& in_name, const std::string& in_desc, 
+    int register_field(std::string_view in_name, std::string_view in_desc, 
             std::shared_ptr<T> *in_dest) {
         using build_type = typename std::remove_reference<decltype(**in_dest)>::type;
 
-        return register_field(in_name, tracker_element_factory<build_type>(), in_desc, 
-                reinterpret_cast<shared_tracker_element *>(in_dest));
+        auto dest = reinterpret_cast<shared_tracker_element *>(in_dest);
+        auto id = replay_field(in_name, dest, false);
+
+        if (id >= 0)
+            return id;
+
+        return register_field_direct(in_name, tracker_element_factory<build_type>(), 
+                in_desc, dest);
     }
 
     // Register a field, automatically deriving its type from the provided destination
@@ -806,26 +871,34 @@ protected:
     //
     // This field should be mapped via the __ProxyDynamicTrackable call
     template<typename T>
-    int register_dynamic_field(const std::string& in_name, const std::string& in_desc, 
+    int register_dynamic_field(std::string_view in_name, std::string_view in_desc, 
             std::shared_ptr<T> *in_dest) {
         using build_type = typename std::remove_reference<decltype(**in_dest)>::type;
 
-        int id = 
-            Globalreg::globalreg->entrytracker->register_field(in_name, 
-                    tracker_element_factory<build_type>(), in_desc);
+        auto dest = reinterpret_cast<shared_tracker_element *>(in_dest);
+        auto id = replay_field(in_name, dest, true);
 
-        if (registered_fields == nullptr)
-            registered_fields = new std::vector<std::unique_ptr<registered_field>>();
+        if (id >= 0)
+            return id;
 
-        auto rf = std::unique_ptr<registered_field>(new registered_field(id, 
-                    reinterpret_cast<shared_tracker_element *>(in_dest), 
-                    true));
+        id = Globalreg::globalreg->entrytracker->register_field(std::string(in_name), 
+                    tracker_element_factory<build_type>(), std::string(in_desc));
 
-        registered_fields->push_back(std::move(rf));
+        record_field(in_name, id, dest, true);
 
         return id;
     }
 
+    // Match the next field against the type schema; returns the field id, or -1 if 
+    // the field must be registered through the entrytracker
+    int replay_field(std::string_view in_name, shared_tracker_element *in_dest, bool in_dynamic);
+    // Register a field through the entrytracker without consulting the type schema
+    int register_field_direct(std::string_view in_name, std::unique_ptr<tracker_element> in_builder,
+            std::string_view in_desc, shared_tracker_element *in_dest);
+    // Record a field registered through the entrytracker
+    void record_field(std::string_view in_name, int in_id, shared_tracker_element *in_dest, 
+            bool in_dynamic);
+
     // Register field types and get a field ID.  Called during record creation, prior to 
     // assigning an existing trackerelement tree or creating a new one
     virtual void register_fields() { }
@@ -841,8 +914,17 @@ protected:
     // Inherit from an existing element or assign a new one.
     // Add imported or new field to our map for use tracking.
     virtual shared_tracker_element import_or_new(std::shared_ptr<tracker_element_map> e, int i);
-
-    std::vector<std::unique_ptr<registered_field>> *registered_fields;
+    // Same, building a new field from a known builder instead of looking it up 
+    shared_tracker_element import_or_new(std::shared_ptr<tracker_element_map> e, int i,
+            tracker_element *builder);
+
+    // Registration state while the component is being built; either the schema being 
+    // replayed and the position in it, or the list of fields registered by hand
+    const field_schema *reg_schema{nullptr};
+    std::vector<std::unique_ptr<registered_field>> *registered_fields{nullptr};
+    unsigned int reg_schema_pos{0};
+    // Schema this instance is counted under
+    const field_schema *acct_schema{nullptr};
 };
 
 
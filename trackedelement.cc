@@ -191,6 +191,34 @@ void tracker_element_mac_addr::coercive_set(const shared_tracker_element& e) {
     }
 }
 
+int64_t tracker_element_accounting::get_count(tracker_type t) {
+    int64_t r = 0;
+
+    for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+        r += shards[i].count[static_cast<unsigned int>(t)].load(std::memory_order_relaxed);
+
+    return r;
+}
+
+int64_t tracker_element_accounting::get_bytes(tracker_type t) {
+    int64_t r = 0;
+
+    for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+        r += shards[i].bytes[static_cast<unsigned int>(t)].load(std::memory_order_relaxed);
+
+    return r;
+}
+
+int64_t tracker_element_accounting::get_total_count() {
+    int64_t r = 0;
+
+    for (unsigned int t = 0; t < num_types; t++)
+        for (unsigned int i = 0; i < KIS_COUNTER_SHARDS; i++)
+            r += shards[i].count[t].load(std::memory_order_relaxed);
+
+    return r;
+}
+
 std::string tracker_element::type_to_string(tracker_type t) {
     switch (t) {
         case tracker_type::tracker_string:
@@ -36,9 +36,11 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <typeinfo>
 #include <unordered_map>
 
 #include "fmt.h"
+#include "kis_sharded_counter.h"
 
 #include "kis_mutex.h"
 #include "macaddr.h"
@@ -200,36 +202,95 @@ enum class tracker_type {
     tracker_uuid_map = 30,
 };
 
+// Live element accounting, per tracker type.  Each thread counts into its own shard
+// so element churn on the packet threads doesn't bounce a shared cache line; the
+// shards are only folded together when someone asks for the totals.
+class tracker_element_accounting {
+public:
+    static constexpr unsigned int num_types = 
+        static_cast<unsigned int>(tracker_type::tracker_uuid_map) + 1;
+
+    static void add(tracker_type t, size_t sz) {
+        auto& s = shards[kismet::counter_shard()];
+        s.count[static_cast<unsigned int>(t)].fetch_add(1, std::memory_order_relaxed);
+        s.bytes[static_cast<unsigned int>(t)].fetch_add(sz, std::memory_order_relaxed);
+    }
+
+    static void remove(tracker_type t, size_t sz) {
+        auto& s = shards[kismet::counter_shard()];
+        s.count[static_cast<unsigned int>(t)].fetch_sub(1, std::memory_order_relaxed);
+        s.bytes[static_cast<unsigned int>(t)].fetch_sub(sz, std::memory_order_relaxed);
+    }
+
+    // Heap storage held by a live element, such as map entries
+    static void add_bytes(tracker_type t, int64_t sz) {
+        auto& s = shards[kismet::counter_shard()];
+        s.bytes[static_cast<unsigned int>(t)].fetch_add(sz, std::memory_order_relaxed);
+    }
+
+    // Live elements and approximate bytes of a type; bytes count the element objects
+    // and the entries of maps, but not the heap storage of strings and vectors
+    static int64_t get_count(tracker_type t);
+    static int64_t get_bytes(tracker_type t);
+
+    // Live elements of all types
+    static int64_t get_total_count();
+
+protected:
+    struct alignas(64) shard {
+        std::atomic<int64_t> count[num_types];
+        std::atomic<int64_t> bytes[num_types];
+    };
+
+    static inline shard shards[KIS_COUNTER_SHARDS];
+};
+
+// Accounting base inherited by each concrete element family alongside tracker_element,
+// so that live objects are counted under their type; it carries no data
+template<tracker_type TT, class E>
+class tracker_element_accounted {
+protected:
+    tracker_element_accounted() {
+        tracker_element_accounting::add(TT, sizeof(E));
+    }
+
+    tracker_element_accounted(const tracker_element_accounted&) {
+        tracker_element_accounting::add(TT, sizeof(E));
+    }
+
+    ~tracker_element_accounted() {
+        tracker_element_accounting::remove(TT, sizeof(E));
+    }
+};
+
 class tracker_element {
 public:
     tracker_element() : 
-        tracked_id(-1) {
-            Globalreg::n_tracked_fields++;
-        }
+        tracked_id(-1) { }
 
     tracker_element(tracker_element&& o) noexcept :
         tracked_id{o.tracked_id} { }
 
     tracker_element( int id) :
-        tracked_id(id) { 
-            Globalreg::n_tracked_fields++;
-        }
+        tracked_id(id) { }
 
     // Inherit from builder
     tracker_element(const tracker_element *p) :
-        tracked_id{p->tracked_id} {
-            Globalreg::n_tracked_fields++;
-        }
+        tracked_id{p->tracked_id} { }
 
-    virtual ~tracker_element() {
-        Globalreg::n_tracked_fields--;
-    };
+    virtual ~tracker_element() { }
 
     // Factory-style for easily making more of the same if we're subclassed
     virtual std::unique_ptr<tracker_element> clone_type() {
         return nullptr;
     }
 
+    // Factory-style as a shared_ptr; element types which can be built in the same 
+    // allocation as their reference count override this
+    virtual std::shared_ptr<tracker_element> clone_shared() {
+        return clone_type();
+    }
+
     // Called prior to serialization output
     virtual void pre_serialize() { }
 
@@ -324,6 +385,17 @@ std::unique_ptr<tracker_element> tracker_element_factory(const Args& ... args) {
     return std::move(dup);
 }
 
+// Build a new element of the same type as p, in a single allocation with its reference
+// count.  Subclasses which don't provide their own clone_shared fall back to clone_type,
+// so an inherited clone_shared never builds an instance of the parent type.
+template<class T>
+std::shared_ptr<tracker_element> tracker_element_clone_shared(T *p) {
+    if (typeid(*p) != typeid(T))
+        return p->clone_type();
+
+    return std::make_shared<T>(p);
+}
+
 // Adapter function for converting cloned elements
 template<class C>
 constexpr17 C tracker_element_clone_adaptor(C p) {
@@ -334,7 +406,8 @@ constexpr17 C tracker_element_clone_adaptor(C p) {
 // Aliased element used to link one element to anothers name, for instance to
 // allow the dot11 tracker a way to link the most recently used ssid from the
 // map to a custom field
-class tracker_element_alias : public tracker_element {
+class tracker_element_alias : public tracker_element,
+    private tracker_element_accounted<tracker_type::tracker_alias, tracker_element_alias> {
 public:
     tracker_element_alias() :
         tracker_element() { }
@@ -395,6 +468,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     std::shared_ptr<tracker_element> get() {
         return alias_element;
     }
@@ -481,7 +558,9 @@ protected:
 
 };
 
-class tracker_element_string : public tracker_element_core_scalar<std::string> {
+// Byte arrays are built on strings and are accounted as strings
+class tracker_element_string : public tracker_element_core_scalar<std::string>,
+    private tracker_element_accounted<tracker_type::tracker_string, tracker_element_string> {
 public:
     tracker_element_string() :
         tracker_element_core_scalar<std::string>() { }
@@ -528,6 +607,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     using tracker_element_core_scalar<std::string>::less_than;
     inline bool less_than(const tracker_element_string& rhs) const;
 
@@ -565,6 +648,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     virtual std::string as_string() const override {
         return to_hex();
     }
@@ -643,7 +730,8 @@ public:
 
 };
 
-class tracker_element_device_key : public tracker_element_core_scalar<device_key> {
+class tracker_element_device_key : public tracker_element_core_scalar<device_key>,
+    private tracker_element_accounted<tracker_type::tracker_key, tracker_element_device_key> {
 public:
     tracker_element_device_key() :
         tracker_element_core_scalar<device_key>() { }
@@ -692,9 +780,14 @@ public:
         auto dup = std::unique_ptr<this_t>(new this_t(this));
         return std::move(dup);
     }
+
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
 };
 
-class tracker_element_uuid : public tracker_element_core_scalar<uuid> {
+class tracker_element_uuid : public tracker_element_core_scalar<uuid>,
+    private tracker_element_accounted<tracker_type::tracker_uuid, tracker_element_uuid> {
 public:
     tracker_element_uuid() :
         tracker_element_core_scalar<uuid>() { }
@@ -737,9 +830,14 @@ public:
         auto dup = std::unique_ptr<this_t>(new this_t(this));
         return std::move(dup);
     }
+
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
 };
 
-class tracker_element_mac_addr : public tracker_element_core_scalar<mac_addr> {
+class tracker_element_mac_addr : public tracker_element_core_scalar<mac_addr>,
+    private tracker_element_accounted<tracker_type::tracker_mac_addr, tracker_element_mac_addr> {
 public:
     tracker_element_mac_addr() :
         tracker_element_core_scalar<mac_addr>() { }
@@ -788,9 +886,14 @@ public:
         auto dup = std::unique_ptr<this_t>(new this_t(this));
         return std::move(dup);
     }
+
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
 };
 
-class tracker_element_ipv4_addr : public tracker_element_core_scalar<uint32_t> {
+class tracker_element_ipv4_addr : public tracker_element_core_scalar<uint32_t>,
+    private tracker_element_accounted<tracker_type::tracker_ipv4_addr, tracker_element_ipv4_addr> {
 public:
     tracker_element_ipv4_addr() :
         tracker_element_core_scalar<uint32_t>() { }
@@ -852,6 +955,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
 };
 
 template<class N>
@@ -868,7 +975,8 @@ public:
 // Simplify numeric conversion w/ an interstitial scalar-like that holds all 
 // our numeric subclasses
 template<class N, tracker_type T = tracker_type::tracker_double, class S = numerical_string<N>>
-class tracker_element_core_numeric : public tracker_element {
+class tracker_element_core_numeric : public tracker_element,
+    private tracker_element_accounted<T, tracker_element_core_numeric<N, T, S>> {
 public:
     tracker_element_core_numeric() :
         tracker_element(),
@@ -955,6 +1063,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     N& get() {
         return value;
     }
@@ -1116,7 +1228,8 @@ using tracker_element_double = tracker_element_core_numeric<double, tracker_type
 // map;  alternate implementation available as core_unordered_map for structures which don't
 // need comparator operations
 template <typename MT, typename K, typename V, tracker_type T>
-class tracker_element_core_map : public tracker_element {
+class tracker_element_core_map : public tracker_element,
+    private tracker_element_accounted<T, tracker_element_core_map<MT, K, V, T>> {
 public:
     using map_t = MT;
     using iterator = typename map_t::iterator;
@@ -1125,21 +1238,32 @@ public:
 
     tracker_element_core_map() : 
         tracker_element(),
-        present_set{0} { }
+        present_set{0},
+        accounted_entries{0} { }
 
     tracker_element_core_map(tracker_element_core_map&& o) noexcept :
         tracker_element{o},
+        map{std::move(o.map)},
         present_set{o.present_set},
-        map{std::move(o.map)} { }
+        accounted_entries{o.accounted_entries} {
+        o.accounted_entries = 0;
+    }
 
     tracker_element_core_map(int id) :
         tracker_element(id),
-        present_set{0} { }
+        present_set{0},
+        accounted_entries{0} { }
 
     // Inherit attributes but not content
     tracker_element_core_map(const tracker_element_core_map<MT, K, V, T> *p) :
         tracker_element{p},
-        present_set{p->present_set} { }
+        present_set{p->present_set},
+        accounted_entries{0} { }
+
+    virtual ~tracker_element_core_map() {
+        tracker_element_accounting::add_bytes(T, 
+                -static_cast<int64_t>(accounted_entries * entry_bytes));
+    }
 
     virtual tracker_type get_type() const override {
         return T;
@@ -1155,6 +1279,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     virtual bool is_stringable() const override {
         return false;
     }
@@ -1238,11 +1366,11 @@ public:
     }
 
     iterator erase(const_iterator i) {
-        return map.erase(i);
+        return accounted(map.erase(i));
     }
 
     iterator erase(iterator first, iterator last) {
-        return map.erase(first, last);
+        return accounted(map.erase(first, last));
     }
 
     bool empty() const noexcept {
@@ -1251,6 +1379,7 @@ public:
 
     void clear() noexcept {
         map.clear();
+        account_entries();
     }
 
     size_t size() const {
@@ -1259,7 +1388,7 @@ public:
 
     // std::insert methods, does not replace existing objects
     std::pair<iterator, bool> insert(pair p) {
-        return map.insert(p);
+        return accounted(map.emplace(p.first, p.second));
     }
 
     std::pair<iterator, bool> insert(const K& i, const V& e) {
@@ -1273,7 +1402,7 @@ public:
         if (k != map.end())
             map.erase(k);
 
-        return map.insert(p);
+        return accounted(map.emplace(p.first, p.second));
     }
 
     std::pair<iterator, bool> replace(const K& i, const V& e) {
@@ -1281,12 +1410,40 @@ public:
         if (k != map.end())
             map.erase(k);
 
-        return map.insert(std::make_pair(i, e));
+        return accounted(map.emplace(i, e));
     }
 
 protected:
+    // Approximate heap cost of one entry; the node holding the pair plus its share of
+    // the bucket or tree links
+    static constexpr size_t entry_bytes = sizeof(typename map_t::value_type) + 2 * sizeof(void *);
+
+    // Bring the accounted heap bytes up to the current number of entries.  Anything which
+    // changes the map through get() is picked up on the next insert or erase, and the 
+    // destructor releases exactly what was accounted, so the totals never drift.
+    void account_entries() {
+        auto sz = static_cast<uint32_t>(map.size());
+
+        if (sz == accounted_entries)
+            return;
+
+        tracker_element_accounting::add_bytes(T, 
+                (static_cast<int64_t>(sz) - static_cast<int64_t>(accounted_entries)) * 
+                static_cast<int64_t>(entry_bytes));
+        accounted_entries = sz;
+    }
+
+    template<typename R>
+    R accounted(R r) {
+        account_entries();
+        return r;
+    }
+
     map_t map;
     uint8_t present_set;
+    // Entries currently counted in the element accounting; fits in the padding after
+    // present_set
+    uint32_t accounted_entries;
 };
 
 // Dictionary / map-by-id
@@ -1328,7 +1485,7 @@ public:
 
         if (existing == map.end()) {
             auto p = std::make_pair(e->get_id(), e);
-            return map.insert(p);
+            return accounted(map.emplace(p.first, std::move(p.second)));
         } else {
             existing->second = e;
             return std::make_pair(existing, true);
@@ -1344,7 +1501,7 @@ public:
 
         if (existing == map.end()) {
             auto p = std::make_pair(e->get_id(), std::static_pointer_cast<tracker_element>(e));
-            return map.insert(p);
+            return accounted(map.emplace(p.first, std::move(p.second)));
         } else {
             existing->second = std::static_pointer_cast<tracker_element>(e);
             return std::make_pair(existing, true);
@@ -1358,7 +1515,7 @@ public:
         if (existing == map.end()) {
             auto p = 
                 std::make_pair(i, std::static_pointer_cast<tracker_element>(e));
-            return map.insert(p);
+            return accounted(map.emplace(p.first, std::move(p.second)));
         } else {
             existing->second = std::static_pointer_cast<tracker_element>(e);
             return std::make_pair(existing, true);
@@ -1372,7 +1529,7 @@ public:
         auto i = map.find(e->get_id());
 
         if (i != map.end())
-            return map.erase(i);
+            return accounted(map.erase(i));
 
         return i;
     }
@@ -1403,7 +1560,8 @@ using tracker_element_double_map_double = tracker_element_core_map<std::unordere
 
 // Core vector
 template<typename T, tracker_type TT>
-class tracker_element_core_vector : public tracker_element {
+class tracker_element_core_vector : public tracker_element,
+    private tracker_element_accounted<TT, tracker_element_core_vector<T, TT>> {
 public:
     using vector_t = std::vector<T>;
     using iterator = typename vector_t::iterator;
@@ -1445,6 +1603,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     virtual bool is_stringable() const override {
         return false;
     }
@@ -1552,7 +1714,8 @@ using tracker_element_vector_double = tracker_element_core_vector<double, tracke
 using tracker_element_vector_string = tracker_element_core_vector<std::string, tracker_type::tracker_vector_string>;
 
 template<typename T1, typename T2, tracker_type TT>
-class tracker_element_core_pair : public tracker_element {
+class tracker_element_core_pair : public tracker_element,
+    private tracker_element_accounted<TT, tracker_element_core_pair<T1, T2, TT>> {
 public:
     using pair_t = std::pair<T1, T2>;
 
@@ -1592,6 +1755,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     virtual bool is_stringable() const override {
         return false;
     }
@@ -1668,6 +1835,10 @@ public:
         return std::move(dup);
     }
 
+    virtual std::shared_ptr<tracker_element> clone_shared() override {
+        return tracker_element_clone_shared(this);
+    }
+
     void set_name(const std::string& name) {
         placeholder_name = name;
     }
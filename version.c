@@ -0,0 +1,3 @@
+#include "version.h"
+const char *VERSION_GIT_COMMIT = "5c8f2ca";
+const char *VERSION_BUILD_TIME = "";